@@ -1196,6 +1196,11 @@ public static class bgfx
 		/// </summary>
 		ViewportLayerArray     = 0x0000000400000000,
 	
+		/// <summary>
+		/// GPU-side conditional rendering is supported.
+		/// </summary>
+		ConditionalRender      = 0x0000000800000000,
+	
 		/// <summary>
 		/// All texture compare modes are supported.
 		/// </summary>
@@ -2682,6 +2687,7 @@ public static class bgfx
 			public uint32 maxTransientVbSize;
 			public uint32 maxTransientIbSize;
 			public uint32 minUniformBufferSize;
+			public uint32 maxPersistentTransforms;
 		}
 	
 		public RendererType rendererType;
@@ -2742,6 +2748,9 @@ public static class bgfx
 			public uint32 maxTransientVbSize;
 			public uint32 maxTransientIbSize;
 			public uint32 minUniformBufferSize;
+			public uint32 dynamicIndexBufferSize;
+			public uint32 dynamicVertexBufferSize;
+			public uint32 maxPersistentTransforms;
 		}
 	
 		public RendererType type;
@@ -2879,11 +2888,24 @@ public static class bgfx
 		public uint32 gpuFrameNum;
 	}
 	
+	[CRepr]
+	public struct GpuRegionStats
+	{
+		public char8[64] name;
+		public int64 gpuTimeBegin;
+		public int64 gpuTimeEnd;
+		public uint32 gpuFrameNum;
+	}
+	
 	[CRepr]
 	public struct EncoderStats
 	{
 		public int64 cpuTimeBegin;
 		public int64 cpuTimeEnd;
+		public int64 transientReserveTime;
+		public uint32 numTransientAllocs;
+		public uint32 numTransientSlabs;
+		public uint32 numTransientContended;
 	}
 	
 	[CRepr]
@@ -2904,12 +2926,16 @@ public static class bgfx
 		public uint32 numDrawCallsPeak;
 		public uint32 maxGpuLatency;
 		public uint32 gpuFrameNum;
+		public uint32 numVertexArrayBinds;
+		public uint32 numVertexAttribCalls;
+		public uint32 uniformBytesSkipped;
 		public uint16 numDynamicIndexBuffers;
 		public uint16 numDynamicVertexBuffers;
 		public uint16 numFrameBuffers;
 		public uint16 numIndexBuffers;
 		public uint16 numOcclusionQueries;
 		public uint16 numPrograms;
+		public uint16 numProgramsPending;
 		public uint16 numShaders;
 		public uint16 numTextures;
 		public uint16 numUniforms;
@@ -2917,8 +2943,15 @@ public static class bgfx
 		public uint16 numVertexLayouts;
 		public int64 textureMemoryUsed;
 		public int64 rtMemoryUsed;
+		public int64 textureMemoryResident;
 		public int32 transientVbUsed;
 		public int32 transientIbUsed;
+		public uint32 dynIbNumFreeBlocks;
+		public uint32 dynIbLargestFreeBlock;
+		public uint32 dynVbNumFreeBlocks;
+		public uint32 dynVbLargestFreeBlock;
+		public uint32 uniformNumFreeBlocks;
+		public uint32 uniformLargestFreeBlock;
 		public uint32[5] numPrims;
 		public int64 gpuMemoryMax;
 		public int64 gpuMemoryUsed;
@@ -2928,6 +2961,8 @@ public static class bgfx
 		public uint16 textHeight;
 		public uint16 numViews;
 		public ViewStats* viewStats;
+		public uint16 numGpuRegions;
+		public GpuRegionStats* gpuRegionStats;
 		public uint8 numEncoders;
 		public EncoderStats* encoderStats;
 	}
@@ -2946,6 +2981,12 @@ public static class bgfx
 	{
 	}
 	
+	[CRepr]
+	public struct DrawListHandle {
+	    public uint16 idx;
+	    public bool Valid => idx != uint16.MaxValue;
+	}
+	
 	[CRepr]
 	public struct DynamicIndexBufferHandle {
 	    public uint16 idx;
@@ -3559,6 +3600,41 @@ public static class bgfx
 	[LinkName("bgfx_destroy_dynamic_vertex_buffer")]
 	public static extern void destroy_dynamic_vertex_buffer(DynamicVertexBufferHandle _handle);
 	
+	/// <summary>
+	/// Allocate matrices in persistent transform buffer. Matrices keep their
+	/// index and value across frames until freed, and only matrices modified
+	/// with `bgfx::updatePersistentTransform` are uploaded on `bgfx::frame`.
+	/// 
+	/// @remarks Requires `BGFX_CAPS_COMPUTE`, and `Init::Limits::maxPersistentTransforms`
+	///   to be non-zero.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_num">Number of matrices.</param>
+	///
+	[LinkName("bgfx_alloc_persistent_transform")]
+	public static extern uint32 alloc_persistent_transform(uint16 _num);
+	
+	/// <summary>
+	/// Free matrices allocated with `bgfx::allocPersistentTransform`.
+	/// </summary>
+	///
+	/// <param name="_index">Index of first matrix returned by `bgfx::allocPersistentTransform`.</param>
+	///
+	[LinkName("bgfx_free_persistent_transform")]
+	public static extern void free_persistent_transform(uint32 _index);
+	
+	/// <summary>
+	/// Update matrices in persistent transform buffer.
+	/// </summary>
+	///
+	/// <param name="_index">Index of first matrix.</param>
+	/// <param name="_mtx">Pointer to first matrix in array.</param>
+	/// <param name="_num">Number of matrices in array.</param>
+	///
+	[LinkName("bgfx_update_persistent_transform")]
+	public static extern void update_persistent_transform(uint32 _index, void* _mtx, uint16 _num);
+	
 	/// <summary>
 	/// Returns number of requested or maximum available indices.
 	/// </summary>
@@ -3740,6 +3816,32 @@ public static class bgfx
 	[LinkName("bgfx_destroy_program")]
 	public static extern void destroy_program(ProgramHandle _handle);
 	
+	/// <summary>
+	/// Set instanced variant of program used for automatic instancing.
+	/// 
+	/// Consecutive draw calls (after sorting) in the same view that use `handle`
+	/// and differ only in transform are merged into single instanced draw call
+	/// with `instanced` program. Per-instance model matrix is passed as instance
+	/// data `i_data0` to `i_data3`.
+	/// 
+	/// Instanced vertex shader is compiled from the same source with
+	/// `shaderc --instanced`, which reads `u_model`, `u_modelView`, and
+	/// `u_modelViewProj` from instance data instead of uniforms.
+	/// 
+	/// @remarks Draw calls with multiple transforms, instance data, indirect
+	///   buffer, occlusion query, or uniforms set between them are not merged.
+	/// 
+	/// @attention `instanced` program is kept alive until variant is changed,
+	///   or `handle` is destroyed. Pass invalid handle to disable.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle.</param>
+	/// <param name="_instanced">Instanced program variant, vertex shader reads model matrix from `i_data0` to `i_data3`.</param>
+	///
+	[LinkName("bgfx_set_instanced_program")]
+	public static extern void set_instanced_program(ProgramHandle _handle, ProgramHandle _instanced);
+	
 	/// <summary>
 	/// Validate texture parameters.
 	/// </summary>
@@ -3963,6 +4065,25 @@ public static class bgfx
 	[LinkName("bgfx_read_texture")]
 	public static extern uint32 read_texture(TextureHandle _handle, void* _data, uint16 _layer, uint8 _mip);
 	
+	/// <summary>
+	/// Set most detailed mip level of texture that is resident. Mip levels above it are not
+	/// sampled, and they are not counted in `Stats::textureMemoryResident`. Texture can be created
+	/// with only tail mips uploaded, and more detailed mips streamed in later with
+	/// `bgfx::updateTexture2D` before lowering min LOD.
+	/// 
+	/// @remarks Renderer still allocates storage for whole mip chain.
+	/// @remarks Sampled texture binds start at min LOD, the same as if `firstMip` passed to
+	///   `bgfx::setTexture` was raised to min LOD. Explicit LOD and texture size queries in
+	///   shader are relative to min LOD. Image (storage) binds are not affected.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_minLod">Most detailed resident mip level. Use 0 to make whole mip chain resident.</param>
+	///
+	[LinkName("bgfx_set_texture_min_lod")]
+	public static extern void set_texture_min_lod(TextureHandle _handle, uint8 _minLod);
+	
 	/// <summary>
 	/// Set texture debug name.
 	/// </summary>
@@ -4480,6 +4601,30 @@ public static class bgfx
 	[LinkName("bgfx_encoder_set_marker")]
 	public static extern void encoder_set_marker(Encoder* _this, char8* _name, int32 _len);
 	
+	/// <summary>
+	/// Begin GPU timing region. Draw and compute calls submitted until matching
+	/// `profilerEndGpu` are attributed to region, and region is timed from first to
+	/// last of them in sorted order. Regions can be nested.
+	/// 
+	/// @remarks
+	///   Results are returned few frames later through `Stats::gpuRegionStats`.
+	///   Supported by OpenGL and Vulkan renderers.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_name">Region name.</param>
+	/// <param name="_len">Region name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
+	///
+	[LinkName("bgfx_encoder_profiler_begin_gpu")]
+	public static extern void encoder_profiler_begin_gpu(Encoder* _this, char8* _name, int32 _len);
+	
+	/// <summary>
+	/// End GPU timing region.
+	/// </summary>
+	///
+	[LinkName("bgfx_encoder_profiler_end_gpu")]
+	public static extern void encoder_profiler_end_gpu(Encoder* _this);
+	
 	/// <summary>
 	/// Set render states for draw primitive.
 	/// 
@@ -4503,14 +4648,23 @@ public static class bgfx
 	public static extern void encoder_set_state(Encoder* _this, uint64 _state, uint32 _rgba);
 	
 	/// <summary>
-	/// Set condition for rendering.
+	/// Set condition for rendering. Condition applies to next draw call or compute
+	/// dispatch.
+	/// 
+	/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+	///   draw call is predicated on GPU with result of query issued in earlier view
+	///   of the same frame. Otherwise last query result available on CPU is used.
+	///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+	///   conditional rendering doesn't apply to compute.
+	/// 
 	/// </summary>
 	///
 	/// <param name="_handle">Occlusion query handle.</param>
 	/// <param name="_visible">Render if occlusion query is visible.</param>
+	/// <param name="_current">Use query result from current frame.</param>
 	///
 	[LinkName("bgfx_encoder_set_condition")]
-	public static extern void encoder_set_condition(Encoder* _this, OcclusionQueryHandle _handle, bool _visible);
+	public static extern void encoder_set_condition(Encoder* _this, OcclusionQueryHandle _handle, bool _visible, bool _current);
 	
 	/// <summary>
 	/// Set stencil test state.
@@ -4572,6 +4726,18 @@ public static class bgfx
 	[LinkName("bgfx_encoder_set_transform_cached")]
 	public static extern void encoder_set_transform_cached(Encoder* _this, uint32 _cache, uint16 _num);
 	
+	/// <summary>
+	/// Set persistent transform index for draw primitive. Persistent transform
+	/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+	/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_index">Index in persistent transform buffer.</param>
+	///
+	[LinkName("bgfx_encoder_set_persistent_transform")]
+	public static extern void encoder_set_persistent_transform(Encoder* _this, uint32 _index);
+	
 	/// <summary>
 	/// Reserve matrices in internal matrix cache.
 	/// 
@@ -4585,6 +4751,48 @@ public static class bgfx
 	[LinkName("bgfx_encoder_alloc_transform")]
 	public static extern uint32 encoder_alloc_transform(Encoder* _this, Transform* _transform, uint16 _num);
 	
+	/// <summary>
+	/// Allocate transient index buffer from encoder's slab of frame's transient
+	/// index buffer. Slabs are reserved with single atomic operation, and
+	/// allocations within slab don't take any lock.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_tib">TransientIndexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+	/// <param name="_num">Number of indices to allocate.</param>
+	/// <param name="_index32">Set to `true` if input indices will be 32-bit.</param>
+	///
+	[LinkName("bgfx_encoder_alloc_transient_index_buffer")]
+	public static extern void encoder_alloc_transient_index_buffer(Encoder* _this, TransientIndexBuffer* _tib, uint32 _num, bool _index32);
+	
+	/// <summary>
+	/// Allocate transient vertex buffer from encoder's slab of frame's transient
+	/// vertex buffer. Slabs are reserved with single atomic operation, and
+	/// allocations within slab don't take any lock.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_tvb">TransientVertexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+	/// <param name="_num">Number of vertices to allocate.</param>
+	/// <param name="_layoutHandle">Vertex layout, created with `createVertexLayout`.</param>
+	///
+	[LinkName("bgfx_encoder_alloc_transient_vertex_buffer")]
+	public static extern void encoder_alloc_transient_vertex_buffer(Encoder* _this, TransientVertexBuffer* _tvb, uint32 _num, VertexLayoutHandle _layoutHandle);
+	
+	/// <summary>
+	/// Allocate instance data buffer from encoder's slab of frame's transient
+	/// vertex buffer. Slabs are reserved with single atomic operation, and
+	/// allocations within slab don't take any lock.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_idb">InstanceDataBuffer structure will be filled, and will be valid for duration of frame, and can be reused for multiple draw calls.</param>
+	/// <param name="_num">Number of instances.</param>
+	/// <param name="_stride">Instance stride. Must be multiple of 16.</param>
+	///
+	[LinkName("bgfx_encoder_alloc_instance_data_buffer")]
+	public static extern void encoder_alloc_instance_data_buffer(Encoder* _this, InstanceDataBuffer* _idb, uint32 _num, uint16 _stride);
+	
 	/// <summary>
 	/// Set shader uniform parameter for draw primitive.
 	/// </summary>
@@ -5049,6 +5257,50 @@ public static class bgfx
 	[LinkName("bgfx_encoder_blit")]
 	public static extern void encoder_blit(Encoder* _this, ViewId _id, TextureHandle _dst, uint8 _dstMip, uint16 _dstX, uint16 _dstY, uint16 _dstZ, TextureHandle _src, uint8 _srcMip, uint16 _srcX, uint16 _srcY, uint16 _srcZ, uint16 _width, uint16 _height, uint16 _depth);
 	
+	/// <summary>
+	/// Start recording draw list. All following submits on this encoder are
+	/// captured into draw list instead of being submitted to the frame, until
+	/// `bgfx::Encoder::endDrawList` is called.
+	/// 
+	/// @remarks
+	///   Recording must begin and end within the same frame. Draw calls using transient
+	///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+	///   occlusion queries, are dropped.
+	/// 
+	/// </summary>
+	///
+	[LinkName("bgfx_encoder_begin_draw_list")]
+	public static extern void encoder_begin_draw_list(Encoder* _this);
+	
+	/// <summary>
+	/// End recording draw list.
+	/// 
+	/// @remarks
+	///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+	///   indirect buffers it uses. They can be destroyed while draw list is alive,
+	///   but they are released only after draw list is destroyed.
+	/// 
+	/// </summary>
+	///
+	[LinkName("bgfx_encoder_end_draw_list")]
+	public static extern DrawListHandle encoder_end_draw_list(Encoder* _this);
+	
+	/// <summary>
+	/// Submit previously recorded draw list for rendering. Draw state, bindings,
+	/// uniforms and sort keys captured during recording are replayed into view.
+	/// 
+	/// @remarks
+	///   Encoder state set before this call is not used, and it's not cleared.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_drawList">Draw list.</param>
+	/// <param name="_mtx">Base transform applied to all recorded transforms. It can be `NULL` if recorded transforms are used as is.</param>
+	///
+	[LinkName("bgfx_encoder_submit_draw_list")]
+	public static extern void encoder_submit_draw_list(Encoder* _this, ViewId _id, DrawListHandle _drawList, void* _mtx);
+	
 	/// <summary>
 	/// Request screen shot of window back buffer.
 	/// 
@@ -5064,6 +5316,50 @@ public static class bgfx
 	[LinkName("bgfx_request_screen_shot")]
 	public static extern void request_screen_shot(FrameBufferHandle _handle, char8* _filePath);
 	
+	/// <summary>
+	/// Save recorded trace as Chrome trace-event JSON, which can be opened in Perfetto UI or
+	/// `chrome://tracing`. Trace contains most recent profiler scopes from all threads, and
+	/// per-view GPU timings.
+	/// 
+	/// @remarks
+	///   Requires `BGFX_CONFIG_TRACE`. GPU timings require `BGFX_DEBUG_PROFILER` debug flag.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_filePath">Output file path.</param>
+	///
+	[LinkName("bgfx_save_trace")]
+	public static extern bool save_trace(char8* _filePath);
+	
+	/// <summary>
+	/// Request capture of resources and sorted frame. Captured frame is written to file when frame
+	/// is rendered, and it can be replayed with `bgfx::replayFrameCapture`.
+	/// 
+	/// @remarks
+	///   Requires `BGFX_CONFIG_CAPTURE`. Only resources created after `bgfx::init` are captured.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_filePath">Output file path.</param>
+	///
+	[LinkName("bgfx_request_frame_capture")]
+	public static extern void request_frame_capture(char8* _filePath);
+	
+	/// <summary>
+	/// Replay captured frame instead of submitted frame. Captured resources are created on next
+	/// frame, and captured frame is rendered every frame until replay is stopped.
+	/// 
+	/// @remarks
+	///   Requires `BGFX_CONFIG_CAPTURE`. Capture must be done by bgfx built with the same
+	///   configuration, and shaders must be compatible with current renderer.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_filePath">Frame capture file path. Pass `NULL` to stop replay.</param>
+	///
+	[LinkName("bgfx_replay_frame_capture")]
+	public static extern bool replay_frame_capture(char8* _filePath);
+	
 	/// <summary>
 	/// Render frame. Executes the actual GPU rendering work for one frame.
 	/// 
@@ -5188,6 +5484,30 @@ public static class bgfx
 	[LinkName("bgfx_set_marker")]
 	public static extern void set_marker(char8* _name, int32 _len);
 	
+	/// <summary>
+	/// Begin GPU timing region. Draw and compute calls submitted until matching
+	/// `profilerEndGpu` are attributed to region, and region is timed from first to
+	/// last of them in sorted order. Regions can be nested.
+	/// 
+	/// @remarks
+	///   Results are returned few frames later through `Stats::gpuRegionStats`.
+	///   Supported by OpenGL and Vulkan renderers.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_name">Region name.</param>
+	/// <param name="_len">Region name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
+	///
+	[LinkName("bgfx_profiler_begin_gpu")]
+	public static extern void profiler_begin_gpu(char8* _name, int32 _len);
+	
+	/// <summary>
+	/// End GPU timing region.
+	/// </summary>
+	///
+	[LinkName("bgfx_profiler_end_gpu")]
+	public static extern void profiler_end_gpu();
+	
 	/// <summary>
 	/// Set render states for draw primitive.
 	/// 
@@ -5211,14 +5531,23 @@ public static class bgfx
 	public static extern void set_state(uint64 _state, uint32 _rgba);
 	
 	/// <summary>
-	/// Set condition for rendering.
+	/// Set condition for rendering. Condition applies to next draw call or compute
+	/// dispatch.
+	/// 
+	/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+	///   draw call is predicated on GPU with result of query issued in earlier view
+	///   of the same frame. Otherwise last query result available on CPU is used.
+	///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+	///   conditional rendering doesn't apply to compute.
+	/// 
 	/// </summary>
 	///
 	/// <param name="_handle">Occlusion query handle.</param>
 	/// <param name="_visible">Render if occlusion query is visible.</param>
+	/// <param name="_current">Use query result from current frame.</param>
 	///
 	[LinkName("bgfx_set_condition")]
-	public static extern void set_condition(OcclusionQueryHandle _handle, bool _visible);
+	public static extern void set_condition(OcclusionQueryHandle _handle, bool _visible, bool _current);
 	
 	/// <summary>
 	/// Set stencil test state.
@@ -5280,6 +5609,18 @@ public static class bgfx
 	[LinkName("bgfx_set_transform_cached")]
 	public static extern void set_transform_cached(uint32 _cache, uint16 _num);
 	
+	/// <summary>
+	/// Set persistent transform index for draw primitive. Persistent transform
+	/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+	/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_index">Index in persistent transform buffer.</param>
+	///
+	[LinkName("bgfx_set_persistent_transform")]
+	public static extern void set_persistent_transform(uint32 _index);
+	
 	/// <summary>
 	/// Reserve matrices in internal matrix cache.
 	/// 
@@ -5726,6 +6067,59 @@ public static class bgfx
 	[LinkName("bgfx_blit")]
 	public static extern void blit(ViewId _id, TextureHandle _dst, uint8 _dstMip, uint16 _dstX, uint16 _dstY, uint16 _dstZ, TextureHandle _src, uint8 _srcMip, uint16 _srcX, uint16 _srcY, uint16 _srcZ, uint16 _width, uint16 _height, uint16 _depth);
 	
+	/// <summary>
+	/// Start recording draw list. All following submits are captured
+	/// into draw list instead of being submitted to the frame, until
+	/// `bgfx::endDrawList` is called.
+	/// 
+	/// @remarks
+	///   Recording must begin and end within the same frame. Draw calls using transient
+	///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+	///   occlusion queries, are dropped.
+	/// 
+	/// </summary>
+	///
+	[LinkName("bgfx_begin_draw_list")]
+	public static extern void begin_draw_list();
+	
+	/// <summary>
+	/// End recording draw list.
+	/// 
+	/// @remarks
+	///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+	///   indirect buffers it uses. They can be destroyed while draw list is alive,
+	///   but they are released only after draw list is destroyed.
+	/// 
+	/// </summary>
+	///
+	[LinkName("bgfx_end_draw_list")]
+	public static extern DrawListHandle end_draw_list();
+	
+	/// <summary>
+	/// Submit previously recorded draw list for rendering. Draw state, bindings,
+	/// uniforms and sort keys captured during recording are replayed into view.
+	/// 
+	/// @remarks
+	///   Encoder state set before this call is not used, and it's not cleared.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_drawList">Draw list.</param>
+	/// <param name="_mtx">Base transform applied to all recorded transforms. It can be `NULL` if recorded transforms are used as is.</param>
+	///
+	[LinkName("bgfx_submit_draw_list")]
+	public static extern void submit_draw_list(ViewId _id, DrawListHandle _drawList, void* _mtx);
+	
+	/// <summary>
+	/// Destroy draw list, and release resources referenced by it.
+	/// </summary>
+	///
+	/// <param name="_handle">Handle to draw list object.</param>
+	///
+	[LinkName("bgfx_destroy_draw_list")]
+	public static extern void destroy_draw_list(DrawListHandle _handle);
+	
 
 	public static bgfx.StateFlags blend_function_separate(bgfx.StateFlags _srcRGB, bgfx.StateFlags _dstRGB, bgfx.StateFlags _srcA, bgfx.StateFlags _dstA)
 	{
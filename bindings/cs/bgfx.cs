@@ -1195,6 +1195,11 @@ public static partial class bgfx
 		/// </summary>
 		ViewportLayerArray     = 0x0000000400000000,
 	
+		/// <summary>
+		/// GPU-side conditional rendering is supported.
+		/// </summary>
+		ConditionalRender      = 0x0000000800000000,
+	
 		/// <summary>
 		/// All texture compare modes are supported.
 		/// </summary>
@@ -2660,6 +2665,7 @@ public static partial class bgfx
 			public uint maxTransientVbSize;
 			public uint maxTransientIbSize;
 			public uint minUniformBufferSize;
+			public uint maxPersistentTransforms;
 		}
 	
 		public RendererType rendererType;
@@ -2715,6 +2721,9 @@ public static partial class bgfx
 			public uint maxTransientVbSize;
 			public uint maxTransientIbSize;
 			public uint minUniformBufferSize;
+			public uint dynamicIndexBufferSize;
+			public uint dynamicVertexBufferSize;
+			public uint maxPersistentTransforms;
 		}
 	
 		public RendererType type;
@@ -2840,10 +2849,22 @@ public static partial class bgfx
 		public uint gpuFrameNum;
 	}
 	
+	public unsafe struct GpuRegionStats
+	{
+		public fixed byte name[64];
+		public long gpuTimeBegin;
+		public long gpuTimeEnd;
+		public uint gpuFrameNum;
+	}
+	
 	public unsafe struct EncoderStats
 	{
 		public long cpuTimeBegin;
 		public long cpuTimeEnd;
+		public long transientReserveTime;
+		public uint numTransientAllocs;
+		public uint numTransientSlabs;
+		public uint numTransientContended;
 	}
 	
 	public unsafe struct Stats
@@ -2863,12 +2884,16 @@ public static partial class bgfx
 		public uint numDrawCallsPeak;
 		public uint maxGpuLatency;
 		public uint gpuFrameNum;
+		public uint numVertexArrayBinds;
+		public uint numVertexAttribCalls;
+		public uint uniformBytesSkipped;
 		public ushort numDynamicIndexBuffers;
 		public ushort numDynamicVertexBuffers;
 		public ushort numFrameBuffers;
 		public ushort numIndexBuffers;
 		public ushort numOcclusionQueries;
 		public ushort numPrograms;
+		public ushort numProgramsPending;
 		public ushort numShaders;
 		public ushort numTextures;
 		public ushort numUniforms;
@@ -2876,8 +2901,15 @@ public static partial class bgfx
 		public ushort numVertexLayouts;
 		public long textureMemoryUsed;
 		public long rtMemoryUsed;
+		public long textureMemoryResident;
 		public int transientVbUsed;
 		public int transientIbUsed;
+		public uint dynIbNumFreeBlocks;
+		public uint dynIbLargestFreeBlock;
+		public uint dynVbNumFreeBlocks;
+		public uint dynVbLargestFreeBlock;
+		public uint uniformNumFreeBlocks;
+		public uint uniformLargestFreeBlock;
 		public fixed uint numPrims[5];
 		public long gpuMemoryMax;
 		public long gpuMemoryUsed;
@@ -2887,6 +2919,8 @@ public static partial class bgfx
 		public ushort textHeight;
 		public ushort numViews;
 		public ViewStats* viewStats;
+		public ushort numGpuRegions;
+		public GpuRegionStats* gpuRegionStats;
 		public byte numEncoders;
 		public EncoderStats* encoderStats;
 	}
@@ -2903,6 +2937,11 @@ public static partial class bgfx
 	{
 	}
 	
+	public struct DrawListHandle {
+	    public ushort idx;
+	    public bool Valid => idx != UInt16.MaxValue;
+	}
+	
 	public struct DynamicIndexBufferHandle {
 	    public ushort idx;
 	    public bool Valid => idx != UInt16.MaxValue;
@@ -3505,6 +3544,41 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_dynamic_vertex_buffer", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_dynamic_vertex_buffer(DynamicVertexBufferHandle _handle);
 	
+	/// <summary>
+	/// Allocate matrices in persistent transform buffer. Matrices keep their
+	/// index and value across frames until freed, and only matrices modified
+	/// with `bgfx::updatePersistentTransform` are uploaded on `bgfx::frame`.
+	/// 
+	/// @remarks Requires `BGFX_CAPS_COMPUTE`, and `Init::Limits::maxPersistentTransforms`
+	///   to be non-zero.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_num">Number of matrices.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_alloc_persistent_transform", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint alloc_persistent_transform(ushort _num);
+	
+	/// <summary>
+	/// Free matrices allocated with `bgfx::allocPersistentTransform`.
+	/// </summary>
+	///
+	/// <param name="_index">Index of first matrix returned by `bgfx::allocPersistentTransform`.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_free_persistent_transform", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void free_persistent_transform(uint _index);
+	
+	/// <summary>
+	/// Update matrices in persistent transform buffer.
+	/// </summary>
+	///
+	/// <param name="_index">Index of first matrix.</param>
+	/// <param name="_mtx">Pointer to first matrix in array.</param>
+	/// <param name="_num">Number of matrices in array.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_update_persistent_transform", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void update_persistent_transform(uint _index, void* _mtx, ushort _num);
+	
 	/// <summary>
 	/// Returns number of requested or maximum available indices.
 	/// </summary>
@@ -3687,6 +3761,32 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_program", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_program(ProgramHandle _handle);
 	
+	/// <summary>
+	/// Set instanced variant of program used for automatic instancing.
+	/// 
+	/// Consecutive draw calls (after sorting) in the same view that use `handle`
+	/// and differ only in transform are merged into single instanced draw call
+	/// with `instanced` program. Per-instance model matrix is passed as instance
+	/// data `i_data0` to `i_data3`.
+	/// 
+	/// Instanced vertex shader is compiled from the same source with
+	/// `shaderc --instanced`, which reads `u_model`, `u_modelView`, and
+	/// `u_modelViewProj` from instance data instead of uniforms.
+	/// 
+	/// @remarks Draw calls with multiple transforms, instance data, indirect
+	///   buffer, occlusion query, or uniforms set between them are not merged.
+	/// 
+	/// @attention `instanced` program is kept alive until variant is changed,
+	///   or `handle` is destroyed. Pass invalid handle to disable.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle.</param>
+	/// <param name="_instanced">Instanced program variant, vertex shader reads model matrix from `i_data0` to `i_data3`.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_instanced_program", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_instanced_program(ProgramHandle _handle, ProgramHandle _instanced);
+	
 	/// <summary>
 	/// Validate texture parameters.
 	/// </summary>
@@ -3913,6 +4013,25 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_read_texture", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe uint read_texture(TextureHandle _handle, void* _data, ushort _layer, byte _mip);
 	
+	/// <summary>
+	/// Set most detailed mip level of texture that is resident. Mip levels above it are not
+	/// sampled, and they are not counted in `Stats::textureMemoryResident`. Texture can be created
+	/// with only tail mips uploaded, and more detailed mips streamed in later with
+	/// `bgfx::updateTexture2D` before lowering min LOD.
+	/// 
+	/// @remarks Renderer still allocates storage for whole mip chain.
+	/// @remarks Sampled texture binds start at min LOD, the same as if `firstMip` passed to
+	///   `bgfx::setTexture` was raised to min LOD. Explicit LOD and texture size queries in
+	///   shader are relative to min LOD. Image (storage) binds are not affected.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_minLod">Most detailed resident mip level. Use 0 to make whole mip chain resident.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_texture_min_lod", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_texture_min_lod(TextureHandle _handle, byte _minLod);
+	
 	/// <summary>
 	/// Set texture debug name.
 	/// </summary>
@@ -4430,6 +4549,30 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_encoder_set_marker", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void encoder_set_marker(Encoder* _this, [MarshalAs(UnmanagedType.LPStr)] string _name, int _len);
 	
+	/// <summary>
+	/// Begin GPU timing region. Draw and compute calls submitted until matching
+	/// `profilerEndGpu` are attributed to region, and region is timed from first to
+	/// last of them in sorted order. Regions can be nested.
+	/// 
+	/// @remarks
+	///   Results are returned few frames later through `Stats::gpuRegionStats`.
+	///   Supported by OpenGL and Vulkan renderers.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_name">Region name.</param>
+	/// <param name="_len">Region name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_profiler_begin_gpu", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_profiler_begin_gpu(Encoder* _this, [MarshalAs(UnmanagedType.LPStr)] string _name, int _len);
+	
+	/// <summary>
+	/// End GPU timing region.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_profiler_end_gpu", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_profiler_end_gpu(Encoder* _this);
+	
 	/// <summary>
 	/// Set render states for draw primitive.
 	/// 
@@ -4453,14 +4596,23 @@ public static partial class bgfx
 	public static extern unsafe void encoder_set_state(Encoder* _this, ulong _state, uint _rgba);
 	
 	/// <summary>
-	/// Set condition for rendering.
+	/// Set condition for rendering. Condition applies to next draw call or compute
+	/// dispatch.
+	/// 
+	/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+	///   draw call is predicated on GPU with result of query issued in earlier view
+	///   of the same frame. Otherwise last query result available on CPU is used.
+	///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+	///   conditional rendering doesn't apply to compute.
+	/// 
 	/// </summary>
 	///
 	/// <param name="_handle">Occlusion query handle.</param>
 	/// <param name="_visible">Render if occlusion query is visible.</param>
+	/// <param name="_current">Use query result from current frame.</param>
 	///
 	[DllImport(DllName, EntryPoint="bgfx_encoder_set_condition", CallingConvention = CallingConvention.Cdecl)]
-	public static extern unsafe void encoder_set_condition(Encoder* _this, OcclusionQueryHandle _handle, bool _visible);
+	public static extern unsafe void encoder_set_condition(Encoder* _this, OcclusionQueryHandle _handle, bool _visible, bool _current);
 	
 	/// <summary>
 	/// Set stencil test state.
@@ -4522,6 +4674,18 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_encoder_set_transform_cached", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void encoder_set_transform_cached(Encoder* _this, uint _cache, ushort _num);
 	
+	/// <summary>
+	/// Set persistent transform index for draw primitive. Persistent transform
+	/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+	/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_index">Index in persistent transform buffer.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_set_persistent_transform", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_set_persistent_transform(Encoder* _this, uint _index);
+	
 	/// <summary>
 	/// Reserve matrices in internal matrix cache.
 	/// 
@@ -4535,6 +4699,48 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_encoder_alloc_transform", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe uint encoder_alloc_transform(Encoder* _this, Transform* _transform, ushort _num);
 	
+	/// <summary>
+	/// Allocate transient index buffer from encoder's slab of frame's transient
+	/// index buffer. Slabs are reserved with single atomic operation, and
+	/// allocations within slab don't take any lock.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_tib">TransientIndexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+	/// <param name="_num">Number of indices to allocate.</param>
+	/// <param name="_index32">Set to `true` if input indices will be 32-bit.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_alloc_transient_index_buffer", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_alloc_transient_index_buffer(Encoder* _this, TransientIndexBuffer* _tib, uint _num, bool _index32);
+	
+	/// <summary>
+	/// Allocate transient vertex buffer from encoder's slab of frame's transient
+	/// vertex buffer. Slabs are reserved with single atomic operation, and
+	/// allocations within slab don't take any lock.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_tvb">TransientVertexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+	/// <param name="_num">Number of vertices to allocate.</param>
+	/// <param name="_layoutHandle">Vertex layout, created with `createVertexLayout`.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_alloc_transient_vertex_buffer", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_alloc_transient_vertex_buffer(Encoder* _this, TransientVertexBuffer* _tvb, uint _num, VertexLayoutHandle _layoutHandle);
+	
+	/// <summary>
+	/// Allocate instance data buffer from encoder's slab of frame's transient
+	/// vertex buffer. Slabs are reserved with single atomic operation, and
+	/// allocations within slab don't take any lock.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_idb">InstanceDataBuffer structure will be filled, and will be valid for duration of frame, and can be reused for multiple draw calls.</param>
+	/// <param name="_num">Number of instances.</param>
+	/// <param name="_stride">Instance stride. Must be multiple of 16.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_alloc_instance_data_buffer", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_alloc_instance_data_buffer(Encoder* _this, InstanceDataBuffer* _idb, uint _num, ushort _stride);
+	
 	/// <summary>
 	/// Set shader uniform parameter for draw primitive.
 	/// </summary>
@@ -4999,6 +5205,50 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_encoder_blit", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void encoder_blit(Encoder* _this, ushort _id, TextureHandle _dst, byte _dstMip, ushort _dstX, ushort _dstY, ushort _dstZ, TextureHandle _src, byte _srcMip, ushort _srcX, ushort _srcY, ushort _srcZ, ushort _width, ushort _height, ushort _depth);
 	
+	/// <summary>
+	/// Start recording draw list. All following submits on this encoder are
+	/// captured into draw list instead of being submitted to the frame, until
+	/// `bgfx::Encoder::endDrawList` is called.
+	/// 
+	/// @remarks
+	///   Recording must begin and end within the same frame. Draw calls using transient
+	///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+	///   occlusion queries, are dropped.
+	/// 
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_begin_draw_list", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_begin_draw_list(Encoder* _this);
+	
+	/// <summary>
+	/// End recording draw list.
+	/// 
+	/// @remarks
+	///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+	///   indirect buffers it uses. They can be destroyed while draw list is alive,
+	///   but they are released only after draw list is destroyed.
+	/// 
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_end_draw_list", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe DrawListHandle encoder_end_draw_list(Encoder* _this);
+	
+	/// <summary>
+	/// Submit previously recorded draw list for rendering. Draw state, bindings,
+	/// uniforms and sort keys captured during recording are replayed into view.
+	/// 
+	/// @remarks
+	///   Encoder state set before this call is not used, and it's not cleared.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_drawList">Draw list.</param>
+	/// <param name="_mtx">Base transform applied to all recorded transforms. It can be `NULL` if recorded transforms are used as is.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_submit_draw_list", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_submit_draw_list(Encoder* _this, ushort _id, DrawListHandle _drawList, void* _mtx);
+	
 	/// <summary>
 	/// Request screen shot of window back buffer.
 	/// 
@@ -5014,6 +5264,52 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_request_screen_shot", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void request_screen_shot(FrameBufferHandle _handle, [MarshalAs(UnmanagedType.LPStr)] string _filePath);
 	
+	/// <summary>
+	/// Save recorded trace as Chrome trace-event JSON, which can be opened in Perfetto UI or
+	/// `chrome://tracing`. Trace contains most recent profiler scopes from all threads, and
+	/// per-view GPU timings.
+	/// 
+	/// @remarks
+	///   Requires `BGFX_CONFIG_TRACE`. GPU timings require `BGFX_DEBUG_PROFILER` debug flag.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_filePath">Output file path.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_save_trace", CallingConvention = CallingConvention.Cdecl)]
+	[return: MarshalAs(UnmanagedType.I1)]
+	public static extern unsafe bool save_trace([MarshalAs(UnmanagedType.LPStr)] string _filePath);
+	
+	/// <summary>
+	/// Request capture of resources and sorted frame. Captured frame is written to file when frame
+	/// is rendered, and it can be replayed with `bgfx::replayFrameCapture`.
+	/// 
+	/// @remarks
+	///   Requires `BGFX_CONFIG_CAPTURE`. Only resources created after `bgfx::init` are captured.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_filePath">Output file path.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_request_frame_capture", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void request_frame_capture([MarshalAs(UnmanagedType.LPStr)] string _filePath);
+	
+	/// <summary>
+	/// Replay captured frame instead of submitted frame. Captured resources are created on next
+	/// frame, and captured frame is rendered every frame until replay is stopped.
+	/// 
+	/// @remarks
+	///   Requires `BGFX_CONFIG_CAPTURE`. Capture must be done by bgfx built with the same
+	///   configuration, and shaders must be compatible with current renderer.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_filePath">Frame capture file path. Pass `NULL` to stop replay.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_replay_frame_capture", CallingConvention = CallingConvention.Cdecl)]
+	[return: MarshalAs(UnmanagedType.I1)]
+	public static extern unsafe bool replay_frame_capture([MarshalAs(UnmanagedType.LPStr)] string _filePath);
+	
 	/// <summary>
 	/// Render frame. Executes the actual GPU rendering work for one frame.
 	/// 
@@ -5138,6 +5434,30 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_set_marker", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void set_marker([MarshalAs(UnmanagedType.LPStr)] string _name, int _len);
 	
+	/// <summary>
+	/// Begin GPU timing region. Draw and compute calls submitted until matching
+	/// `profilerEndGpu` are attributed to region, and region is timed from first to
+	/// last of them in sorted order. Regions can be nested.
+	/// 
+	/// @remarks
+	///   Results are returned few frames later through `Stats::gpuRegionStats`.
+	///   Supported by OpenGL and Vulkan renderers.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_name">Region name.</param>
+	/// <param name="_len">Region name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_profiler_begin_gpu", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void profiler_begin_gpu([MarshalAs(UnmanagedType.LPStr)] string _name, int _len);
+	
+	/// <summary>
+	/// End GPU timing region.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_profiler_end_gpu", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void profiler_end_gpu();
+	
 	/// <summary>
 	/// Set render states for draw primitive.
 	/// 
@@ -5161,14 +5481,23 @@ public static partial class bgfx
 	public static extern unsafe void set_state(ulong _state, uint _rgba);
 	
 	/// <summary>
-	/// Set condition for rendering.
+	/// Set condition for rendering. Condition applies to next draw call or compute
+	/// dispatch.
+	/// 
+	/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+	///   draw call is predicated on GPU with result of query issued in earlier view
+	///   of the same frame. Otherwise last query result available on CPU is used.
+	///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+	///   conditional rendering doesn't apply to compute.
+	/// 
 	/// </summary>
 	///
 	/// <param name="_handle">Occlusion query handle.</param>
 	/// <param name="_visible">Render if occlusion query is visible.</param>
+	/// <param name="_current">Use query result from current frame.</param>
 	///
 	[DllImport(DllName, EntryPoint="bgfx_set_condition", CallingConvention = CallingConvention.Cdecl)]
-	public static extern unsafe void set_condition(OcclusionQueryHandle _handle, bool _visible);
+	public static extern unsafe void set_condition(OcclusionQueryHandle _handle, bool _visible, bool _current);
 	
 	/// <summary>
 	/// Set stencil test state.
@@ -5230,6 +5559,18 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_set_transform_cached", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void set_transform_cached(uint _cache, ushort _num);
 	
+	/// <summary>
+	/// Set persistent transform index for draw primitive. Persistent transform
+	/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+	/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_index">Index in persistent transform buffer.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_persistent_transform", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_persistent_transform(uint _index);
+	
 	/// <summary>
 	/// Reserve matrices in internal matrix cache.
 	/// 
@@ -5676,5 +6017,58 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_blit", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void blit(ushort _id, TextureHandle _dst, byte _dstMip, ushort _dstX, ushort _dstY, ushort _dstZ, TextureHandle _src, byte _srcMip, ushort _srcX, ushort _srcY, ushort _srcZ, ushort _width, ushort _height, ushort _depth);
 	
+	/// <summary>
+	/// Start recording draw list. All following submits are captured
+	/// into draw list instead of being submitted to the frame, until
+	/// `bgfx::endDrawList` is called.
+	/// 
+	/// @remarks
+	///   Recording must begin and end within the same frame. Draw calls using transient
+	///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+	///   occlusion queries, are dropped.
+	/// 
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_begin_draw_list", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void begin_draw_list();
+	
+	/// <summary>
+	/// End recording draw list.
+	/// 
+	/// @remarks
+	///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+	///   indirect buffers it uses. They can be destroyed while draw list is alive,
+	///   but they are released only after draw list is destroyed.
+	/// 
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_end_draw_list", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe DrawListHandle end_draw_list();
+	
+	/// <summary>
+	/// Submit previously recorded draw list for rendering. Draw state, bindings,
+	/// uniforms and sort keys captured during recording are replayed into view.
+	/// 
+	/// @remarks
+	///   Encoder state set before this call is not used, and it's not cleared.
+	/// 
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_drawList">Draw list.</param>
+	/// <param name="_mtx">Base transform applied to all recorded transforms. It can be `NULL` if recorded transforms are used as is.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_submit_draw_list", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void submit_draw_list(ushort _id, DrawListHandle _drawList, void* _mtx);
+	
+	/// <summary>
+	/// Destroy draw list, and release resources referenced by it.
+	/// </summary>
+	///
+	/// <param name="_handle">Handle to draw list object.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_destroy_draw_list", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void destroy_draw_list(DrawListHandle _handle);
+	
 }
 }
@@ -588,6 +588,7 @@ class CapsFlags(enum.IntFlag):
 	VertexId = 0x100000000
 	VideoDecode = 0x200000000
 	ViewportLayerArray = 0x400000000
+	ConditionalRender = 0x800000000
 	TextureCompareAll = 0x180000
 
 class CapsFormatFlags(enum.IntFlag):
@@ -719,6 +720,9 @@ class Transform(ctypes.Structure):
 class ViewStats(ctypes.Structure):
 	pass
 
+class GpuRegionStats(ctypes.Structure):
+	pass
+
 class EncoderStats(ctypes.Structure):
 	pass
 
@@ -731,6 +735,13 @@ class VertexLayout(ctypes.Structure):
 class Encoder(ctypes.Structure):
 	pass
 
+class DrawListHandle(ctypes.Structure):
+	_fields_ = [("idx", ctypes.c_uint16)]
+
+	@property
+	def valid(self):
+		return self.idx != 0xffff
+
 class DynamicIndexBufferHandle(ctypes.Structure):
 	_fields_ = [("idx", ctypes.c_uint16)]
 
@@ -850,6 +861,7 @@ CapsLimits._fields_ = [
 	("maxTransientVbSize", ctypes.c_uint32),
 	("maxTransientIbSize", ctypes.c_uint32),
 	("minUniformBufferSize", ctypes.c_uint32),
+	("maxPersistentTransforms", ctypes.c_uint32),
 ]
 
 Caps._fields_ = [
@@ -900,6 +912,9 @@ InitLimits._fields_ = [
 	("maxTransientVbSize", ctypes.c_uint32),
 	("maxTransientIbSize", ctypes.c_uint32),
 	("minUniformBufferSize", ctypes.c_uint32),
+	("dynamicIndexBufferSize", ctypes.c_uint32),
+	("dynamicVertexBufferSize", ctypes.c_uint32),
+	("maxPersistentTransforms", ctypes.c_uint32),
 ]
 
 Init._fields_ = [
@@ -1014,9 +1029,20 @@ ViewStats._fields_ = [
 	("gpuFrameNum", ctypes.c_uint32),
 ]
 
+GpuRegionStats._fields_ = [
+	("name", (ctypes.c_char * 64)),
+	("gpuTimeBegin", ctypes.c_int64),
+	("gpuTimeEnd", ctypes.c_int64),
+	("gpuFrameNum", ctypes.c_uint32),
+]
+
 EncoderStats._fields_ = [
 	("cpuTimeBegin", ctypes.c_int64),
 	("cpuTimeEnd", ctypes.c_int64),
+	("transientReserveTime", ctypes.c_int64),
+	("numTransientAllocs", ctypes.c_uint32),
+	("numTransientSlabs", ctypes.c_uint32),
+	("numTransientContended", ctypes.c_uint32),
 ]
 
 Stats._fields_ = [
@@ -1035,12 +1061,16 @@ Stats._fields_ = [
 	("numDrawCallsPeak", ctypes.c_uint32),
 	("maxGpuLatency", ctypes.c_uint32),
 	("gpuFrameNum", ctypes.c_uint32),
+	("numVertexArrayBinds", ctypes.c_uint32),
+	("numVertexAttribCalls", ctypes.c_uint32),
+	("uniformBytesSkipped", ctypes.c_uint32),
 	("numDynamicIndexBuffers", ctypes.c_uint16),
 	("numDynamicVertexBuffers", ctypes.c_uint16),
 	("numFrameBuffers", ctypes.c_uint16),
 	("numIndexBuffers", ctypes.c_uint16),
 	("numOcclusionQueries", ctypes.c_uint16),
 	("numPrograms", ctypes.c_uint16),
+	("numProgramsPending", ctypes.c_uint16),
 	("numShaders", ctypes.c_uint16),
 	("numTextures", ctypes.c_uint16),
 	("numUniforms", ctypes.c_uint16),
@@ -1048,8 +1078,15 @@ Stats._fields_ = [
 	("numVertexLayouts", ctypes.c_uint16),
 	("textureMemoryUsed", ctypes.c_int64),
 	("rtMemoryUsed", ctypes.c_int64),
+	("textureMemoryResident", ctypes.c_int64),
 	("transientVbUsed", ctypes.c_int32),
 	("transientIbUsed", ctypes.c_int32),
+	("dynIbNumFreeBlocks", ctypes.c_uint32),
+	("dynIbLargestFreeBlock", ctypes.c_uint32),
+	("dynVbNumFreeBlocks", ctypes.c_uint32),
+	("dynVbLargestFreeBlock", ctypes.c_uint32),
+	("uniformNumFreeBlocks", ctypes.c_uint32),
+	("uniformLargestFreeBlock", ctypes.c_uint32),
 	("numPrims", (ctypes.c_uint32 * 5)),
 	("gpuMemoryMax", ctypes.c_int64),
 	("gpuMemoryUsed", ctypes.c_int64),
@@ -1059,6 +1096,8 @@ Stats._fields_ = [
 	("textHeight", ctypes.c_uint16),
 	("numViews", ctypes.c_uint16),
 	("viewStats", ctypes.POINTER(ViewStats)),
+	("numGpuRegions", ctypes.c_uint16),
+	("gpuRegionStats", ctypes.POINTER(GpuRegionStats)),
 	("numEncoders", ctypes.c_uint8),
 	("encoderStats", ctypes.POINTER(EncoderStats)),
 ]
@@ -1259,6 +1298,18 @@ def _bind(lib):
 	bgfx_destroy_dynamic_vertex_buffer = lib.bgfx_destroy_dynamic_vertex_buffer
 	bgfx_destroy_dynamic_vertex_buffer.argtypes = [DynamicVertexBufferHandle]
 	bgfx_destroy_dynamic_vertex_buffer.restype = None
+	global bgfx_alloc_persistent_transform
+	bgfx_alloc_persistent_transform = lib.bgfx_alloc_persistent_transform
+	bgfx_alloc_persistent_transform.argtypes = [ctypes.c_uint16]
+	bgfx_alloc_persistent_transform.restype = ctypes.c_uint32
+	global bgfx_free_persistent_transform
+	bgfx_free_persistent_transform = lib.bgfx_free_persistent_transform
+	bgfx_free_persistent_transform.argtypes = [ctypes.c_uint32]
+	bgfx_free_persistent_transform.restype = None
+	global bgfx_update_persistent_transform
+	bgfx_update_persistent_transform = lib.bgfx_update_persistent_transform
+	bgfx_update_persistent_transform.argtypes = [ctypes.c_uint32, ctypes.c_void_p, ctypes.c_uint16]
+	bgfx_update_persistent_transform.restype = None
 	global bgfx_get_avail_transient_index_buffer
 	bgfx_get_avail_transient_index_buffer = lib.bgfx_get_avail_transient_index_buffer
 	bgfx_get_avail_transient_index_buffer.argtypes = [ctypes.c_uint32, ctypes.c_bool]
@@ -1323,6 +1374,10 @@ def _bind(lib):
 	bgfx_destroy_program = lib.bgfx_destroy_program
 	bgfx_destroy_program.argtypes = [ProgramHandle]
 	bgfx_destroy_program.restype = None
+	global bgfx_set_instanced_program
+	bgfx_set_instanced_program = lib.bgfx_set_instanced_program
+	bgfx_set_instanced_program.argtypes = [ProgramHandle, ProgramHandle]
+	bgfx_set_instanced_program.restype = None
 	global bgfx_is_texture_valid
 	bgfx_is_texture_valid = lib.bgfx_is_texture_valid
 	bgfx_is_texture_valid.argtypes = [ctypes.c_uint16, ctypes.c_bool, ctypes.c_uint16, ctypes.c_int, ctypes.c_uint64]
@@ -1379,6 +1434,10 @@ def _bind(lib):
 	bgfx_read_texture = lib.bgfx_read_texture
 	bgfx_read_texture.argtypes = [TextureHandle, ctypes.c_void_p, ctypes.c_uint16, ctypes.c_uint8]
 	bgfx_read_texture.restype = ctypes.c_uint32
+	global bgfx_set_texture_min_lod
+	bgfx_set_texture_min_lod = lib.bgfx_set_texture_min_lod
+	bgfx_set_texture_min_lod.argtypes = [TextureHandle, ctypes.c_uint8]
+	bgfx_set_texture_min_lod.restype = None
 	global bgfx_set_texture_name
 	bgfx_set_texture_name = lib.bgfx_set_texture_name
 	bgfx_set_texture_name.argtypes = [TextureHandle, ctypes.c_char_p, ctypes.c_int32]
@@ -1523,13 +1582,21 @@ def _bind(lib):
 	bgfx_encoder_set_marker = lib.bgfx_encoder_set_marker
 	bgfx_encoder_set_marker.argtypes = [ctypes.POINTER(Encoder), ctypes.c_char_p, ctypes.c_int32]
 	bgfx_encoder_set_marker.restype = None
+	global bgfx_encoder_profiler_begin_gpu
+	bgfx_encoder_profiler_begin_gpu = lib.bgfx_encoder_profiler_begin_gpu
+	bgfx_encoder_profiler_begin_gpu.argtypes = [ctypes.POINTER(Encoder), ctypes.c_char_p, ctypes.c_int32]
+	bgfx_encoder_profiler_begin_gpu.restype = None
+	global bgfx_encoder_profiler_end_gpu
+	bgfx_encoder_profiler_end_gpu = lib.bgfx_encoder_profiler_end_gpu
+	bgfx_encoder_profiler_end_gpu.argtypes = [ctypes.POINTER(Encoder)]
+	bgfx_encoder_profiler_end_gpu.restype = None
 	global bgfx_encoder_set_state
 	bgfx_encoder_set_state = lib.bgfx_encoder_set_state
 	bgfx_encoder_set_state.argtypes = [ctypes.POINTER(Encoder), ctypes.c_uint64, ctypes.c_uint32]
 	bgfx_encoder_set_state.restype = None
 	global bgfx_encoder_set_condition
 	bgfx_encoder_set_condition = lib.bgfx_encoder_set_condition
-	bgfx_encoder_set_condition.argtypes = [ctypes.POINTER(Encoder), OcclusionQueryHandle, ctypes.c_bool]
+	bgfx_encoder_set_condition.argtypes = [ctypes.POINTER(Encoder), OcclusionQueryHandle, ctypes.c_bool, ctypes.c_bool]
 	bgfx_encoder_set_condition.restype = None
 	global bgfx_encoder_set_stencil
 	bgfx_encoder_set_stencil = lib.bgfx_encoder_set_stencil
@@ -1551,10 +1618,26 @@ def _bind(lib):
 	bgfx_encoder_set_transform_cached = lib.bgfx_encoder_set_transform_cached
 	bgfx_encoder_set_transform_cached.argtypes = [ctypes.POINTER(Encoder), ctypes.c_uint32, ctypes.c_uint16]
 	bgfx_encoder_set_transform_cached.restype = None
+	global bgfx_encoder_set_persistent_transform
+	bgfx_encoder_set_persistent_transform = lib.bgfx_encoder_set_persistent_transform
+	bgfx_encoder_set_persistent_transform.argtypes = [ctypes.POINTER(Encoder), ctypes.c_uint32]
+	bgfx_encoder_set_persistent_transform.restype = None
 	global bgfx_encoder_alloc_transform
 	bgfx_encoder_alloc_transform = lib.bgfx_encoder_alloc_transform
 	bgfx_encoder_alloc_transform.argtypes = [ctypes.POINTER(Encoder), ctypes.POINTER(Transform), ctypes.c_uint16]
 	bgfx_encoder_alloc_transform.restype = ctypes.c_uint32
+	global bgfx_encoder_alloc_transient_index_buffer
+	bgfx_encoder_alloc_transient_index_buffer = lib.bgfx_encoder_alloc_transient_index_buffer
+	bgfx_encoder_alloc_transient_index_buffer.argtypes = [ctypes.POINTER(Encoder), ctypes.POINTER(TransientIndexBuffer), ctypes.c_uint32, ctypes.c_bool]
+	bgfx_encoder_alloc_transient_index_buffer.restype = None
+	global bgfx_encoder_alloc_transient_vertex_buffer
+	bgfx_encoder_alloc_transient_vertex_buffer = lib.bgfx_encoder_alloc_transient_vertex_buffer
+	bgfx_encoder_alloc_transient_vertex_buffer.argtypes = [ctypes.POINTER(Encoder), ctypes.POINTER(TransientVertexBuffer), ctypes.c_uint32, VertexLayoutHandle]
+	bgfx_encoder_alloc_transient_vertex_buffer.restype = None
+	global bgfx_encoder_alloc_instance_data_buffer
+	bgfx_encoder_alloc_instance_data_buffer = lib.bgfx_encoder_alloc_instance_data_buffer
+	bgfx_encoder_alloc_instance_data_buffer.argtypes = [ctypes.POINTER(Encoder), ctypes.POINTER(InstanceDataBuffer), ctypes.c_uint32, ctypes.c_uint16]
+	bgfx_encoder_alloc_instance_data_buffer.restype = None
 	global bgfx_encoder_set_uniform
 	bgfx_encoder_set_uniform = lib.bgfx_encoder_set_uniform
 	bgfx_encoder_set_uniform.argtypes = [ctypes.POINTER(Encoder), UniformHandle, ctypes.c_void_p, ctypes.c_uint16]
@@ -1695,10 +1778,34 @@ def _bind(lib):
 	bgfx_encoder_blit = lib.bgfx_encoder_blit
 	bgfx_encoder_blit.argtypes = [ctypes.POINTER(Encoder), ctypes.c_uint16, TextureHandle, ctypes.c_uint8, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, TextureHandle, ctypes.c_uint8, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16]
 	bgfx_encoder_blit.restype = None
+	global bgfx_encoder_begin_draw_list
+	bgfx_encoder_begin_draw_list = lib.bgfx_encoder_begin_draw_list
+	bgfx_encoder_begin_draw_list.argtypes = [ctypes.POINTER(Encoder)]
+	bgfx_encoder_begin_draw_list.restype = None
+	global bgfx_encoder_end_draw_list
+	bgfx_encoder_end_draw_list = lib.bgfx_encoder_end_draw_list
+	bgfx_encoder_end_draw_list.argtypes = [ctypes.POINTER(Encoder)]
+	bgfx_encoder_end_draw_list.restype = DrawListHandle
+	global bgfx_encoder_submit_draw_list
+	bgfx_encoder_submit_draw_list = lib.bgfx_encoder_submit_draw_list
+	bgfx_encoder_submit_draw_list.argtypes = [ctypes.POINTER(Encoder), ctypes.c_uint16, DrawListHandle, ctypes.c_void_p]
+	bgfx_encoder_submit_draw_list.restype = None
 	global bgfx_request_screen_shot
 	bgfx_request_screen_shot = lib.bgfx_request_screen_shot
 	bgfx_request_screen_shot.argtypes = [FrameBufferHandle, ctypes.c_char_p]
 	bgfx_request_screen_shot.restype = None
+	global bgfx_save_trace
+	bgfx_save_trace = lib.bgfx_save_trace
+	bgfx_save_trace.argtypes = [ctypes.c_char_p]
+	bgfx_save_trace.restype = ctypes.c_bool
+	global bgfx_request_frame_capture
+	bgfx_request_frame_capture = lib.bgfx_request_frame_capture
+	bgfx_request_frame_capture.argtypes = [ctypes.c_char_p]
+	bgfx_request_frame_capture.restype = None
+	global bgfx_replay_frame_capture
+	bgfx_replay_frame_capture = lib.bgfx_replay_frame_capture
+	bgfx_replay_frame_capture.argtypes = [ctypes.c_char_p]
+	bgfx_replay_frame_capture.restype = ctypes.c_bool
 	global bgfx_render_frame
 	bgfx_render_frame = lib.bgfx_render_frame
 	bgfx_render_frame.argtypes = [ctypes.c_int32]
@@ -1723,13 +1830,21 @@ def _bind(lib):
 	bgfx_set_marker = lib.bgfx_set_marker
 	bgfx_set_marker.argtypes = [ctypes.c_char_p, ctypes.c_int32]
 	bgfx_set_marker.restype = None
+	global bgfx_profiler_begin_gpu
+	bgfx_profiler_begin_gpu = lib.bgfx_profiler_begin_gpu
+	bgfx_profiler_begin_gpu.argtypes = [ctypes.c_char_p, ctypes.c_int32]
+	bgfx_profiler_begin_gpu.restype = None
+	global bgfx_profiler_end_gpu
+	bgfx_profiler_end_gpu = lib.bgfx_profiler_end_gpu
+	bgfx_profiler_end_gpu.argtypes = []
+	bgfx_profiler_end_gpu.restype = None
 	global bgfx_set_state
 	bgfx_set_state = lib.bgfx_set_state
 	bgfx_set_state.argtypes = [ctypes.c_uint64, ctypes.c_uint32]
 	bgfx_set_state.restype = None
 	global bgfx_set_condition
 	bgfx_set_condition = lib.bgfx_set_condition
-	bgfx_set_condition.argtypes = [OcclusionQueryHandle, ctypes.c_bool]
+	bgfx_set_condition.argtypes = [OcclusionQueryHandle, ctypes.c_bool, ctypes.c_bool]
 	bgfx_set_condition.restype = None
 	global bgfx_set_stencil
 	bgfx_set_stencil = lib.bgfx_set_stencil
@@ -1751,6 +1866,10 @@ def _bind(lib):
 	bgfx_set_transform_cached = lib.bgfx_set_transform_cached
 	bgfx_set_transform_cached.argtypes = [ctypes.c_uint32, ctypes.c_uint16]
 	bgfx_set_transform_cached.restype = None
+	global bgfx_set_persistent_transform
+	bgfx_set_persistent_transform = lib.bgfx_set_persistent_transform
+	bgfx_set_persistent_transform.argtypes = [ctypes.c_uint32]
+	bgfx_set_persistent_transform.restype = None
 	global bgfx_alloc_transform
 	bgfx_alloc_transform = lib.bgfx_alloc_transform
 	bgfx_alloc_transform.argtypes = [ctypes.POINTER(Transform), ctypes.c_uint16]
@@ -1887,3 +2006,19 @@ def _bind(lib):
 	bgfx_blit = lib.bgfx_blit
 	bgfx_blit.argtypes = [ctypes.c_uint16, TextureHandle, ctypes.c_uint8, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, TextureHandle, ctypes.c_uint8, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16, ctypes.c_uint16]
 	bgfx_blit.restype = None
+	global bgfx_begin_draw_list
+	bgfx_begin_draw_list = lib.bgfx_begin_draw_list
+	bgfx_begin_draw_list.argtypes = []
+	bgfx_begin_draw_list.restype = None
+	global bgfx_end_draw_list
+	bgfx_end_draw_list = lib.bgfx_end_draw_list
+	bgfx_end_draw_list.argtypes = []
+	bgfx_end_draw_list.restype = DrawListHandle
+	global bgfx_submit_draw_list
+	bgfx_submit_draw_list = lib.bgfx_submit_draw_list
+	bgfx_submit_draw_list.argtypes = [ctypes.c_uint16, DrawListHandle, ctypes.c_void_p]
+	bgfx_submit_draw_list.restype = None
+	global bgfx_destroy_draw_list
+	bgfx_destroy_draw_list = lib.bgfx_destroy_draw_list
+	bgfx_destroy_draw_list.argtypes = [DrawListHandle]
+	bgfx_destroy_draw_list.restype = None
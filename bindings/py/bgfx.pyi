@@ -1071,6 +1071,8 @@ class CapsFlags(enum.IntFlag):
 	VideoDecode = 0x200000000
 	# Viewport layer is available in vertex shader.
 	ViewportLayerArray = 0x400000000
+	# GPU-side conditional rendering is supported.
+	ConditionalRender = 0x800000000
 	# All texture compare modes are supported.
 	TextureCompareAll = 0x180000
 
@@ -1270,6 +1272,9 @@ class CapsLimits(ctypes.Structure):
 	maxTransientIbSize: int
 	# Mimimum uniform buffer size.
 	minUniformBufferSize: int
+	# Maximum number of persistent transform matrices, 0 when
+	# persistent transform buffer is not available.
+	maxPersistentTransforms: int
 
 # Renderer capabilities.
 class Caps(ctypes.Structure):
@@ -1406,6 +1411,13 @@ class InitLimits(ctypes.Structure):
 	maxTransientIbSize: int
 	# Mimimum uniform buffer size.
 	minUniformBufferSize: int
+	# Dynamic index buffer backing store page size.
+	dynamicIndexBufferSize: int
+	# Dynamic vertex buffer backing store page size.
+	dynamicVertexBufferSize: int
+	# Number of matrices in persistent transform buffer. Set to 0 to
+	# disable it. See `bgfx::allocPersistentTransform`.
+	maxPersistentTransforms: int
 
 # Initialization parameters used by `bgfx::init`.
 class Init(ctypes.Structure):
@@ -1634,12 +1646,31 @@ class ViewStats(ctypes.Structure):
 	# Frame which generated gpuTimeBegin, gpuTimeEnd.
 	gpuFrameNum: int
 
+# GPU region stats.
+class GpuRegionStats(ctypes.Structure):
+	# Region name.
+	name: bytes
+	# GPU begin time.
+	gpuTimeBegin: int
+	# GPU end time.
+	gpuTimeEnd: int
+	# Frame which generated gpuTimeBegin, gpuTimeEnd.
+	gpuFrameNum: int
+
 # Encoder stats.
 class EncoderStats(ctypes.Structure):
 	# Encoder thread CPU submit begin time.
 	cpuTimeBegin: int
 	# Encoder thread CPU submit end time.
 	cpuTimeEnd: int
+	# Time spent reserving transient buffer slabs from frame.
+	transientReserveTime: int
+	# Number of transient buffer allocations.
+	numTransientAllocs: int
+	# Number of transient buffer slabs reserved from frame.
+	numTransientSlabs: int
+	# Number of slab reservations retried due to contention.
+	numTransientContended: int
 
 # Renderer statistics data.
 # 
@@ -1678,6 +1709,13 @@ class Stats(ctypes.Structure):
 	maxGpuLatency: int
 	# Frame which generated gpuTimeBegin, gpuTimeEnd.
 	gpuFrameNum: int
+	# Number of vertex array object binds (OpenGL only).
+	numVertexArrayBinds: int
+	# Number of vertex input setup calls (OpenGL only).
+	numVertexAttribCalls: int
+	# Bytes of per-draw uniform data not committed because values
+	# were same as already set.
+	uniformBytesSkipped: int
 	# Number of used dynamic index buffers.
 	numDynamicIndexBuffers: int
 	# Number of used dynamic vertex buffers.
@@ -1690,6 +1728,9 @@ class Stats(ctypes.Structure):
 	numOcclusionQueries: int
 	# Number of used programs.
 	numPrograms: int
+	# Number of programs still being compiled and linked, draws
+	# using them are skipped (OpenGL only).
+	numProgramsPending: int
 	# Number of used shaders.
 	numShaders: int
 	# Number of used textures.
@@ -1704,10 +1745,26 @@ class Stats(ctypes.Structure):
 	textureMemoryUsed: int
 	# Estimate of render target memory used.
 	rtMemoryUsed: int
+	# Estimate of texture memory used by mips at or above min LOD,
+	# see `bgfx::setTextureMinLod`.
+	textureMemoryResident: int
 	# Amount of transient vertex buffer used.
 	transientVbUsed: int
 	# Amount of transient index buffer used.
 	transientIbUsed: int
+	# Number of free blocks in dynamic index buffer backing store.
+	dynIbNumFreeBlocks: int
+	# Largest free block in dynamic index buffer backing store. Many
+	# small free blocks indicate fragmented backing store.
+	dynIbLargestFreeBlock: int
+	# Number of free blocks in dynamic vertex buffer backing store.
+	dynVbNumFreeBlocks: int
+	# Largest free block in dynamic vertex buffer backing store.
+	dynVbLargestFreeBlock: int
+	# Number of free blocks in view uniform store.
+	uniformNumFreeBlocks: int
+	# Largest free block in view uniform store.
+	uniformLargestFreeBlock: int
 	# Number of primitives rendered.
 	numPrims: ctypes.Array
 	# Maximum available GPU memory for application.
@@ -1726,6 +1783,10 @@ class Stats(ctypes.Structure):
 	numViews: int
 	# Array of View stats.
 	viewStats: _Pointer[ViewStats]
+	# Number of GPU region stats.
+	numGpuRegions: int
+	# Array of GPU region stats.
+	gpuRegionStats: _Pointer[GpuRegionStats]
 	# Number of encoders used during frame.
 	numEncoders: int
 	# Array of encoder stats.
@@ -1747,6 +1808,12 @@ class VertexLayout(ctypes.Structure):
 class Encoder(ctypes.Structure):
 	pass
 
+class DrawListHandle(ctypes.Structure):
+	idx: int
+
+	@property
+	def valid(self) -> bool: ...
+
 class DynamicIndexBufferHandle(ctypes.Structure):
 	idx: int
 
@@ -2077,6 +2144,21 @@ def bgfx_update_dynamic_vertex_buffer(_handle: DynamicVertexBufferHandle, _start
 # Destroy dynamic vertex buffer.
 def bgfx_destroy_dynamic_vertex_buffer(_handle: DynamicVertexBufferHandle, /) -> None: ...
 
+# Allocate matrices in persistent transform buffer. Matrices keep their
+# index and value across frames until freed, and only matrices modified
+# with `bgfx::updatePersistentTransform` are uploaded on `bgfx::frame`.
+# 
+# @remarks Requires `BGFX_CAPS_COMPUTE`, and `Init::Limits::maxPersistentTransforms`
+#   to be non-zero.
+# 
+def bgfx_alloc_persistent_transform(_num: int, /) -> int: ...
+
+# Free matrices allocated with `bgfx::allocPersistentTransform`.
+def bgfx_free_persistent_transform(_index: int, /) -> None: ...
+
+# Update matrices in persistent transform buffer.
+def bgfx_update_persistent_transform(_index: int, _mtx: Any, _num: int, /) -> None: ...
+
 # Returns number of requested or maximum available indices.
 def bgfx_get_avail_transient_index_buffer(_num: int, _index32: bool, /) -> int: ...
 
@@ -2149,6 +2231,25 @@ def bgfx_create_compute_program(_csh: ShaderHandle, _destroyShaders: bool, /) ->
 # Destroy program.
 def bgfx_destroy_program(_handle: ProgramHandle, /) -> None: ...
 
+# Set instanced variant of program used for automatic instancing.
+# 
+# Consecutive draw calls (after sorting) in the same view that use `handle`
+# and differ only in transform are merged into single instanced draw call
+# with `instanced` program. Per-instance model matrix is passed as instance
+# data `i_data0` to `i_data3`.
+# 
+# Instanced vertex shader is compiled from the same source with
+# `shaderc --instanced`, which reads `u_model`, `u_modelView`, and
+# `u_modelViewProj` from instance data instead of uniforms.
+# 
+# @remarks Draw calls with multiple transforms, instance data, indirect
+#   buffer, occlusion query, or uniforms set between them are not merged.
+# 
+# @attention `instanced` program is kept alive until variant is changed,
+#   or `handle` is destroyed. Pass invalid handle to disable.
+# 
+def bgfx_set_instanced_program(_handle: ProgramHandle, _instanced: ProgramHandle, /) -> None: ...
+
 # Validate texture parameters.
 def bgfx_is_texture_valid(_depth: int, _cubeMap: bool, _numLayers: int, _format: Union[TextureFormat, int], _flags: int, /) -> bool: ...
 
@@ -2293,6 +2394,18 @@ def bgfx_clear_texture(_handle: TextureHandle, _mip: int, _numMips: int, _layer:
 # 
 def bgfx_read_texture(_handle: TextureHandle, _data: Any, _layer: int, _mip: int, /) -> int: ...
 
+# Set most detailed mip level of texture that is resident. Mip levels above it are not
+# sampled, and they are not counted in `Stats::textureMemoryResident`. Texture can be created
+# with only tail mips uploaded, and more detailed mips streamed in later with
+# `bgfx::updateTexture2D` before lowering min LOD.
+# 
+# @remarks Renderer still allocates storage for whole mip chain.
+# @remarks Sampled texture binds start at min LOD, the same as if `firstMip` passed to
+#   `bgfx::setTexture` was raised to min LOD. Explicit LOD and texture size queries in
+#   shader are relative to min LOD. Image (storage) binds are not affected.
+# 
+def bgfx_set_texture_min_lod(_handle: TextureHandle, _minLod: int, /) -> None: ...
+
 # Set texture debug name.
 def bgfx_set_texture_name(_handle: TextureHandle, _name: Optional[bytes], _len: int, /) -> None: ...
 
@@ -2544,6 +2657,19 @@ def bgfx_encoder_end(_encoder: Optional[Union[Encoder, _Pointer[Encoder], ctypes
 # graphics debugging tools.
 def bgfx_encoder_set_marker(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _name: Optional[bytes], _len: int, /) -> None: ...
 
+# Begin GPU timing region. Draw and compute calls submitted until matching
+# `profilerEndGpu` are attributed to region, and region is timed from first to
+# last of them in sorted order. Regions can be nested.
+# 
+# @remarks
+#   Results are returned few frames later through `Stats::gpuRegionStats`.
+#   Supported by OpenGL and Vulkan renderers.
+# 
+def bgfx_encoder_profiler_begin_gpu(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _name: Optional[bytes], _len: int, /) -> None: ...
+
+# End GPU timing region.
+def bgfx_encoder_profiler_end_gpu(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], /) -> None: ...
+
 # Set render states for draw primitive.
 # 
 # @remarks
@@ -2559,8 +2685,16 @@ def bgfx_encoder_set_marker(_this: Optional[Union[Encoder, _Pointer[Encoder], ct
 # 
 def bgfx_encoder_set_state(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _state: int, _rgba: int, /) -> None: ...
 
-# Set condition for rendering.
-def bgfx_encoder_set_condition(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _handle: OcclusionQueryHandle, _visible: bool, /) -> None: ...
+# Set condition for rendering. Condition applies to next draw call or compute
+# dispatch.
+# 
+# @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+#   draw call is predicated on GPU with result of query issued in earlier view
+#   of the same frame. Otherwise last query result available on CPU is used.
+#   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+#   conditional rendering doesn't apply to compute.
+# 
+def bgfx_encoder_set_condition(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _handle: OcclusionQueryHandle, _visible: bool, _current: bool, /) -> None: ...
 
 # Set stencil test state.
 def bgfx_encoder_set_stencil(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _fstencil: int, _bstencil: int, /) -> None: ...
@@ -2586,12 +2720,36 @@ def bgfx_encoder_set_transform(_this: Optional[Union[Encoder, _Pointer[Encoder],
 #  Set model matrix from matrix cache for draw primitive.
 def bgfx_encoder_set_transform_cached(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _cache: int, _num: int, /) -> None: ...
 
+# Set persistent transform index for draw primitive. Persistent transform
+# buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+# available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+# 
+def bgfx_encoder_set_persistent_transform(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _index: int, /) -> None: ...
+
 # Reserve matrices in internal matrix cache.
 # 
 # @attention Pointer returned can be modified until `bgfx::frame` is called.
 # 
 def bgfx_encoder_alloc_transform(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _transform: Optional[Union[Transform, _Pointer[Transform], ctypes.Array]], _num: int, /) -> int: ...
 
+# Allocate transient index buffer from encoder's slab of frame's transient
+# index buffer. Slabs are reserved with single atomic operation, and
+# allocations within slab don't take any lock.
+# 
+def bgfx_encoder_alloc_transient_index_buffer(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _tib: Optional[Union[TransientIndexBuffer, _Pointer[TransientIndexBuffer], ctypes.Array]], _num: int, _index32: bool, /) -> None: ...
+
+# Allocate transient vertex buffer from encoder's slab of frame's transient
+# vertex buffer. Slabs are reserved with single atomic operation, and
+# allocations within slab don't take any lock.
+# 
+def bgfx_encoder_alloc_transient_vertex_buffer(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _tvb: Optional[Union[TransientVertexBuffer, _Pointer[TransientVertexBuffer], ctypes.Array]], _num: int, _layoutHandle: VertexLayoutHandle, /) -> None: ...
+
+# Allocate instance data buffer from encoder's slab of frame's transient
+# vertex buffer. Slabs are reserved with single atomic operation, and
+# allocations within slab don't take any lock.
+# 
+def bgfx_encoder_alloc_instance_data_buffer(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _idb: Optional[Union[InstanceDataBuffer, _Pointer[InstanceDataBuffer], ctypes.Array]], _num: int, _stride: int, /) -> None: ...
+
 # Set shader uniform parameter for draw primitive.
 def bgfx_encoder_set_uniform(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _handle: UniformHandle, _value: Any, _num: int, /) -> None: ...
 
@@ -2850,6 +3008,34 @@ def bgfx_encoder_blit(
 	/,
 ) -> None: ...
 
+# Start recording draw list. All following submits on this encoder are
+# captured into draw list instead of being submitted to the frame, until
+# `bgfx::Encoder::endDrawList` is called.
+# 
+# @remarks
+#   Recording must begin and end within the same frame. Draw calls using transient
+#   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+#   occlusion queries, are dropped.
+# 
+def bgfx_encoder_begin_draw_list(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], /) -> None: ...
+
+# End recording draw list.
+# 
+# @remarks
+#   Draw list holds reference to programs, textures, uniforms, index, vertex and
+#   indirect buffers it uses. They can be destroyed while draw list is alive,
+#   but they are released only after draw list is destroyed.
+# 
+def bgfx_encoder_end_draw_list(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], /) -> DrawListHandle: ...
+
+# Submit previously recorded draw list for rendering. Draw state, bindings,
+# uniforms and sort keys captured during recording are replayed into view.
+# 
+# @remarks
+#   Encoder state set before this call is not used, and it's not cleared.
+# 
+def bgfx_encoder_submit_draw_list(_this: Optional[Union[Encoder, _Pointer[Encoder], ctypes.Array]], _id: int, _drawList: DrawListHandle, _mtx: Any, /) -> None: ...
+
 # Request screen shot of window back buffer.
 # 
 # @remarks
@@ -2858,6 +3044,32 @@ def bgfx_encoder_blit(
 # 
 def bgfx_request_screen_shot(_handle: FrameBufferHandle, _filePath: Optional[bytes], /) -> None: ...
 
+# Save recorded trace as Chrome trace-event JSON, which can be opened in Perfetto UI or
+# `chrome://tracing`. Trace contains most recent profiler scopes from all threads, and
+# per-view GPU timings.
+# 
+# @remarks
+#   Requires `BGFX_CONFIG_TRACE`. GPU timings require `BGFX_DEBUG_PROFILER` debug flag.
+# 
+def bgfx_save_trace(_filePath: Optional[bytes], /) -> bool: ...
+
+# Request capture of resources and sorted frame. Captured frame is written to file when frame
+# is rendered, and it can be replayed with `bgfx::replayFrameCapture`.
+# 
+# @remarks
+#   Requires `BGFX_CONFIG_CAPTURE`. Only resources created after `bgfx::init` are captured.
+# 
+def bgfx_request_frame_capture(_filePath: Optional[bytes], /) -> None: ...
+
+# Replay captured frame instead of submitted frame. Captured resources are created on next
+# frame, and captured frame is rendered every frame until replay is stopped.
+# 
+# @remarks
+#   Requires `BGFX_CONFIG_CAPTURE`. Capture must be done by bgfx built with the same
+#   configuration, and shaders must be compatible with current renderer.
+# 
+def bgfx_replay_frame_capture(_filePath: Optional[bytes], /) -> bool: ...
+
 # Render frame. Executes the actual GPU rendering work for one frame.
 # 
 # In the default **multithreaded** configuration, `bgfx::renderFrame` runs
@@ -2948,6 +3160,19 @@ def bgfx_override_internal_texture(
 # graphics debugging tools.
 def bgfx_set_marker(_name: Optional[bytes], _len: int, /) -> None: ...
 
+# Begin GPU timing region. Draw and compute calls submitted until matching
+# `profilerEndGpu` are attributed to region, and region is timed from first to
+# last of them in sorted order. Regions can be nested.
+# 
+# @remarks
+#   Results are returned few frames later through `Stats::gpuRegionStats`.
+#   Supported by OpenGL and Vulkan renderers.
+# 
+def bgfx_profiler_begin_gpu(_name: Optional[bytes], _len: int, /) -> None: ...
+
+# End GPU timing region.
+def bgfx_profiler_end_gpu() -> None: ...
+
 # Set render states for draw primitive.
 # 
 # @remarks
@@ -2963,8 +3188,16 @@ def bgfx_set_marker(_name: Optional[bytes], _len: int, /) -> None: ...
 # 
 def bgfx_set_state(_state: int, _rgba: int, /) -> None: ...
 
-# Set condition for rendering.
-def bgfx_set_condition(_handle: OcclusionQueryHandle, _visible: bool, /) -> None: ...
+# Set condition for rendering. Condition applies to next draw call or compute
+# dispatch.
+# 
+# @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+#   draw call is predicated on GPU with result of query issued in earlier view
+#   of the same frame. Otherwise last query result available on CPU is used.
+#   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+#   conditional rendering doesn't apply to compute.
+# 
+def bgfx_set_condition(_handle: OcclusionQueryHandle, _visible: bool, _current: bool, /) -> None: ...
 
 # Set stencil test state.
 def bgfx_set_stencil(_fstencil: int, _bstencil: int, /) -> None: ...
@@ -2990,6 +3223,12 @@ def bgfx_set_transform(_mtx: Any, _num: int, /) -> int: ...
 #  Set model matrix from matrix cache for draw primitive.
 def bgfx_set_transform_cached(_cache: int, _num: int, /) -> None: ...
 
+# Set persistent transform index for draw primitive. Persistent transform
+# buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+# available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+# 
+def bgfx_set_persistent_transform(_index: int, /) -> None: ...
+
 # Reserve matrices in internal matrix cache.
 # 
 # @attention Pointer returned can be modified until `bgfx::frame` is called.
@@ -3192,3 +3431,34 @@ def bgfx_blit(
 	_depth: int,
 	/,
 ) -> None: ...
+
+# Start recording draw list. All following submits are captured
+# into draw list instead of being submitted to the frame, until
+# `bgfx::endDrawList` is called.
+# 
+# @remarks
+#   Recording must begin and end within the same frame. Draw calls using transient
+#   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+#   occlusion queries, are dropped.
+# 
+def bgfx_begin_draw_list() -> None: ...
+
+# End recording draw list.
+# 
+# @remarks
+#   Draw list holds reference to programs, textures, uniforms, index, vertex and
+#   indirect buffers it uses. They can be destroyed while draw list is alive,
+#   but they are released only after draw list is destroyed.
+# 
+def bgfx_end_draw_list() -> DrawListHandle: ...
+
+# Submit previously recorded draw list for rendering. Draw state, bindings,
+# uniforms and sort keys captured during recording are replayed into view.
+# 
+# @remarks
+#   Encoder state set before this call is not used, and it's not cleared.
+# 
+def bgfx_submit_draw_list(_id: int, _drawList: DrawListHandle, _mtx: Any, /) -> None: ...
+
+# Destroy draw list, and release resources referenced by it.
+def bgfx_destroy_draw_list(_handle: DrawListHandle, /) -> None: ...
@@ -737,6 +737,9 @@ pub const CapsFlags_VideoDecode: CapsFlags            = 0x0000000200000000;
 /// Viewport layer is available in vertex shader.
 pub const CapsFlags_ViewportLayerArray: CapsFlags     = 0x0000000400000000;
 
+/// GPU-side conditional rendering is supported.
+pub const CapsFlags_ConditionalRender: CapsFlags      = 0x0000000800000000;
+
 /// All texture compare modes are supported.
 pub const CapsFlags_TextureCompareAll: CapsFlags      = 0x0000000000180000;
 
@@ -1646,6 +1649,7 @@ pub const Caps = extern struct {
         maxTransientVbSize: u32,
         maxTransientIbSize: u32,
         minUniformBufferSize: u32,
+        maxPersistentTransforms: u32,
     };
 
         rendererType: RendererType,
@@ -1696,6 +1700,9 @@ pub const Init = extern struct {
         maxTransientVbSize: u32,
         maxTransientIbSize: u32,
         minUniformBufferSize: u32,
+        dynamicIndexBufferSize: u32,
+        dynamicVertexBufferSize: u32,
+        maxPersistentTransforms: u32,
     };
 
         type: RendererType,
@@ -1819,9 +1826,20 @@ pub const Init = extern struct {
         gpuFrameNum: u32,
     };
 
+    pub const GpuRegionStats = extern struct {
+        name: [64]u8,
+        gpuTimeBegin: i64,
+        gpuTimeEnd: i64,
+        gpuFrameNum: u32,
+    };
+
     pub const EncoderStats = extern struct {
         cpuTimeBegin: i64,
         cpuTimeEnd: i64,
+        transientReserveTime: i64,
+        numTransientAllocs: u32,
+        numTransientSlabs: u32,
+        numTransientContended: u32,
     };
 
     pub const Stats = extern struct {
@@ -1840,12 +1858,16 @@ pub const Init = extern struct {
         numDrawCallsPeak: u32,
         maxGpuLatency: u32,
         gpuFrameNum: u32,
+        numVertexArrayBinds: u32,
+        numVertexAttribCalls: u32,
+        uniformBytesSkipped: u32,
         numDynamicIndexBuffers: u16,
         numDynamicVertexBuffers: u16,
         numFrameBuffers: u16,
         numIndexBuffers: u16,
         numOcclusionQueries: u16,
         numPrograms: u16,
+        numProgramsPending: u16,
         numShaders: u16,
         numTextures: u16,
         numUniforms: u16,
@@ -1853,8 +1875,15 @@ pub const Init = extern struct {
         numVertexLayouts: u16,
         textureMemoryUsed: i64,
         rtMemoryUsed: i64,
+        textureMemoryResident: i64,
         transientVbUsed: i32,
         transientIbUsed: i32,
+        dynIbNumFreeBlocks: u32,
+        dynIbLargestFreeBlock: u32,
+        dynVbNumFreeBlocks: u32,
+        dynVbLargestFreeBlock: u32,
+        uniformNumFreeBlocks: u32,
+        uniformLargestFreeBlock: u32,
         numPrims: [5]u32,
         gpuMemoryMax: i64,
         gpuMemoryUsed: i64,
@@ -1864,6 +1893,8 @@ pub const Init = extern struct {
         textHeight: u16,
         numViews: u16,
         viewStats: [*c]ViewStats,
+        numGpuRegions: u16,
+        gpuRegionStats: [*c]GpuRegionStats,
         numEncoders: u8,
         encoderStats: [*c]EncoderStats,
     };
@@ -1918,6 +1949,23 @@ pub const Init = extern struct {
         pub inline fn setMarker(self: ?*Encoder, _name: [*c]const u8, _len: i32) void {
             return bgfx_encoder_set_marker(self, _name, _len);
         }
+        /// Begin GPU timing region. Draw and compute calls submitted until matching
+        /// `profilerEndGpu` are attributed to region, and region is timed from first to
+        /// last of them in sorted order. Regions can be nested.
+        /// 
+        /// @remarks
+        ///   Results are returned few frames later through `Stats::gpuRegionStats`.
+        ///   Supported by OpenGL and Vulkan renderers.
+        /// 
+        /// <param name="_name">Region name.</param>
+        /// <param name="_len">Region name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
+        pub inline fn profilerBeginGpu(self: ?*Encoder, _name: [*c]const u8, _len: i32) void {
+            return bgfx_encoder_profiler_begin_gpu(self, _name, _len);
+        }
+        /// End GPU timing region.
+        pub inline fn profilerEndGpu(self: ?*Encoder) void {
+            return bgfx_encoder_profiler_end_gpu(self);
+        }
         /// Set render states for draw primitive.
         /// 
         /// @remarks
@@ -1936,11 +1984,20 @@ pub const Init = extern struct {
         pub inline fn setState(self: ?*Encoder, _state: u64, _rgba: u32) void {
             return bgfx_encoder_set_state(self, _state, _rgba);
         }
-        /// Set condition for rendering.
+        /// Set condition for rendering. Condition applies to next draw call or compute
+        /// dispatch.
+        /// 
+        /// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+        ///   draw call is predicated on GPU with result of query issued in earlier view
+        ///   of the same frame. Otherwise last query result available on CPU is used.
+        ///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+        ///   conditional rendering doesn't apply to compute.
+        /// 
         /// <param name="_handle">Occlusion query handle.</param>
         /// <param name="_visible">Render if occlusion query is visible.</param>
-        pub inline fn setCondition(self: ?*Encoder, _handle: OcclusionQueryHandle, _visible: bool) void {
-            return bgfx_encoder_set_condition(self, _handle, _visible);
+        /// <param name="_current">Use query result from current frame.</param>
+        pub inline fn setCondition(self: ?*Encoder, _handle: OcclusionQueryHandle, _visible: bool, _current: bool) void {
+            return bgfx_encoder_set_condition(self, _handle, _visible, _current);
         }
         /// Set stencil test state.
         /// <param name="_fstencil">Front stencil state.</param>
@@ -1982,6 +2039,14 @@ pub const Init = extern struct {
         pub inline fn setTransformCached(self: ?*Encoder, _cache: u32, _num: u16) void {
             return bgfx_encoder_set_transform_cached(self, _cache, _num);
         }
+        /// Set persistent transform index for draw primitive. Persistent transform
+        /// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+        /// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+        /// 
+        /// <param name="_index">Index in persistent transform buffer.</param>
+        pub inline fn setPersistentTransform(self: ?*Encoder, _index: u32) void {
+            return bgfx_encoder_set_persistent_transform(self, _index);
+        }
         /// Reserve matrices in internal matrix cache.
         /// 
         /// @attention Pointer returned can be modified until `bgfx::frame` is called.
@@ -1991,6 +2056,36 @@ pub const Init = extern struct {
         pub inline fn allocTransform(self: ?*Encoder, _transform: [*c]Transform, _num: u16) u32 {
             return bgfx_encoder_alloc_transform(self, _transform, _num);
         }
+        /// Allocate transient index buffer from encoder's slab of frame's transient
+        /// index buffer. Slabs are reserved with single atomic operation, and
+        /// allocations within slab don't take any lock.
+        /// 
+        /// <param name="_tib">TransientIndexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+        /// <param name="_num">Number of indices to allocate.</param>
+        /// <param name="_index32">Set to `true` if input indices will be 32-bit.</param>
+        pub inline fn allocTransientIndexBuffer(self: ?*Encoder, _tib: [*c]TransientIndexBuffer, _num: u32, _index32: bool) void {
+            return bgfx_encoder_alloc_transient_index_buffer(self, _tib, _num, _index32);
+        }
+        /// Allocate transient vertex buffer from encoder's slab of frame's transient
+        /// vertex buffer. Slabs are reserved with single atomic operation, and
+        /// allocations within slab don't take any lock.
+        /// 
+        /// <param name="_tvb">TransientVertexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+        /// <param name="_num">Number of vertices to allocate.</param>
+        /// <param name="_layoutHandle">Vertex layout, created with `createVertexLayout`.</param>
+        pub inline fn allocTransientVertexBuffer(self: ?*Encoder, _tvb: [*c]TransientVertexBuffer, _num: u32, _layoutHandle: VertexLayoutHandle) void {
+            return bgfx_encoder_alloc_transient_vertex_buffer(self, _tvb, _num, _layoutHandle);
+        }
+        /// Allocate instance data buffer from encoder's slab of frame's transient
+        /// vertex buffer. Slabs are reserved with single atomic operation, and
+        /// allocations within slab don't take any lock.
+        /// 
+        /// <param name="_idb">InstanceDataBuffer structure will be filled, and will be valid for duration of frame, and can be reused for multiple draw calls.</param>
+        /// <param name="_num">Number of instances.</param>
+        /// <param name="_stride">Instance stride. Must be multiple of 16.</param>
+        pub inline fn allocInstanceDataBuffer(self: ?*Encoder, _idb: [*c]InstanceDataBuffer, _num: u32, _stride: u16) void {
+            return bgfx_encoder_alloc_instance_data_buffer(self, _idb, _num, _stride);
+        }
         /// Set shader uniform parameter for draw primitive.
         /// <param name="_handle">Uniform.</param>
         /// <param name="_value">Pointer to uniform data.</param>
@@ -2294,8 +2389,46 @@ pub const Init = extern struct {
         pub inline fn blit(self: ?*Encoder, _id: ViewId, _dst: TextureHandle, _dstMip: u8, _dstX: u16, _dstY: u16, _dstZ: u16, _src: TextureHandle, _srcMip: u8, _srcX: u16, _srcY: u16, _srcZ: u16, _width: u16, _height: u16, _depth: u16) void {
             return bgfx_encoder_blit(self, _id, _dst, _dstMip, _dstX, _dstY, _dstZ, _src, _srcMip, _srcX, _srcY, _srcZ, _width, _height, _depth);
         }
+        /// Start recording draw list. All following submits on this encoder are
+        /// captured into draw list instead of being submitted to the frame, until
+        /// `bgfx::Encoder::endDrawList` is called.
+        /// 
+        /// @remarks
+        ///   Recording must begin and end within the same frame. Draw calls using transient
+        ///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+        ///   occlusion queries, are dropped.
+        /// 
+        pub inline fn beginDrawList(self: ?*Encoder) void {
+            return bgfx_encoder_begin_draw_list(self);
+        }
+        /// End recording draw list.
+        /// 
+        /// @remarks
+        ///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+        ///   indirect buffers it uses. They can be destroyed while draw list is alive,
+        ///   but they are released only after draw list is destroyed.
+        /// 
+        pub inline fn endDrawList(self: ?*Encoder) DrawListHandle {
+            return bgfx_encoder_end_draw_list(self);
+        }
+        /// Submit previously recorded draw list for rendering. Draw state, bindings,
+        /// uniforms and sort keys captured during recording are replayed into view.
+        /// 
+        /// @remarks
+        ///   Encoder state set before this call is not used, and it's not cleared.
+        /// 
+        /// <param name="_id">View id.</param>
+        /// <param name="_drawList">Draw list.</param>
+        /// <param name="_mtx">Base transform applied to all recorded transforms. It can be `NULL` if recorded transforms are used as is.</param>
+        pub inline fn submitDrawList(self: ?*Encoder, _id: ViewId, _drawList: DrawListHandle, _mtx: ?*const anyopaque) void {
+            return bgfx_encoder_submit_draw_list(self, _id, _drawList, _mtx);
+        }
     };
 
+pub const DrawListHandle = extern struct {
+    idx: c_ushort,
+};
+
 pub const DynamicIndexBufferHandle = extern struct {
     idx: c_ushort,
 };
@@ -2759,6 +2892,35 @@ pub inline fn destroyDynamicVertexBuffer(_handle: DynamicVertexBufferHandle) voi
 }
 extern fn bgfx_destroy_dynamic_vertex_buffer(_handle: DynamicVertexBufferHandle) void;
 
+/// Allocate matrices in persistent transform buffer. Matrices keep their
+/// index and value across frames until freed, and only matrices modified
+/// with `bgfx::updatePersistentTransform` are uploaded on `bgfx::frame`.
+/// 
+/// @remarks Requires `BGFX_CAPS_COMPUTE`, and `Init::Limits::maxPersistentTransforms`
+///   to be non-zero.
+/// 
+/// <param name="_num">Number of matrices.</param>
+pub inline fn allocPersistentTransform(_num: u16) u32 {
+    return bgfx_alloc_persistent_transform(_num);
+}
+extern fn bgfx_alloc_persistent_transform(_num: u16) u32;
+
+/// Free matrices allocated with `bgfx::allocPersistentTransform`.
+/// <param name="_index">Index of first matrix returned by `bgfx::allocPersistentTransform`.</param>
+pub inline fn freePersistentTransform(_index: u32) void {
+    return bgfx_free_persistent_transform(_index);
+}
+extern fn bgfx_free_persistent_transform(_index: u32) void;
+
+/// Update matrices in persistent transform buffer.
+/// <param name="_index">Index of first matrix.</param>
+/// <param name="_mtx">Pointer to first matrix in array.</param>
+/// <param name="_num">Number of matrices in array.</param>
+pub inline fn updatePersistentTransform(_index: u32, _mtx: ?*const anyopaque, _num: u16) void {
+    return bgfx_update_persistent_transform(_index, _mtx, _num);
+}
+extern fn bgfx_update_persistent_transform(_index: u32, _mtx: ?*const anyopaque, _num: u16) void;
+
 /// Returns number of requested or maximum available indices.
 /// <param name="_num">Number of required indices.</param>
 /// <param name="_index32">Set to `true` if input indices will be 32-bit.</param>
@@ -2908,6 +3070,30 @@ pub inline fn destroyProgram(_handle: ProgramHandle) void {
 }
 extern fn bgfx_destroy_program(_handle: ProgramHandle) void;
 
+/// Set instanced variant of program used for automatic instancing.
+/// 
+/// Consecutive draw calls (after sorting) in the same view that use `handle`
+/// and differ only in transform are merged into single instanced draw call
+/// with `instanced` program. Per-instance model matrix is passed as instance
+/// data `i_data0` to `i_data3`.
+/// 
+/// Instanced vertex shader is compiled from the same source with
+/// `shaderc --instanced`, which reads `u_model`, `u_modelView`, and
+/// `u_modelViewProj` from instance data instead of uniforms.
+/// 
+/// @remarks Draw calls with multiple transforms, instance data, indirect
+///   buffer, occlusion query, or uniforms set between them are not merged.
+/// 
+/// @attention `instanced` program is kept alive until variant is changed,
+///   or `handle` is destroyed. Pass invalid handle to disable.
+/// 
+/// <param name="_handle">Program handle.</param>
+/// <param name="_instanced">Instanced program variant, vertex shader reads model matrix from `i_data0` to `i_data3`.</param>
+pub inline fn setInstancedProgram(_handle: ProgramHandle, _instanced: ProgramHandle) void {
+    return bgfx_set_instanced_program(_handle, _instanced);
+}
+extern fn bgfx_set_instanced_program(_handle: ProgramHandle, _instanced: ProgramHandle) void;
+
 /// Validate texture parameters.
 /// <param name="_depth">Depth dimension of volume texture.</param>
 /// <param name="_cubeMap">Indicates that texture contains cubemap.</param>
@@ -3103,6 +3289,23 @@ pub inline fn readTexture(_handle: TextureHandle, _data: ?*anyopaque, _layer: u1
 }
 extern fn bgfx_read_texture(_handle: TextureHandle, _data: ?*anyopaque, _layer: u16, _mip: u8) u32;
 
+/// Set most detailed mip level of texture that is resident. Mip levels above it are not
+/// sampled, and they are not counted in `Stats::textureMemoryResident`. Texture can be created
+/// with only tail mips uploaded, and more detailed mips streamed in later with
+/// `bgfx::updateTexture2D` before lowering min LOD.
+/// 
+/// @remarks Renderer still allocates storage for whole mip chain.
+/// @remarks Sampled texture binds start at min LOD, the same as if `firstMip` passed to
+///   `bgfx::setTexture` was raised to min LOD. Explicit LOD and texture size queries in
+///   shader are relative to min LOD. Image (storage) binds are not affected.
+/// 
+/// <param name="_handle">Texture handle.</param>
+/// <param name="_minLod">Most detailed resident mip level. Use 0 to make whole mip chain resident.</param>
+pub inline fn setTextureMinLod(_handle: TextureHandle, _minLod: u8) void {
+    return bgfx_set_texture_min_lod(_handle, _minLod);
+}
+extern fn bgfx_set_texture_min_lod(_handle: TextureHandle, _minLod: u8) void;
+
 /// Set texture debug name.
 /// <param name="_handle">Texture handle.</param>
 /// <param name="_name">Texture name.</param>
@@ -3546,6 +3749,21 @@ extern fn bgfx_encoder_end(_encoder: ?*Encoder) void;
 /// <param name="_len">Marker name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
 extern fn bgfx_encoder_set_marker(self: ?*Encoder, _name: [*c]const u8, _len: i32) void;
 
+/// Begin GPU timing region. Draw and compute calls submitted until matching
+/// `profilerEndGpu` are attributed to region, and region is timed from first to
+/// last of them in sorted order. Regions can be nested.
+/// 
+/// @remarks
+///   Results are returned few frames later through `Stats::gpuRegionStats`.
+///   Supported by OpenGL and Vulkan renderers.
+/// 
+/// <param name="_name">Region name.</param>
+/// <param name="_len">Region name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
+extern fn bgfx_encoder_profiler_begin_gpu(self: ?*Encoder, _name: [*c]const u8, _len: i32) void;
+
+/// End GPU timing region.
+extern fn bgfx_encoder_profiler_end_gpu(self: ?*Encoder) void;
+
 /// Set render states for draw primitive.
 /// 
 /// @remarks
@@ -3563,10 +3781,19 @@ extern fn bgfx_encoder_set_marker(self: ?*Encoder, _name: [*c]const u8, _len: i3
 /// <param name="_rgba">Sets blend factor used by `BGFX_STATE_BLEND_FACTOR` and   `BGFX_STATE_BLEND_INV_FACTOR` blend modes.</param>
 extern fn bgfx_encoder_set_state(self: ?*Encoder, _state: u64, _rgba: u32) void;
 
-/// Set condition for rendering.
+/// Set condition for rendering. Condition applies to next draw call or compute
+/// dispatch.
+/// 
+/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+///   draw call is predicated on GPU with result of query issued in earlier view
+///   of the same frame. Otherwise last query result available on CPU is used.
+///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+///   conditional rendering doesn't apply to compute.
+/// 
 /// <param name="_handle">Occlusion query handle.</param>
 /// <param name="_visible">Render if occlusion query is visible.</param>
-extern fn bgfx_encoder_set_condition(self: ?*Encoder, _handle: OcclusionQueryHandle, _visible: bool) void;
+/// <param name="_current">Use query result from current frame.</param>
+extern fn bgfx_encoder_set_condition(self: ?*Encoder, _handle: OcclusionQueryHandle, _visible: bool, _current: bool) void;
 
 /// Set stencil test state.
 /// <param name="_fstencil">Front stencil state.</param>
@@ -3603,6 +3830,13 @@ extern fn bgfx_encoder_set_transform(self: ?*Encoder, _mtx: ?*const anyopaque, _
 /// <param name="_num">Number of matrices from cache.</param>
 extern fn bgfx_encoder_set_transform_cached(self: ?*Encoder, _cache: u32, _num: u16) void;
 
+/// Set persistent transform index for draw primitive. Persistent transform
+/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+/// 
+/// <param name="_index">Index in persistent transform buffer.</param>
+extern fn bgfx_encoder_set_persistent_transform(self: ?*Encoder, _index: u32) void;
+
 /// Reserve matrices in internal matrix cache.
 /// 
 /// @attention Pointer returned can be modified until `bgfx::frame` is called.
@@ -3611,6 +3845,33 @@ extern fn bgfx_encoder_set_transform_cached(self: ?*Encoder, _cache: u32, _num:
 /// <param name="_num">Number of matrices.</param>
 extern fn bgfx_encoder_alloc_transform(self: ?*Encoder, _transform: [*c]Transform, _num: u16) u32;
 
+/// Allocate transient index buffer from encoder's slab of frame's transient
+/// index buffer. Slabs are reserved with single atomic operation, and
+/// allocations within slab don't take any lock.
+/// 
+/// <param name="_tib">TransientIndexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+/// <param name="_num">Number of indices to allocate.</param>
+/// <param name="_index32">Set to `true` if input indices will be 32-bit.</param>
+extern fn bgfx_encoder_alloc_transient_index_buffer(self: ?*Encoder, _tib: [*c]TransientIndexBuffer, _num: u32, _index32: bool) void;
+
+/// Allocate transient vertex buffer from encoder's slab of frame's transient
+/// vertex buffer. Slabs are reserved with single atomic operation, and
+/// allocations within slab don't take any lock.
+/// 
+/// <param name="_tvb">TransientVertexBuffer structure will be filled, and will be valid for the duration of frame, and can be reused for multiple draw calls.</param>
+/// <param name="_num">Number of vertices to allocate.</param>
+/// <param name="_layoutHandle">Vertex layout, created with `createVertexLayout`.</param>
+extern fn bgfx_encoder_alloc_transient_vertex_buffer(self: ?*Encoder, _tvb: [*c]TransientVertexBuffer, _num: u32, _layoutHandle: VertexLayoutHandle) void;
+
+/// Allocate instance data buffer from encoder's slab of frame's transient
+/// vertex buffer. Slabs are reserved with single atomic operation, and
+/// allocations within slab don't take any lock.
+/// 
+/// <param name="_idb">InstanceDataBuffer structure will be filled, and will be valid for duration of frame, and can be reused for multiple draw calls.</param>
+/// <param name="_num">Number of instances.</param>
+/// <param name="_stride">Instance stride. Must be multiple of 16.</param>
+extern fn bgfx_encoder_alloc_instance_data_buffer(self: ?*Encoder, _idb: [*c]InstanceDataBuffer, _num: u32, _stride: u16) void;
+
 /// Set shader uniform parameter for draw primitive.
 /// <param name="_handle">Uniform.</param>
 /// <param name="_value">Pointer to uniform data.</param>
@@ -3906,6 +4167,37 @@ extern fn bgfx_encoder_discard(self: ?*Encoder, _flags: u8) void;
 /// <param name="_depth">If texture is 3D this argument represents depth of region, otherwise it's unused.</param>
 extern fn bgfx_encoder_blit(self: ?*Encoder, _id: ViewId, _dst: TextureHandle, _dstMip: u8, _dstX: u16, _dstY: u16, _dstZ: u16, _src: TextureHandle, _srcMip: u8, _srcX: u16, _srcY: u16, _srcZ: u16, _width: u16, _height: u16, _depth: u16) void;
 
+/// Start recording draw list. All following submits on this encoder are
+/// captured into draw list instead of being submitted to the frame, until
+/// `bgfx::Encoder::endDrawList` is called.
+/// 
+/// @remarks
+///   Recording must begin and end within the same frame. Draw calls using transient
+///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+///   occlusion queries, are dropped.
+/// 
+extern fn bgfx_encoder_begin_draw_list(self: ?*Encoder) void;
+
+/// End recording draw list.
+/// 
+/// @remarks
+///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+///   indirect buffers it uses. They can be destroyed while draw list is alive,
+///   but they are released only after draw list is destroyed.
+/// 
+extern fn bgfx_encoder_end_draw_list(self: ?*Encoder) DrawListHandle;
+
+/// Submit previously recorded draw list for rendering. Draw state, bindings,
+/// uniforms and sort keys captured during recording are replayed into view.
+/// 
+/// @remarks
+///   Encoder state set before this call is not used, and it's not cleared.
+/// 
+/// <param name="_id">View id.</param>
+/// <param name="_drawList">Draw list.</param>
+/// <param name="_mtx">Base transform applied to all recorded transforms. It can be `NULL` if recorded transforms are used as is.</param>
+extern fn bgfx_encoder_submit_draw_list(self: ?*Encoder, _id: ViewId, _drawList: DrawListHandle, _mtx: ?*const anyopaque) void;
+
 /// Request screen shot of window back buffer.
 /// 
 /// @remarks
@@ -3919,6 +4211,44 @@ pub inline fn requestScreenShot(_handle: FrameBufferHandle, _filePath: [*c]const
 }
 extern fn bgfx_request_screen_shot(_handle: FrameBufferHandle, _filePath: [*c]const u8) void;
 
+/// Save recorded trace as Chrome trace-event JSON, which can be opened in Perfetto UI or
+/// `chrome://tracing`. Trace contains most recent profiler scopes from all threads, and
+/// per-view GPU timings.
+/// 
+/// @remarks
+///   Requires `BGFX_CONFIG_TRACE`. GPU timings require `BGFX_DEBUG_PROFILER` debug flag.
+/// 
+/// <param name="_filePath">Output file path.</param>
+pub inline fn saveTrace(_filePath: [*c]const u8) bool {
+    return bgfx_save_trace(_filePath);
+}
+extern fn bgfx_save_trace(_filePath: [*c]const u8) bool;
+
+/// Request capture of resources and sorted frame. Captured frame is written to file when frame
+/// is rendered, and it can be replayed with `bgfx::replayFrameCapture`.
+/// 
+/// @remarks
+///   Requires `BGFX_CONFIG_CAPTURE`. Only resources created after `bgfx::init` are captured.
+/// 
+/// <param name="_filePath">Output file path.</param>
+pub inline fn requestFrameCapture(_filePath: [*c]const u8) void {
+    return bgfx_request_frame_capture(_filePath);
+}
+extern fn bgfx_request_frame_capture(_filePath: [*c]const u8) void;
+
+/// Replay captured frame instead of submitted frame. Captured resources are created on next
+/// frame, and captured frame is rendered every frame until replay is stopped.
+/// 
+/// @remarks
+///   Requires `BGFX_CONFIG_CAPTURE`. Capture must be done by bgfx built with the same
+///   configuration, and shaders must be compatible with current renderer.
+/// 
+/// <param name="_filePath">Frame capture file path. Pass `NULL` to stop replay.</param>
+pub inline fn replayFrameCapture(_filePath: [*c]const u8) bool {
+    return bgfx_replay_frame_capture(_filePath);
+}
+extern fn bgfx_replay_frame_capture(_filePath: [*c]const u8) bool;
+
 /// Render frame. Executes the actual GPU rendering work for one frame.
 /// 
 /// In the default **multithreaded** configuration, `bgfx::renderFrame` runs
@@ -4032,6 +4362,27 @@ pub inline fn setMarker(_name: [*c]const u8, _len: i32) void {
 }
 extern fn bgfx_set_marker(_name: [*c]const u8, _len: i32) void;
 
+/// Begin GPU timing region. Draw and compute calls submitted until matching
+/// `profilerEndGpu` are attributed to region, and region is timed from first to
+/// last of them in sorted order. Regions can be nested.
+/// 
+/// @remarks
+///   Results are returned few frames later through `Stats::gpuRegionStats`.
+///   Supported by OpenGL and Vulkan renderers.
+/// 
+/// <param name="_name">Region name.</param>
+/// <param name="_len">Region name length (if length is INT32_MAX, it's expected that _name is zero terminated string.</param>
+pub inline fn profilerBeginGpu(_name: [*c]const u8, _len: i32) void {
+    return bgfx_profiler_begin_gpu(_name, _len);
+}
+extern fn bgfx_profiler_begin_gpu(_name: [*c]const u8, _len: i32) void;
+
+/// End GPU timing region.
+pub inline fn profilerEndGpu() void {
+    return bgfx_profiler_end_gpu();
+}
+extern fn bgfx_profiler_end_gpu() void;
+
 /// Set render states for draw primitive.
 /// 
 /// @remarks
@@ -4052,13 +4403,22 @@ pub inline fn setState(_state: u64, _rgba: u32) void {
 }
 extern fn bgfx_set_state(_state: u64, _rgba: u32) void;
 
-/// Set condition for rendering.
+/// Set condition for rendering. Condition applies to next draw call or compute
+/// dispatch.
+/// 
+/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+///   draw call is predicated on GPU with result of query issued in earlier view
+///   of the same frame. Otherwise last query result available on CPU is used.
+///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+///   conditional rendering doesn't apply to compute.
+/// 
 /// <param name="_handle">Occlusion query handle.</param>
 /// <param name="_visible">Render if occlusion query is visible.</param>
-pub inline fn setCondition(_handle: OcclusionQueryHandle, _visible: bool) void {
-    return bgfx_set_condition(_handle, _visible);
+/// <param name="_current">Use query result from current frame.</param>
+pub inline fn setCondition(_handle: OcclusionQueryHandle, _visible: bool, _current: bool) void {
+    return bgfx_set_condition(_handle, _visible, _current);
 }
-extern fn bgfx_set_condition(_handle: OcclusionQueryHandle, _visible: bool) void;
+extern fn bgfx_set_condition(_handle: OcclusionQueryHandle, _visible: bool, _current: bool) void;
 
 /// Set stencil test state.
 /// <param name="_fstencil">Front stencil state.</param>
@@ -4110,6 +4470,16 @@ pub inline fn setTransformCached(_cache: u32, _num: u16) void {
 }
 extern fn bgfx_set_transform_cached(_cache: u32, _num: u16) void;
 
+/// Set persistent transform index for draw primitive. Persistent transform
+/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+/// 
+/// <param name="_index">Index in persistent transform buffer.</param>
+pub inline fn setPersistentTransform(_index: u32) void {
+    return bgfx_set_persistent_transform(_index);
+}
+extern fn bgfx_set_persistent_transform(_index: u32) void;
+
 /// Reserve matrices in internal matrix cache.
 /// 
 /// @attention Pointer returned can be modified until `bgfx::frame` is called.
@@ -4488,4 +4858,51 @@ pub inline fn blit(_id: ViewId, _dst: TextureHandle, _dstMip: u8, _dstX: u16, _d
 }
 extern fn bgfx_blit(_id: ViewId, _dst: TextureHandle, _dstMip: u8, _dstX: u16, _dstY: u16, _dstZ: u16, _src: TextureHandle, _srcMip: u8, _srcX: u16, _srcY: u16, _srcZ: u16, _width: u16, _height: u16, _depth: u16) void;
 
+/// Start recording draw list. All following submits are captured
+/// into draw list instead of being submitted to the frame, until
+/// `bgfx::endDrawList` is called.
+/// 
+/// @remarks
+///   Recording must begin and end within the same frame. Draw calls using transient
+///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+///   occlusion queries, are dropped.
+/// 
+pub inline fn beginDrawList() void {
+    return bgfx_begin_draw_list();
+}
+extern fn bgfx_begin_draw_list() void;
+
+/// End recording draw list.
+/// 
+/// @remarks
+///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+///   indirect buffers it uses. They can be destroyed while draw list is alive,
+///   but they are released only after draw list is destroyed.
+/// 
+pub inline fn endDrawList() DrawListHandle {
+    return bgfx_end_draw_list();
+}
+extern fn bgfx_end_draw_list() DrawListHandle;
+
+/// Submit previously recorded draw list for rendering. Draw state, bindings,
+/// uniforms and sort keys captured during recording are replayed into view.
+/// 
+/// @remarks
+///   Encoder state set before this call is not used, and it's not cleared.
+/// 
+/// <param name="_id">View id.</param>
+/// <param name="_drawList">Draw list.</param>
+/// <param name="_mtx">Base transform applied to all recorded transforms. It can be `NULL` if recorded transforms are used as is.</param>
+pub inline fn submitDrawList(_id: ViewId, _drawList: DrawListHandle, _mtx: ?*const anyopaque) void {
+    return bgfx_submit_draw_list(_id, _drawList, _mtx);
+}
+extern fn bgfx_submit_draw_list(_id: ViewId, _drawList: DrawListHandle, _mtx: ?*const anyopaque) void;
+
+/// Destroy draw list, and release resources referenced by it.
+/// <param name="_handle">Handle to draw list object.</param>
+pub inline fn destroyDrawList(_handle: DrawListHandle) void {
+    return bgfx_destroy_draw_list(_handle);
+}
+extern fn bgfx_destroy_draw_list(_handle: DrawListHandle) void;
+
 
@@ -239,6 +239,24 @@ public:
 				m_textBufferManager->appendText(m_scrollableBuffer, m_fontScaled, m_textBegin, m_textEnd);
 			}
 
+			// Previous frame, text is uploaded as transient vertices every frame.
+			const bgfx::Stats* stats = bgfx::getStats();
+			const double toGpuMs = 1000.0/double(stats->gpuTimerFreq);
+
+			ImGui::Separator();
+
+			for (uint16_t ii = 0; ii < stats->numViews; ++ii)
+			{
+				const bgfx::ViewStats& viewStats = stats->viewStats[ii];
+
+				if (0 == viewStats.view)
+				{
+					ImGui::Text("Text GPU: %0.3f [ms]", double(viewStats.gpuTimeEnd - viewStats.gpuTimeBegin)*toGpuMs);
+				}
+			}
+
+			ImGui::Text("Transient VB: %d, IB: %d [bytes]", stats->transientVbUsed, stats->transientIbUsed);
+
 			ImGui::End();
 
 			imguiEndFrame();
@@ -1467,6 +1467,37 @@ public:
 
 			showExampleDialog(this);
 
+			ImGui::SetNextWindowPos(
+				  ImVec2(m_width - m_width / 5.0f - 10.0f, 10.0f)
+				, ImGuiCond_FirstUseEver
+				);
+			ImGui::SetNextWindowSize(
+				  ImVec2(m_width / 5.0f, m_height / 8.0f)
+				, ImGuiCond_FirstUseEver
+				);
+			ImGui::Begin("Stats"
+				, NULL
+				, 0
+				);
+
+			// Previous frame, nanovg renders into view 0, and ImGui into its own view.
+			const bgfx::Stats* stats = bgfx::getStats();
+			const double toGpuMs = 1000.0/double(stats->gpuTimerFreq);
+
+			for (uint16_t ii = 0; ii < stats->numViews; ++ii)
+			{
+				const bgfx::ViewStats& viewStats = stats->viewStats[ii];
+
+				if (0 == viewStats.view)
+				{
+					ImGui::Text("nanovg GPU: %0.3f [ms]", double(viewStats.gpuTimeEnd - viewStats.gpuTimeBegin)*toGpuMs);
+				}
+			}
+
+			ImGui::Text("Draw calls (all views): %d", stats->numDraw);
+
+			ImGui::End();
+
 			imguiEndFrame();
 
 			// Set view 0 default viewport.
@@ -13,15 +13,14 @@
 
 #include "common.h"
 #include "bgfx_utils.h"
+#include "gpudriven.h"
 #include "imgui/imgui.h"
 
 namespace
 {
 
 #define RENDER_PASS_HIZ_ID            0
-#define RENDER_PASS_HIZ_DOWNSCALE_ID  1
-#define RENDER_PASS_OCCLUDE_PROPS_ID  2
-#define RENDER_PASS_COMPACT_STREAM_ID 3
+#define RENDER_PASS_HIZ_DOWNSCALE_ID  1 // GpuDriven::cull uses views 1-3.
 #define RENDER_PASS_MAIN_ID           4
 
 struct Camera
@@ -317,10 +316,8 @@ public:
 
 		m_width  = _width;
 		m_height = _height;
-
-		//find largest pow of two dims less than backbuffer size
-		m_hiZwidth  = (uint32_t)bx::pow(2.0f, bx::floor(bx::log2(float(m_width ) ) ) );
-		m_hiZheight = (uint32_t)bx::pow(2.0f, bx::floor(bx::log2(float(m_height) ) ) );
+		m_oldWidth  = _width;
+		m_oldHeight = _height;
 
 		m_debug  = BGFX_DEBUG_TEXT;
 		m_reset  = BGFX_RESET_VSYNC;
@@ -340,10 +337,7 @@ public:
 		bgfx::setDebug(m_debug);
 
 		// Create uniforms and samplers.
-		u_inputRTSize       = bgfx::createUniform("u_inputRTSize",       bgfx::UniformType::Vec4);
-		u_cullingConfig     = bgfx::createUniform("u_cullingConfig",     bgfx::UniformType::Vec4);
-		u_color             = bgfx::createUniform("u_color",             bgfx::UniformType::Vec4, 32);
-		s_texOcclusionDepth = bgfx::createUniform("s_texOcclusionDepth", bgfx::UniformType::Sampler);
+		u_color = bgfx::createUniform("u_color", bgfx::UniformType::Vec4, 32);
 
 		//create props
 		{
@@ -503,124 +497,9 @@ public:
 
 		//Setup Occlusion pass
 		{
-			const uint64_t tsFlags = 0
-				| BGFX_TEXTURE_RT
-				| BGFX_SAMPLER_MIN_POINT
-				| BGFX_SAMPLER_MAG_POINT
-				| BGFX_SAMPLER_MIP_POINT
-				| BGFX_SAMPLER_U_CLAMP
-				| BGFX_SAMPLER_V_CLAMP
-				;
-
-			// Create buffers for the HiZ pass
-			m_hiZDepthBuffer = bgfx::createFrameBuffer(uint16_t(m_hiZwidth), uint16_t(m_hiZheight), bgfx::TextureFormat::D32F, tsFlags);
-
-			bgfx::TextureHandle buffer = bgfx::createTexture2D(uint16_t(m_hiZwidth), uint16_t(m_hiZheight), true, 1, bgfx::TextureFormat::R32F, BGFX_TEXTURE_COMPUTE_WRITE | tsFlags);
-			bgfx::Attachment at;
-			at.init(buffer, bgfx::Access::Write, 0, 1, 0, BGFX_RESOLVE_NONE);
-			m_hiZBuffer = bgfx::createFrameBuffer(1, &at, true);
-
-			//how many mip will the Hi Z buffer have?
-			m_noofHiZMips = (uint8_t)(1 + bx::floor(bx::log2(float(bx::max(m_hiZwidth, m_hiZheight) ) ) ) );
-
-			// Setup compute shader buffers
-
-			//The compute shader will write how many unoccluded instances per drawcall there are here
-			m_drawcallInstanceCounts = bgfx::createDynamicIndexBuffer(s_maxNoofProps, BGFX_BUFFER_INDEX32 | BGFX_BUFFER_COMPUTE_READ_WRITE);
-
-			//the compute shader will write the result of the occlusion test for each instance here
-			m_instancePredicates = bgfx::createDynamicIndexBuffer(s_maxNoofInstances, BGFX_BUFFER_COMPUTE_READ_WRITE);
-
-			//bounding box for each instance, will be fed to the compute shader to calculate occlusion
-			{
-				bgfx::VertexLayout computeVertexLayout;
-				computeVertexLayout.begin()
-					.add(bgfx::Attrib::TexCoord0, 4, bgfx::AttribType::Float)
-					.end();
-
-				//initialise the buffer with the bounding boxes of all instances
-				const int sizeOfBuffer = 2 * 4 * m_totalInstancesCount;
-				float* boundingBoxes = new float[sizeOfBuffer];
-
-				float* data = boundingBoxes;
-				for (uint16_t i = 0; i < m_noofProps; i++)
-				{
-					Prop& prop = m_props[i];
-
-					const uint32_t numInstances = prop.m_noofInstances;
-
-					for (uint32_t j = 0; j < numInstances; j++)
-					{
-						bx::memCopy(data, prop.m_instances[j].m_bboxMin, 3 * sizeof(float));
-						data[3] = (float)i; // store the drawcall ID here to avoid creating a separate buffer
-						data += 4;
-
-						bx::memCopy(data, prop.m_instances[j].m_bboxMax, 3 * sizeof(float));
-						data += 4;
-					}
-				}
-
-				const bgfx::Memory* mem = bgfx::makeRef(boundingBoxes, sizeof(float) * sizeOfBuffer);
-
-				m_instanceBoundingBoxes = bgfx::createDynamicVertexBuffer(mem, computeVertexLayout, BGFX_BUFFER_COMPUTE_READ);
-			}
-
-			//pre and post occlusion culling instance data buffers
-			{
-				bgfx::VertexLayout instanceBufferVertexLayout;
-				instanceBufferVertexLayout.begin()
-					.add(bgfx::Attrib::TexCoord0, 4, bgfx::AttribType::Float)
-					.add(bgfx::Attrib::TexCoord1, 4, bgfx::AttribType::Float)
-					.add(bgfx::Attrib::TexCoord2, 4, bgfx::AttribType::Float)
-					.add(bgfx::Attrib::TexCoord3, 4, bgfx::AttribType::Float)
-					.end();
-
-				//initialise the buffer with data for all instances
-				//Currently we only store a world matrix (16 floats)
-				const int sizeOfBuffer = 16 * m_totalInstancesCount;
-				float* instanceData = new float[sizeOfBuffer];
-
-				float* data = instanceData;
-				for (uint16_t ii = 0; ii < m_noofProps; ++ii)
-				{
-					Prop& prop = m_props[ii];
-
-					const uint32_t numInstances = prop.m_noofInstances;
-
-					for (uint32_t jj = 0; jj < numInstances; ++jj)
-					{
-						bx::memCopy(data, prop.m_instances[jj].m_world, 16 * sizeof(float) );
-						data[3] = float(ii); // store the drawcall ID here to avoid creating a separate buffer
-						data += 16;
-					}
-				}
-
-				const bgfx::Memory* mem = bgfx::makeRef(instanceData, sizeof(float) * sizeOfBuffer);
-
-				//pre occlusion buffer
-				m_instanceBuffer = bgfx::createVertexBuffer(mem, instanceBufferVertexLayout, BGFX_BUFFER_COMPUTE_READ);
-
-				//post occlusion buffer
-				m_culledInstanceBuffer = bgfx::createDynamicVertexBuffer(4 * m_totalInstancesCount, instanceBufferVertexLayout, BGFX_BUFFER_COMPUTE_WRITE);
-			}
-
-			//we use one "drawcall" per prop to render all its instances
-			m_indirectBuffer = bgfx::createIndirectBuffer(m_noofProps);
-
-			// Create programs from shaders for occlusion pass.
-			m_programOcclusionPass    = loadProgram("vs_gdr_render_occlusion", NULL);
-			m_programCopyZ            = loadProgram("cs_gdr_copy_z", NULL);
-			m_programDownscaleHiZ     = loadProgram("cs_gdr_downscale_hi_z", NULL);
-			m_programOccludeProps     = loadProgram("cs_gdr_occlude_props", NULL);
-			m_programStreamCompaction = loadProgram("cs_gdr_stream_compaction", NULL);
+			m_programOcclusionPass = loadProgram("vs_gdr_render_occlusion", NULL);
 
-			// Set view RENDER_PASS_HIZ_ID clear state.
-			bgfx::setViewClear(RENDER_PASS_HIZ_ID
-				, BGFX_CLEAR_DEPTH
-				, 0x0
-				, 1.0f
-				, 0
-			);
+			m_gpuDrivenSupported = m_gpuDriven.init(m_width, m_height, s_maxNoofInstances, s_maxNoofProps);
 		}
 
 		// Setup Main pass
@@ -653,7 +532,7 @@ public:
 		// CPU data to fill the master buffers
 		m_allPropVerticesDataCPU = new PosVertex[totalNoofVertices];
 		m_allPropIndicesDataCPU = new uint16_t[totalNoofIndices];
-		m_indirectBufferDataCPU = new uint32_t[m_noofProps * 3];
+		GpuDrivenDrawcall* drawcalls = new GpuDrivenDrawcall[m_noofProps];
 
 		// Copy data over to the master buffers
 		PosVertex* propVerticesData = m_allPropVerticesDataCPU;
@@ -672,9 +551,9 @@ public:
 			propVerticesData += prop.m_noofVertices;
 			propIndicesData += prop.m_noofIndices;
 
-			m_indirectBufferDataCPU[ i * 3 ] = prop.m_noofIndices;
-			m_indirectBufferDataCPU[ i * 3 + 1] = indexBufferOffset;
-			m_indirectBufferDataCPU[ i * 3 + 2] = vertexBufferOffset;
+			drawcalls[i].m_numIndices  = prop.m_noofIndices;
+			drawcalls[i].m_startIndex  = indexBufferOffset;
+			drawcalls[i].m_startVertex = vertexBufferOffset;
 
 			indexBufferOffset += prop.m_noofIndices;
 			vertexBufferOffset += prop.m_noofVertices;
@@ -691,14 +570,36 @@ public:
 					bgfx::makeRef(m_allPropIndicesDataCPU, totalNoofIndices * sizeof(uint16_t) )
 					);
 
-		// Create buffer with const drawcall data which will be copied to the indirect buffer later.
-		m_indirectBufferData = bgfx::createIndexBuffer(
-			bgfx::makeRef(m_indirectBufferDataCPU, m_noofProps * 3 * sizeof(uint32_t)),
-			BGFX_BUFFER_COMPUTE_READ | BGFX_BUFFER_INDEX32
-		);
+		// Upload drawcall and instance data for GPU culling.
+		if (m_gpuDrivenSupported)
+		{
+			m_gpuDriven.setDrawcalls(drawcalls, m_noofProps);
+
+			GpuDrivenInstance* instances = new GpuDrivenInstance[m_totalInstancesCount];
+			GpuDrivenInstance* instance  = instances;
+
+			for (uint16_t ii = 0; ii < m_noofProps; ++ii)
+			{
+				const Prop& prop = m_props[ii];
+
+				for (uint32_t jj = 0; jj < prop.m_noofInstances; ++jj)
+				{
+					bx::memCopy(instance->m_mtx, prop.m_instances[jj].m_world,   sizeof(instance->m_mtx) );
+					bx::memCopy(instance->m_min, prop.m_instances[jj].m_bboxMin, sizeof(instance->m_min) );
+					bx::memCopy(instance->m_max, prop.m_instances[jj].m_bboxMax, sizeof(instance->m_max) );
+					instance->m_drawcall = ii;
+					++instance;
+				}
+			}
+
+			m_gpuDriven.setInstances(instances, m_totalInstancesCount);
+
+			delete[] instances;
+		}
+
+		delete[] drawcalls;
 
 		m_useIndirect = true;
-		m_firstFrame = true;
 
 		imguiCreate();
 
@@ -713,10 +614,8 @@ public:
 
 		bgfx::destroy(m_programMainPass);
 		bgfx::destroy(m_programOcclusionPass);
-		bgfx::destroy(m_programCopyZ);
-		bgfx::destroy(m_programDownscaleHiZ);
-		bgfx::destroy(m_programOccludeProps);
-		bgfx::destroy(m_programStreamCompaction);
+
+		m_gpuDriven.shutdown();
 
 		for (uint16_t i = 0; i < m_noofProps; i++)
 		{
@@ -732,27 +631,13 @@ public:
 
 		delete[] m_props;
 
-		bgfx::destroy(m_hiZDepthBuffer);
-		bgfx::destroy(m_hiZBuffer);
-		bgfx::destroy(m_indirectBuffer);
-		bgfx::destroy(m_indirectBufferData);
-		bgfx::destroy(m_instanceBoundingBoxes);
-		bgfx::destroy(m_drawcallInstanceCounts);
-		bgfx::destroy(m_instancePredicates);
-		bgfx::destroy(m_instanceBuffer);
-		bgfx::destroy(m_culledInstanceBuffer);
-
 		bgfx::destroy(m_allPropsVertexbufferHandle);
 		bgfx::destroy(m_allPropsIndexbufferHandle);
 
-		bgfx::destroy(s_texOcclusionDepth);
-		bgfx::destroy(u_inputRTSize);
-		bgfx::destroy(u_cullingConfig);
 		bgfx::destroy(u_color);
 
 		delete[] m_allPropVerticesDataCPU;
 		delete[] m_allPropIndicesDataCPU;
-		delete[] m_indirectBufferDataCPU;
 
 		// Shutdown bgfx.
 		bgfx::shutdown();
@@ -763,13 +648,10 @@ public:
 	//renders the occluders to a depth buffer
 	void renderOcclusionBufferPass()
 	{
-		// Setup the occlusion pass projection
-		bx::mtxProj(m_occlusionProj, 60.0f, float(m_hiZwidth) / float(m_hiZheight), 0.1f, 500.0f, bgfx::getCaps()->homogeneousDepth);
-
-		bgfx::setViewTransform(RENDER_PASS_HIZ_ID, m_mainView, m_occlusionProj);
-
-		bgfx::setViewFrameBuffer(RENDER_PASS_HIZ_ID, m_hiZDepthBuffer);
-		bgfx::setViewRect(RENDER_PASS_HIZ_ID, 0, 0, uint16_t(m_hiZwidth), uint16_t(m_hiZheight));
+		// Occluders are rendered with main camera view and projection, so that
+		// Hi-Z texels map to main pass screen. GpuDriven::cull tests instance
+		// bounds against Hi-Z with the same transform.
+		const bgfx::ViewId viewId = m_gpuDriven.beginOcclusion(RENDER_PASS_HIZ_ID, m_mainView, m_mainProj);
 
 		const uint16_t instanceStride = sizeof(InstanceData);
 
@@ -809,100 +691,12 @@ public:
 					bgfx::setState(BGFX_STATE_DEFAULT);
 
 					// Submit primitive for rendering to view.
-					bgfx::submit(RENDER_PASS_HIZ_ID, m_programOcclusionPass);
+					bgfx::submit(viewId, m_programOcclusionPass);
 				}
 			}
 		}
 	}
 
-	// downscale the occluder depth buffer to create a mipmap chain
-	void renderDownscalePass()
-	{
-		uint32_t width = m_hiZwidth;
-		uint32_t height = m_hiZheight;
-
-		// copy mip zero over to the hi Z buffer.
-		// We can't currently use blit as it requires same format and CopyResource is not exposed.
-		{
-			float inputRendertargetSize[4] = { (float)width, (float)height, 0.0f, 0.0f };
-			bgfx::setUniform(u_inputRTSize, inputRendertargetSize);
-
-			bgfx::setTexture(0, s_texOcclusionDepth, getTexture(m_hiZDepthBuffer, 0));
-			bgfx::setImage(1, getTexture(m_hiZBuffer,      0), 0, bgfx::Access::Write);
-
-			bgfx::dispatch(RENDER_PASS_HIZ_DOWNSCALE_ID, m_programCopyZ, width/16, height/16);
-		}
-
-		for (uint8_t lod = 1; lod < m_noofHiZMips; ++lod)
-		{
-			float inputRendertargetSize[4] = { (float)width, (float)height, 2.0f, 2.0f };
-			bgfx::setUniform(u_inputRTSize, inputRendertargetSize);
-
-			// down scale mip 1 onwards
-			width /= 2;
-			height /= 2;
-
-			bgfx::setImage(0, getTexture(m_hiZBuffer, 0), lod - 1, bgfx::Access::Read);
-			bgfx::setImage(1, getTexture(m_hiZBuffer, 0), lod,     bgfx::Access::Write);
-
-			bgfx::dispatch(RENDER_PASS_HIZ_DOWNSCALE_ID, m_programDownscaleHiZ, width/16, height/16);
-		}
-	}
-
-	// perform the occlusion using the mip chain
-	void renderOccludePropsPass()
-	{
-		// run the computer shader to determine visibility of each instance
-		bgfx::setTexture(0, s_texOcclusionDepth, bgfx::getTexture(m_hiZBuffer, 0) );
-
-		bgfx::setBuffer(1, m_instanceBoundingBoxes,  bgfx::Access::Read);
-		bgfx::setBuffer(2, m_drawcallInstanceCounts, bgfx::Access::ReadWrite);
-		bgfx::setBuffer(3, m_instancePredicates,     bgfx::Access::Write);
-
-		float inputRendertargetSize[4] = { (float)m_hiZwidth, (float)m_hiZheight, 1.0f/ m_hiZwidth, 1.0f/ m_hiZheight };
-		bgfx::setUniform(u_inputRTSize, inputRendertargetSize);
-
-		// store a rounded-up, power of two instance count for the stream compaction step
-		float noofInstancesPowOf2 = bx::pow(2.0f, bx::floor(bx::log(m_totalInstancesCount) / bx::log(2.0f) ) + 1.0f);
-
-		float cullingConfig[4] =
-		{
-			(float)m_totalInstancesCount,
-			noofInstancesPowOf2,
-			(float)m_noofHiZMips,
-			(float)m_noofProps
-		};
-		bgfx::setUniform(u_cullingConfig, cullingConfig);
-
-		//set the view/projection transforms so that the compute shader can receive the viewProjection matrix automagically
-		bgfx::setViewTransform(RENDER_PASS_OCCLUDE_PROPS_ID, m_mainView, m_occlusionProj);
-
-		uint16_t groupX = bx::max<uint16_t>(m_totalInstancesCount / 64 + 1, 1);
-
-		bgfx::dispatch(RENDER_PASS_OCCLUDE_PROPS_ID, m_programOccludeProps, groupX, 1, 1);
-
-		// perform stream compaction to remove occluded instances
-
-		// the per drawcall data that is constant (noof indices/vertices and offsets to vertex/index buffers)
-	 	bgfx::setBuffer(0, m_indirectBufferData, bgfx::Access::Read);
-		// instance data for all instances (pre culling)
-		bgfx::setBuffer(1, m_instanceBuffer, bgfx::Access::Read);
-		// per instance visibility (output of culling pass)
-		bgfx::setBuffer(2, m_instancePredicates, bgfx::Access::Read);
-
-		// how many instances per drawcall
-		bgfx::setBuffer(3, m_drawcallInstanceCounts, bgfx::Access::ReadWrite);
-		// drawcall data that will drive drawIndirect
-		bgfx::setBuffer(4, m_indirectBuffer, bgfx::Access::ReadWrite);
-		// culled instance data
-		bgfx::setBuffer(5, m_culledInstanceBuffer, bgfx::Access::Write);
-
-		bgfx::setUniform(u_cullingConfig, cullingConfig);
-
-		bgfx::dispatch(RENDER_PASS_COMPACT_STREAM_ID, m_programStreamCompaction, 1, 1, 1);
-
-	}
-
 	// render the unoccluded props to the screen
 	void renderMainPass()
 	{
@@ -922,18 +716,15 @@ public:
 		// Set "material" data (currently a color only)
 		bgfx::setUniform(u_color, &m_materials[0].m_color, m_noofMaterials);
 
-		// We can't use indirect drawing for the first frame because the content of m_drawcallInstanceCounts
-		// is initially undefined.
-		if (m_useIndirect && !m_firstFrame)
+		if (m_useIndirect
+		&&  m_gpuDriven.isValid() )
 		{
 			// Set vertex and index buffer.
 			bgfx::setVertexBuffer(0, m_allPropsVertexbufferHandle);
 			bgfx::setIndexBuffer( m_allPropsIndexbufferHandle);
 
-			// Set instance data buffer.
-			bgfx::setInstanceDataBuffer(m_culledInstanceBuffer,  0,  m_totalInstancesCount );
-
-			bgfx::submit(RENDER_PASS_MAIN_ID, m_programMainPass, m_indirectBuffer, 0, m_noofProps);
+			// Submit all unoccluded instances with single indirect draw.
+			m_gpuDriven.submit(RENDER_PASS_MAIN_ID, m_programMainPass);
 		}
 		else
 		{
@@ -975,7 +766,6 @@ public:
 				}
 			}
 		}
-		m_firstFrame = false;
 	}
 
 	bool update() override
@@ -1041,17 +831,8 @@ public:
 
 			m_camera.update(deltaTime);
 
-			// Get renderer capabilities info.
-			const bgfx::Caps* caps = bgfx::getCaps();
-
 			// Check if instancing, compute and draw indirect are supported.
-			const uint64_t requiredCaps = 0
-				| BGFX_CAPS_INSTANCING
-				| BGFX_CAPS_COMPUTE
-				| BGFX_CAPS_DRAW_INDIRECT
-				;
-
-			if (requiredCaps != (requiredCaps & caps->supported) )
+			if (!m_gpuDrivenSupported)
 			{
 				// When instancing, compute or draw indirect is not supported by GPU,
 				// implement alternative code path that doesn't use them.
@@ -1060,6 +841,16 @@ public:
 			}
 			else
 			{
+				if (m_oldWidth  != m_width
+				||  m_oldHeight != m_height)
+				{
+					// Hi-Z buffers match backbuffer size.
+					m_oldWidth  = m_width;
+					m_oldHeight = m_height;
+
+					m_gpuDriven.resize(m_width, m_height);
+				}
+
 				// calculate main view and project matrices as they are typically reused between passes.
 				m_camera.mtxLookAt(m_mainView);
 				bx::mtxProj(m_mainProj, 60.0f, float(m_width) / float(m_height), 0.1f, 500.0f, bgfx::getCaps()->homogeneousDepth);
@@ -1067,9 +858,7 @@ public:
 				//submit drawcalls for all passes
 				renderOcclusionBufferPass();
 
-				renderDownscalePass();
-
-				renderOccludePropsPass();
+				m_gpuDriven.cull(RENDER_PASS_HIZ_DOWNSCALE_ID);
 
 				renderMainPass();
 			}
@@ -1088,43 +877,25 @@ public:
 
 	uint32_t m_width;
 	uint32_t m_height;
-	uint32_t m_hiZwidth;
-	uint32_t m_hiZheight;
+	uint32_t m_oldWidth;
+	uint32_t m_oldHeight;
 	uint32_t m_debug;
 	uint32_t m_reset;
 
 	float m_mainView[16];
 	float m_mainProj[16];
-	float m_occlusionProj[16];
 
 	bgfx::ProgramHandle m_programMainPass;
 	bgfx::ProgramHandle m_programOcclusionPass;
-	bgfx::ProgramHandle m_programCopyZ;
-	bgfx::ProgramHandle m_programDownscaleHiZ;
-	bgfx::ProgramHandle m_programOccludeProps;
-	bgfx::ProgramHandle m_programStreamCompaction;
 
-	bgfx::FrameBufferHandle m_hiZDepthBuffer;
-	bgfx::FrameBufferHandle m_hiZBuffer;
-	bgfx::IndirectBufferHandle m_indirectBuffer;
+	GpuDriven m_gpuDriven;
 
 	bgfx::VertexBufferHandle m_allPropsVertexbufferHandle;
 	bgfx::IndexBufferHandle  m_allPropsIndexbufferHandle;
-	bgfx::IndexBufferHandle m_indirectBufferData;
 
 	PosVertex* m_allPropVerticesDataCPU;
 	uint16_t* m_allPropIndicesDataCPU;
-	uint32_t* m_indirectBufferDataCPU;
-
-	bgfx::DynamicVertexBufferHandle m_instanceBoundingBoxes;
-	bgfx::DynamicIndexBufferHandle m_drawcallInstanceCounts;
-	bgfx::DynamicIndexBufferHandle m_instancePredicates;
-	bgfx::VertexBufferHandle m_instanceBuffer;
-	bgfx::DynamicVertexBufferHandle m_culledInstanceBuffer;
 
-	bgfx::UniformHandle s_texOcclusionDepth;
-	bgfx::UniformHandle u_inputRTSize;
-	bgfx::UniformHandle u_cullingConfig;
 	bgfx::UniformHandle u_color;
 
 	Prop*	m_props;
@@ -1137,10 +908,8 @@ public:
 
 	static const uint16_t s_maxNoofInstances = 2048;
 
-	uint8_t m_noofHiZMips;
-
+	bool m_gpuDrivenSupported;
 	bool m_useIndirect;
-	bool m_firstFrame;
 
 	Camera m_camera;
 	Mouse m_mouse;
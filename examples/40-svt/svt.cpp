@@ -155,6 +155,7 @@ public:
 		// Create virtual texture and feedback buffer
 		m_vt = new vt::VirtualTexture(tileDataFile, m_vti, 2048, 1);
 		m_feedbackBuffer = new vt::FeedbackBuffer(m_vti, 64, 64);
+		m_frameNumber = 0;
 
 		m_frameTime.reset();
 	}
@@ -312,12 +313,10 @@ public:
 					if (i == 0)
 					{
 						bgfx::submit(i, m_vt_mip);
-						// Download previous frame feedback info
-						m_feedbackBuffer->download();
+						// Download feedback info that arrived since the last frame, requests stay unchanged otherwise
+						m_feedbackBuffer->download(m_frameNumber);
 						// Update and upload new requests
 						m_vt->update(m_feedbackBuffer->getRequests(), 4);
-						// Clear feedback
-						m_feedbackBuffer->clear();
 						// Copy new frame feedback buffer
 						m_feedbackBuffer->copy(3);
 					}
@@ -333,7 +332,7 @@ public:
 
 			// Advance to next frame. Rendering thread will be kicked to
 			// process submitted rendering primitives.
-			bgfx::frame();
+			m_frameNumber = bgfx::frame();
 
 			return true;
 		}
@@ -362,6 +361,7 @@ public:
 	vt::VirtualTextureInfo* m_vti;
 	vt::VirtualTexture* m_vt;
 	vt::FeedbackBuffer* m_feedbackBuffer;
+	uint32_t m_frameNumber;
 
 	FrameTime m_frameTime;
 };
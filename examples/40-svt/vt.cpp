@@ -18,6 +18,11 @@
 
 #include "vt.h"
 
+#if BX_PLATFORM_POSIX
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#endif // BX_PLATFORM_POSIX
+
 namespace vt
 {
 
@@ -506,22 +511,123 @@ PageLoader::PageLoader(TileDataFile* _tileDataFile, PageIndexer* _indexer, Virtu
 	, m_indexer(_indexer)
 	, m_info(_info)
 {
+#if BX_CONFIG_SUPPORTS_THREADING
+	m_shutdown = false;
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(m_thread); ++ii)
+	{
+		m_thread[ii].init(threadFunc, this, 0, "vt page loader");
+	}
+#endif // BX_CONFIG_SUPPORTS_THREADING
+}
+
+PageLoader::~PageLoader()
+{
+#if BX_CONFIG_SUPPORTS_THREADING
+	{
+		bx::MutexScope scope(m_lock);
+		m_shutdown = true;
+	}
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(m_thread); ++ii)
+	{
+		m_sem.post();
+	}
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(m_thread); ++ii)
+	{
+		m_thread[ii].shutdown();
+	}
+#endif // BX_CONFIG_SUPPORTS_THREADING
+
+	for (auto state : m_pending)   { bx::deleteObject(VirtualTexture::getAllocator(), state); }
+	for (auto state : m_completed) { bx::deleteObject(VirtualTexture::getAllocator(), state); }
+	for (auto state : m_free)      { bx::deleteObject(VirtualTexture::getAllocator(), state); }
 }
 
+// Queue the page for loading, data is handed back through loadComplete from update
 void PageLoader::submit(Page request)
 {
-	ReadState state;
-	state.m_page = request;
-	loadPage(state);
-	onPageLoadComplete(state);
+	ReadState* state = allocReadState();
+	state->m_page = request;
+	state->m_colorMipLevels = m_colorMipLevels;
+	state->m_showBorders = m_showBorders;
+	state->m_data.resize(m_info->GetPageSize() * m_info->GetPageSize() * s_channelCount);
+
+#if BX_CONFIG_SUPPORTS_THREADING
+	{
+		bx::MutexScope scope(m_lock);
+		m_pending.push_back(state);
+	}
+
+	m_sem.post();
+#else
+	loadPage(*state);
+	m_completed.push_back(state);
+#endif // BX_CONFIG_SUPPORTS_THREADING
 }
 
-void PageLoader::loadPage(ReadState& state)
+// Drop requests no loader thread has picked up yet, so that pages requested by
+// the most recent feedback don't queue behind the ones nobody looks at anymore
+void PageLoader::cancelPending()
+{
+	m_delivery.clear();
+
+	{
+#if BX_CONFIG_SUPPORTS_THREADING
+		bx::MutexScope scope(m_lock);
+#endif // BX_CONFIG_SUPPORTS_THREADING
+		m_delivery.swap(m_pending);
+	}
+
+	for (auto state : m_delivery)
+	{
+		loadCancelled(state->m_page);
+		freeReadState(state);
+	}
+
+	m_delivery.clear();
+}
+
+// Hand at most _maxCount loaded pages over for upload
+void PageLoader::update(int _maxCount)
 {
-	int size = m_info->GetPageSize() * m_info->GetPageSize() * s_channelCount;
-	state.m_data.resize(size);
+	m_delivery.clear();
 
-	if (m_colorMipLevels)
+	{
+#if BX_CONFIG_SUPPORTS_THREADING
+		bx::MutexScope scope(m_lock);
+#endif // BX_CONFIG_SUPPORTS_THREADING
+		int count = bx::min(_maxCount, (int)m_completed.size() );
+		if (0 < count)
+		{
+			m_delivery.insert(m_delivery.end(), m_completed.begin(), m_completed.begin() + count);
+			m_completed.erase(m_completed.begin(), m_completed.begin() + count);
+		}
+	}
+
+	for (auto state : m_delivery)
+	{
+		// Page was loaded with settings that changed in the meantime, let it be requested again
+		if (state->m_colorMipLevels != m_colorMipLevels
+		||  state->m_showBorders    != m_showBorders)
+		{
+			loadCancelled(state->m_page);
+		}
+		else
+		{
+			loadComplete(state->m_page, &state->m_data[0]);
+		}
+
+		freeReadState(state);
+	}
+
+	m_delivery.clear();
+}
+
+void PageLoader::loadPage(ReadState& state)
+{
+	if (state.m_colorMipLevels)
 	{
 		copyColor(&state.m_data[0], state.m_page);
 	}
@@ -530,15 +636,72 @@ void PageLoader::loadPage(ReadState& state)
 		m_tileDataFile->readPage(m_indexer->getIndexFromPage(state.m_page), &state.m_data[0]);
 	}
 
-	if (m_showBorders)
+	if (state.m_showBorders)
 	{
 		copyBorder(&state.m_data[0]);
 	}
 }
 
-void PageLoader::onPageLoadComplete(ReadState& state)
+int32_t PageLoader::threadFunc(bx::Thread* _thread, void* _userData)
 {
-	loadComplete(state.m_page, &state.m_data[0]);
+	BX_UNUSED(_thread);
+	PageLoader* loader = (PageLoader*)_userData;
+	return loader->worker();
+}
+
+int32_t PageLoader::worker()
+{
+#if BX_CONFIG_SUPPORTS_THREADING
+	for (;;)
+	{
+		m_sem.wait();
+
+		ReadState* state = nullptr;
+
+		{
+			bx::MutexScope scope(m_lock);
+
+			if (m_shutdown)
+			{
+				break;
+			}
+
+			// Request might have been cancelled after the semaphore was posted
+			if (!m_pending.empty() )
+			{
+				state = m_pending[0];
+				m_pending.erase(m_pending.begin() );
+			}
+		}
+
+		if (nullptr != state)
+		{
+			loadPage(*state);
+
+			bx::MutexScope scope(m_lock);
+			m_completed.push_back(state);
+		}
+	}
+#endif // BX_CONFIG_SUPPORTS_THREADING
+
+	return 0;
+}
+
+PageLoader::ReadState* PageLoader::allocReadState()
+{
+	if (!m_free.empty() )
+	{
+		ReadState* state = m_free.back();
+		m_free.pop_back();
+		return state;
+	}
+
+	return BX_NEW(VirtualTexture::getAllocator(), ReadState);
+}
+
+void PageLoader::freeReadState(ReadState* state)
+{
+	m_free.push_back(state);
 }
 
 void PageLoader::copyBorder(uint8_t* image)
@@ -601,6 +764,7 @@ PageCache::PageCache(TextureAtlas* _atlas, PageLoader* _loader, int _count)
 {
 	clear();
 	m_loader->loadComplete = [&](Page page, uint8_t* data) { loadComplete(page, data); };
+	m_loader->loadCancelled = [&](Page page) { loadCancelled(page); };
 }
 
 // Update the pages's position in the lru
@@ -697,6 +861,12 @@ void PageCache::loadComplete(Page page, uint8_t* data)
 	added(page, pt);
 }
 
+// Loading was abandoned, allow the page to be requested again
+void PageCache::loadCancelled(Page page)
+{
+	m_loading.erase(page);
+}
+
 // TextureAtlas
 TextureAtlas::TextureAtlas(VirtualTextureInfo* _info, int _count, int _uploadsperframe)
 	: m_info(_info)
@@ -761,15 +931,21 @@ FeedbackBuffer::FeedbackBuffer(VirtualTextureInfo* _info, int _width, int _heigh
 	: m_info(_info)
 	, m_width(_width)
 	, m_height(_height)
-	, m_stagingPool(_width, _height, 1, true)
+	, m_stagingPool(_width, _height, BX_COUNTOF(m_readback), true)
+	, m_readbackIndex(0)
 {
 	// Setup classes
 	m_indexer = BX_NEW(VirtualTexture::getAllocator(), PageIndexer)(m_info);
 	m_requests.resize(m_indexer->getCount());
 
 	// Initialize and clear buffers
-	m_downloadBuffer.resize(m_width * m_height * s_channelCount);
-	bx::memSet(&m_downloadBuffer[0], 0, m_width * m_height * s_channelCount);
+	for (auto& readback : m_readback)
+	{
+		readback.m_texture = { bgfx::kInvalidHandle };
+		readback.m_frame = 0;
+		readback.m_data.resize(m_width * m_height * s_channelCount);
+		bx::memSet(&readback.m_data[0], 0, m_width * m_height * s_channelCount);
+	}
 	clear();
 
 	// Initialize feedback frame buffer
@@ -780,7 +956,6 @@ FeedbackBuffer::FeedbackBuffer(VirtualTextureInfo* _info, int _width, int _heigh
 	};
 
 	m_feedbackFrameBuffer = bgfx::createFrameBuffer(BX_COUNTOF(feedbackFrameBufferTextures), feedbackFrameBufferTextures, true);
-	m_lastStagingTexture = { bgfx::kInvalidHandle };
 }
 
 FeedbackBuffer::~FeedbackBuffer()
@@ -797,24 +972,59 @@ void FeedbackBuffer::clear()
 
 void FeedbackBuffer::copy(bgfx::ViewId viewId)
 {
-	m_lastStagingTexture = m_stagingPool.getTexture();
+	Readback& readback = m_readback[m_readbackIndex];
+
+	// All staging textures are still in flight, skip this frame's feedback
+	if (0 != readback.m_frame)
+	{
+		return;
+	}
+
+	readback.m_texture = m_stagingPool.getTexture();
 	// Copy feedback buffer render target to staging texture
-	bgfx::blit(viewId, m_lastStagingTexture, 0, 0, bgfx::getTexture(m_feedbackFrameBuffer));
+	bgfx::blit(viewId, readback.m_texture, 0, 0, bgfx::getTexture(m_feedbackFrameBuffer));
+	// Read back executes after the blit, data is available a couple of frames later
+	readback.m_frame = bgfx::readTexture(readback.m_texture, &readback.m_data[0]);
 	m_stagingPool.next();
+	m_readbackIndex = (m_readbackIndex + 1) % BX_COUNTOF(m_readback);
 }
 
-void FeedbackBuffer::download()
+void FeedbackBuffer::download(uint32_t frameNumber)
 {
-	// Check if there's an already rendered feedback buffer available
-	if (m_lastStagingTexture.idx == bgfx::kInvalidHandle)
+	// Use the most recent feedback that already arrived, older ones are superseded by it
+	Readback* latest = nullptr;
+
+	for (auto& readback : m_readback)
+	{
+		if (0 != readback.m_frame
+		&&  frameNumber >= readback.m_frame)
+		{
+			if (nullptr == latest
+			||  readback.m_frame > latest->m_frame)
+			{
+				latest = &readback;
+			}
+		}
+	}
+
+	if (nullptr == latest)
 	{
 		return;
 	}
 
-	// Read the texture
-	bgfx::readTexture(m_lastStagingTexture, &m_downloadBuffer[0]);
+	for (auto& readback : m_readback)
+	{
+		if (0 != readback.m_frame
+		&&  readback.m_frame <= latest->m_frame)
+		{
+			readback.m_frame = 0;
+		}
+	}
+
+	clear();
+
 	// Loop through pixels and check if anything was written
-	auto data = &m_downloadBuffer[0];
+	auto data = &latest->m_data[0];
 	auto colors = (Color*)data;
 	auto dataSize = m_width * m_height;
 
@@ -1022,11 +1232,18 @@ bgfx::TextureHandle VirtualTexture::getPageTableTexture()
 
 void VirtualTexture::clear()
 {
+	m_loader->cancelPending();
 	m_cache->clear();
 }
 
 void VirtualTexture::update(const tinystl::vector<int>& requests, bgfx::ViewId blitViewId)
 {
+	// Upload pages finished by the loader threads, bounded by staging textures available this frame
+	m_loader->update(m_uploadsPerFrame);
+
+	// Requests from previous feedback that didn't start loading yet are superseded by this one
+	m_loader->cancelPending();
+
 	m_pagesToLoad.clear();
 
 	// Find out what is already in memory
@@ -1091,20 +1308,48 @@ bx::AllocatorI* VirtualTexture::getAllocator()
 	return s_allocator;
 }
 
-TileDataFile::TileDataFile(const bx::FilePath& filename, VirtualTextureInfo* _info, bool _readWrite) : m_info(_info)
+TileDataFile::TileDataFile(const bx::FilePath& filename, VirtualTextureInfo* _info, bool _readWrite)
+	: m_info(_info)
+	, m_mapped(nullptr)
+	, m_mappedSize(0)
 {
 	const char* access = _readWrite ? "w+b" : "rb";
 	m_file = fopen(filename.getCPtr(), access);
 	m_size = m_info->GetPageSize() * m_info->GetPageSize() * s_channelCount;
+
+#if BX_PLATFORM_POSIX
+	// Map read-only tile files, so loader threads can copy pages without seeking
+	struct stat st;
+	if (!_readWrite
+	&&  nullptr != m_file
+	&&  0 == fstat(fileno(m_file), &st)
+	&&  0 < st.st_size)
+	{
+		void* ptr = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fileno(m_file), 0);
+		if (MAP_FAILED != ptr)
+		{
+			m_mapped = (const uint8_t*)ptr;
+			m_mappedSize = size_t(st.st_size);
+		}
+	}
+#endif // BX_PLATFORM_POSIX
 }
 
 TileDataFile::~TileDataFile()
 {
+#if BX_PLATFORM_POSIX
+	if (nullptr != m_mapped)
+	{
+		munmap( (void*)m_mapped, m_mappedSize);
+	}
+#endif // BX_PLATFORM_POSIX
+
 	fclose(m_file);
 }
 
 void TileDataFile::readInfo()
 {
+	bx::MutexScope scope(m_lock);
 	fseek(m_file, 0, SEEK_SET);
 	auto ret = fread(m_info, sizeof(*m_info), 1, m_file);
 	BX_UNUSED(ret);
@@ -1113,6 +1358,7 @@ void TileDataFile::readInfo()
 
 void TileDataFile::writeInfo()
 {
+	bx::MutexScope scope(m_lock);
 	fseek(m_file, 0, SEEK_SET);
 	auto ret = fwrite(m_info, sizeof(*m_info), 1, m_file);
 	BX_UNUSED(ret);
@@ -1120,13 +1366,27 @@ void TileDataFile::writeInfo()
 
 void TileDataFile::readPage(int index, uint8_t* data)
 {
-	fseek(m_file, m_size * index + s_tileFileDataOffset, SEEK_SET);
+	const size_t offset = size_t(m_size) * index + s_tileFileDataOffset;
+
+	if (nullptr != m_mapped)
+	{
+		if (offset + m_size <= m_mappedSize)
+		{
+			bx::memCopy(data, &m_mapped[offset], m_size);
+		}
+
+		return;
+	}
+
+	bx::MutexScope scope(m_lock);
+	fseek(m_file, long(offset), SEEK_SET);
 	auto ret = fread(data, m_size, 1, m_file);
 	BX_UNUSED(ret);
 }
 
 void TileDataFile::writePage(int index, uint8_t* data)
 {
+	bx::MutexScope scope(m_lock);
 	fseek(m_file, m_size * index + s_tileFileDataOffset, SEEK_SET);
 	auto ret = fwrite(data, m_size, 1, m_file);
 	BX_UNUSED(ret);
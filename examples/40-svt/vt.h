@@ -16,6 +16,9 @@
 #pragma once
 
 #include <bimg/decode.h>
+#include <bx/mutex.h>
+#include <bx/semaphore.h>
+#include <bx/thread.h>
 #include <tinystl/allocator.h>
 #include <tinystl/unordered_set.h>
 #include <tinystl/vector.h>
@@ -221,25 +224,49 @@ public:
 	struct ReadState
 	{
 		Page						m_page;
+		bool						m_colorMipLevels;
+		bool						m_showBorders;
 		tinystl::vector<uint8_t>	m_data;
 	};
 
 	PageLoader(TileDataFile* _tileDataFile, PageIndexer* _indexer, VirtualTextureInfo* _info);
+	~PageLoader();
+
 	void submit(Page request);
+	void cancelPending();
+	void update(int _maxCount);
 	void loadPage(ReadState& state);
-	void onPageLoadComplete(ReadState& state);
 	void copyBorder(uint8_t* image);
 	void copyColor(uint8_t* image, Page request);
 
 	std::function<void(Page, uint8_t*)> loadComplete;
+	std::function<void(Page)>           loadCancelled;
 
 	bool m_colorMipLevels;
 	bool m_showBorders;
 
 private:
+	static int32_t threadFunc(bx::Thread* _thread, void* _userData);
+	int32_t worker();
+
+	ReadState* allocReadState();
+	void freeReadState(ReadState* state);
+
 	TileDataFile*		m_tileDataFile;
 	PageIndexer*        m_indexer;
 	VirtualTextureInfo* m_info;
+
+	tinystl::vector<ReadState*> m_pending;   // Requests waiting for a loader thread, most important first
+	tinystl::vector<ReadState*> m_completed; // Loaded pages waiting to be uploaded on the main thread
+	tinystl::vector<ReadState*> m_delivery;
+	tinystl::vector<ReadState*> m_free;
+
+#if BX_CONFIG_SUPPORTS_THREADING
+	bx::Mutex     m_lock;
+	bx::Semaphore m_sem;
+	bx::Thread    m_thread[2];
+	bool          m_shutdown;
+#endif // BX_CONFIG_SUPPORTS_THREADING
 };
 
 // PageCache
@@ -251,6 +278,7 @@ public:
 	bool request(Page request, bgfx::ViewId blitViewId);
 	void clear();
 	void loadComplete(Page page, uint8_t* data);
+	void loadCancelled(Page page);
 
 	// These callbacks are used to notify the other systems
 	std::function<void(Page, Point)> removed;
@@ -310,7 +338,7 @@ public:
 	void clear();
 
 	void copy(bgfx::ViewId viewId);
-	void download();
+	void download(uint32_t frameNumber);
 
 	// This function validates the pages and adds the page's parents
 	// We do this so that we can fall back to them if we run out of memory
@@ -329,13 +357,22 @@ private:
 	int m_width = 0;
 	int m_height = 0;
 
+	// Read back is asynchronous, every staging texture has its own download buffer and
+	// the frame number at which its data becomes available (0 when nothing is in flight).
+	struct Readback
+	{
+		bgfx::TextureHandle			m_texture;
+		uint32_t					m_frame;
+		tinystl::vector<uint8_t>	m_data;
+	};
+
 	StagingPool				m_stagingPool;
-	bgfx::TextureHandle		m_lastStagingTexture;
+	Readback				m_readback[3];
+	int						m_readbackIndex;
 	bgfx::FrameBufferHandle m_feedbackFrameBuffer;
 
 	// This stores the pages by index.  The int value is number of requests.
 	tinystl::vector<int>		m_requests;
-	tinystl::vector<uint8_t>	m_downloadBuffer;
 };
 
 // VirtualTexture
@@ -402,6 +439,7 @@ public:
 	void readInfo();
 	void writeInfo();
 
+	// Safe to call from multiple loader threads at once
 	void readPage(int index, uint8_t* data);
 	void writePage(int index, uint8_t* data);
 
@@ -409,6 +447,11 @@ private:
 	VirtualTextureInfo*	m_info;
 	int					m_size;
 	FILE*				m_file;
+
+	// Read-only tile files are memory mapped where supported, otherwise reads are serialized
+	const uint8_t*		m_mapped;
+	size_t				m_mappedSize;
+	bx::Mutex			m_lock;
 };
 
 // TileGenerator
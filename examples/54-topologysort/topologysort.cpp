@@ -0,0 +1,389 @@
+/*
+ * Copyright 2011-2026 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "common.h"
+#include "bgfx_utils.h"
+#include "imgui/imgui.h"
+
+#include <bx/rng.h>
+#include <bx/sort.h>
+#include <bx/timer.h>
+
+namespace
+{
+
+struct PosColorVertex
+{
+	float m_x;
+	float m_y;
+	float m_z;
+	uint32_t m_abgr;
+
+	static void init()
+	{
+		ms_layout
+			.begin()
+			.add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float)
+			.add(bgfx::Attrib::Color0,   4, bgfx::AttribType::Uint8, true)
+			.end();
+	};
+
+	static bgfx::VertexLayout ms_layout;
+};
+
+bgfx::VertexLayout PosColorVertex::ms_layout;
+
+// Scalar sort, same as bgfx::topologySortTriList before it was vectorized and threaded,
+// with TopologySort::DistanceBackToFrontAvg. Used as reference for timing.
+void referenceSortTriList(
+	  uint32_t* _dst
+	, uint32_t* _temp
+	, const float _pos[3]
+	, const PosColorVertex* _vertices
+	, const uint32_t* _indices
+	, uint32_t _num
+	)
+{
+	uint32_t* keys       = &_temp[_num*0];
+	uint32_t* values     = &_temp[_num*1];
+	uint32_t* tempKeys   = &_temp[_num*2];
+	uint32_t* tempValues = &_temp[_num*3];
+
+	const bx::Vec3 pos = bx::load<bx::Vec3>(_pos);
+
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		float distance = 0.0f;
+
+		for (uint32_t corner = 0; corner < 3; ++corner)
+		{
+			const bx::Vec3 tmp = bx::sub(pos, bx::load<bx::Vec3>(&_vertices[_indices[ii*3+corner] ].m_x) );
+			distance += bx::sqrt(bx::dot(tmp, tmp) );
+		}
+
+		uint32_t ui = bx::floatToBits(distance * 1.0f/3.0f);
+		keys[ii]   = bx::floatFlip(ui) ^ UINT32_MAX;
+		values[ii] = ii;
+	}
+
+	bx::radixSort(keys, tempKeys, values, tempValues, _num);
+
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		const uint32_t face = values[ii]*3;
+		_dst[ii*3+0] = _indices[face+0];
+		_dst[ii*3+1] = _indices[face+1];
+		_dst[ii*3+2] = _indices[face+2];
+	}
+}
+
+class ExampleTopologySort : public entry::AppI
+{
+public:
+	ExampleTopologySort(const char* _name, const char* _description, const char* _url)
+		: entry::AppI(_name, _description, _url)
+		, m_vertices(NULL)
+		, m_indices(NULL)
+		, m_sorted(NULL)
+		, m_temp(NULL)
+		, m_numTriangles(0)
+		, m_numTrianglesLog2(16)
+		, m_reference(true)
+		, m_referenceTime(0.0f)
+		, m_sortTime(0.0f)
+	{
+	}
+
+	void init(int32_t _argc, const char* const* _argv, uint32_t _width, uint32_t _height) override
+	{
+		Args args(_argc, _argv);
+
+		m_width  = _width;
+		m_height = _height;
+		m_debug  = BGFX_DEBUG_NONE;
+		m_reset  = BGFX_RESET_VSYNC;
+
+		bgfx::Init init;
+		init.type     = args.m_type;
+		init.vendorId = args.m_pciId;
+		init.platformData.nwh  = entry::getNativeWindowHandle(entry::kDefaultWindowHandle);
+		init.platformData.ndt  = entry::getNativeDisplayHandle();
+		init.platformData.type = entry::getNativeWindowHandleType();
+		init.resolution.width  = m_width;
+		init.resolution.height = m_height;
+		init.resolution.reset  = m_reset;
+		bgfx::init(init);
+
+		// Enable debug text.
+		bgfx::setDebug(m_debug);
+
+		// Set view 0 clear state.
+		bgfx::setViewClear(0
+			, BGFX_CLEAR_COLOR|BGFX_CLEAR_DEPTH
+			, 0x303030ff
+			, 1.0f
+			, 0
+			);
+
+		// Create vertex stream declaration.
+		PosColorVertex::init();
+
+		m_vbh = BGFX_INVALID_HANDLE;
+		m_ibh = BGFX_INVALID_HANDLE;
+
+		createMesh();
+
+		// Create program from shaders.
+		m_program = loadProgram("vs_cubes", "fs_cubes");
+
+		m_frameTime.reset();
+
+		imguiCreate();
+	}
+
+	virtual int shutdown() override
+	{
+		imguiDestroy();
+
+		// Cleanup.
+		destroyMesh();
+
+		bgfx::destroy(m_program);
+
+		// Shutdown bgfx.
+		bgfx::shutdown();
+
+		return 0;
+	}
+
+	void createMesh()
+	{
+		m_numTriangles = 1<<m_numTrianglesLog2;
+
+		bx::AllocatorI* allocator = entry::getAllocator();
+		m_vertices = (PosColorVertex*)bx::alloc(allocator, m_numTriangles*3*sizeof(PosColorVertex) );
+		m_indices  = (uint32_t*)bx::alloc(allocator, m_numTriangles*3*sizeof(uint32_t) );
+		m_sorted   = (uint32_t*)bx::alloc(allocator, m_numTriangles*3*sizeof(uint32_t) );
+		m_temp     = (uint32_t*)bx::alloc(allocator, m_numTriangles*4*sizeof(uint32_t) );
+
+		// Small randomly oriented triangles scattered inside sphere.
+		bx::RngMwc mwc;
+
+		const float size = 0.5f * bx::pow(float(m_numTriangles), -1.0f/3.0f) * 16.0f;
+
+		for (uint32_t ii = 0; ii < m_numTriangles; ++ii)
+		{
+			const bx::Vec3 center = bx::mul(bx::randUnitSphere(&mwc), 10.0f * bx::frnd(&mwc) );
+			const uint32_t abgr   = 0x40000000 | (mwc.gen() & 0x00ffffff);
+
+			for (uint32_t corner = 0; corner < 3; ++corner)
+			{
+				const bx::Vec3 pos = bx::mad(bx::randUnitSphere(&mwc), size, center);
+
+				PosColorVertex& vertex = m_vertices[ii*3+corner];
+				vertex.m_x    = pos.x;
+				vertex.m_y    = pos.y;
+				vertex.m_z    = pos.z;
+				vertex.m_abgr = abgr;
+
+				m_indices[ii*3+corner] = ii*3+corner;
+			}
+		}
+
+		m_vbh = bgfx::createVertexBuffer(
+			  bgfx::copy(m_vertices, m_numTriangles*3*sizeof(PosColorVertex) )
+			, PosColorVertex::ms_layout
+			);
+
+		m_ibh = bgfx::createDynamicIndexBuffer(m_numTriangles*3, BGFX_BUFFER_INDEX32);
+
+		m_referenceTime = 0.0f;
+		m_sortTime      = 0.0f;
+	}
+
+	void destroyMesh()
+	{
+		if (bgfx::isValid(m_vbh) )
+		{
+			bgfx::destroy(m_vbh);
+			bgfx::destroy(m_ibh);
+		}
+
+		bx::AllocatorI* allocator = entry::getAllocator();
+		bx::free(allocator, m_vertices);
+		bx::free(allocator, m_indices);
+		bx::free(allocator, m_sorted);
+		bx::free(allocator, m_temp);
+	}
+
+	bool update() override
+	{
+		if (!entry::processEvents(m_width, m_height, m_debug, m_reset, &m_mouseState) )
+		{
+			m_frameTime.frame();
+			const float time = bx::toSeconds<float>(m_frameTime.getDurationTime() );
+
+			imguiBeginFrame(m_mouseState.m_mx
+				,  m_mouseState.m_my
+				, (m_mouseState.m_buttons[entry::MouseButton::Left  ] ? IMGUI_MBUT_LEFT   : 0)
+				| (m_mouseState.m_buttons[entry::MouseButton::Right ] ? IMGUI_MBUT_RIGHT  : 0)
+				| (m_mouseState.m_buttons[entry::MouseButton::Middle] ? IMGUI_MBUT_MIDDLE : 0)
+				,  m_mouseState.m_mz
+				, uint16_t(m_width)
+				, uint16_t(m_height)
+				);
+
+			showExampleDialog(this);
+
+			ImGui::SetNextWindowPos(
+				  ImVec2(m_width - m_width / 4.0f - 10.0f, 10.0f)
+				, ImGuiCond_FirstUseEver
+				);
+			ImGui::SetNextWindowSize(
+				  ImVec2(m_width / 4.0f, m_height / 4.0f)
+				, ImGuiCond_FirstUseEver
+				);
+			ImGui::Begin("Settings"
+				, NULL
+				, 0
+				);
+
+			ImGui::Text("Triangles: %d", m_numTriangles);
+
+			int32_t numTrianglesLog2 = m_numTrianglesLog2;
+			ImGui::SliderInt("Log2", &numTrianglesLog2, 10, 19);
+
+			ImGui::Checkbox("Reference sort", &m_reference);
+
+			ImGui::Separator();
+
+			ImGui::Text("Reference:           %7.3f [ms]", double(m_referenceTime) );
+			ImGui::Text("topologySortTriList: %7.3f [ms]", double(m_sortTime) );
+
+			if (m_reference
+			&&  0.0f < m_sortTime)
+			{
+				ImGui::Text("Speedup:             %7.2fx", double(m_referenceTime/m_sortTime) );
+			}
+
+			ImGui::End();
+
+			imguiEndFrame();
+
+			if (numTrianglesLog2 != m_numTrianglesLog2)
+			{
+				destroyMesh();
+				m_numTrianglesLog2 = numTrianglesLog2;
+				createMesh();
+			}
+
+			const bx::Vec3 at  = { 0.0f, 0.0f, 0.0f };
+			const bx::Vec3 eye = { bx::sin(time*0.2f)*25.0f, 5.0f, bx::cos(time*0.2f)*25.0f };
+
+			// Set view and projection matrix for view 0.
+			{
+				float view[16];
+				bx::mtxLookAt(view, eye, at);
+
+				float proj[16];
+				bx::mtxProj(proj, 60.0f, float(m_width)/float(m_height), 0.1f, 100.0f, bgfx::getCaps()->homogeneousDepth);
+				bgfx::setViewTransform(0, view, proj);
+
+				// Set view 0 default viewport.
+				bgfx::setViewRect(0, 0, 0, uint16_t(m_width), uint16_t(m_height) );
+			}
+
+			// This dummy draw call is here to make sure that view 0 is cleared
+			// if no other draw calls are submitted to view 0.
+			bgfx::touch(0);
+
+			const float pos[3] = { eye.x, eye.y, eye.z };
+			const bx::Vec3 dirVec = bx::normalize(bx::sub(at, eye) );
+			const float dir[3] = { dirVec.x, dirVec.y, dirVec.z };
+
+			const double toMs = 1000.0/double(bx::getHPFrequency() );
+
+			if (m_reference)
+			{
+				const int64_t start = bx::getHPCounter();
+				referenceSortTriList(m_sorted, m_temp, pos, m_vertices, m_indices, m_numTriangles);
+				const float elapsed = float( (bx::getHPCounter() - start)*toMs);
+				m_referenceTime = bx::lerp(m_referenceTime, elapsed, 0.1f);
+			}
+
+			{
+				const int64_t start = bx::getHPCounter();
+				bgfx::topologySortTriList(
+					  bgfx::TopologySort::DistanceBackToFrontAvg
+					, m_sorted
+					, m_numTriangles*3*sizeof(uint32_t)
+					, dir
+					, pos
+					, m_vertices
+					, sizeof(PosColorVertex)
+					, m_indices
+					, m_numTriangles*3
+					, true
+					);
+				const float elapsed = float( (bx::getHPCounter() - start)*toMs);
+				m_sortTime = bx::lerp(m_sortTime, elapsed, 0.1f);
+			}
+
+			bgfx::update(m_ibh, 0, bgfx::copy(m_sorted, m_numTriangles*3*sizeof(uint32_t) ) );
+
+			bgfx::setVertexBuffer(0, m_vbh);
+			bgfx::setIndexBuffer(m_ibh);
+
+			bgfx::setState(0
+				| BGFX_STATE_WRITE_RGB
+				| BGFX_STATE_DEPTH_TEST_LESS
+				| BGFX_STATE_BLEND_ALPHA
+				| BGFX_STATE_MSAA
+				);
+
+			bgfx::submit(0, m_program);
+
+			// Advance to next frame. Rendering thread will be kicked to
+			// process submitted rendering primitives.
+			bgfx::frame();
+
+			return true;
+		}
+
+		return false;
+	}
+
+	entry::MouseState m_mouseState;
+
+	uint32_t m_width;
+	uint32_t m_height;
+	uint32_t m_debug;
+	uint32_t m_reset;
+	bgfx::VertexBufferHandle m_vbh;
+	bgfx::DynamicIndexBufferHandle m_ibh;
+	bgfx::ProgramHandle m_program;
+
+	PosColorVertex* m_vertices;
+	uint32_t* m_indices;
+	uint32_t* m_sorted;
+	uint32_t* m_temp;
+
+	FrameTime m_frameTime;
+
+	uint32_t m_numTriangles;
+	int32_t  m_numTrianglesLog2;
+	bool     m_reference;
+	float    m_referenceTime;
+	float    m_sortTime;
+};
+
+} // namespace
+
+ENTRY_IMPLEMENT_MAIN(
+	  ExampleTopologySort
+	, "54-topologysort"
+	, "Sorting transparent triangles with bgfx::topologySortTriList."
+	, "https://bkaradzic.github.io/bgfx/examples.html#topologysort"
+	);
@@ -196,22 +196,22 @@ public:
 		return sizeof(TextVertex);
 	}
 
-	/// get a pointer to the index buffer to submit it to the graphic
-	const uint16_t* getIndexBuffer() const
-	{
-		return m_indexBuffer;
-	}
-
 	/// number of index in the index buffer
 	uint32_t getIndexCount() const
 	{
 		return m_indexCount;
 	}
 
-	/// Size in bytes of an index.
-	uint32_t getIndexSize() const
+	/// First vertex modified since last call to `resetDirtyVertex`.
+	uint32_t getDirtyVertex() const
 	{
-		return sizeof(uint16_t);
+		return m_dirtyVertex;
+	}
+
+	/// Mark all vertices as uploaded.
+	void resetDirtyVertex()
+	{
+		m_dirtyVertex = m_vertexCount;
 	}
 
 	uint32_t getTextColor() const
@@ -296,11 +296,11 @@ private:
 	FontManager* m_fontManager;
 
 	TextVertex* m_vertexBuffer;
-	uint16_t* m_indexBuffer;
 	uint8_t* m_styleBuffer;
 
 	uint32_t m_indexCount;
 	uint32_t m_lineStartIndex;
+	uint32_t m_dirtyVertex;
 	uint16_t m_vertexCount;
 };
 
@@ -325,10 +325,10 @@ TextBuffer::TextBuffer(FontManager* _fontManager)
 	, m_previousCodePoint(0)
 	, m_fontManager(_fontManager)
 	, m_vertexBuffer(new TextVertex[MAX_BUFFERED_CHARACTERS * 4])
-	, m_indexBuffer(new uint16_t[MAX_BUFFERED_CHARACTERS * 6])
 	, m_styleBuffer(new uint8_t[MAX_BUFFERED_CHARACTERS * 4])
 	, m_indexCount(0)
 	, m_lineStartIndex(0)
+	, m_dirtyVertex(0)
 	, m_vertexCount(0)
 {
 	m_rectangle.width = 0;
@@ -340,7 +340,6 @@ TextBuffer::TextBuffer(FontManager* _fontManager)
 TextBuffer::~TextBuffer()
 {
 	delete [] m_vertexBuffer;
-	delete [] m_indexBuffer;
 	delete [] m_styleBuffer;
 }
 
@@ -468,12 +467,6 @@ void TextBuffer::appendAtlasFace(uint16_t _faceIndex)
 	setVertex(m_vertexCount + 2, x1, y1, m_backgroundColor);
 	setVertex(m_vertexCount + 3, x1, y0, m_backgroundColor);
 
-	m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-	m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
 	m_vertexCount += 4;
 	m_indexCount += 6;
 }
@@ -488,6 +481,7 @@ void TextBuffer::clearTextBuffer()
 	m_vertexCount = 0;
 	m_indexCount = 0;
 	m_lineStartIndex = 0;
+	m_dirtyVertex = 0;
 	m_lineAscender = 0;
 	m_lineDescender = 0;
 	m_lineGap = 0;
@@ -584,12 +578,6 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 			setVertex(m_vertexCount + 2, x1, y1, adjustedDropShadowColor);
 			setVertex(m_vertexCount + 3, x1, y0, adjustedDropShadowColor);
 
-			m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-			m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-			m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-			m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-			m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-			m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
 			m_vertexCount += 4;
 			m_indexCount += 6;
 		}
@@ -630,12 +618,6 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 		setVertex(vertexCount + 2, x1, y1, m_backgroundColor, STYLE_BACKGROUND);
 		setVertex(vertexCount + 3, x1, y0, m_backgroundColor, STYLE_BACKGROUND);
 
-		m_indexBuffer[m_indexCount + 0] = vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = vertexCount + 3;
 		m_vertexCount += 4;
 		m_indexCount += 6;
 	}
@@ -659,12 +641,6 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 		setVertex(m_vertexCount + 2, x1, y1, m_underlineColor, STYLE_UNDERLINE);
 		setVertex(m_vertexCount + 3, x1, y0, m_underlineColor, STYLE_UNDERLINE);
 
-		m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
 		m_vertexCount += 4;
 		m_indexCount += 6;
 	}
@@ -688,12 +664,6 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 		setVertex(m_vertexCount + 2, x1, y1, m_overlineColor, STYLE_OVERLINE);
 		setVertex(m_vertexCount + 3, x1, y0, m_overlineColor, STYLE_OVERLINE);
 
-		m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
 		m_vertexCount += 4;
 		m_indexCount += 6;
 	}
@@ -717,12 +687,6 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 		setVertex(m_vertexCount + 2, x1, y1, m_strikeThroughColor, STYLE_STRIKE_THROUGH);
 		setVertex(m_vertexCount + 3, x1, y0, m_strikeThroughColor, STYLE_STRIKE_THROUGH);
 
-		m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-		m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-		m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-		m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
 		m_vertexCount += 4;
 		m_indexCount += 6;
 	}
@@ -776,12 +740,6 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 		setOutlineColor(m_vertexCount + 3, m_outlineColor);
 	}
 
-	m_indexBuffer[m_indexCount + 0] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 1] = m_vertexCount + 1;
-	m_indexBuffer[m_indexCount + 2] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 3] = m_vertexCount + 0;
-	m_indexBuffer[m_indexCount + 4] = m_vertexCount + 2;
-	m_indexBuffer[m_indexCount + 5] = m_vertexCount + 3;
 	m_vertexCount += 4;
 	m_indexCount += 6;
 
@@ -801,6 +759,8 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 
 void TextBuffer::verticalCenterLastLine(float _dy, float _top, float _bottom)
 {
+	m_dirtyVertex = bx::min(m_dirtyVertex, m_lineStartIndex);
+
 	for (uint32_t ii = m_lineStartIndex; ii < m_vertexCount; ii += 4)
 	{
 		if (m_styleBuffer[ii] == STYLE_BACKGROUND)
@@ -888,6 +848,22 @@ TextBufferManager::TextBufferManager(FontManager* _fontManager)
 	s_texColor = bgfx::createUniform("s_texColor", bgfx::UniformType::Sampler);
 	u_dropShadowColor = bgfx::createUniform("u_dropShadowColor", bgfx::UniformType::Vec4);
 	u_params = bgfx::createUniform("u_params", bgfx::UniformType::Vec4);
+
+	// Every glyph and decoration is a quad, all text buffers share the same index buffer.
+	const bgfx::Memory* mem = bgfx::alloc(MAX_BUFFERED_CHARACTERS * 6 * sizeof(uint16_t) );
+	uint16_t* indices = (uint16_t*)mem->data;
+	for (uint16_t ii = 0; ii < MAX_BUFFERED_CHARACTERS; ++ii)
+	{
+		const uint16_t vertex = uint16_t(ii * 4);
+		indices[ii * 6 + 0] = vertex + 0;
+		indices[ii * 6 + 1] = vertex + 1;
+		indices[ii * 6 + 2] = vertex + 2;
+		indices[ii * 6 + 3] = vertex + 0;
+		indices[ii * 6 + 4] = vertex + 2;
+		indices[ii * 6 + 5] = vertex + 3;
+	}
+
+	m_indexBuffer = bgfx::createIndexBuffer(mem);
 }
 
 TextBufferManager::~TextBufferManager()
@@ -898,6 +874,8 @@ TextBufferManager::~TextBufferManager()
 		);
 	delete [] m_textBuffers;
 
+	bgfx::destroy(m_indexBuffer);
+
 	bgfx::destroy(u_params);
 
 	bgfx::destroy(u_dropShadowColor);
@@ -921,8 +899,8 @@ TextBufferHandle TextBufferManager::createTextBuffer(uint32_t _type, BufferType:
 	bc.textBuffer = new TextBuffer(m_fontManager);
 	bc.fontType = _type;
 	bc.bufferType = _bufferType;
-	bc.indexBufferHandleIdx = bgfx::kInvalidHandle;
 	bc.vertexBufferHandleIdx = bgfx::kInvalidHandle;
+	bc.vertexCapacity = 0;
 
 	TextBufferHandle ret = {textIdx};
 	return ret;
@@ -946,22 +924,16 @@ void TextBufferManager::destroyTextBuffer(TextBufferHandle _handle)
 	{
 	case BufferType::Static:
 		{
-			bgfx::IndexBufferHandle ibh;
 			bgfx::VertexBufferHandle vbh;
-			ibh.idx = bc.indexBufferHandleIdx;
 			vbh.idx = bc.vertexBufferHandleIdx;
-			bgfx::destroy(ibh);
 			bgfx::destroy(vbh);
 		}
 
 		break;
 
 	case BufferType::Dynamic:
-		bgfx::DynamicIndexBufferHandle ibh;
 		bgfx::DynamicVertexBufferHandle vbh;
-		ibh.idx = bc.indexBufferHandleIdx;
 		vbh.idx = bc.vertexBufferHandleIdx;
-		bgfx::destroy(ibh);
 		bgfx::destroy(vbh);
 
 		break;
@@ -977,10 +949,10 @@ void TextBufferManager::submitTextBuffer(TextBufferHandle _handle, bgfx::ViewId
 
 	BufferCache& bc = m_textBuffers[_handle.idx];
 
-	uint32_t indexSize  = bc.textBuffer->getIndexCount()  * bc.textBuffer->getIndexSize();
-	uint32_t vertexSize = bc.textBuffer->getVertexCount() * bc.textBuffer->getVertexSize();
+	const uint32_t vertexCount = bc.textBuffer->getVertexCount();
+	const uint32_t vertexSize  = vertexCount * bc.textBuffer->getVertexSize();
 
-	if (0 == indexSize || 0 == vertexSize)
+	if (0 == vertexCount)
 	{
 		return;
 	}
@@ -1103,90 +1075,83 @@ void TextBufferManager::submitTextBuffer(TextBufferHandle _handle, bgfx::ViewId
 	{
 	case BufferType::Static:
 		{
-			bgfx::IndexBufferHandle ibh;
 			bgfx::VertexBufferHandle vbh;
 
 			if (bgfx::kInvalidHandle == bc.vertexBufferHandleIdx)
 			{
-				ibh = bgfx::createIndexBuffer(
-								bgfx::copy(bc.textBuffer->getIndexBuffer(), indexSize)
-								);
-
 				vbh = bgfx::createVertexBuffer(
 								  bgfx::copy(bc.textBuffer->getVertexBuffer(), vertexSize)
 								, m_vertexLayout
 								);
 
 				bc.vertexBufferHandleIdx = vbh.idx;
-				bc.indexBufferHandleIdx = ibh.idx;
 			}
 			else
 			{
 				vbh.idx = bc.vertexBufferHandleIdx;
-				ibh.idx = bc.indexBufferHandleIdx;
 			}
 
-			bgfx::setVertexBuffer(0, vbh, 0, bc.textBuffer->getVertexCount() );
-			bgfx::setIndexBuffer(ibh, 0, bc.textBuffer->getIndexCount() );
+			bgfx::setVertexBuffer(0, vbh, 0, vertexCount);
 		}
 		break;
 
 	case BufferType::Dynamic:
 		{
-			bgfx::DynamicIndexBufferHandle ibh;
 			bgfx::DynamicVertexBufferHandle vbh;
+			uint32_t dirtyVertex = bc.textBuffer->getDirtyVertex();
 
-			if (bgfx::kInvalidHandle == bc.vertexBufferHandleIdx )
+			if (vertexCount > bc.vertexCapacity)
 			{
-				ibh = bgfx::createDynamicIndexBuffer(
-								bgfx::copy(bc.textBuffer->getIndexBuffer(), indexSize)
-								);
-
-				vbh = bgfx::createDynamicVertexBuffer(
-								  bgfx::copy(bc.textBuffer->getVertexBuffer(), vertexSize)
-								, m_vertexLayout
-								);
+				if (bgfx::kInvalidHandle != bc.vertexBufferHandleIdx)
+				{
+					vbh.idx = bc.vertexBufferHandleIdx;
+					bgfx::destroy(vbh);
+				}
+
+				bc.vertexCapacity = bx::min<uint32_t>(
+					  bx::max(vertexCount, bc.vertexCapacity * 2)
+					, MAX_BUFFERED_CHARACTERS * 4
+					);
 
-				bc.indexBufferHandleIdx = ibh.idx;
+				vbh = bgfx::createDynamicVertexBuffer(bc.vertexCapacity, m_vertexLayout);
 				bc.vertexBufferHandleIdx = vbh.idx;
+				dirtyVertex = 0;
 			}
 			else
 			{
-				ibh.idx = bc.indexBufferHandleIdx;
 				vbh.idx = bc.vertexBufferHandleIdx;
+			}
 
-				bgfx::update(
-					  ibh
-					, 0
-					, bgfx::copy(bc.textBuffer->getIndexBuffer(), indexSize)
-					);
+			// Upload only vertices that were appended, or moved since last submit.
+			if (dirtyVertex < vertexCount)
+			{
+				const uint32_t stride = bc.textBuffer->getVertexSize();
 
 				bgfx::update(
 					  vbh
-					, 0
-					, bgfx::copy(bc.textBuffer->getVertexBuffer(), vertexSize)
+					, dirtyVertex
+					, bgfx::copy(bc.textBuffer->getVertexBuffer() + dirtyVertex * stride, (vertexCount - dirtyVertex) * stride)
 					);
 			}
 
-			bgfx::setVertexBuffer(0, vbh, 0, bc.textBuffer->getVertexCount() );
-			bgfx::setIndexBuffer(ibh, 0, bc.textBuffer->getIndexCount() );
+			bc.textBuffer->resetDirtyVertex();
+
+			bgfx::setVertexBuffer(0, vbh, 0, vertexCount);
 		}
 		break;
 
 	case BufferType::Transient:
 		{
-			bgfx::TransientIndexBuffer tib;
 			bgfx::TransientVertexBuffer tvb;
-			bgfx::allocTransientIndexBuffer(&tib, bc.textBuffer->getIndexCount() );
-			bgfx::allocTransientVertexBuffer(&tvb, bc.textBuffer->getVertexCount(), m_vertexLayout);
-			bx::memCopy(tib.data, bc.textBuffer->getIndexBuffer(), indexSize);
+			bgfx::allocTransientVertexBuffer(&tvb, vertexCount, m_vertexLayout);
 			bx::memCopy(tvb.data, bc.textBuffer->getVertexBuffer(), vertexSize);
-			bgfx::setVertexBuffer(0, &tvb, 0, bc.textBuffer->getVertexCount() );
-			bgfx::setIndexBuffer(&tib, 0, bc.textBuffer->getIndexCount() );
+			bgfx::setVertexBuffer(0, &tvb, 0, vertexCount);
 		}
 		break;
 	}
 
+	bgfx::setIndexBuffer(m_indexBuffer, 0, bc.textBuffer->getIndexCount() );
+
 	bgfx::submit(_id, program, _depth);
 }
 
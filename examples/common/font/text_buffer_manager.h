@@ -84,8 +84,8 @@ public:
 private:
 	struct BufferCache
 	{
-		uint16_t indexBufferHandleIdx;
 		uint16_t vertexBufferHandleIdx;
+		uint32_t vertexCapacity;
 		TextBuffer* textBuffer;
 		BufferType::Enum bufferType;
 		uint32_t fontType;
@@ -95,6 +95,7 @@ private:
 	bx::HandleAllocT<MAX_TEXT_BUFFER_COUNT> m_textBufferHandles;
 	FontManager* m_fontManager;
 	bgfx::VertexLayout m_vertexLayout;
+	bgfx::IndexBufferHandle m_indexBuffer;
 	bgfx::UniformHandle s_texColor;
 	bgfx::UniformHandle u_dropShadowColor;
 	bgfx::UniformHandle u_params;
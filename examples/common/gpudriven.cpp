@@ -0,0 +1,382 @@
+/*
+ * Copyright 2018 Kostas Anagnostou. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/math.h>
+#include "gpudriven.h"
+#include "bgfx_utils.h"
+
+// Stream compaction is done by single work group of 1024 threads, two
+// instances per thread.
+static const uint32_t kMaxInstances = 2048;
+
+static uint32_t roundUpPow2(uint32_t _a)
+{
+	return _a <= 1 ? 1 : 1u << (32 - bx::countLeadingZeros<uint32_t>(_a - 1) );
+}
+
+static bgfx::VertexLayout s_vec4Layout;
+static bgfx::VertexLayout s_mtxLayout;
+
+GpuDriven::GpuDriven()
+	: m_programCopyZ(BGFX_INVALID_HANDLE)
+	, m_programDownscaleHiZ(BGFX_INVALID_HANDLE)
+	, m_programOccludeProps(BGFX_INVALID_HANDLE)
+	, m_programStreamCompaction(BGFX_INVALID_HANDLE)
+	, s_texOcclusionDepth(BGFX_INVALID_HANDLE)
+	, u_inputRTSize(BGFX_INVALID_HANDLE)
+	, u_cullingConfig(BGFX_INVALID_HANDLE)
+	, m_hiZDepthBuffer(BGFX_INVALID_HANDLE)
+	, m_hiZBuffer(BGFX_INVALID_HANDLE)
+	, m_drawcallData(BGFX_INVALID_HANDLE)
+	, m_drawcallInstanceCounts(BGFX_INVALID_HANDLE)
+	, m_instancePredicates(BGFX_INVALID_HANDLE)
+	, m_instanceBoundingBoxes(BGFX_INVALID_HANDLE)
+	, m_instanceBuffer(BGFX_INVALID_HANDLE)
+	, m_culledInstanceBuffer(BGFX_INVALID_HANDLE)
+	, m_indirectBuffer(BGFX_INVALID_HANDLE)
+	, m_hiZWidth(0)
+	, m_hiZHeight(0)
+	, m_maxInstances(0)
+	, m_numInstances(0)
+	, m_maxDrawcalls(0)
+	, m_numDrawcalls(0)
+	, m_numHiZMips(0)
+	, m_valid(false)
+{
+	bx::mtxIdentity(m_view);
+	bx::mtxIdentity(m_proj);
+}
+
+GpuDriven::~GpuDriven()
+{
+	shutdown();
+}
+
+bool GpuDriven::init(uint32_t _width, uint32_t _height, uint32_t _maxInstances, uint16_t _maxDrawcalls)
+{
+	const uint64_t requiredCaps = 0
+		| BGFX_CAPS_INSTANCING
+		| BGFX_CAPS_COMPUTE
+		| BGFX_CAPS_DRAW_INDIRECT
+		;
+
+	if (requiredCaps != (requiredCaps & bgfx::getCaps()->supported) )
+	{
+		return false;
+	}
+
+	if (0 == s_vec4Layout.getStride() )
+	{
+		s_vec4Layout
+			.begin()
+			.add(bgfx::Attrib::TexCoord0, 4, bgfx::AttribType::Float)
+			.end();
+
+		s_mtxLayout
+			.begin()
+			.add(bgfx::Attrib::TexCoord0, 4, bgfx::AttribType::Float)
+			.add(bgfx::Attrib::TexCoord1, 4, bgfx::AttribType::Float)
+			.add(bgfx::Attrib::TexCoord2, 4, bgfx::AttribType::Float)
+			.add(bgfx::Attrib::TexCoord3, 4, bgfx::AttribType::Float)
+			.end();
+	}
+
+	BX_WARN(_maxInstances <= kMaxInstances
+		, "GpuDriven: Max number of instances is %d (requested %d)."
+		, kMaxInstances
+		, _maxInstances
+		);
+
+	m_maxInstances = bx::min(_maxInstances, kMaxInstances);
+	m_maxDrawcalls = _maxDrawcalls;
+	m_numInstances = 0;
+	m_numDrawcalls = 0;
+	m_valid        = false;
+
+	u_inputRTSize       = bgfx::createUniform("u_inputRTSize",       bgfx::UniformType::Vec4);
+	u_cullingConfig     = bgfx::createUniform("u_cullingConfig",     bgfx::UniformType::Vec4);
+	s_texOcclusionDepth = bgfx::createUniform("s_texOcclusionDepth", bgfx::UniformType::Sampler);
+
+	m_programCopyZ            = loadProgram("cs_gdr_copy_z", NULL);
+	m_programDownscaleHiZ     = loadProgram("cs_gdr_downscale_hi_z", NULL);
+	m_programOccludeProps     = loadProgram("cs_gdr_occlude_props", NULL);
+	m_programStreamCompaction = loadProgram("cs_gdr_stream_compaction", NULL);
+
+	// Number of indices, start index and start vertex per drawcall.
+	m_drawcallData = bgfx::createDynamicIndexBuffer(m_maxDrawcalls*3, BGFX_BUFFER_INDEX32 | BGFX_BUFFER_COMPUTE_READ);
+
+	// Number of unoccluded instances per drawcall, written by culling and
+	// reset to zero by compaction. Must start zeroed.
+	const bgfx::Memory* mem = bgfx::alloc(m_maxDrawcalls*sizeof(uint32_t) );
+	bx::memSet(mem->data, 0, mem->size);
+	m_drawcallInstanceCounts = bgfx::createDynamicIndexBuffer(mem, BGFX_BUFFER_INDEX32 | BGFX_BUFFER_COMPUTE_READ_WRITE);
+
+	// Compaction scans pow2 rounded-up number of predicates.
+	m_instancePredicates = bgfx::createDynamicIndexBuffer(kMaxInstances, BGFX_BUFFER_COMPUTE_READ_WRITE);
+
+	m_instanceBoundingBoxes = bgfx::createDynamicVertexBuffer(m_maxInstances*2, s_vec4Layout, BGFX_BUFFER_COMPUTE_READ);
+	m_instanceBuffer        = bgfx::createDynamicVertexBuffer(m_maxInstances,   s_mtxLayout,  BGFX_BUFFER_COMPUTE_READ);
+	m_culledInstanceBuffer  = bgfx::createDynamicVertexBuffer(m_maxInstances,   s_mtxLayout,  BGFX_BUFFER_COMPUTE_WRITE);
+
+	m_indirectBuffer = bgfx::createIndirectBuffer(m_maxDrawcalls);
+
+	createHiZ(_width, _height);
+
+	return true;
+}
+
+void GpuDriven::shutdown()
+{
+	if (!bgfx::isValid(m_indirectBuffer) )
+	{
+		return;
+	}
+
+	destroyHiZ();
+
+	bgfx::destroy(m_programCopyZ);
+	bgfx::destroy(m_programDownscaleHiZ);
+	bgfx::destroy(m_programOccludeProps);
+	bgfx::destroy(m_programStreamCompaction);
+
+	bgfx::destroy(s_texOcclusionDepth);
+	bgfx::destroy(u_inputRTSize);
+	bgfx::destroy(u_cullingConfig);
+
+	bgfx::destroy(m_drawcallData);
+	bgfx::destroy(m_drawcallInstanceCounts);
+	bgfx::destroy(m_instancePredicates);
+	bgfx::destroy(m_instanceBoundingBoxes);
+	bgfx::destroy(m_instanceBuffer);
+	bgfx::destroy(m_culledInstanceBuffer);
+	bgfx::destroy(m_indirectBuffer);
+
+	m_indirectBuffer.idx = bgfx::kInvalidHandle;
+	m_valid = false;
+}
+
+void GpuDriven::createHiZ(uint32_t _width, uint32_t _height)
+{
+	// Largest power of two dimensions not larger than backbuffer.
+	m_hiZWidth  = 1u << (31 - bx::countLeadingZeros<uint32_t>(bx::max<uint32_t>(_width,  1) ) );
+	m_hiZHeight = 1u << (31 - bx::countLeadingZeros<uint32_t>(bx::max<uint32_t>(_height, 1) ) );
+
+	m_numHiZMips = uint8_t(1 + bx::floorLog2(bx::max(m_hiZWidth, m_hiZHeight) ) );
+
+	const uint64_t tsFlags = 0
+		| BGFX_TEXTURE_RT
+		| BGFX_SAMPLER_MIN_POINT
+		| BGFX_SAMPLER_MAG_POINT
+		| BGFX_SAMPLER_MIP_POINT
+		| BGFX_SAMPLER_U_CLAMP
+		| BGFX_SAMPLER_V_CLAMP
+		;
+
+	m_hiZDepthBuffer = bgfx::createFrameBuffer(uint16_t(m_hiZWidth), uint16_t(m_hiZHeight), bgfx::TextureFormat::D32F, tsFlags);
+
+	bgfx::TextureHandle buffer = bgfx::createTexture2D(
+		  uint16_t(m_hiZWidth)
+		, uint16_t(m_hiZHeight)
+		, true
+		, 1
+		, bgfx::TextureFormat::R32F
+		, BGFX_TEXTURE_COMPUTE_WRITE | tsFlags
+		);
+
+	bgfx::Attachment at;
+	at.init(buffer, bgfx::Access::Write, 0, 1, 0, BGFX_RESOLVE_NONE);
+	m_hiZBuffer = bgfx::createFrameBuffer(1, &at, true);
+}
+
+void GpuDriven::destroyHiZ()
+{
+	bgfx::destroy(m_hiZDepthBuffer);
+	bgfx::destroy(m_hiZBuffer);
+}
+
+void GpuDriven::resize(uint32_t _width, uint32_t _height)
+{
+	destroyHiZ();
+	createHiZ(_width, _height);
+}
+
+void GpuDriven::setDrawcalls(const GpuDrivenDrawcall* _drawcalls, uint16_t _num)
+{
+	BX_ASSERT(_num <= m_maxDrawcalls, "Too many drawcalls %d (max: %d).", _num, m_maxDrawcalls);
+	m_numDrawcalls = bx::min(_num, m_maxDrawcalls);
+
+	const bgfx::Memory* mem = bgfx::alloc(m_numDrawcalls*3*sizeof(uint32_t) );
+	uint32_t* data = (uint32_t*)mem->data;
+
+	for (uint16_t ii = 0; ii < m_numDrawcalls; ++ii)
+	{
+		data[ii*3+0] = _drawcalls[ii].m_numIndices;
+		data[ii*3+1] = _drawcalls[ii].m_startIndex;
+		data[ii*3+2] = _drawcalls[ii].m_startVertex;
+	}
+
+	bgfx::update(m_drawcallData, 0, mem);
+}
+
+void GpuDriven::setInstances(const GpuDrivenInstance* _instances, uint32_t _num)
+{
+	BX_ASSERT(_num <= m_maxInstances, "Too many instances %d (max: %d).", _num, m_maxInstances);
+	m_numInstances = bx::min(_num, m_maxInstances);
+
+	updateInstances(0, _instances, m_numInstances);
+}
+
+void GpuDriven::updateInstances(uint32_t _start, const GpuDrivenInstance* _instances, uint32_t _num)
+{
+	if (_start >= m_numInstances)
+	{
+		return;
+	}
+
+	_num = bx::min(_num, m_numInstances - _start);
+
+	const bgfx::Memory* bounds = bgfx::alloc(_num*8*sizeof(float) );
+	const bgfx::Memory* mtx    = bgfx::alloc(_num*16*sizeof(float) );
+
+	float* bb = (float*)bounds->data;
+	float* mm = (float*)mtx->data;
+
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		const GpuDrivenInstance& instance = _instances[ii];
+
+		// Drawcall index is stored in unused w component of AABB min and
+		// in world matrix, so that it's available both to culling and to
+		// vertex shader.
+		bx::memCopy(bb, instance.m_min, 3*sizeof(float) );
+		bb[3] = float(instance.m_drawcall);
+		bx::memCopy(&bb[4], instance.m_max, 3*sizeof(float) );
+		bb[7] = 1.0f;
+		bb += 8;
+
+		bx::memCopy(mm, instance.m_mtx, 16*sizeof(float) );
+		mm[3] = float(instance.m_drawcall);
+		mm += 16;
+	}
+
+	bgfx::update(m_instanceBoundingBoxes, _start*2, bounds);
+	bgfx::update(m_instanceBuffer,        _start,   mtx);
+}
+
+bgfx::ViewId GpuDriven::beginOcclusion(bgfx::ViewId _viewId, const float* _view, const float* _proj)
+{
+	bx::memCopy(m_view, _view, sizeof(m_view) );
+	bx::memCopy(m_proj, _proj, sizeof(m_proj) );
+
+	bgfx::setViewClear(_viewId, BGFX_CLEAR_DEPTH, 0, 1.0f, 0);
+	bgfx::setViewFrameBuffer(_viewId, m_hiZDepthBuffer);
+	bgfx::setViewRect(_viewId, 0, 0, uint16_t(m_hiZWidth), uint16_t(m_hiZHeight) );
+	bgfx::setViewTransform(_viewId, m_view, m_proj);
+	bgfx::touch(_viewId);
+
+	return _viewId;
+}
+
+bgfx::ViewId GpuDriven::cull(bgfx::ViewId _viewId)
+{
+	const bgfx::ViewId downscaleViewId  = _viewId;
+	const bgfx::ViewId occludeViewId    = _viewId + 1;
+	const bgfx::ViewId compactionViewId = _viewId + 2;
+
+	if (0 == m_numInstances
+	||  0 == m_numDrawcalls)
+	{
+		m_valid = false;
+		return compactionViewId + 1;
+	}
+
+	// Copy mip 0 to Hi-Z buffer. Blit can't be used because formats differ.
+	uint32_t width  = m_hiZWidth;
+	uint32_t height = m_hiZHeight;
+
+	{
+		const float inputRTSize[4] = { float(width), float(height), 0.0f, 0.0f };
+		bgfx::setUniform(u_inputRTSize, inputRTSize);
+
+		bgfx::setTexture(0, s_texOcclusionDepth, bgfx::getTexture(m_hiZDepthBuffer, 0) );
+		bgfx::setImage(1, bgfx::getTexture(m_hiZBuffer, 0), 0, bgfx::Access::Write);
+
+		bgfx::dispatch(downscaleViewId, m_programCopyZ, bx::max<uint32_t>(width/16, 1), bx::max<uint32_t>(height/16, 1) );
+	}
+
+	for (uint8_t lod = 1; lod < m_numHiZMips; ++lod)
+	{
+		const float inputRTSize[4] = { float(width), float(height), 2.0f, 2.0f };
+		bgfx::setUniform(u_inputRTSize, inputRTSize);
+
+		width  = bx::max<uint32_t>(width /2, 1);
+		height = bx::max<uint32_t>(height/2, 1);
+
+		bgfx::setImage(0, bgfx::getTexture(m_hiZBuffer, 0), lod - 1, bgfx::Access::Read);
+		bgfx::setImage(1, bgfx::getTexture(m_hiZBuffer, 0), lod,     bgfx::Access::Write);
+
+		bgfx::dispatch(downscaleViewId, m_programDownscaleHiZ, bx::max<uint32_t>(width/16, 1), bx::max<uint32_t>(height/16, 1) );
+	}
+
+	// Test each instance AABB against Hi-Z. Culling writes predicate for
+	// every invocation, so dispatch covers whole pow2 range scanned by
+	// compaction, and tail is zeroed.
+	const uint32_t numInstancesPow2 = bx::max<uint32_t>(roundUpPow2(m_numInstances), 64);
+
+	const float cullingConfig[4] =
+	{
+		float(m_numInstances),
+		float(numInstancesPow2),
+		float(m_numHiZMips),
+		float(m_numDrawcalls),
+	};
+
+	{
+		bgfx::setTexture(0, s_texOcclusionDepth, bgfx::getTexture(m_hiZBuffer, 0) );
+
+		bgfx::setBuffer(1, m_instanceBoundingBoxes,  bgfx::Access::Read);
+		bgfx::setBuffer(2, m_drawcallInstanceCounts, bgfx::Access::ReadWrite);
+		bgfx::setBuffer(3, m_instancePredicates,     bgfx::Access::Write);
+
+		const float inputRTSize[4] = { float(m_hiZWidth), float(m_hiZHeight), 1.0f/float(m_hiZWidth), 1.0f/float(m_hiZHeight) };
+		bgfx::setUniform(u_inputRTSize, inputRTSize);
+		bgfx::setUniform(u_cullingConfig, cullingConfig);
+
+		// Shader receives u_viewProj from view transform.
+		bgfx::setViewTransform(occludeViewId, m_view, m_proj);
+
+		bgfx::dispatch(occludeViewId, m_programOccludeProps, numInstancesPow2/64, 1, 1);
+	}
+
+	// Compact visible instances and write indirect draw arguments.
+	{
+		bgfx::setBuffer(0, m_drawcallData,           bgfx::Access::Read);
+		bgfx::setBuffer(1, m_instanceBuffer,         bgfx::Access::Read);
+		bgfx::setBuffer(2, m_instancePredicates,     bgfx::Access::Read);
+		bgfx::setBuffer(3, m_drawcallInstanceCounts, bgfx::Access::ReadWrite);
+		bgfx::setBuffer(4, m_indirectBuffer,         bgfx::Access::ReadWrite);
+		bgfx::setBuffer(5, m_culledInstanceBuffer,   bgfx::Access::Write);
+
+		bgfx::setUniform(u_cullingConfig, cullingConfig);
+
+		bgfx::dispatch(compactionViewId, m_programStreamCompaction, 1, 1, 1);
+	}
+
+	m_valid = true;
+
+	return compactionViewId + 1;
+}
+
+void GpuDriven::submit(bgfx::ViewId _viewId, bgfx::ProgramHandle _program, uint32_t _depth, uint8_t _flags)
+{
+	if (!m_valid)
+	{
+		bgfx::discard(_flags);
+		return;
+	}
+
+	bgfx::setInstanceDataBuffer(m_culledInstanceBuffer, 0, m_numInstances);
+	bgfx::submit(_viewId, _program, m_indirectBuffer, 0, m_numDrawcalls, _depth, _flags);
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2018 Kostas Anagnostou. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef GPUDRIVEN_H_HEADER_GUARD
+#define GPUDRIVEN_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+
+/// Per drawcall constant data. All drawcalls index into the same vertex and
+/// index buffer, selected by the caller before `GpuDriven::submit`.
+struct GpuDrivenDrawcall
+{
+	uint32_t m_numIndices;  //!< Number of indices.
+	uint32_t m_startIndex;  //!< First index in shared index buffer.
+	uint32_t m_startVertex; //!< First vertex in shared vertex buffer.
+};
+
+/// Per instance data.
+struct GpuDrivenInstance
+{
+	float    m_mtx[16];  //!< World matrix. Element 3 is overwritten with `m_drawcall`.
+	float    m_min[3];   //!< World space AABB min.
+	float    m_max[3];   //!< World space AABB max.
+	uint16_t m_drawcall; //!< Drawcall index.
+};
+
+/// GPU occlusion culling and indirect draw generation.
+///
+/// Usage:
+///   1. `setDrawcalls` and `setInstances` whenever scene changes.
+///   2. `beginOcclusion`, submit occluders to returned view.
+///   3. `cull`, dispatches Hi-Z downscale, culling and stream compaction.
+///   4. Set vertex/index buffer and state, then `submit`.
+///
+/// Instances must be sorted by drawcall. Culled instance data is 4 x vec4
+/// per instance (world matrix), bound as instance data buffer on submit.
+///
+class GpuDriven
+{
+public:
+	///
+	GpuDriven();
+
+	///
+	~GpuDriven();
+
+	/// Returns false if compute, instancing or draw indirect are not supported.
+	bool init(uint32_t _width, uint32_t _height, uint32_t _maxInstances, uint16_t _maxDrawcalls);
+
+	///
+	void shutdown();
+
+	/// Recreates Hi-Z buffers when backbuffer size changes.
+	void resize(uint32_t _width, uint32_t _height);
+
+	///
+	void setDrawcalls(const GpuDrivenDrawcall* _drawcalls, uint16_t _num);
+
+	///
+	void setInstances(const GpuDrivenInstance* _instances, uint32_t _num);
+
+	/// Update subset of instances previously set with `setInstances`.
+	void updateInstances(uint32_t _start, const GpuDrivenInstance* _instances, uint32_t _num);
+
+	/// Setup occluder depth pass, returns view to which occluders should be submitted.
+	bgfx::ViewId beginOcclusion(bgfx::ViewId _viewId, const float* _view, const float* _proj);
+
+	/// Dispatch Hi-Z downscale, culling and compaction to views `_viewId` to `_viewId+2`.
+	/// Returns next unused view.
+	bgfx::ViewId cull(bgfx::ViewId _viewId);
+
+	/// Submit all visible instances. Vertex/index buffer and state must be set.
+	void submit(bgfx::ViewId _viewId, bgfx::ProgramHandle _program, uint32_t _depth = 0, uint8_t _flags = BGFX_DISCARD_ALL);
+
+	/// Returns true when results of `cull` are available for `submit`.
+	bool isValid() const
+	{
+		return m_valid;
+	}
+
+	///
+	bgfx::IndirectBufferHandle getIndirectBuffer() const
+	{
+		return m_indirectBuffer;
+	}
+
+	///
+	bgfx::DynamicVertexBufferHandle getInstanceBuffer() const
+	{
+		return m_culledInstanceBuffer;
+	}
+
+	///
+	uint32_t getNumInstances() const
+	{
+		return m_numInstances;
+	}
+
+	///
+	uint16_t getNumDrawcalls() const
+	{
+		return m_numDrawcalls;
+	}
+
+private:
+	void createHiZ(uint32_t _width, uint32_t _height);
+	void destroyHiZ();
+
+	bgfx::ProgramHandle m_programCopyZ;
+	bgfx::ProgramHandle m_programDownscaleHiZ;
+	bgfx::ProgramHandle m_programOccludeProps;
+	bgfx::ProgramHandle m_programStreamCompaction;
+
+	bgfx::UniformHandle s_texOcclusionDepth;
+	bgfx::UniformHandle u_inputRTSize;
+	bgfx::UniformHandle u_cullingConfig;
+
+	bgfx::FrameBufferHandle m_hiZDepthBuffer;
+	bgfx::FrameBufferHandle m_hiZBuffer;
+
+	bgfx::DynamicIndexBufferHandle  m_drawcallData;
+	bgfx::DynamicIndexBufferHandle  m_drawcallInstanceCounts;
+	bgfx::DynamicIndexBufferHandle  m_instancePredicates;
+	bgfx::DynamicVertexBufferHandle m_instanceBoundingBoxes;
+	bgfx::DynamicVertexBufferHandle m_instanceBuffer;
+	bgfx::DynamicVertexBufferHandle m_culledInstanceBuffer;
+	bgfx::IndirectBufferHandle      m_indirectBuffer;
+
+	float m_view[16];
+	float m_proj[16];
+
+	uint32_t m_hiZWidth;
+	uint32_t m_hiZHeight;
+	uint32_t m_maxInstances;
+	uint32_t m_numInstances;
+	uint16_t m_maxDrawcalls;
+	uint16_t m_numDrawcalls;
+	uint8_t  m_numHiZMips;
+	bool     m_valid;
+};
+
+#endif // GPUDRIVEN_H_HEADER_GUARD
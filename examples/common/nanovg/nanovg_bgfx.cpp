@@ -145,6 +145,7 @@ namespace
 		bgfx::TextureHandle texMissing;
 
 		bgfx::TransientVertexBuffer tvb;
+		bgfx::TransientIndexBuffer tib;
 		bgfx::ViewId viewId;
 
 		struct GLNVGtexture* textures;
@@ -169,6 +170,15 @@ namespace
 		unsigned char* uniforms;
 		int cuniforms;
 		int nuniforms;
+		uint32_t nindices;
+
+		// Per flush index buffer, and pending batch
+		uint32_t indexCount;
+		uint32_t indexOffset;
+		uint32_t batchFirst;
+		uint64_t batchState;
+		int batchUniformOffset;
+		int batchImage;
 	};
 
 	static struct GLNVGtexture* glnvg__allocTexture(struct GLNVGcontext* gl)
@@ -553,24 +563,124 @@ namespace
 		bgfx::setViewRect(gl->viewId, 0, 0, width * devicePixelRatio, height * devicePixelRatio);
 	}
 
-	static void fan(uint32_t _start, uint32_t _count)
+	static uint32_t glnvg__fanIndexCount(int count)
 	{
-		uint32_t numTris = _count-2;
-		BX_ASSERT(_count >= 3, "less than one triangle");
-		BX_ASSERT(_start + ((numTris - 1) * 3) + 2 <= UINT16_MAX, "index overflow");
-		bgfx::TransientIndexBuffer tib;
-		bgfx::allocTransientIndexBuffer(&tib, numTris*3);
-		BX_ASSERT(tib.size == numTris*3*(tib.isIndex16 ? 2 : 4), "did not get enough room for indices");
+		return 2 < count ? uint32_t(count-2)*3 : 0;
+	}
 
-		uint16_t* data = (uint16_t*)tib.data;
-		for (uint32_t ii = 0; ii < numTris; ++ii)
+	static uint16_t* glnvg__allocIndices(struct GLNVGcontext* gl, uint32_t num)
+	{
+		if (gl->indexOffset + num > gl->indexCount)
 		{
-			data[ii*3+0] = uint16_t(_start);
-			data[ii*3+1] = uint16_t(_start + ii + 1);
-			data[ii*3+2] = uint16_t(_start + ii + 2);
+			return NULL;
 		}
 
-		bgfx::setIndexBuffer(&tib);
+		uint16_t* indices = &( (uint16_t*)gl->tib.data)[gl->indexOffset];
+		gl->indexOffset += num;
+		return indices;
+	}
+
+	static void glnvg__fanIndices(struct GLNVGcontext* gl, int start, int count)
+	{
+		const uint32_t numTris = glnvg__fanIndexCount(count)/3;
+		uint16_t* data = glnvg__allocIndices(gl, numTris*3);
+
+		if (NULL != data)
+		{
+			for (uint32_t ii = 0; ii < numTris; ++ii)
+			{
+				data[ii*3+0] = uint16_t(start);
+				data[ii*3+1] = uint16_t(start + ii + 1);
+				data[ii*3+2] = uint16_t(start + ii + 2);
+			}
+		}
+	}
+
+	static void glnvg__stripIndices(struct GLNVGcontext* gl, int start, int count)
+	{
+		const uint32_t numTris = glnvg__fanIndexCount(count)/3;
+		uint16_t* data = glnvg__allocIndices(gl, numTris*3);
+
+		if (NULL != data)
+		{
+			// Flip every other triangle to keep strip winding.
+			for (uint32_t ii = 0; ii < numTris; ++ii)
+			{
+				const uint32_t odd = ii&1;
+				data[ii*3+0] = uint16_t(start + ii + odd);
+				data[ii*3+1] = uint16_t(start + ii + 1 - odd);
+				data[ii*3+2] = uint16_t(start + ii + 2);
+			}
+		}
+	}
+
+	static void glnvg__listIndices(struct GLNVGcontext* gl, int start, int count)
+	{
+		const uint32_t num = uint32_t(count/3)*3;
+		uint16_t* data = glnvg__allocIndices(gl, num);
+
+		if (NULL != data)
+		{
+			for (uint32_t ii = 0; ii < num; ++ii)
+			{
+				data[ii] = uint16_t(start + ii);
+			}
+		}
+	}
+
+	static void glnvg__submit(struct GLNVGcontext* gl, uint32_t first, uint64_t state, uint32_t fstencil = BGFX_STENCIL_NONE, uint32_t bstencil = BGFX_STENCIL_NONE)
+	{
+		const uint32_t num = gl->indexOffset - first;
+
+		if (0 < num)
+		{
+			bgfx::setState(state);
+			bgfx::setStencil(fstencil, bstencil);
+			bgfx::setVertexBuffer(0, &gl->tvb);
+			bgfx::setIndexBuffer(&gl->tib, first, num);
+			bgfx::setTexture(0, gl->s_tex, gl->th);
+			bgfx::submit(gl->viewId, gl->prog);
+		}
+	}
+
+	static void glnvg__flushBatch(struct GLNVGcontext* gl)
+	{
+		if (gl->batchFirst < gl->indexOffset)
+		{
+			nvgRenderSetUniforms(gl, gl->batchUniformOffset, gl->batchImage);
+			glnvg__submit(gl, gl->batchFirst, gl->batchState);
+		}
+
+		gl->batchFirst = gl->indexOffset;
+	}
+
+	// Consecutive calls that don't use stencil, and share state, image, and paint are merged into
+	// single draw.
+	static void glnvg__beginBatch(struct GLNVGcontext* gl, struct GLNVGcall* call)
+	{
+		if (gl->batchFirst < gl->indexOffset)
+		{
+			const bool compatible = true
+				&& gl->batchState == gl->state
+				&& gl->batchImage == call->image
+				&& 0 == bx::memCmp(
+					  nvg__fragUniformPtr(gl, gl->batchUniformOffset)
+					, nvg__fragUniformPtr(gl, call->uniformOffset)
+					, sizeof(struct GLNVGfragUniforms)
+					)
+				;
+
+			if (compatible)
+			{
+				return;
+			}
+
+			glnvg__flushBatch(gl);
+		}
+
+		gl->batchState         = gl->state;
+		gl->batchUniformOffset = call->uniformOffset;
+		gl->batchImage         = call->image;
 	}
 
 	static void glnvg__fill(struct GLNVGcontext* gl, struct GLNVGcall* call)
@@ -578,70 +688,72 @@ namespace
 		struct GLNVGpath* paths = &gl->paths[call->pathOffset];
 		int i, npaths = call->pathCount;
 
-		// set bindpoint for solid loc
-		nvgRenderSetUniforms(gl, call->uniformOffset, 0);
+		glnvg__flushBatch(gl);
 
+		uint32_t first = gl->indexOffset;
 		for (i = 0; i < npaths; i++)
 		{
-			if (2 < paths[i].fillCount)
-			{
-				bgfx::setState(0);
-				bgfx::setStencil(0
-					| BGFX_STENCIL_TEST_ALWAYS
-					| BGFX_STENCIL_FUNC_RMASK(0xff)
-					| BGFX_STENCIL_OP_FAIL_S_KEEP
-					| BGFX_STENCIL_OP_FAIL_Z_KEEP
-					| BGFX_STENCIL_OP_PASS_Z_INCR
-					, 0
-					| BGFX_STENCIL_TEST_ALWAYS
-					| BGFX_STENCIL_FUNC_RMASK(0xff)
-					| BGFX_STENCIL_OP_FAIL_S_KEEP
-					| BGFX_STENCIL_OP_FAIL_Z_KEEP
-					| BGFX_STENCIL_OP_PASS_Z_DECR
-					);
-				bgfx::setVertexBuffer(0, &gl->tvb);
-				bgfx::setTexture(0, gl->s_tex, gl->th);
-				fan(paths[i].fillOffset, paths[i].fillCount);
-				bgfx::submit(gl->viewId, gl->prog);
-			}
+			glnvg__fanIndices(gl, paths[i].fillOffset, paths[i].fillCount);
 		}
 
+		// set bindpoint for solid loc
+		nvgRenderSetUniforms(gl, call->uniformOffset, 0);
+		glnvg__submit(gl
+			, first
+			, 0
+			, 0
+			| BGFX_STENCIL_TEST_ALWAYS
+			| BGFX_STENCIL_FUNC_RMASK(0xff)
+			| BGFX_STENCIL_OP_FAIL_S_KEEP
+			| BGFX_STENCIL_OP_FAIL_Z_KEEP
+			| BGFX_STENCIL_OP_PASS_Z_INCR
+			, 0
+			| BGFX_STENCIL_TEST_ALWAYS
+			| BGFX_STENCIL_FUNC_RMASK(0xff)
+			| BGFX_STENCIL_OP_FAIL_S_KEEP
+			| BGFX_STENCIL_OP_FAIL_Z_KEEP
+			| BGFX_STENCIL_OP_PASS_Z_DECR
+			);
+
 		// Draw aliased off-pixels
 		nvgRenderSetUniforms(gl, call->uniformOffset + gl->fragSize, call->image);
 
 		if (gl->edgeAntiAlias)
 		{
 			// Draw fringes
+			first = gl->indexOffset;
 			for (i = 0; i < npaths; i++)
 			{
-				bgfx::setState(gl->state
-					| BGFX_STATE_PT_TRISTRIP
-					);
-				bgfx::setStencil(0
-					| BGFX_STENCIL_TEST_EQUAL
-					| BGFX_STENCIL_FUNC_RMASK(0xff)
-					| BGFX_STENCIL_OP_FAIL_S_KEEP
-					| BGFX_STENCIL_OP_FAIL_Z_KEEP
-					| BGFX_STENCIL_OP_PASS_Z_KEEP
-					);
-				bgfx::setVertexBuffer(0, &gl->tvb, paths[i].strokeOffset, paths[i].strokeCount);
-				bgfx::setTexture(0, gl->s_tex, gl->th);
-				bgfx::submit(gl->viewId, gl->prog);
+				glnvg__stripIndices(gl, paths[i].strokeOffset, paths[i].strokeCount);
 			}
-		}
 
-		// Draw fill
-		bgfx::setState(gl->state);
-		bgfx::setVertexBuffer(0, &gl->tvb, call->vertexOffset, call->vertexCount);
-		bgfx::setTexture(0, gl->s_tex, gl->th);
-		bgfx::setStencil(0
-				| BGFX_STENCIL_TEST_NOTEQUAL
+			glnvg__submit(gl
+				, first
+				, gl->state
+				, 0
+				| BGFX_STENCIL_TEST_EQUAL
 				| BGFX_STENCIL_FUNC_RMASK(0xff)
-				| BGFX_STENCIL_OP_FAIL_S_ZERO
-				| BGFX_STENCIL_OP_FAIL_Z_ZERO
-				| BGFX_STENCIL_OP_PASS_Z_ZERO
+				| BGFX_STENCIL_OP_FAIL_S_KEEP
+				| BGFX_STENCIL_OP_FAIL_Z_KEEP
+				| BGFX_STENCIL_OP_PASS_Z_KEEP
 				);
-		bgfx::submit(gl->viewId, gl->prog);
+		}
+
+		// Draw fill
+		first = gl->indexOffset;
+		glnvg__listIndices(gl, call->vertexOffset, call->vertexCount);
+		glnvg__submit(gl
+			, first
+			, gl->state
+			, 0
+			| BGFX_STENCIL_TEST_NOTEQUAL
+			| BGFX_STENCIL_FUNC_RMASK(0xff)
+			| BGFX_STENCIL_OP_FAIL_S_ZERO
+			| BGFX_STENCIL_OP_FAIL_Z_ZERO
+			| BGFX_STENCIL_OP_PASS_Z_ZERO
+			);
+
+		gl->batchFirst = gl->indexOffset;
 	}
 
 	static void glnvg__convexFill(struct GLNVGcontext* gl, struct GLNVGcall* call)
@@ -649,16 +761,11 @@ namespace
 		struct GLNVGpath* paths = &gl->paths[call->pathOffset];
 		int i, npaths = call->pathCount;
 
-		nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
+		glnvg__beginBatch(gl, call);
 
 		for (i = 0; i < npaths; i++)
 		{
-			if (paths[i].fillCount == 0) continue;
-			bgfx::setState(gl->state);
-			bgfx::setVertexBuffer(0, &gl->tvb);
-			bgfx::setTexture(0, gl->s_tex, gl->th);
-			fan(paths[i].fillOffset, paths[i].fillCount);
-			bgfx::submit(gl->viewId, gl->prog);
+			glnvg__fanIndices(gl, paths[i].fillOffset, paths[i].fillCount);
 		}
 
 		if (gl->edgeAntiAlias)
@@ -666,12 +773,7 @@ namespace
 			// Draw fringes
 			for (i = 0; i < npaths; i++)
 			{
-				bgfx::setState(gl->state
-					| BGFX_STATE_PT_TRISTRIP
-					);
-				bgfx::setVertexBuffer(0, &gl->tvb, paths[i].strokeOffset, paths[i].strokeCount);
-				bgfx::setTexture(0, gl->s_tex, gl->th);
-				bgfx::submit(gl->viewId, gl->prog);
+				glnvg__stripIndices(gl, paths[i].strokeOffset, paths[i].strokeCount);
 			}
 		}
 	}
@@ -681,17 +783,12 @@ namespace
 		struct GLNVGpath* paths = &gl->paths[call->pathOffset];
 		int npaths = call->pathCount, i;
 
-		nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
+		glnvg__beginBatch(gl, call);
 
 		// Draw Strokes
 		for (i = 0; i < npaths; i++)
 		{
-			bgfx::setState(gl->state
-				| BGFX_STATE_PT_TRISTRIP
-				);
-			bgfx::setVertexBuffer(0, &gl->tvb, paths[i].strokeOffset, paths[i].strokeCount);
-			bgfx::setTexture(0, gl->s_tex, gl->th);
-			bgfx::submit(gl->viewId, gl->prog);
+			glnvg__stripIndices(gl, paths[i].strokeOffset, paths[i].strokeCount);
 		}
 	}
 
@@ -699,12 +796,8 @@ namespace
 	{
 		if (3 <= call->vertexCount)
 		{
-			nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
-
-			bgfx::setState(gl->state);
-			bgfx::setVertexBuffer(0, &gl->tvb, call->vertexOffset, call->vertexCount);
-			bgfx::setTexture(0, gl->s_tex, gl->th);
-			bgfx::submit(gl->viewId, gl->prog);
+			glnvg__beginBatch(gl, call);
+			glnvg__listIndices(gl, call->vertexOffset, call->vertexCount);
 		}
 	}
 
@@ -777,6 +870,21 @@ namespace
 
 			bx::memCopy(gl->tvb.data, gl->verts, gl->nverts * sizeof(struct NVGvertex) );
 
+			gl->indexCount = bgfx::getAvailTransientIndexBuffer(gl->nindices);
+			if (gl->indexCount < gl->nindices)
+			{
+				BX_WARN(true, "Index number truncated due to transient index buffer overflow");
+			}
+
+			if (0 == gl->indexCount)
+			{
+				goto _cleanup;
+			}
+
+			bgfx::allocTransientIndexBuffer(&gl->tib, gl->indexCount);
+			gl->indexOffset = 0;
+			gl->batchFirst  = 0;
+
 			bgfx::setUniform(gl->u_viewSize, gl->view);
 
 			for (uint32_t ii = 0, num = gl->ncalls; ii < num; ++ii)
@@ -806,6 +914,8 @@ namespace
 					break;
 				}
 			}
+
+			glnvg__flushBatch(gl);
 		}
 
 _cleanup:
@@ -814,6 +924,7 @@ _cleanup:
 		gl->npaths    = 0;
 		gl->ncalls    = 0;
 		gl->nuniforms = 0;
+		gl->nindices  = 0;
 	}
 
 	static int glnvg__maxVertCount(const struct NVGpath* paths, int npaths)
@@ -952,6 +1063,7 @@ _cleanup:
 				copy->fillCount = path->nfill;
 				bx::memCopy(&gl->verts[offset], path->fill, sizeof(struct NVGvertex) * path->nfill);
 				offset += path->nfill;
+				gl->nindices += glnvg__fanIndexCount(path->nfill);
 			}
 
 			if (path->nstroke > 0)
@@ -960,6 +1072,7 @@ _cleanup:
 				copy->strokeCount = path->nstroke;
 				bx::memCopy(&gl->verts[offset], path->stroke, sizeof(struct NVGvertex) * path->nstroke);
 				offset += path->nstroke;
+				gl->nindices += gl->edgeAntiAlias ? glnvg__fanIndexCount(path->nstroke) : 0;
 			}
 		}
 
@@ -978,6 +1091,7 @@ _cleanup:
 		// Setup uniforms for draw calls
 		if (call->type == GLNVG_FILL)
 		{
+			gl->nindices += call->vertexCount;
 			call->uniformOffset = glnvg__allocFragUniforms(gl, 2);
 			// Simple shader for stencil
 			frag = nvg__fragUniformPtr(gl, call->uniformOffset);
@@ -1033,6 +1147,7 @@ _cleanup:
 				copy->strokeCount = path->nstroke;
 				bx::memCopy(&gl->verts[offset], path->stroke, sizeof(struct NVGvertex) * path->nstroke);
 				offset += path->nstroke;
+				gl->nindices += glnvg__fanIndexCount(path->nstroke);
 			}
 		}
 
@@ -1058,6 +1173,7 @@ _cleanup:
 		call->vertexOffset = glnvg__allocVerts(gl, nverts);
 		call->vertexCount = nverts;
 		bx::memCopy(&gl->verts[call->vertexOffset], verts, sizeof(struct NVGvertex) * nverts);
+		gl->nindices += uint32_t(nverts/3)*3;
 
 		// Fill shader
 		call->uniformOffset = glnvg__allocFragUniforms(gl, 1);
@@ -519,6 +519,7 @@ namespace bgfx
 	/// View id.
 	typedef uint16_t ViewId;
 
+	BGFX_HANDLE(DrawListHandle)
 	BGFX_HANDLE(DynamicIndexBufferHandle)
 	BGFX_HANDLE(DynamicVertexBufferHandle)
 	BGFX_HANDLE(FrameBufferHandle)
@@ -573,6 +574,8 @@ namespace bgfx
 			uint32_t maxTransientVbSize;      //!< Maximum transient vertex buffer size.
 			uint32_t maxTransientIbSize;      //!< Maximum transient index buffer size.
 			uint32_t minUniformBufferSize;    //!< Mimimum uniform buffer size.
+			uint32_t maxPersistentTransforms; //!< Maximum number of persistent transform matrices, 0 when
+			                                  ///  persistent transform buffer is not available.
 		};
 
 		RendererType::Enum rendererType;        //!< Renderer backend type. See: `bgfx::RendererType`
@@ -684,25 +687,29 @@ namespace bgfx
 		{
 			Limits();
 
-			uint16_t maxEncoders;           //!< Maximum number of encoder threads.
-			uint32_t numDrawCalls;          //!< Number of draw calls per frame to reserve storage for. Rounded
-			                                ///  up to a multiple of `BGFX_CONFIG_DRAW_CALL_BLOCK`, which is also
-			                                ///  the minimum. This is a reservation, not a limit: submitting more
-			                                ///  than this grows the storage during the frame, up to
-			                                ///  `BGFX_CONFIG_MAX_DRAW_CALLS`. With
-			                                ///  `BGFX_CONFIG_DYNAMIC_FRAME_STORAGE` disabled nothing grows, and
-			                                ///  this is a hard limit that `Caps::Limits::maxDrawCalls` reports
-			                                ///  back; submissions past it are dropped. See
-			                                ///  `Stats::numDrawCallsPeak` to size it.
-			uint32_t numDrawCallPeakFrames; //!< Number of frames the draw-call peak (high-water mark) is observed
-			                                ///  before unused storage is released. Set to 0 to keep whatever has
-			                                ///  been allocated for the lifetime of the context. With
-			                                ///  `BGFX_CONFIG_DYNAMIC_FRAME_STORAGE` disabled nothing per frame is
-			                                ///  resized at all, and this only releases unused uniform buffer space.
-			uint32_t minResourceCbSize;     //!< Minimum resource command buffer size.
-			uint32_t maxTransientVbSize;    //!< Maximum transient vertex buffer size.
-			uint32_t maxTransientIbSize;    //!< Maximum transient index buffer size.
-			uint32_t minUniformBufferSize;  //!< Mimimum uniform buffer size.
+			uint16_t maxEncoders;             //!< Maximum number of encoder threads.
+			uint32_t numDrawCalls;            //!< Number of draw calls per frame to reserve storage for. Rounded
+			                                  ///  up to a multiple of `BGFX_CONFIG_DRAW_CALL_BLOCK`, which is also
+			                                  ///  the minimum. This is a reservation, not a limit: submitting more
+			                                  ///  than this grows the storage during the frame, up to
+			                                  ///  `BGFX_CONFIG_MAX_DRAW_CALLS`. With
+			                                  ///  `BGFX_CONFIG_DYNAMIC_FRAME_STORAGE` disabled nothing grows, and
+			                                  ///  this is a hard limit that `Caps::Limits::maxDrawCalls` reports
+			                                  ///  back; submissions past it are dropped. See
+			                                  ///  `Stats::numDrawCallsPeak` to size it.
+			uint32_t numDrawCallPeakFrames;   //!< Number of frames the draw-call peak (high-water mark) is observed
+			                                  ///  before unused storage is released. Set to 0 to keep whatever has
+			                                  ///  been allocated for the lifetime of the context. With
+			                                  ///  `BGFX_CONFIG_DYNAMIC_FRAME_STORAGE` disabled nothing per frame is
+			                                  ///  resized at all, and this only releases unused uniform buffer space.
+			uint32_t minResourceCbSize;       //!< Minimum resource command buffer size.
+			uint32_t maxTransientVbSize;      //!< Maximum transient vertex buffer size.
+			uint32_t maxTransientIbSize;      //!< Maximum transient index buffer size.
+			uint32_t minUniformBufferSize;    //!< Mimimum uniform buffer size.
+			uint32_t dynamicIndexBufferSize;  //!< Dynamic index buffer backing store page size.
+			uint32_t dynamicVertexBufferSize; //!< Dynamic vertex buffer backing store page size.
+			uint32_t maxPersistentTransforms; //!< Number of matrices in persistent transform buffer. Set to 0 to
+			                                  ///  disable it. See `bgfx::allocPersistentTransform`.
 		};
 
 		RendererType::Enum type;   //!< Select rendering backend. When set to RendererType::Count
@@ -938,14 +945,30 @@ namespace bgfx
 		uint32_t gpuFrameNum; //!< Frame which generated gpuTimeBegin, gpuTimeEnd.
 	};
 
+	/// GPU region stats.
+	///
+	/// @attention C99's equivalent binding is `bgfx_gpu_region_stats_t`.
+	///
+	struct GpuRegionStats
+	{
+		char name[64];        //!< Region name.
+		int64_t gpuTimeBegin; //!< GPU begin time.
+		int64_t gpuTimeEnd;   //!< GPU end time.
+		uint32_t gpuFrameNum; //!< Frame which generated gpuTimeBegin, gpuTimeEnd.
+	};
+
 	/// Encoder stats.
 	///
 	/// @attention C99's equivalent binding is `bgfx_encoder_stats_t`.
 	///
 	struct EncoderStats
 	{
-		int64_t cpuTimeBegin; //!< Encoder thread CPU submit begin time.
-		int64_t cpuTimeEnd;   //!< Encoder thread CPU submit end time.
+		int64_t cpuTimeBegin;           //!< Encoder thread CPU submit begin time.
+		int64_t cpuTimeEnd;             //!< Encoder thread CPU submit end time.
+		int64_t transientReserveTime;   //!< Time spent reserving transient buffer slabs from frame.
+		uint32_t numTransientAllocs;    //!< Number of transient buffer allocations.
+		uint32_t numTransientSlabs;     //!< Number of transient buffer slabs reserved from frame.
+		uint32_t numTransientContended; //!< Number of slab reservations retried due to contention.
 	};
 
 	/// Renderer statistics data.
@@ -974,12 +997,18 @@ namespace bgfx
 		                                    ///  to tune `Init::Limits::numDrawCalls`.
 		uint32_t maxGpuLatency;             //!< GPU driver latency.
 		uint32_t gpuFrameNum;               //!< Frame which generated gpuTimeBegin, gpuTimeEnd.
+		uint32_t numVertexArrayBinds;       //!< Number of vertex array object binds (OpenGL only).
+		uint32_t numVertexAttribCalls;      //!< Number of vertex input setup calls (OpenGL only).
+		uint32_t uniformBytesSkipped;       //!< Bytes of per-draw uniform data not committed because values
+		                                    ///  were same as already set.
 		uint16_t numDynamicIndexBuffers;    //!< Number of used dynamic index buffers.
 		uint16_t numDynamicVertexBuffers;   //!< Number of used dynamic vertex buffers.
 		uint16_t numFrameBuffers;           //!< Number of used frame buffers.
 		uint16_t numIndexBuffers;           //!< Number of used index buffers.
 		uint16_t numOcclusionQueries;       //!< Number of used occlusion queries.
 		uint16_t numPrograms;               //!< Number of used programs.
+		uint16_t numProgramsPending;        //!< Number of programs still being compiled and linked, draws
+		                                    ///  using them are skipped (OpenGL only).
 		uint16_t numShaders;                //!< Number of used shaders.
 		uint16_t numTextures;               //!< Number of used textures.
 		uint16_t numUniforms;               //!< Number of used uniforms.
@@ -987,8 +1016,17 @@ namespace bgfx
 		uint16_t numVertexLayouts;          //!< Number of used vertex layouts.
 		int64_t textureMemoryUsed;          //!< Estimate of texture memory used.
 		int64_t rtMemoryUsed;               //!< Estimate of render target memory used.
+		int64_t textureMemoryResident;      //!< Estimate of texture memory used by mips at or above min LOD,
+		                                    ///  see `bgfx::setTextureMinLod`.
 		int32_t transientVbUsed;            //!< Amount of transient vertex buffer used.
 		int32_t transientIbUsed;            //!< Amount of transient index buffer used.
+		uint32_t dynIbNumFreeBlocks;        //!< Number of free blocks in dynamic index buffer backing store.
+		uint32_t dynIbLargestFreeBlock;     //!< Largest free block in dynamic index buffer backing store. Many
+		                                    ///  small free blocks indicate fragmented backing store.
+		uint32_t dynVbNumFreeBlocks;        //!< Number of free blocks in dynamic vertex buffer backing store.
+		uint32_t dynVbLargestFreeBlock;     //!< Largest free block in dynamic vertex buffer backing store.
+		uint32_t uniformNumFreeBlocks;      //!< Number of free blocks in view uniform store.
+		uint32_t uniformLargestFreeBlock;   //!< Largest free block in view uniform store.
 		uint32_t numPrims[Topology::Count]; //!< Number of primitives rendered.
 		int64_t gpuMemoryMax;               //!< Maximum available GPU memory for application.
 		int64_t gpuMemoryUsed;              //!< Amount of GPU memory used by the application.
@@ -998,6 +1036,8 @@ namespace bgfx
 		uint16_t textHeight;                //!< Debug text height in characters.
 		uint16_t numViews;                  //!< Number of view stats.
 		ViewStats* viewStats;               //!< Array of View stats.
+		uint16_t numGpuRegions;             //!< Number of GPU region stats.
+		GpuRegionStats* gpuRegionStats;     //!< Array of GPU region stats.
 		uint8_t numEncoders;                //!< Number of encoders used during frame.
 		EncoderStats* encoderStats;         //!< Array of encoder stats.
 	};
@@ -1138,6 +1178,31 @@ namespace bgfx
 			, int32_t _len = INT32_MAX
 			);
 
+		/// Begin GPU timing region. Draw and compute calls submitted until matching
+		/// `profilerEndGpu` are attributed to region, and region is timed from first to
+		/// last of them in sorted order. Regions can be nested.
+		///
+		/// @param[in] _name Region name.
+		/// @param[in] _len Region name length (if length is INT32_MAX, it's expected
+		///   that _name is zero terminated string.
+		///
+		/// @remarks
+		///   Results are returned few frames later through `Stats::gpuRegionStats`.
+		///   Supported by OpenGL and Vulkan renderers.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_profiler_begin_gpu`.
+		///
+		void profilerBeginGpu(
+			  const char* _name
+			, int32_t _len = INT32_MAX
+			);
+
+		/// End GPU timing region.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_profiler_end_gpu`.
+		///
+		void profilerEndGpu();
+
 		/// Set render states for draw primitive.
 		///
 		/// @param[in] _state State flags. Default state for primitive type is
@@ -1170,16 +1235,25 @@ namespace bgfx
 			, uint32_t _rgba = 0
 			);
 
-		/// Set condition for rendering.
+		/// Set condition for rendering. Condition applies to next draw call or compute
+		/// dispatch.
 		///
 		/// @param[in] _handle Occlusion query handle.
 		/// @param[in] _visible Render if occlusion query is visible.
+		/// @param[in] _current Use query result from current frame.
+		///
+		/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+		///   draw call is predicated on GPU with result of query issued in earlier view
+		///   of the same frame. Otherwise last query result available on CPU is used.
+		///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+		///   conditional rendering doesn't apply to compute.
 		///
 		/// @attention C99's equivalent binding is `bgfx_encoder_set_condition`.
 		///
 		void setCondition(
 			  OcclusionQueryHandle _handle
 			, bool _visible
+			, bool _current = false
 			);
 
 		/// Set stencil test state.
@@ -1255,6 +1329,16 @@ namespace bgfx
 			, uint16_t _num = 1
 			);
 
+		/// Set persistent transform index for draw primitive. Persistent transform
+		/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+		/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+		///
+		/// @param[in] _index Index in persistent transform buffer.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_set_persistent_transform`.
+		///
+		void setPersistentTransform(uint32_t _index);
+
 		/// Reserve matrices in internal matrix cache.
 		///
 		/// @param[out] _transform Pointer to `Transform` structure.
@@ -1271,6 +1355,60 @@ namespace bgfx
 			, uint16_t _num
 			);
 
+		/// Allocate transient index buffer from encoder's slab of frame's transient
+		/// index buffer. Slabs are reserved with single atomic operation, and
+		/// allocations within slab don't take any lock.
+		///
+		/// @param[out] _tib TransientIndexBuffer structure will be filled, and will be valid
+		///   for the duration of frame, and can be reused for multiple draw
+		///   calls.
+		/// @param[in] _num Number of indices to allocate.
+		/// @param[in] _index32 Set to `true` if input indices will be 32-bit.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_alloc_transient_index_buffer`.
+		///
+		void allocTransientIndexBuffer(
+			  TransientIndexBuffer* _tib
+			, uint32_t _num
+			, bool _index32 = false
+			);
+
+		/// Allocate transient vertex buffer from encoder's slab of frame's transient
+		/// vertex buffer. Slabs are reserved with single atomic operation, and
+		/// allocations within slab don't take any lock.
+		///
+		/// @param[out] _tvb TransientVertexBuffer structure will be filled, and will be valid
+		///   for the duration of frame, and can be reused for multiple draw
+		///   calls.
+		/// @param[in] _num Number of vertices to allocate.
+		/// @param[in] _layoutHandle Vertex layout, created with `createVertexLayout`.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_alloc_transient_vertex_buffer`.
+		///
+		void allocTransientVertexBuffer(
+			  TransientVertexBuffer* _tvb
+			, uint32_t _num
+			, VertexLayoutHandle _layoutHandle
+			);
+
+		/// Allocate instance data buffer from encoder's slab of frame's transient
+		/// vertex buffer. Slabs are reserved with single atomic operation, and
+		/// allocations within slab don't take any lock.
+		///
+		/// @param[out] _idb InstanceDataBuffer structure will be filled, and will be valid
+		///   for duration of frame, and can be reused for multiple draw
+		///   calls.
+		/// @param[in] _num Number of instances.
+		/// @param[in] _stride Instance stride. Must be multiple of 16.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_alloc_instance_data_buffer`.
+		///
+		void allocInstanceDataBuffer(
+			  InstanceDataBuffer* _idb
+			, uint32_t _num
+			, uint16_t _stride
+			);
+
 		/// Set shader uniform parameter for draw primitive.
 		///
 		/// @param[in] _handle Uniform.
@@ -1891,6 +2029,51 @@ namespace bgfx
 			, uint16_t _height = UINT16_MAX
 			, uint16_t _depth = UINT16_MAX
 			);
+
+		/// Start recording draw list. All following submits on this encoder are
+		/// captured into draw list instead of being submitted to the frame, until
+		/// `bgfx::Encoder::endDrawList` is called.
+		///
+		/// @remarks
+		///   Recording must begin and end within the same frame. Draw calls using transient
+		///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+		///   occlusion queries, are dropped.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_begin_draw_list`.
+		///
+		void beginDrawList();
+
+		/// End recording draw list.
+		///
+		/// @returns Handle to draw list object, or invalid handle if nothing was recorded.
+		///
+		/// @remarks
+		///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+		///   indirect buffers it uses. They can be destroyed while draw list is alive,
+		///   but they are released only after draw list is destroyed.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_end_draw_list`.
+		///
+		DrawListHandle endDrawList();
+
+		/// Submit previously recorded draw list for rendering. Draw state, bindings,
+		/// uniforms and sort keys captured during recording are replayed into view.
+		///
+		/// @param[in] _id View id.
+		/// @param[in] _drawList Draw list.
+		/// @param[in] _mtx Base transform applied to all recorded transforms. It can be
+		///   `NULL` if recorded transforms are used as is.
+		///
+		/// @remarks
+		///   Encoder state set before this call is not used, and it's not cleared.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_submit_draw_list`.
+		///
+		void submit(
+			  ViewId _id
+			, DrawListHandle _drawList
+			, const void* _mtx = NULL
+			);
 	};
 
 	/// Callback interface to implement application specific behavior.
@@ -2758,6 +2941,43 @@ namespace bgfx
 	///
 	void destroy(DynamicVertexBufferHandle _handle);
 
+	/// Allocate matrices in persistent transform buffer. Matrices keep their
+	/// index and value across frames until freed, and only matrices modified
+	/// with `bgfx::updatePersistentTransform` are uploaded on `bgfx::frame`.
+	///
+	/// @param[in] _num Number of matrices.
+	///
+	/// @returns Index of first matrix, or `UINT32_MAX` if buffer is full.
+	///
+	/// @remarks Requires `BGFX_CAPS_COMPUTE`, and `Init::Limits::maxPersistentTransforms`
+	///   to be non-zero.
+	///
+	/// @attention C99's equivalent binding is `bgfx_alloc_persistent_transform`.
+	///
+	uint32_t allocPersistentTransform(uint16_t _num = 1);
+
+	/// Free matrices allocated with `bgfx::allocPersistentTransform`.
+	///
+	/// @param[in] _index Index of first matrix returned by `bgfx::allocPersistentTransform`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_free_persistent_transform`.
+	///
+	void freePersistentTransform(uint32_t _index);
+
+	/// Update matrices in persistent transform buffer.
+	///
+	/// @param[in] _index Index of first matrix.
+	/// @param[in] _mtx Pointer to first matrix in array.
+	/// @param[in] _num Number of matrices in array.
+	///
+	/// @attention C99's equivalent binding is `bgfx_update_persistent_transform`.
+	///
+	void updatePersistentTransform(
+		  uint32_t _index
+		, const void* _mtx
+		, uint16_t _num = 1
+		);
+
 	/// Returns number of requested or maximum available indices.
 	///
 	/// @param[in] _num Number of required indices.
@@ -2989,6 +3209,34 @@ namespace bgfx
 	///
 	void destroy(ProgramHandle _handle);
 
+	/// Set instanced variant of program used for automatic instancing.
+	///
+	/// Consecutive draw calls (after sorting) in the same view that use `handle`
+	/// and differ only in transform are merged into single instanced draw call
+	/// with `instanced` program. Per-instance model matrix is passed as instance
+	/// data `i_data0` to `i_data3`.
+	///
+	/// Instanced vertex shader is compiled from the same source with
+	/// `shaderc --instanced`, which reads `u_model`, `u_modelView`, and
+	/// `u_modelViewProj` from instance data instead of uniforms.
+	///
+	/// @param[in] _handle Program handle.
+	/// @param[in] _instanced Instanced program variant, vertex shader reads
+	///   model matrix from `i_data0` to `i_data3`.
+	///
+	/// @remarks Draw calls with multiple transforms, instance data, indirect
+	///   buffer, occlusion query, or uniforms set between them are not merged.
+	///
+	/// @attention `instanced` program is kept alive until variant is changed,
+	///   or `handle` is destroyed. Pass invalid handle to disable.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_instanced_program`.
+	///
+	void setInstancedProgram(
+		  ProgramHandle _handle
+		, ProgramHandle _instanced
+		);
+
 	/// Validate texture parameters.
 	///
 	/// @param[in] _depth Depth dimension of volume texture.
@@ -3369,6 +3617,28 @@ namespace bgfx
 		, uint8_t _mip = 0
 		);
 
+	/// Set most detailed mip level of texture that is resident. Mip levels above it are not
+	/// sampled, and they are not counted in `Stats::textureMemoryResident`. Texture can be created
+	/// with only tail mips uploaded, and more detailed mips streamed in later with
+	/// `bgfx::updateTexture2D` before lowering min LOD.
+	///
+	/// @param[in] _handle Texture handle.
+	/// @param[in] _minLod Most detailed resident mip level. Use 0 to make whole
+	///   mip chain resident.
+	///
+	/// @remarks Renderer still allocates storage for whole mip chain.
+	///
+	/// @remarks Sampled texture binds start at min LOD, the same as if `firstMip` passed to
+	///   `bgfx::setTexture` was raised to min LOD. Explicit LOD and texture size queries in
+	///   shader are relative to min LOD. Image (storage) binds are not affected.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_texture_min_lod`.
+	///
+	void setTextureMinLod(
+		  TextureHandle _handle
+		, uint8_t _minLod
+		);
+
 	/// Set texture debug name.
 	///
 	/// @param[in] _handle Texture handle.
@@ -4056,6 +4326,48 @@ namespace bgfx
 		, const char* _filePath
 		);
 
+	/// Save recorded trace as Chrome trace-event JSON, which can be opened in Perfetto UI or
+	/// `chrome://tracing`. Trace contains most recent profiler scopes from all threads, and
+	/// per-view GPU timings.
+	///
+	/// @param[in] _filePath Output file path.
+	///
+	/// @returns Returns true if trace was saved.
+	///
+	/// @remarks
+	///   Requires `BGFX_CONFIG_TRACE`. GPU timings require `BGFX_DEBUG_PROFILER` debug flag.
+	///
+	/// @attention C99's equivalent binding is `bgfx_save_trace`.
+	///
+	bool saveTrace(const char* _filePath);
+
+	/// Request capture of resources and sorted frame. Captured frame is written to file when frame
+	/// is rendered, and it can be replayed with `bgfx::replayFrameCapture`.
+	///
+	/// @param[in] _filePath Output file path.
+	///
+	/// @remarks
+	///   Requires `BGFX_CONFIG_CAPTURE`. Only resources created after `bgfx::init` are captured.
+	///
+	/// @attention C99's equivalent binding is `bgfx_request_frame_capture`.
+	///
+	void requestFrameCapture(const char* _filePath);
+
+	/// Replay captured frame instead of submitted frame. Captured resources are created on next
+	/// frame, and captured frame is rendered every frame until replay is stopped.
+	///
+	/// @param[in] _filePath Frame capture file path. Pass `NULL` to stop replay.
+	///
+	/// @returns Returns true if frame capture was loaded.
+	///
+	/// @remarks
+	///   Requires `BGFX_CONFIG_CAPTURE`. Capture must be done by bgfx built with the same
+	///   configuration, and shaders must be compatible with current renderer.
+	///
+	/// @attention C99's equivalent binding is `bgfx_replay_frame_capture`.
+	///
+	bool replayFrameCapture(const char* _filePath);
+
 	/// Render frame. Executes the actual GPU rendering work for one frame.
 	///
 	/// In the default **multithreaded** configuration, `bgfx::renderFrame` runs
@@ -4199,6 +4511,31 @@ namespace bgfx
 		, int32_t _len = INT32_MAX
 		);
 
+	/// Begin GPU timing region. Draw and compute calls submitted until matching
+	/// `profilerEndGpu` are attributed to region, and region is timed from first to
+	/// last of them in sorted order. Regions can be nested.
+	///
+	/// @param[in] _name Region name.
+	/// @param[in] _len Region name length (if length is INT32_MAX, it's expected
+	///   that _name is zero terminated string.
+	///
+	/// @remarks
+	///   Results are returned few frames later through `Stats::gpuRegionStats`.
+	///   Supported by OpenGL and Vulkan renderers.
+	///
+	/// @attention C99's equivalent binding is `bgfx_profiler_begin_gpu`.
+	///
+	void profilerBeginGpu(
+		  const char* _name
+		, int32_t _len = INT32_MAX
+		);
+
+	/// End GPU timing region.
+	///
+	/// @attention C99's equivalent binding is `bgfx_profiler_end_gpu`.
+	///
+	void profilerEndGpu();
+
 	/// Set render states for draw primitive.
 	///
 	/// @param[in] _state State flags. Default state for primitive type is
@@ -4231,16 +4568,25 @@ namespace bgfx
 		, uint32_t _rgba = 0
 		);
 
-	/// Set condition for rendering.
+	/// Set condition for rendering. Condition applies to next draw call or compute
+	/// dispatch.
 	///
 	/// @param[in] _handle Occlusion query handle.
 	/// @param[in] _visible Render if occlusion query is visible.
+	/// @param[in] _current Use query result from current frame.
+	///
+	/// @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+	///   draw call is predicated on GPU with result of query issued in earlier view
+	///   of the same frame. Otherwise last query result available on CPU is used.
+	///   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+	///   conditional rendering doesn't apply to compute.
 	///
 	/// @attention C99's equivalent binding is `bgfx_set_condition`.
 	///
 	void setCondition(
 		  OcclusionQueryHandle _handle
 		, bool _visible
+		, bool _current = false
 		);
 
 	/// Set stencil test state.
@@ -4316,6 +4662,16 @@ namespace bgfx
 		, uint16_t _num = 1
 		);
 
+	/// Set persistent transform index for draw primitive. Persistent transform
+	/// buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+	/// available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+	///
+	/// @param[in] _index Index in persistent transform buffer.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_persistent_transform`.
+	///
+	void setPersistentTransform(uint32_t _index);
+
 	/// Reserve matrices in internal matrix cache.
 	///
 	/// @param[out] _transform Pointer to `Transform` structure.
@@ -4951,6 +5307,59 @@ namespace bgfx
 		, uint16_t _depth = UINT16_MAX
 		);
 
+	/// Start recording draw list. All following submits are captured
+	/// into draw list instead of being submitted to the frame, until
+	/// `bgfx::endDrawList` is called.
+	///
+	/// @remarks
+	///   Recording must begin and end within the same frame. Draw calls using transient
+	///   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+	///   occlusion queries, are dropped.
+	///
+	/// @attention C99's equivalent binding is `bgfx_begin_draw_list`.
+	///
+	void beginDrawList();
+
+	/// End recording draw list.
+	///
+	/// @returns Handle to draw list object, or invalid handle if nothing was recorded.
+	///
+	/// @remarks
+	///   Draw list holds reference to programs, textures, uniforms, index, vertex and
+	///   indirect buffers it uses. They can be destroyed while draw list is alive,
+	///   but they are released only after draw list is destroyed.
+	///
+	/// @attention C99's equivalent binding is `bgfx_end_draw_list`.
+	///
+	DrawListHandle endDrawList();
+
+	/// Submit previously recorded draw list for rendering. Draw state, bindings,
+	/// uniforms and sort keys captured during recording are replayed into view.
+	///
+	/// @param[in] _id View id.
+	/// @param[in] _drawList Draw list.
+	/// @param[in] _mtx Base transform applied to all recorded transforms. It can be
+	///   `NULL` if recorded transforms are used as is.
+	///
+	/// @remarks
+	///   Encoder state set before this call is not used, and it's not cleared.
+	///
+	/// @attention C99's equivalent binding is `bgfx_submit_draw_list`.
+	///
+	void submit(
+		  ViewId _id
+		, DrawListHandle _drawList
+		, const void* _mtx = NULL
+		);
+
+	/// Destroy draw list, and release resources referenced by it.
+	///
+	/// @param[in] _handle Handle to draw list object.
+	///
+	/// @attention C99's equivalent binding is `bgfx_destroy_draw_list`.
+	///
+	void destroy(DrawListHandle _handle);
+
 } // namespace bgfx
 
 #endif // BGFX_H_HEADER_GUARD
@@ -534,6 +534,8 @@ typedef struct bgfx_callback_vtbl_s
 
 } bgfx_callback_vtbl_t;
 
+typedef struct bgfx_draw_list_handle_s { uint16_t idx; } bgfx_draw_list_handle_t;
+
 typedef struct bgfx_dynamic_index_buffer_handle_s { uint16_t idx; } bgfx_dynamic_index_buffer_handle_t;
 
 typedef struct bgfx_dynamic_vertex_buffer_handle_s { uint16_t idx; } bgfx_dynamic_vertex_buffer_handle_t;
@@ -614,6 +616,12 @@ typedef struct bgfx_caps_limits_s
     uint32_t             maxTransientVbSize; /** Maximum transient vertex buffer size.    */
     uint32_t             maxTransientIbSize; /** Maximum transient index buffer size.     */
     uint32_t             minUniformBufferSize; /** Mimimum uniform buffer size.             */
+    
+    /**
+     * Maximum number of persistent transform matrices, 0 when
+     * persistent transform buffer is not available.
+     */
+    uint32_t             maxPersistentTransforms;
 
 } bgfx_caps_limits_t;
 
@@ -781,6 +789,14 @@ typedef struct bgfx_init_limits_s
     uint32_t             maxTransientVbSize; /** Maximum transient vertex buffer size.    */
     uint32_t             maxTransientIbSize; /** Maximum transient index buffer size.     */
     uint32_t             minUniformBufferSize; /** Mimimum uniform buffer size.             */
+    uint32_t             dynamicIndexBufferSize; /** Dynamic index buffer backing store page size. */
+    uint32_t             dynamicVertexBufferSize; /** Dynamic vertex buffer backing store page size. */
+    
+    /**
+     * Number of matrices in persistent transform buffer. Set to 0 to
+     * disable it. See `bgfx::allocPersistentTransform`.
+     */
+    uint32_t             maxPersistentTransforms;
 
 } bgfx_init_limits_t;
 
@@ -1044,6 +1060,19 @@ typedef struct bgfx_view_stats_s
 
 } bgfx_view_stats_t;
 
+/**
+ * GPU region stats.
+ *
+ */
+typedef struct bgfx_gpu_region_stats_s
+{
+    char                 name[64];           /** Region name.                             */
+    int64_t              gpuTimeBegin;       /** GPU begin time.                          */
+    int64_t              gpuTimeEnd;         /** GPU end time.                            */
+    uint32_t             gpuFrameNum;        /** Frame which generated gpuTimeBegin, gpuTimeEnd. */
+
+} bgfx_gpu_region_stats_t;
+
 /**
  * Encoder stats.
  *
@@ -1052,6 +1081,10 @@ typedef struct bgfx_encoder_stats_s
 {
     int64_t              cpuTimeBegin;       /** Encoder thread CPU submit begin time.    */
     int64_t              cpuTimeEnd;         /** Encoder thread CPU submit end time.      */
+    int64_t              transientReserveTime; /** Time spent reserving transient buffer slabs from frame. */
+    uint32_t             numTransientAllocs; /** Number of transient buffer allocations.  */
+    uint32_t             numTransientSlabs;  /** Number of transient buffer slabs reserved from frame. */
+    uint32_t             numTransientContended; /** Number of slab reservations retried due to contention. */
 
 } bgfx_encoder_stats_t;
 
@@ -1085,12 +1118,26 @@ typedef struct bgfx_stats_s
     uint32_t             numDrawCallsPeak;
     uint32_t             maxGpuLatency;      /** GPU driver latency.                      */
     uint32_t             gpuFrameNum;        /** Frame which generated gpuTimeBegin, gpuTimeEnd. */
+    uint32_t             numVertexArrayBinds; /** Number of vertex array object binds (OpenGL only). */
+    uint32_t             numVertexAttribCalls; /** Number of vertex input setup calls (OpenGL only). */
+    
+    /**
+     * Bytes of per-draw uniform data not committed because values
+     * were same as already set.
+     */
+    uint32_t             uniformBytesSkipped;
     uint16_t             numDynamicIndexBuffers; /** Number of used dynamic index buffers.    */
     uint16_t             numDynamicVertexBuffers; /** Number of used dynamic vertex buffers.   */
     uint16_t             numFrameBuffers;    /** Number of used frame buffers.            */
     uint16_t             numIndexBuffers;    /** Number of used index buffers.            */
     uint16_t             numOcclusionQueries; /** Number of used occlusion queries.        */
     uint16_t             numPrograms;        /** Number of used programs.                 */
+    
+    /**
+     * Number of programs still being compiled and linked, draws
+     * using them are skipped (OpenGL only).
+     */
+    uint16_t             numProgramsPending;
     uint16_t             numShaders;         /** Number of used shaders.                  */
     uint16_t             numTextures;        /** Number of used textures.                 */
     uint16_t             numUniforms;        /** Number of used uniforms.                 */
@@ -1098,8 +1145,25 @@ typedef struct bgfx_stats_s
     uint16_t             numVertexLayouts;   /** Number of used vertex layouts.           */
     int64_t              textureMemoryUsed;  /** Estimate of texture memory used.         */
     int64_t              rtMemoryUsed;       /** Estimate of render target memory used.   */
+    
+    /**
+     * Estimate of texture memory used by mips at or above min LOD,
+     * see `bgfx::setTextureMinLod`.
+     */
+    int64_t              textureMemoryResident;
     int32_t              transientVbUsed;    /** Amount of transient vertex buffer used.  */
     int32_t              transientIbUsed;    /** Amount of transient index buffer used.   */
+    uint32_t             dynIbNumFreeBlocks; /** Number of free blocks in dynamic index buffer backing store. */
+    
+    /**
+     * Largest free block in dynamic index buffer backing store. Many
+     * small free blocks indicate fragmented backing store.
+     */
+    uint32_t             dynIbLargestFreeBlock;
+    uint32_t             dynVbNumFreeBlocks; /** Number of free blocks in dynamic vertex buffer backing store. */
+    uint32_t             dynVbLargestFreeBlock; /** Largest free block in dynamic vertex buffer backing store. */
+    uint32_t             uniformNumFreeBlocks; /** Number of free blocks in view uniform store. */
+    uint32_t             uniformLargestFreeBlock; /** Largest free block in view uniform store. */
     uint32_t             numPrims[BGFX_TOPOLOGY_COUNT]; /** Number of primitives rendered.           */
     int64_t              gpuMemoryMax;       /** Maximum available GPU memory for application. */
     int64_t              gpuMemoryUsed;      /** Amount of GPU memory used by the application. */
@@ -1109,6 +1173,8 @@ typedef struct bgfx_stats_s
     uint16_t             textHeight;         /** Debug text height in characters.         */
     uint16_t             numViews;           /** Number of view stats.                    */
     bgfx_view_stats_t*   viewStats;          /** Array of View stats.                     */
+    uint16_t             numGpuRegions;      /** Number of GPU region stats.              */
+    bgfx_gpu_region_stats_t* gpuRegionStats; /** Array of GPU region stats.               */
     uint8_t              numEncoders;        /** Number of encoders used during frame.    */
     bgfx_encoder_stats_t* encoderStats;      /** Array of encoder stats.                  */
 
@@ -1800,6 +1866,39 @@ BGFX_C_API void bgfx_update_dynamic_vertex_buffer(bgfx_dynamic_vertex_buffer_han
  */
 BGFX_C_API void bgfx_destroy_dynamic_vertex_buffer(bgfx_dynamic_vertex_buffer_handle_t _handle);
 
+/**
+ * Allocate matrices in persistent transform buffer. Matrices keep their
+ * index and value across frames until freed, and only matrices modified
+ * with `bgfx::updatePersistentTransform` are uploaded on `bgfx::frame`.
+ *
+ * @remarks Requires `BGFX_CAPS_COMPUTE`, and `Init::Limits::maxPersistentTransforms`
+ *   to be non-zero.
+ *
+ * @param[in] _num Number of matrices.
+ *
+ * @returns Index of first matrix, or `UINT32_MAX` if buffer is full.
+ *
+ */
+BGFX_C_API uint32_t bgfx_alloc_persistent_transform(uint16_t _num);
+
+/**
+ * Free matrices allocated with `bgfx::allocPersistentTransform`.
+ *
+ * @param[in] _index Index of first matrix returned by `bgfx::allocPersistentTransform`.
+ *
+ */
+BGFX_C_API void bgfx_free_persistent_transform(uint32_t _index);
+
+/**
+ * Update matrices in persistent transform buffer.
+ *
+ * @param[in] _index Index of first matrix.
+ * @param[in] _mtx Pointer to first matrix in array.
+ * @param[in] _num Number of matrices in array.
+ *
+ */
+BGFX_C_API void bgfx_update_persistent_transform(uint32_t _index, const void* _mtx, uint16_t _num);
+
 /**
  * Returns number of requested or maximum available indices.
  *
@@ -1988,6 +2087,31 @@ BGFX_C_API bgfx_program_handle_t bgfx_create_compute_program(bgfx_shader_handle_
  */
 BGFX_C_API void bgfx_destroy_program(bgfx_program_handle_t _handle);
 
+/**
+ * Set instanced variant of program used for automatic instancing.
+ *
+ * Consecutive draw calls (after sorting) in the same view that use `handle`
+ * and differ only in transform are merged into single instanced draw call
+ * with `instanced` program. Per-instance model matrix is passed as instance
+ * data `i_data0` to `i_data3`.
+ *
+ * Instanced vertex shader is compiled from the same source with
+ * `shaderc --instanced`, which reads `u_model`, `u_modelView`, and
+ * `u_modelViewProj` from instance data instead of uniforms.
+ *
+ * @remarks Draw calls with multiple transforms, instance data, indirect
+ *   buffer, occlusion query, or uniforms set between them are not merged.
+ *
+ * @attention `instanced` program is kept alive until variant is changed,
+ *   or `handle` is destroyed. Pass invalid handle to disable.
+ *
+ * @param[in] _handle Program handle.
+ * @param[in] _instanced Instanced program variant, vertex shader reads
+ *  model matrix from `i_data0` to `i_data3`.
+ *
+ */
+BGFX_C_API void bgfx_set_instanced_program(bgfx_program_handle_t _handle, bgfx_program_handle_t _instanced);
+
 /**
  * Validate texture parameters.
  *
@@ -2262,6 +2386,24 @@ BGFX_C_API void bgfx_clear_texture(bgfx_texture_handle_t _handle, uint8_t _mip,
  */
 BGFX_C_API uint32_t bgfx_read_texture(bgfx_texture_handle_t _handle, void* _data, uint16_t _layer, uint8_t _mip);
 
+/**
+ * Set most detailed mip level of texture that is resident. Mip levels above it are not
+ * sampled, and they are not counted in `Stats::textureMemoryResident`. Texture can be created
+ * with only tail mips uploaded, and more detailed mips streamed in later with
+ * `bgfx::updateTexture2D` before lowering min LOD.
+ *
+ * @remarks Renderer still allocates storage for whole mip chain.
+ * @remarks Sampled texture binds start at min LOD, the same as if `firstMip` passed to
+ *   `bgfx::setTexture` was raised to min LOD. Explicit LOD and texture size queries in
+ *   shader are relative to min LOD. Image (storage) binds are not affected.
+ *
+ * @param[in] _handle Texture handle.
+ * @param[in] _minLod Most detailed resident mip level. Use 0 to make whole
+ *  mip chain resident.
+ *
+ */
+BGFX_C_API void bgfx_set_texture_min_lod(bgfx_texture_handle_t _handle, uint8_t _minLod);
+
 /**
  * Set texture debug name.
  *
@@ -2786,6 +2928,28 @@ BGFX_C_API void bgfx_encoder_end(bgfx_encoder_t* _encoder);
  */
 BGFX_C_API void bgfx_encoder_set_marker(bgfx_encoder_t* _this, const char* _name, int32_t _len);
 
+/**
+ * Begin GPU timing region. Draw and compute calls submitted until matching
+ * `profilerEndGpu` are attributed to region, and region is timed from first to
+ * last of them in sorted order. Regions can be nested.
+ *
+ * @remarks
+ *   Results are returned few frames later through `Stats::gpuRegionStats`.
+ *   Supported by OpenGL and Vulkan renderers.
+ *
+ * @param[in] _name Region name.
+ * @param[in] _len Region name length (if length is INT32_MAX, it's expected
+ *  that _name is zero terminated string.
+ *
+ */
+BGFX_C_API void bgfx_encoder_profiler_begin_gpu(bgfx_encoder_t* _this, const char* _name, int32_t _len);
+
+/**
+ * End GPU timing region.
+ *
+ */
+BGFX_C_API void bgfx_encoder_profiler_end_gpu(bgfx_encoder_t* _this);
+
 /**
  * Set render states for draw primitive.
  *
@@ -2816,13 +2980,21 @@ BGFX_C_API void bgfx_encoder_set_marker(bgfx_encoder_t* _this, const char* _name
 BGFX_C_API void bgfx_encoder_set_state(bgfx_encoder_t* _this, uint64_t _state, uint32_t _rgba);
 
 /**
- * Set condition for rendering.
+ * Set condition for rendering. Condition applies to next draw call or compute
+ * dispatch.
+ *
+ * @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+ *   draw call is predicated on GPU with result of query issued in earlier view
+ *   of the same frame. Otherwise last query result available on CPU is used.
+ *   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+ *   conditional rendering doesn't apply to compute.
  *
  * @param[in] _handle Occlusion query handle.
  * @param[in] _visible Render if occlusion query is visible.
+ * @param[in] _current Use query result from current frame.
  *
  */
-BGFX_C_API void bgfx_encoder_set_condition(bgfx_encoder_t* _this, bgfx_occlusion_query_handle_t _handle, bool _visible);
+BGFX_C_API void bgfx_encoder_set_condition(bgfx_encoder_t* _this, bgfx_occlusion_query_handle_t _handle, bool _visible, bool _current);
 
 /**
  * Set stencil test state.
@@ -2883,6 +3055,16 @@ BGFX_C_API uint32_t bgfx_encoder_set_transform(bgfx_encoder_t* _this, const void
  */
 BGFX_C_API void bgfx_encoder_set_transform_cached(bgfx_encoder_t* _this, uint32_t _cache, uint16_t _num);
 
+/**
+ * Set persistent transform index for draw primitive. Persistent transform
+ * buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+ * available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+ *
+ * @param[in] _index Index in persistent transform buffer.
+ *
+ */
+BGFX_C_API void bgfx_encoder_set_persistent_transform(bgfx_encoder_t* _this, uint32_t _index);
+
 /**
  * Reserve matrices in internal matrix cache.
  *
@@ -2896,6 +3078,48 @@ BGFX_C_API void bgfx_encoder_set_transform_cached(bgfx_encoder_t* _this, uint32_
  */
 BGFX_C_API uint32_t bgfx_encoder_alloc_transform(bgfx_encoder_t* _this, bgfx_transform_t* _transform, uint16_t _num);
 
+/**
+ * Allocate transient index buffer from encoder's slab of frame's transient
+ * index buffer. Slabs are reserved with single atomic operation, and
+ * allocations within slab don't take any lock.
+ *
+ * @param[out] _tib TransientIndexBuffer structure will be filled, and will be valid
+ *  for the duration of frame, and can be reused for multiple draw
+ *  calls.
+ * @param[in] _num Number of indices to allocate.
+ * @param[in] _index32 Set to `true` if input indices will be 32-bit.
+ *
+ */
+BGFX_C_API void bgfx_encoder_alloc_transient_index_buffer(bgfx_encoder_t* _this, bgfx_transient_index_buffer_t* _tib, uint32_t _num, bool _index32);
+
+/**
+ * Allocate transient vertex buffer from encoder's slab of frame's transient
+ * vertex buffer. Slabs are reserved with single atomic operation, and
+ * allocations within slab don't take any lock.
+ *
+ * @param[out] _tvb TransientVertexBuffer structure will be filled, and will be valid
+ *  for the duration of frame, and can be reused for multiple draw
+ *  calls.
+ * @param[in] _num Number of vertices to allocate.
+ * @param[in] _layoutHandle Vertex layout, created with `createVertexLayout`.
+ *
+ */
+BGFX_C_API void bgfx_encoder_alloc_transient_vertex_buffer(bgfx_encoder_t* _this, bgfx_transient_vertex_buffer_t* _tvb, uint32_t _num, bgfx_vertex_layout_handle_t _layoutHandle);
+
+/**
+ * Allocate instance data buffer from encoder's slab of frame's transient
+ * vertex buffer. Slabs are reserved with single atomic operation, and
+ * allocations within slab don't take any lock.
+ *
+ * @param[out] _idb InstanceDataBuffer structure will be filled, and will be valid
+ *  for duration of frame, and can be reused for multiple draw
+ *  calls.
+ * @param[in] _num Number of instances.
+ * @param[in] _stride Instance stride. Must be multiple of 16.
+ *
+ */
+BGFX_C_API void bgfx_encoder_alloc_instance_data_buffer(bgfx_encoder_t* _this, bgfx_instance_data_buffer_t* _idb, uint32_t _num, uint16_t _stride);
+
 /**
  * Set shader uniform parameter for draw primitive.
  *
@@ -3342,6 +3566,45 @@ BGFX_C_API void bgfx_encoder_discard(bgfx_encoder_t* _this, uint8_t _flags);
  */
 BGFX_C_API void bgfx_encoder_blit(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_texture_handle_t _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, bgfx_texture_handle_t _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth);
 
+/**
+ * Start recording draw list. All following submits on this encoder are
+ * captured into draw list instead of being submitted to the frame, until
+ * `bgfx::Encoder::endDrawList` is called.
+ *
+ * @remarks
+ *   Recording must begin and end within the same frame. Draw calls using transient
+ *   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+ *   occlusion queries, are dropped.
+ *
+ */
+BGFX_C_API void bgfx_encoder_begin_draw_list(bgfx_encoder_t* _this);
+
+/**
+ * End recording draw list.
+ *
+ * @remarks
+ *   Draw list holds reference to programs, textures, uniforms, index, vertex and
+ *   indirect buffers it uses. They can be destroyed while draw list is alive,
+ *   but they are released only after draw list is destroyed.
+ *
+ */
+BGFX_C_API bgfx_draw_list_handle_t bgfx_encoder_end_draw_list(bgfx_encoder_t* _this);
+
+/**
+ * Submit previously recorded draw list for rendering. Draw state, bindings,
+ * uniforms and sort keys captured during recording are replayed into view.
+ *
+ * @remarks
+ *   Encoder state set before this call is not used, and it's not cleared.
+ *
+ * @param[in] _id View id.
+ * @param[in] _drawList Draw list.
+ * @param[in] _mtx Base transform applied to all recorded transforms. It can be
+ *  `NULL` if recorded transforms are used as is.
+ *
+ */
+BGFX_C_API void bgfx_encoder_submit_draw_list(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_draw_list_handle_t _drawList, const void* _mtx);
+
 /**
  * Request screen shot of window back buffer.
  *
@@ -3356,6 +3619,48 @@ BGFX_C_API void bgfx_encoder_blit(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgf
  */
 BGFX_C_API void bgfx_request_screen_shot(bgfx_frame_buffer_handle_t _handle, const char* _filePath);
 
+/**
+ * Save recorded trace as Chrome trace-event JSON, which can be opened in Perfetto UI or
+ * `chrome://tracing`. Trace contains most recent profiler scopes from all threads, and
+ * per-view GPU timings.
+ *
+ * @remarks
+ *   Requires `BGFX_CONFIG_TRACE`. GPU timings require `BGFX_DEBUG_PROFILER` debug flag.
+ *
+ * @param[in] _filePath Output file path.
+ *
+ * @returns Returns true if trace was saved.
+ *
+ */
+BGFX_C_API bool bgfx_save_trace(const char* _filePath);
+
+/**
+ * Request capture of resources and sorted frame. Captured frame is written to file when frame
+ * is rendered, and it can be replayed with `bgfx::replayFrameCapture`.
+ *
+ * @remarks
+ *   Requires `BGFX_CONFIG_CAPTURE`. Only resources created after `bgfx::init` are captured.
+ *
+ * @param[in] _filePath Output file path.
+ *
+ */
+BGFX_C_API void bgfx_request_frame_capture(const char* _filePath);
+
+/**
+ * Replay captured frame instead of submitted frame. Captured resources are created on next
+ * frame, and captured frame is rendered every frame until replay is stopped.
+ *
+ * @remarks
+ *   Requires `BGFX_CONFIG_CAPTURE`. Capture must be done by bgfx built with the same
+ *   configuration, and shaders must be compatible with current renderer.
+ *
+ * @param[in] _filePath Frame capture file path. Pass `NULL` to stop replay.
+ *
+ * @returns Returns true if frame capture was loaded.
+ *
+ */
+BGFX_C_API bool bgfx_replay_frame_capture(const char* _filePath);
+
 /**
  * Render frame. Executes the actual GPU rendering work for one frame.
  *
@@ -3483,6 +3788,28 @@ BGFX_C_API uintptr_t bgfx_override_internal_texture(bgfx_texture_handle_t _handl
  */
 BGFX_C_API void bgfx_set_marker(const char* _name, int32_t _len);
 
+/**
+ * Begin GPU timing region. Draw and compute calls submitted until matching
+ * `profilerEndGpu` are attributed to region, and region is timed from first to
+ * last of them in sorted order. Regions can be nested.
+ *
+ * @remarks
+ *   Results are returned few frames later through `Stats::gpuRegionStats`.
+ *   Supported by OpenGL and Vulkan renderers.
+ *
+ * @param[in] _name Region name.
+ * @param[in] _len Region name length (if length is INT32_MAX, it's expected
+ *  that _name is zero terminated string.
+ *
+ */
+BGFX_C_API void bgfx_profiler_begin_gpu(const char* _name, int32_t _len);
+
+/**
+ * End GPU timing region.
+ *
+ */
+BGFX_C_API void bgfx_profiler_end_gpu(void);
+
 /**
  * Set render states for draw primitive.
  *
@@ -3513,13 +3840,21 @@ BGFX_C_API void bgfx_set_marker(const char* _name, int32_t _len);
 BGFX_C_API void bgfx_set_state(uint64_t _state, uint32_t _rgba);
 
 /**
- * Set condition for rendering.
+ * Set condition for rendering. Condition applies to next draw call or compute
+ * dispatch.
+ *
+ * @remarks When `current` is set and `BGFX_CAPS_CONDITIONAL_RENDER` is supported,
+ *   draw call is predicated on GPU with result of query issued in earlier view
+ *   of the same frame. Otherwise last query result available on CPU is used.
+ *   Compute dispatch is predicated on GPU only with Vulkan renderer, since OpenGL
+ *   conditional rendering doesn't apply to compute.
  *
  * @param[in] _handle Occlusion query handle.
  * @param[in] _visible Render if occlusion query is visible.
+ * @param[in] _current Use query result from current frame.
  *
  */
-BGFX_C_API void bgfx_set_condition(bgfx_occlusion_query_handle_t _handle, bool _visible);
+BGFX_C_API void bgfx_set_condition(bgfx_occlusion_query_handle_t _handle, bool _visible, bool _current);
 
 /**
  * Set stencil test state.
@@ -3580,6 +3915,16 @@ BGFX_C_API uint32_t bgfx_set_transform(const void* _mtx, uint16_t _num);
  */
 BGFX_C_API void bgfx_set_transform_cached(uint32_t _cache, uint16_t _num);
 
+/**
+ * Set persistent transform index for draw primitive. Persistent transform
+ * buffer is bound to `BGFX_CONFIG_TRANSFORM_BUFFER_STAGE`, and index is
+ * available to shader as `persistentTransformIndex()`, see `bgfx_compute.sh`.
+ *
+ * @param[in] _index Index in persistent transform buffer.
+ *
+ */
+BGFX_C_API void bgfx_set_persistent_transform(uint32_t _index);
+
 /**
  * Reserve matrices in internal matrix cache.
  *
@@ -4010,6 +4355,53 @@ BGFX_C_API void bgfx_discard(uint8_t _flags);
  */
 BGFX_C_API void bgfx_blit(bgfx_view_id_t _id, bgfx_texture_handle_t _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, bgfx_texture_handle_t _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth);
 
+/**
+ * Start recording draw list. All following submits are captured
+ * into draw list instead of being submitted to the frame, until
+ * `bgfx::endDrawList` is called.
+ *
+ * @remarks
+ *   Recording must begin and end within the same frame. Draw calls using transient
+ *   buffers, dynamic buffers created without `BGFX_BUFFER_COMPUTE_*` flags, or
+ *   occlusion queries, are dropped.
+ *
+ */
+BGFX_C_API void bgfx_begin_draw_list(void);
+
+/**
+ * End recording draw list.
+ *
+ * @remarks
+ *   Draw list holds reference to programs, textures, uniforms, index, vertex and
+ *   indirect buffers it uses. They can be destroyed while draw list is alive,
+ *   but they are released only after draw list is destroyed.
+ *
+ */
+BGFX_C_API bgfx_draw_list_handle_t bgfx_end_draw_list(void);
+
+/**
+ * Submit previously recorded draw list for rendering. Draw state, bindings,
+ * uniforms and sort keys captured during recording are replayed into view.
+ *
+ * @remarks
+ *   Encoder state set before this call is not used, and it's not cleared.
+ *
+ * @param[in] _id View id.
+ * @param[in] _drawList Draw list.
+ * @param[in] _mtx Base transform applied to all recorded transforms. It can be
+ *  `NULL` if recorded transforms are used as is.
+ *
+ */
+BGFX_C_API void bgfx_submit_draw_list(bgfx_view_id_t _id, bgfx_draw_list_handle_t _drawList, const void* _mtx);
+
+/**
+ * Destroy draw list, and release resources referenced by it.
+ *
+ * @param[in] _handle Handle to draw list object.
+ *
+ */
+BGFX_C_API void bgfx_destroy_draw_list(bgfx_draw_list_handle_t _handle);
+
 /**/
 typedef enum bgfx_function_id
 {
@@ -4063,6 +4455,9 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_CREATE_DYNAMIC_VERTEX_BUFFER_MEM,
     BGFX_FUNCTION_ID_UPDATE_DYNAMIC_VERTEX_BUFFER,
     BGFX_FUNCTION_ID_DESTROY_DYNAMIC_VERTEX_BUFFER,
+    BGFX_FUNCTION_ID_ALLOC_PERSISTENT_TRANSFORM,
+    BGFX_FUNCTION_ID_FREE_PERSISTENT_TRANSFORM,
+    BGFX_FUNCTION_ID_UPDATE_PERSISTENT_TRANSFORM,
     BGFX_FUNCTION_ID_GET_AVAIL_TRANSIENT_INDEX_BUFFER,
     BGFX_FUNCTION_ID_GET_AVAIL_TRANSIENT_VERTEX_BUFFER,
     BGFX_FUNCTION_ID_GET_AVAIL_INSTANCE_DATA_BUFFER,
@@ -4079,6 +4474,7 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_CREATE_PROGRAM,
     BGFX_FUNCTION_ID_CREATE_COMPUTE_PROGRAM,
     BGFX_FUNCTION_ID_DESTROY_PROGRAM,
+    BGFX_FUNCTION_ID_SET_INSTANCED_PROGRAM,
     BGFX_FUNCTION_ID_IS_TEXTURE_VALID,
     BGFX_FUNCTION_ID_IS_VIDEO_CODEC_VALID,
     BGFX_FUNCTION_ID_IS_FRAME_BUFFER_VALID,
@@ -4093,6 +4489,7 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_UPDATE_TEXTURE_CUBE,
     BGFX_FUNCTION_ID_CLEAR_TEXTURE,
     BGFX_FUNCTION_ID_READ_TEXTURE,
+    BGFX_FUNCTION_ID_SET_TEXTURE_MIN_LOD,
     BGFX_FUNCTION_ID_SET_TEXTURE_NAME,
     BGFX_FUNCTION_ID_GET_DIRECT_ACCESS_PTR,
     BGFX_FUNCTION_ID_DESTROY_TEXTURE,
@@ -4129,6 +4526,8 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_ENCODER_BEGIN,
     BGFX_FUNCTION_ID_ENCODER_END,
     BGFX_FUNCTION_ID_ENCODER_SET_MARKER,
+    BGFX_FUNCTION_ID_ENCODER_PROFILER_BEGIN_GPU,
+    BGFX_FUNCTION_ID_ENCODER_PROFILER_END_GPU,
     BGFX_FUNCTION_ID_ENCODER_SET_STATE,
     BGFX_FUNCTION_ID_ENCODER_SET_CONDITION,
     BGFX_FUNCTION_ID_ENCODER_SET_STENCIL,
@@ -4136,7 +4535,11 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_ENCODER_SET_SCISSOR_CACHED,
     BGFX_FUNCTION_ID_ENCODER_SET_TRANSFORM,
     BGFX_FUNCTION_ID_ENCODER_SET_TRANSFORM_CACHED,
+    BGFX_FUNCTION_ID_ENCODER_SET_PERSISTENT_TRANSFORM,
     BGFX_FUNCTION_ID_ENCODER_ALLOC_TRANSFORM,
+    BGFX_FUNCTION_ID_ENCODER_ALLOC_TRANSIENT_INDEX_BUFFER,
+    BGFX_FUNCTION_ID_ENCODER_ALLOC_TRANSIENT_VERTEX_BUFFER,
+    BGFX_FUNCTION_ID_ENCODER_ALLOC_INSTANCE_DATA_BUFFER,
     BGFX_FUNCTION_ID_ENCODER_SET_UNIFORM,
     BGFX_FUNCTION_ID_SET_VIEW_UNIFORM,
     BGFX_FUNCTION_ID_SET_FRAME_UNIFORM,
@@ -4172,13 +4575,21 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_ENCODER_DISPATCH_INDIRECT,
     BGFX_FUNCTION_ID_ENCODER_DISCARD,
     BGFX_FUNCTION_ID_ENCODER_BLIT,
+    BGFX_FUNCTION_ID_ENCODER_BEGIN_DRAW_LIST,
+    BGFX_FUNCTION_ID_ENCODER_END_DRAW_LIST,
+    BGFX_FUNCTION_ID_ENCODER_SUBMIT_DRAW_LIST,
     BGFX_FUNCTION_ID_REQUEST_SCREEN_SHOT,
+    BGFX_FUNCTION_ID_SAVE_TRACE,
+    BGFX_FUNCTION_ID_REQUEST_FRAME_CAPTURE,
+    BGFX_FUNCTION_ID_REPLAY_FRAME_CAPTURE,
     BGFX_FUNCTION_ID_RENDER_FRAME,
     BGFX_FUNCTION_ID_SET_PLATFORM_DATA,
     BGFX_FUNCTION_ID_GET_INTERNAL_DATA,
     BGFX_FUNCTION_ID_OVERRIDE_INTERNAL_TEXTURE_PTR,
     BGFX_FUNCTION_ID_OVERRIDE_INTERNAL_TEXTURE,
     BGFX_FUNCTION_ID_SET_MARKER,
+    BGFX_FUNCTION_ID_PROFILER_BEGIN_GPU,
+    BGFX_FUNCTION_ID_PROFILER_END_GPU,
     BGFX_FUNCTION_ID_SET_STATE,
     BGFX_FUNCTION_ID_SET_CONDITION,
     BGFX_FUNCTION_ID_SET_STENCIL,
@@ -4186,6 +4597,7 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_SET_SCISSOR_CACHED,
     BGFX_FUNCTION_ID_SET_TRANSFORM,
     BGFX_FUNCTION_ID_SET_TRANSFORM_CACHED,
+    BGFX_FUNCTION_ID_SET_PERSISTENT_TRANSFORM,
     BGFX_FUNCTION_ID_ALLOC_TRANSFORM,
     BGFX_FUNCTION_ID_SET_UNIFORM,
     BGFX_FUNCTION_ID_SET_INDEX_BUFFER,
@@ -4220,6 +4632,10 @@ typedef enum bgfx_function_id
     BGFX_FUNCTION_ID_DISPATCH_INDIRECT,
     BGFX_FUNCTION_ID_DISCARD,
     BGFX_FUNCTION_ID_BLIT,
+    BGFX_FUNCTION_ID_BEGIN_DRAW_LIST,
+    BGFX_FUNCTION_ID_END_DRAW_LIST,
+    BGFX_FUNCTION_ID_SUBMIT_DRAW_LIST,
+    BGFX_FUNCTION_ID_DESTROY_DRAW_LIST,
 
     BGFX_FUNCTION_ID_COUNT
 
@@ -4278,6 +4694,9 @@ struct bgfx_interface_vtbl
     bgfx_dynamic_vertex_buffer_handle_t (*create_dynamic_vertex_buffer_mem)(const bgfx_memory_t* _mem, const bgfx_vertex_layout_t* _layout, uint16_t _flags);
     void (*update_dynamic_vertex_buffer)(bgfx_dynamic_vertex_buffer_handle_t _handle, uint32_t _startVertex, const bgfx_memory_t* _mem);
     void (*destroy_dynamic_vertex_buffer)(bgfx_dynamic_vertex_buffer_handle_t _handle);
+    uint32_t (*alloc_persistent_transform)(uint16_t _num);
+    void (*free_persistent_transform)(uint32_t _index);
+    void (*update_persistent_transform)(uint32_t _index, const void* _mtx, uint16_t _num);
     uint32_t (*get_avail_transient_index_buffer)(uint32_t _num, bool _index32);
     uint32_t (*get_avail_transient_vertex_buffer)(uint32_t _num, const bgfx_vertex_layout_t * _layout);
     uint32_t (*get_avail_instance_data_buffer)(uint32_t _num, uint16_t _stride);
@@ -4294,6 +4713,7 @@ struct bgfx_interface_vtbl
     bgfx_program_handle_t (*create_program)(bgfx_shader_handle_t _vsh, bgfx_shader_handle_t _fsh, bool _destroyShaders);
     bgfx_program_handle_t (*create_compute_program)(bgfx_shader_handle_t _csh, bool _destroyShaders);
     void (*destroy_program)(bgfx_program_handle_t _handle);
+    void (*set_instanced_program)(bgfx_program_handle_t _handle, bgfx_program_handle_t _instanced);
     bool (*is_texture_valid)(uint16_t _depth, bool _cubeMap, uint16_t _numLayers, bgfx_texture_format_t _format, uint64_t _flags);
     bool (*is_video_codec_valid)(bgfx_video_codec_t _codec, uint8_t _chroma, uint8_t _bitDepth, uint16_t _codedWidth, uint16_t _codedHeight, uint8_t _maxDpbSlots, uint8_t _maxActiveReferences);
     bool (*is_frame_buffer_valid)(uint8_t _num, const bgfx_attachment_t* _attachment);
@@ -4308,6 +4728,7 @@ struct bgfx_interface_vtbl
     void (*update_texture_cube)(bgfx_texture_handle_t _handle, uint16_t _layer, uint8_t _side, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height, const bgfx_memory_t* _mem, uint16_t _pitch);
     void (*clear_texture)(bgfx_texture_handle_t _handle, uint8_t _mip, uint8_t _numMips, uint16_t _layer, uint16_t _numLayers);
     uint32_t (*read_texture)(bgfx_texture_handle_t _handle, void* _data, uint16_t _layer, uint8_t _mip);
+    void (*set_texture_min_lod)(bgfx_texture_handle_t _handle, uint8_t _minLod);
     void (*set_texture_name)(bgfx_texture_handle_t _handle, const char* _name, int32_t _len);
     void* (*get_direct_access_ptr)(bgfx_texture_handle_t _handle);
     void (*destroy_texture)(bgfx_texture_handle_t _handle);
@@ -4344,14 +4765,20 @@ struct bgfx_interface_vtbl
     bgfx_encoder_t* (*encoder_begin)(bool _forceNewEncoder);
     void (*encoder_end)(bgfx_encoder_t* _encoder);
     void (*encoder_set_marker)(bgfx_encoder_t* _this, const char* _name, int32_t _len);
+    void (*encoder_profiler_begin_gpu)(bgfx_encoder_t* _this, const char* _name, int32_t _len);
+    void (*encoder_profiler_end_gpu)(bgfx_encoder_t* _this);
     void (*encoder_set_state)(bgfx_encoder_t* _this, uint64_t _state, uint32_t _rgba);
-    void (*encoder_set_condition)(bgfx_encoder_t* _this, bgfx_occlusion_query_handle_t _handle, bool _visible);
+    void (*encoder_set_condition)(bgfx_encoder_t* _this, bgfx_occlusion_query_handle_t _handle, bool _visible, bool _current);
     void (*encoder_set_stencil)(bgfx_encoder_t* _this, uint32_t _fstencil, uint32_t _bstencil);
     uint16_t (*encoder_set_scissor)(bgfx_encoder_t* _this, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height);
     void (*encoder_set_scissor_cached)(bgfx_encoder_t* _this, uint16_t _cache);
     uint32_t (*encoder_set_transform)(bgfx_encoder_t* _this, const void* _mtx, uint16_t _num);
     void (*encoder_set_transform_cached)(bgfx_encoder_t* _this, uint32_t _cache, uint16_t _num);
+    void (*encoder_set_persistent_transform)(bgfx_encoder_t* _this, uint32_t _index);
     uint32_t (*encoder_alloc_transform)(bgfx_encoder_t* _this, bgfx_transform_t* _transform, uint16_t _num);
+    void (*encoder_alloc_transient_index_buffer)(bgfx_encoder_t* _this, bgfx_transient_index_buffer_t* _tib, uint32_t _num, bool _index32);
+    void (*encoder_alloc_transient_vertex_buffer)(bgfx_encoder_t* _this, bgfx_transient_vertex_buffer_t* _tvb, uint32_t _num, bgfx_vertex_layout_handle_t _layoutHandle);
+    void (*encoder_alloc_instance_data_buffer)(bgfx_encoder_t* _this, bgfx_instance_data_buffer_t* _idb, uint32_t _num, uint16_t _stride);
     void (*encoder_set_uniform)(bgfx_encoder_t* _this, bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
     void (*set_view_uniform)(bgfx_view_id_t _id, bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
     void (*set_frame_uniform)(bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
@@ -4387,20 +4814,29 @@ struct bgfx_interface_vtbl
     void (*encoder_dispatch_indirect)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, uint32_t _num, uint8_t _flags);
     void (*encoder_discard)(bgfx_encoder_t* _this, uint8_t _flags);
     void (*encoder_blit)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_texture_handle_t _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, bgfx_texture_handle_t _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth);
+    void (*encoder_begin_draw_list)(bgfx_encoder_t* _this);
+    bgfx_draw_list_handle_t (*encoder_end_draw_list)(bgfx_encoder_t* _this);
+    void (*encoder_submit_draw_list)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_draw_list_handle_t _drawList, const void* _mtx);
     void (*request_screen_shot)(bgfx_frame_buffer_handle_t _handle, const char* _filePath);
+    bool (*save_trace)(const char* _filePath);
+    void (*request_frame_capture)(const char* _filePath);
+    bool (*replay_frame_capture)(const char* _filePath);
     bgfx_render_frame_t (*render_frame)(int32_t _msecs);
     void (*set_platform_data)(const bgfx_platform_data_t * _data);
     const bgfx_internal_data_t* (*get_internal_data)(void);
     uintptr_t (*override_internal_texture_ptr)(bgfx_texture_handle_t _handle, uintptr_t _ptr, uint16_t _layerIndex);
     uintptr_t (*override_internal_texture)(bgfx_texture_handle_t _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, bgfx_texture_format_t _format, uint64_t _flags);
     void (*set_marker)(const char* _name, int32_t _len);
+    void (*profiler_begin_gpu)(const char* _name, int32_t _len);
+    void (*profiler_end_gpu)(void);
     void (*set_state)(uint64_t _state, uint32_t _rgba);
-    void (*set_condition)(bgfx_occlusion_query_handle_t _handle, bool _visible);
+    void (*set_condition)(bgfx_occlusion_query_handle_t _handle, bool _visible, bool _current);
     void (*set_stencil)(uint32_t _fstencil, uint32_t _bstencil);
     uint16_t (*set_scissor)(uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height);
     void (*set_scissor_cached)(uint16_t _cache);
     uint32_t (*set_transform)(const void* _mtx, uint16_t _num);
     void (*set_transform_cached)(uint32_t _cache, uint16_t _num);
+    void (*set_persistent_transform)(uint32_t _index);
     uint32_t (*alloc_transform)(bgfx_transform_t* _transform, uint16_t _num);
     void (*set_uniform)(bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
     void (*set_index_buffer)(bgfx_index_buffer_handle_t _handle, uint32_t _firstIndex, uint32_t _numIndices);
@@ -4435,6 +4871,10 @@ struct bgfx_interface_vtbl
     void (*dispatch_indirect)(bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, uint32_t _num, uint8_t _flags);
     void (*discard)(uint8_t _flags);
     void (*blit)(bgfx_view_id_t _id, bgfx_texture_handle_t _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, bgfx_texture_handle_t _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth);
+    void (*begin_draw_list)(void);
+    bgfx_draw_list_handle_t (*end_draw_list)(void);
+    void (*submit_draw_list)(bgfx_view_id_t _id, bgfx_draw_list_handle_t _drawList, const void* _mtx);
+    void (*destroy_draw_list)(bgfx_draw_list_handle_t _handle);
 };
 
 /**/
@@ -15,7 +15,7 @@
 #ifndef BGFX_DEFINES_H_HEADER_GUARD
 #define BGFX_DEFINES_H_HEADER_GUARD
 
-#define BGFX_API_VERSION UINT32_C(155)
+#define BGFX_API_VERSION UINT32_C(157)
 
 /**
  * Color RGB/alpha/depth write. When it's not specified write will be disabled.
@@ -486,6 +486,7 @@
 #define BGFX_CAPS_VERTEX_ID                       UINT64_C(0x0000000100000000) //!< Rendering with VertexID only is supported.
 #define BGFX_CAPS_VIDEO_DECODE                    UINT64_C(0x0000000200000000) //!< Hardware video decode is supported.
 #define BGFX_CAPS_VIEWPORT_LAYER_ARRAY            UINT64_C(0x0000000400000000) //!< Viewport layer is available in vertex shader.
+#define BGFX_CAPS_CONDITIONAL_RENDER              UINT64_C(0x0000000800000000) //!< GPU-side conditional rendering is supported.
 /// All texture compare modes are supported.
 #define BGFX_CAPS_TEXTURE_COMPARE_ALL (0 \
 	| BGFX_CAPS_TEXTURE_COMPARE_RESERVED \
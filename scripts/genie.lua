@@ -587,6 +587,7 @@ or _OPTIONS["with-combined-examples"] then
 		, "51-gpufont"
 		, "52-layered"
 		, "53-sky2"
+		, "54-topologysort"
 		)
 
 
@@ -608,4 +609,5 @@ if _OPTIONS["with-tools"] then
 	dofile "texturev.lua"
 	dofile "geometryc.lua"
 	dofile "geometryv.lua"
+	dofile "replay.lua"
 end
@@ -4,6 +4,7 @@
  */
 
 #include "bgfx.cpp"
+#include "capture.cpp"
 #include "debug_renderdoc.cpp"
 #include "dxgi.cpp"
 #include "glcontext_egl.cpp"
@@ -26,4 +27,5 @@
 #include "video_vk.cpp"
 #include "shader.cpp"
 #include "topology.cpp"
+#include "trace.cpp"
 #include "vertexlayout.cpp"
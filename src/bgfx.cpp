@@ -392,6 +392,9 @@ namespace bgfx
 
 #if BGFX_CONFIG_MULTITHREADED
 	static BX_THREAD_LOCAL uint32_t s_threadIndex(0);
+	static BX_THREAD_LOCAL uint8_t  s_threadSlot(0);
+	static BX_THREAD_LOCAL uint32_t s_threadSlotGeneration(0); // Slot is valid only when matching context generation.
+	static uint32_t s_cmdThreadGeneration = 0;
 #else
 	static uint32_t s_threadIndex(0);
 #endif // BGFX_CONFIG_MULTITHREADED
@@ -1212,6 +1215,159 @@ namespace bgfx
 	}
 #endif // BGFX_CONFIG_VIDEO
 
+	// Dirty ranges separated by fewer clean matrices than this are uploaded
+	// as single range.
+	static constexpr uint32_t kTransformBufferMaxDirtyGap = 8;
+
+	void TransformBuffer::init(uint32_t _maxTransforms)
+	{
+		BGFX_CHECK_API_THREAD();
+
+		if (0 == _maxTransforms)
+		{
+			return;
+		}
+
+		VertexLayout layout;
+		layout
+			.begin()
+			.add(Attrib::TexCoord0, 4, AttribType::Float)
+			.end();
+
+		m_handle = createDynamicVertexBuffer(_maxTransforms*4, layout, BGFX_BUFFER_COMPUTE_READ);
+
+		if (!isValid(m_handle) )
+		{
+			BX_TRACE("Failed to create persistent transform buffer (%d matrices).", _maxTransforms);
+			return;
+		}
+
+		const uint32_t numDirty = (_maxTransforms + 63) / 64;
+
+		m_maxTransforms = _maxTransforms;
+		m_data  = (float*   )bx::alloc(g_allocator, _maxTransforms*16*sizeof(float) );
+		m_dirty = (uint64_t*)bx::alloc(g_allocator, numDirty*sizeof(uint64_t) );
+		bx::memSet(m_dirty, 0, numDirty*sizeof(uint64_t) );
+
+		m_alloc.reset();
+		m_alloc.add(0, _maxTransforms*16*sizeof(float) );
+	}
+
+	void TransformBuffer::shutdown()
+	{
+		BGFX_CHECK_API_THREAD();
+
+		if (isValid(m_handle) )
+		{
+			destroy(m_handle);
+			m_handle = BGFX_INVALID_HANDLE;
+		}
+
+		bx::free(g_allocator, m_data);
+		bx::free(g_allocator, m_dirty);
+
+		m_data  = NULL;
+		m_dirty = NULL;
+		m_maxTransforms = 0;
+
+		m_alloc.reset();
+	}
+
+	uint32_t TransformBuffer::alloc(uint16_t _num)
+	{
+		if (0 == m_maxTransforms)
+		{
+			return UINT32_MAX;
+		}
+
+		const uint64_t ptr = m_alloc.alloc(bx::max<uint16_t>(_num, 1)*16*sizeof(float) );
+		if (NonLocalAllocator::kInvalidBlock == ptr)
+		{
+			return UINT32_MAX;
+		}
+
+		const uint32_t index = uint32_t(ptr / (16*sizeof(float) ) );
+
+		// New matrices are identity until updated.
+		for (uint32_t ii = index, end = index + _num; ii < end; ++ii)
+		{
+			bx::mtxIdentity(&m_data[ii*16]);
+		}
+
+		markDirty(index, _num);
+
+		return index;
+	}
+
+	void TransformBuffer::free(uint32_t _index)
+	{
+		m_alloc.free(uint64_t(_index)*16*sizeof(float) );
+	}
+
+	void TransformBuffer::update(uint32_t _index, const void* _mtx, uint16_t _num)
+	{
+		if (_index + _num > m_maxTransforms)
+		{
+			return;
+		}
+
+		float* dst = &m_data[_index*16];
+		const uint32_t size = _num*16*sizeof(float);
+
+		// Unchanged matrices are not uploaded.
+		if (0 != bx::memCmp(dst, _mtx, size) )
+		{
+			bx::memCopy(dst, _mtx, size);
+			markDirty(_index, _num);
+		}
+	}
+
+	void TransformBuffer::markDirty(uint32_t _index, uint16_t _num)
+	{
+		for (uint32_t ii = _index, end = _index + _num; ii < end; ++ii)
+		{
+			m_dirty[ii/64] |= UINT64_C(1) << (ii%64);
+		}
+	}
+
+	void TransformBuffer::flush()
+	{
+		uint32_t begin = UINT32_MAX;
+		uint32_t last  = 0;
+
+		for (uint32_t word = 0, num = (m_maxTransforms + 63) / 64; word < num; ++word)
+		{
+			uint64_t bits = m_dirty[word];
+
+			if (0 == bits)
+			{
+				continue;
+			}
+
+			m_dirty[word] = 0;
+
+			for (; 0 != bits; bits &= bits - 1)
+			{
+				const uint32_t idx = word*64 + bx::countTrailingZeros<uint64_t>(bits);
+
+				if (UINT32_MAX != begin
+				&&  idx - last > kTransformBufferMaxDirtyGap)
+				{
+					bgfx::update(m_handle, begin*4, copy(&m_data[begin*16], (last - begin + 1)*16*sizeof(float) ) );
+					begin = UINT32_MAX;
+				}
+
+				begin = bx::min(begin, idx);
+				last  = idx;
+			}
+		}
+
+		if (UINT32_MAX != begin)
+		{
+			bgfx::update(m_handle, begin*4, copy(&m_data[begin*16], (last - begin + 1)*16*sizeof(float) ) );
+		}
+	}
+
 	const char* s_uniformTypeName[] =
 	{
 		"sampler1",
@@ -1258,6 +1414,7 @@ namespace bgfx
 		"u_modelViewProj",
 		"u_alphaRef4",
 		"bgfx_indirectArgBase",
+		"bgfx_transformIndex",
 	};
 
 	const char* getPredefinedUniformName(PredefinedUniform::Enum _enum)
@@ -1536,6 +1693,13 @@ namespace bgfx
 			return;
 		}
 
+		if (NULL != m_drawList)
+		{
+			record(_program, _occlusionQuery, _depth);
+			discard(_flags);
+			return;
+		}
+
 		const uint32_t renderItemIdx = bx::atomicFetchAndAddsat<uint32_t>(&m_frame->m_numRenderItems, 1, m_frame->m_maxDrawCalls);
 		if (m_frame->m_maxDrawCalls <= renderItemIdx)
 		{
@@ -1574,35 +1738,297 @@ namespace bgfx
 		m_draw.m_uniformBegin = m_uniformBegin;
 		m_draw.m_uniformEnd   = m_uniformEnd;
 
+		m_draw.m_numVertices = getNumVertices();
+
+		if (isValid(_occlusionQuery) )
+		{
+			m_draw.m_stateFlags |= BGFX_STATE_INTERNAL_OCCLUSION_QUERY;
+			m_draw.m_occlusionQuery = _occlusionQuery;
+		}
+
+		m_draw.m_bindIdx   = bindStateIndexCached();
+		m_draw.m_gpuRegion = m_gpuRegion;
+		m_frame->m_renderItem[renderItemIdx].draw = m_draw;
+
+		m_draw.clear(_flags);
+		clearBind(_flags);
+		if (_flags & BGFX_DISCARD_STATE)
+		{
+			m_uniformBegin = m_uniformEnd;
+		}
+	}
+
+	static bool isShared(IndexBufferHandle _handle)
+	{
+		return isValid(_handle) && s_ctx->m_indexBuffers[_handle.idx].m_shared;
+	}
+
+	static bool isShared(VertexBufferHandle _handle)
+	{
+		return isValid(_handle) && s_ctx->m_vertexBuffers[_handle.idx].m_shared;
+	}
+
+	void EncoderImpl::record(ProgramHandle _program, OcclusionQueryHandle _occlusionQuery, uint32_t _depth)
+	{
+		// Transient and dynamic buffers are suballocated from shared buffers, and
+		// their backing buffer and offset can change after draw is recorded.
+		// Compute dynamic buffers own their backing buffer.
+		bool shared = false
+			|| isShared(m_draw.m_numIndirectBuffer)
+			|| isShared(m_draw.m_indexBuffer)
+			|| isShared(m_draw.m_instanceDataBuffer)
+			;
+
 		if (UINT32_MAX != m_draw.m_streamMask)
 		{
-			uint32_t numVertices = UINT32_MAX;
 			for (BitMaskToIndexIteratorT it(m_draw.m_streamMask); !it.isDone(); it.next() )
 			{
-				numVertices = bx::min(numVertices, m_numVertices[it.idx]);
+				shared |= isShared(m_draw.m_stream[it.idx].m_handle);
+			}
+		}
+
+		for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
+		{
+			const Binding& bind = m_bind.m_bind[stage];
+
+			switch (bind.m_type)
+			{
+			case Binding::IndexBuffer:  shared |= isShared(IndexBufferHandle{bind.m_idx}  ); break;
+			case Binding::VertexBuffer: shared |= isShared(VertexBufferHandle{bind.m_idx} ); break;
+			default: break;
 			}
+		}
+
+		DrawList& drawList = *m_drawList;
 
-			m_draw.m_numVertices = numVertices;
+		const uint32_t numMatrices = 0 != m_draw.m_startMatrix ? m_draw.m_numMatrices : 0;
+
+		BX_WARN(!isValid(_occlusionQuery) && !shared
+			, "Draw list can't record draw call with occlusion query, transient or dynamic buffers. Draw call is dropped."
+			);
+		BX_WARN(drawList.m_matrix.m_num + numMatrices < UINT16_MAX
+			, "Draw list can't record more than %d matrices. Draw call is dropped."
+			, UINT16_MAX - 1
+			);
+
+		if (isValid(_occlusionQuery)
+		||  shared
+		||  drawList.m_matrix.m_num + numMatrices >= UINT16_MAX)
+		{
+			++m_numDropped;
+			return;
+		}
+
+		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
+		const uint32_t uniformEnd = uniformBuffer->getPos();
+
+		if (m_drawListUniformPos < uniformEnd)
+		{
+			const uint32_t size = uniformEnd - m_drawListUniformPos;
+			bx::memCopy(drawList.m_uniform.add(size), uniformBuffer->toPtr(m_drawListUniformPos), size);
+			m_drawListUniformPos = uniformEnd;
+		}
+
+		DrawList::Item& item = *drawList.m_item.add();
+
+		// Invalid program is kept, so that it's not referenced by draw list, and
+		// it's remapped on replay.
+		item.m_key = m_key;
+		item.m_key.m_program = _program;
+		item.m_key.m_depth   = _depth;
+
+		RenderDraw& draw = item.m_draw;
+		draw = m_draw;
+		draw.m_numVertices  = getNumVertices();
+		draw.m_uniformIdx   = UINT8_MAX;
+		draw.m_uniformBegin = m_uniformBegin - m_drawListUniformBase;
+		draw.m_uniformEnd   = uniformEnd     - m_drawListUniformBase;
+
+		if (0 == numMatrices)
+		{
+			draw.m_startMatrix = UINT32_MAX;
 		}
 		else
 		{
-			m_draw.m_numVertices = m_numVertices[0];
+			draw.m_startMatrix = drawList.m_matrix.m_num;
+			bx::memCopy(
+				  drawList.m_matrix.add(numMatrices)
+				, m_frame->m_frameCache.m_matrixCache.toPtr(m_draw.m_startMatrix)
+				, numMatrices*sizeof(Matrix4)
+				);
 		}
 
-		if (isValid(_occlusionQuery) )
+		if (UINT16_MAX != m_draw.m_scissor)
 		{
-			m_draw.m_stateFlags |= BGFX_STATE_INTERNAL_OCCLUSION_QUERY;
-			m_draw.m_occlusionQuery = _occlusionQuery;
+			draw.m_scissor = bx::narrowCast<uint16_t>(drawList.m_rect.m_num);
+			*drawList.m_rect.add() = m_frame->m_frameCache.m_rectCache.m_cache[m_draw.m_scissor];
 		}
 
-		m_draw.m_bindIdx = bindStateIndexCached();
-		m_frame->m_renderItem[renderItemIdx].draw = m_draw;
+		const uint32_t numBinds = drawList.m_bind.m_num;
+		if (0 == numBinds
+		||  0 != bx::memCmp(&drawList.m_bind[numBinds-1], &m_bind, sizeof(m_bind) ) )
+		{
+			*drawList.m_bind.add() = m_bind;
+		}
 
-		m_draw.clear(_flags);
-		clearBind(_flags);
-		if (_flags & BGFX_DISCARD_STATE)
+		draw.m_bindIdx = drawList.m_bind.m_num-1;
+	}
+
+	void EncoderImpl::submit(ViewId _id, const DrawList& _drawList, const float* _mtx)
+	{
+		BX_ASSERT(NULL == m_drawList, "Draw list can't be submitted while recording draw list.");
+
+		const uint32_t num = _drawList.m_item.m_num;
+
+		// Recorded matrices are copied in one block. When base transform is
+		// provided, it's stored after them, and used by draws that were
+		// recorded with identity transform.
+		MatrixCache& matrixCache = m_frame->m_frameCache.m_matrixCache;
+
+		const uint16_t numMatrices = bx::narrowCast<uint16_t>(_drawList.m_matrix.m_num + (NULL != _mtx ? 1 : 0) );
+		uint32_t startMatrix    = 0;
+		uint32_t identityMatrix = 0;
+
+		if (0 < numMatrices)
 		{
-			m_uniformBegin = m_uniformEnd;
+			uint16_t numReserved = numMatrices;
+			startMatrix = matrixCache.reserve(&numReserved);
+
+			if (numReserved < numMatrices)
+			{
+				BX_WARN(false, "Matrix cache is full. Draw list is dropped.");
+				m_numDropped += num;
+				return;
+			}
+
+			Matrix4* dst = &matrixCache.m_cache[startMatrix];
+
+			if (NULL == _mtx)
+			{
+				bx::memCopy(dst, _drawList.m_matrix.m_data, _drawList.m_matrix.m_num*sizeof(Matrix4) );
+			}
+			else
+			{
+				Matrix4 base;
+				bx::memCopy(base.un.val, _mtx, sizeof(Matrix4) );
+
+				for (uint32_t ii = 0, numRecorded = _drawList.m_matrix.m_num; ii < numRecorded; ++ii)
+				{
+					bx::float4x4_mul(&dst[ii].un.f4x4
+						, &_drawList.m_matrix[ii].un.f4x4
+						, &base.un.f4x4
+						);
+				}
+
+				identityMatrix = startMatrix + _drawList.m_matrix.m_num;
+				matrixCache.m_cache[identityMatrix] = base;
+			}
+		}
+
+		const uint32_t first    = bx::atomicFetchAndAddsat<uint32_t>(&m_frame->m_numRenderItems, num, m_frame->m_maxDrawCalls);
+		const uint32_t numItems = bx::min(num, m_frame->m_maxDrawCalls - first);
+
+		m_numDropped   += num - numItems;
+		m_numSubmitted += numItems;
+
+		if (0 == numItems)
+		{
+			return;
+		}
+
+		// Uniforms set on encoder for next draw call are written again after
+		// replayed uniforms, so that they are not overridden by draw list.
+		const uint32_t uniformSize = _drawList.m_uniform.m_num;
+		const uint32_t pending     = m_frame->m_uniformBuffer[m_uniformIdx]->getPos() - m_uniformBegin;
+
+		UniformBuffer::update(&m_frame->m_uniformBuffer[m_uniformIdx], uniformSize + pending);
+		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
+		const uint32_t uniformBase = uniformBuffer->getPos();
+
+		if (0 < uniformSize)
+		{
+			uniformBuffer->write(_drawList.m_uniform.m_data, uniformSize);
+		}
+
+		if (0 < pending)
+		{
+			uniformBuffer->write(uniformBuffer->toPtr(m_uniformBegin), pending);
+		}
+
+		m_uniformBegin = uniformBase + uniformSize;
+
+		const uint8_t mode = s_ctx->m_view[_id].m_mode;
+
+		SortKey::Enum type;
+		uint32_t seq = 0;
+		switch (mode)
+		{
+		case ViewMode::Sequential:      seq  = s_ctx->getSeqIncr(_id, numItems); type = SortKey::SortSequence; break;
+		case ViewMode::DepthAscending:
+		case ViewMode::DepthDescending: type = SortKey::SortDepth;                                             break;
+		default:                        type = SortKey::SortProgram;                                           break;
+		}
+
+		uint32_t lastBind = UINT32_MAX;
+		uint32_t bindIdx  = 0;
+		uint16_t lastRect = UINT16_MAX;
+		uint16_t scissor  = UINT16_MAX;
+
+		for (uint32_t ii = 0; ii < numItems; ++ii)
+		{
+			const DrawList::Item& item = _drawList.m_item[ii];
+			const uint32_t renderItemIdx = first + ii;
+
+			SortKey key = item.m_key;
+			key.m_program = isValid(item.m_key.m_program)
+				? item.m_key.m_program
+				: ProgramHandle{0}
+				;
+			key.m_view  = _id;
+			key.m_seq   = seq + ii;
+			key.m_depth = ViewMode::DepthDescending == mode
+				? UINT32_MAX - item.m_key.m_depth
+				: item.m_key.m_depth
+				;
+
+			m_frame->m_sortKeys[renderItemIdx]   = key.encodeDraw(type);
+			m_frame->m_sortValues[renderItemIdx] = RenderItemCount(renderItemIdx);
+
+			RenderDraw& draw = m_frame->m_renderItem[renderItemIdx].draw;
+			draw = item.m_draw;
+			draw.m_gpuRegion     = m_gpuRegion;
+			draw.m_uniformIdx    = m_uniformIdx;
+			draw.m_uniformBegin += uniformBase;
+			draw.m_uniformEnd   += uniformBase;
+			draw.m_startMatrix   = UINT32_MAX == item.m_draw.m_startMatrix
+				? identityMatrix
+				: startMatrix + item.m_draw.m_startMatrix
+				;
+
+			if (UINT16_MAX != item.m_draw.m_scissor)
+			{
+				if (lastRect != item.m_draw.m_scissor)
+				{
+					lastRect = item.m_draw.m_scissor;
+					const Rect& rect = _drawList.m_rect[lastRect];
+					scissor = bx::narrowCast<uint16_t>(m_frame->m_frameCache.m_rectCache.add(
+						  uint16_t(rect.m_x)
+						, uint16_t(rect.m_y)
+						, rect.m_width
+						, rect.m_height
+						) );
+				}
+
+				draw.m_scissor = scissor;
+			}
+
+			if (lastBind != item.m_draw.m_bindIdx)
+			{
+				lastBind = item.m_draw.m_bindIdx;
+				bindIdx  = bindStateIndex(_drawList.m_bind[lastBind]);
+			}
+
+			draw.m_bindIdx = bindIdx;
 		}
 	}
 
@@ -1632,13 +2058,24 @@ namespace bgfx
 		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
 		m_uniformEnd = uniformBuffer->getPos();
 
-		m_compute.m_startMatrix = m_draw.m_startMatrix;
-		m_compute.m_numMatrices = m_draw.m_numMatrices;
-		m_compute.m_startIndex  = m_draw.m_startIndex;
+		m_compute.m_startMatrix    = m_draw.m_startMatrix;
+		m_compute.m_numMatrices    = m_draw.m_numMatrices;
+		m_compute.m_transformIndex = m_draw.m_transformIndex;
+		m_compute.m_startIndex     = m_draw.m_startIndex;
 		m_compute.m_numX   = bx::max(_numX, 1u);
 		m_compute.m_numY   = bx::max(_numY, 1u);
 		m_compute.m_numZ   = bx::max(_numZ, 1u);
 
+		// Condition is set on draw state, and it applies to next draw or dispatch.
+		const uint8_t conditionFlags = 0
+			| BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT
+			| BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE
+			;
+		m_compute.m_occlusionQuery = m_draw.m_occlusionQuery;
+		m_compute.m_submitFlags   |= m_draw.m_submitFlags & conditionFlags;
+		m_draw.m_occlusionQuery    = BGFX_INVALID_HANDLE;
+		m_draw.m_submitFlags      &= ~conditionFlags;
+
 		m_key.m_program = _handle;
 		m_key.m_depth   = 0;
 		m_key.m_view    = _id;
@@ -1651,7 +2088,8 @@ namespace bgfx
 		m_compute.m_uniformIdx   = m_uniformIdx;
 		m_compute.m_uniformBegin = m_uniformBegin;
 		m_compute.m_uniformEnd   = m_uniformEnd;
-		m_compute.m_bindIdx = bindStateIndexCached();
+		m_compute.m_bindIdx   = bindStateIndexCached();
+		m_compute.m_gpuRegion = m_gpuRegion;
 		m_frame->m_renderItem[renderItemIdx].compute = m_compute;
 
 		m_compute.clear(_flags);
@@ -1692,6 +2130,11 @@ namespace bgfx
 
 	void Frame::sort()
 	{
+		if (m_replay)
+		{
+			return;
+		}
+
 		BGFX_PROFILER_SCOPE("bgfx/Sort", kColorSubmit);
 
 		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
@@ -1760,6 +2203,17 @@ namespace bgfx
 		m_uniformCacheFrame.sort(m_viewOrder, s_ctx->m_tempKeys);
 
 		dedupBind();
+
+		// Instance data is appended to transient vertex buffer, renderer must
+		// sort frame before uploading it.
+		mergeInstances();
+
+		sortGpuRegions();
+
+		if (m_frameCapture)
+		{
+			captureFrame(this, m_frameCaptureFilePath.getCPtr() );
+		}
 	}
 
 	void Frame::dedupBind()
@@ -1820,6 +2274,212 @@ namespace bgfx
 		}
 	}
 
+	static bool isInstanceCandidate(const RenderDraw& _draw)
+	{
+		return true
+			&& 1 == _draw.m_numMatrices
+			&& 1 == _draw.m_numInstances
+			&& !isValid(_draw.m_instanceDataBuffer)
+			&& !isValid(_draw.m_indirectBuffer)
+			&& !isValid(_draw.m_occlusionQuery)
+			;
+	}
+
+	static bool isInstanceOf(const Frame& _frame, const RenderDraw& _first, const RenderDraw& _draw)
+	{
+		// Uniforms set with first draw stay bound for rest of the run, any
+		// other uniform change breaks it.
+		if (!isInstanceCandidate(_draw)
+		||  _draw.m_uniformBegin != _draw.m_uniformEnd
+		||  _draw.m_stateFlags   != _first.m_stateFlags
+		||  _draw.m_stencil      != _first.m_stencil
+		||  _draw.m_rgba         != _first.m_rgba
+		||  _draw.m_scissor      != _first.m_scissor
+		||  _draw.m_submitFlags  != _first.m_submitFlags
+		||  _draw.m_streamMask   != _first.m_streamMask
+		||  _draw.m_numVertices  != _first.m_numVertices
+		||  _draw.m_indexBuffer.idx != _first.m_indexBuffer.idx
+		||  _draw.m_startIndex   != _first.m_startIndex
+		||  _draw.m_numIndices   != _first.m_numIndices
+		||  _draw.m_gpuRegion    != _first.m_gpuRegion
+		||  _draw.m_transformIndex != _first.m_transformIndex)
+		{
+			return false;
+		}
+
+		if (UINT32_MAX != _draw.m_streamMask)
+		{
+			for (BitMaskToIndexIteratorT it(_draw.m_streamMask); !it.isDone(); it.next() )
+			{
+				const Stream& stream = _draw.m_stream[it.idx];
+				const Stream& first  = _first.m_stream[it.idx];
+
+				if (stream.m_handle.idx       != first.m_handle.idx
+				||  stream.m_layoutHandle.idx != first.m_layoutHandle.idx
+				||  stream.m_startVertex      != first.m_startVertex)
+				{
+					return false;
+				}
+			}
+		}
+
+		return _draw.m_bindIdx == _first.m_bindIdx
+			|| 0 == bx::memCmp(
+				  _frame.m_renderBind[_draw.m_bindIdx].m_bind
+				, _frame.m_renderBind[_first.m_bindIdx].m_bind
+				, sizeof(RenderBind::m_bind)
+				)
+			;
+	}
+
+	void Frame::mergeInstances()
+	{
+		if (0 == s_ctx->m_numInstancedPrograms)
+		{
+			return;
+		}
+
+		BGFX_PROFILER_SCOPE("bgfx/MergeInstances", kColorSubmit);
+
+		constexpr uint16_t kInstanceStride = sizeof(Matrix4);
+
+		uint32_t num = 0;
+
+		for (uint32_t ii = 0, numItems = m_numRenderItems; ii < numItems;)
+		{
+			const uint64_t key   = m_sortKeys[ii];
+			const RenderItemCount itemIdx = m_sortValues[ii];
+
+			uint32_t end = ii + 1;
+
+			if (0 != (key & kSortKeyDrawBit) )
+			{
+				const ProgramHandle program   = SortKey::decodeDrawProgram(key);
+				const ProgramHandle instanced = s_ctx->m_instancedProgram[program.idx];
+				RenderDraw& draw = m_renderItem[itemIdx].draw;
+
+				if (isValid(instanced)
+				&&  isInstanceCandidate(draw) )
+				{
+					const ViewId view = SortKey::decodeView(key);
+
+					for (; end < numItems; ++end)
+					{
+						const uint64_t next = m_sortKeys[end];
+
+						if (0 == (next & kSortKeyDrawBit)
+						||  view != SortKey::decodeView(next)
+						||  program.idx != SortKey::decodeDrawProgram(next).idx
+						||  !isInstanceOf(*this, draw, m_renderItem[m_sortValues[end] ].draw) )
+						{
+							break;
+						}
+					}
+
+					uint32_t numInstances = bx::min(end - ii, getAvailTransientVertexBuffer(end - ii, kInstanceStride) );
+
+					if (BGFX_CONFIG_AUTO_INSTANCING_MIN_DRAWS <= numInstances)
+					{
+						const uint32_t offset = allocTransientVertexBuffer(numInstances, kInstanceStride);
+						uint8_t* data = &m_transientVb->data[offset];
+
+						for (uint32_t jj = 0; jj < numInstances; ++jj)
+						{
+							const RenderDraw& instance = m_renderItem[m_sortValues[ii+jj] ].draw;
+							bx::memCopy(&data[jj*kInstanceStride], m_frameCache.m_matrixCache.toPtr(instance.m_startMatrix), kInstanceStride);
+						}
+
+						draw.m_instanceDataOffset = offset;
+						draw.m_instanceDataStride = kInstanceStride;
+						draw.m_numInstances       = numInstances;
+						draw.m_instanceDataBuffer = m_transientVb->handle;
+
+						m_sortKeys[num]   = SortKey::replaceDrawProgram(key, instanced);
+						m_sortValues[num] = itemIdx;
+						++num;
+
+						ii += numInstances;
+						continue;
+					}
+				}
+			}
+
+			for (; ii < end; ++ii)
+			{
+				m_sortKeys[num]   = m_sortKeys[ii];
+				m_sortValues[num] = m_sortValues[ii];
+				++num;
+			}
+		}
+
+		m_numRenderItems = num;
+	}
+
+	void Frame::sortGpuRegions()
+	{
+		if (0 == m_numGpuRegions)
+		{
+			return;
+		}
+
+		BGFX_PROFILER_SCOPE("bgfx/SortGpuRegions", kColorSubmit);
+
+		for (uint32_t ii = 0, num = m_numGpuRegions; ii < num; ++ii)
+		{
+			GpuRegion& region = m_gpuRegion[ii];
+			region.m_first = UINT32_MAX;
+			region.m_last  = UINT32_MAX;
+			region.m_slot  = kInvalidGpuRegion;
+		}
+
+		// Region spans from its first to its last item in sorted order, including items of its
+		// nested regions.
+		for (uint32_t ii = 0, num = m_numRenderItems; ii < num; ++ii)
+		{
+			const RenderItem& item = m_renderItem[m_sortValues[ii] ];
+
+			uint16_t idx = 0 != (m_sortKeys[ii] & kSortKeyDrawBit)
+				? item.draw.m_gpuRegion
+				: item.compute.m_gpuRegion
+				;
+
+			while (kInvalidGpuRegion != idx)
+			{
+				GpuRegion& region = m_gpuRegion[idx];
+
+				if (ii == region.m_last)
+				{
+					// Parents are already updated.
+					break;
+				}
+
+				region.m_first = UINT32_MAX == region.m_first ? ii : region.m_first;
+				region.m_last  = ii;
+
+				idx = region.m_parent;
+			}
+		}
+
+		uint32_t numEvents = 0;
+
+		for (uint32_t ii = 0, num = m_numGpuRegions; ii < num; ++ii)
+		{
+			GpuRegion& region = m_gpuRegion[ii];
+
+			if (UINT32_MAX != region.m_first)
+			{
+				region.m_slot = m_numGpuRegionSlots++;
+				m_gpuRegionEvent[numEvents++] = GpuRegionEvent::encode(region.m_first,  true,  uint16_t(ii) );
+				m_gpuRegionEvent[numEvents++] = GpuRegionEvent::encode(region.m_last+1, false, uint16_t(ii) );
+			}
+		}
+
+		uint64_t tempKeys[BX_COUNTOF(m_gpuRegionEvent)];
+		bx::radixSort(m_gpuRegionEvent, tempKeys, numEvents);
+
+		m_numGpuRegionEvents = numEvents;
+	}
+
 	RenderFrame::Enum renderFrame(int32_t _msecs)
 	{
 		if (BX_ENABLED(BGFX_CONFIG_MULTITHREADED) )
@@ -1903,6 +2563,7 @@ namespace bgfx
 		CAPS_FLAGS(BGFX_CAPS_ALPHA_TO_COVERAGE),
 		CAPS_FLAGS(BGFX_CAPS_BLEND_INDEPENDENT),
 		CAPS_FLAGS(BGFX_CAPS_COMPUTE),
+		CAPS_FLAGS(BGFX_CAPS_CONDITIONAL_RENDER),
 		CAPS_FLAGS(BGFX_CAPS_CONSERVATIVE_RASTER),
 		CAPS_FLAGS(BGFX_CAPS_DRAW_INDIRECT),
 		CAPS_FLAGS(BGFX_CAPS_FRAGMENT_DEPTH),
@@ -2058,6 +2719,7 @@ namespace bgfx
 		LIMITS(maxTransientVbSize);
 		LIMITS(maxTransientIbSize);
 		LIMITS(minUniformBufferSize);
+		LIMITS(maxPersistentTransforms);
 #undef LIMITS
 
 		BX_TRACE("");
@@ -2397,11 +3059,23 @@ namespace bgfx
 
 		s_threadIndex = BGFX_API_THREAD_MAGIC;
 
+#if BGFX_CONFIG_MULTITHREADED
+		m_numCmdThreads       = 0;
+		m_cmdThreadGeneration = ++s_cmdThreadGeneration;
+#endif // BGFX_CONFIG_MULTITHREADED
+
 		for (uint32_t ii = 0; ii < BX_COUNTOF(m_viewRemap); ++ii)
 		{
-			m_viewRemap[ii] = ViewId(ii);
+			m_viewRemap[ii] = ViewId(ii);
+		}
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_instancedProgram); ++ii)
+		{
+			m_instancedProgram[ii] = BGFX_INVALID_HANDLE;
 		}
 
+		m_numInstancedPrograms = 0;
+
 		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
 		{
 			resetView(ViewId(ii) );
@@ -2480,12 +3154,20 @@ namespace bgfx
 			| (isGraphicsDebuggerPresent() ? BGFX_CAPS_GRAPHICS_DEBUGGER : 0)
 			;
 
+		// Persistent transform buffer is read by vertex shaders as compute buffer.
+		g_caps.limits.maxPersistentTransforms = 0 != (g_caps.supported & BGFX_CAPS_COMPUTE)
+			? _init.limits.maxPersistentTransforms
+			: 0
+			;
+
 		dumpCaps();
 
 		m_textVideoMemBlitter.init(m_init.resolution.debugTextScale);
 		m_clearQuad.init();
 		m_mipGen.init();
 		m_videoDecode.init();
+		m_transformBuffer.init(g_caps.limits.maxPersistentTransforms);
+		g_caps.limits.maxPersistentTransforms = m_transformBuffer.m_maxTransforms;
 
 		m_submit->m_transientVb = createTransientVertexBuffer(_init.limits.maxTransientVbSize);
 		m_submit->m_transientIb = createTransientIndexBuffer(_init.limits.maxTransientIbSize);
@@ -2505,6 +3187,15 @@ namespace bgfx
 
 	void Context::shutdown()
 	{
+		// Replayed frame uses transient buffers, stop replay before they are destroyed.
+		if (m_submit->m_frameReplayChanged)
+		{
+			captureUnload(m_submit->m_frameReplay);
+		}
+
+		m_submit->m_frameReplay        = NULL;
+		m_submit->m_frameReplayChanged = true;
+
 		getCommandBuffer(CommandBuffer::RendererShutdownBegin);
 		frame();
 
@@ -2514,6 +3205,8 @@ namespace bgfx
 		m_clearQuad.shutdown();
 		m_mipGen.shutdown();
 		m_videoDecode.shutdown();
+		m_transformBuffer.shutdown();
+		topologyShutdown();
 		frame();
 
 		if (BX_ENABLED(BGFX_CONFIG_MULTITHREADED) )
@@ -2541,6 +3234,11 @@ namespace bgfx
 		bx::alignedFree(g_allocator, m_encoder, BX_ALIGNOF(EncoderImpl) );
 		bx::free(g_allocator, m_encoderStats);
 
+		for (uint16_t ii = 0, num = m_drawListHandle.getNumHandles(); ii < num; ++ii)
+		{
+			bx::deleteObject(g_allocator, m_drawList[m_drawListHandle.getHandleAt(ii)]);
+		}
+
 		BX_ASSERT(
 			  m_layoutHandle.getNumHandles() == m_vertexLayoutRef.m_vertexLayoutMap.getNumElements()
 			, "VertexLayoutRef mismatch, num handles %d, handles in hash map %d."
@@ -2657,6 +3355,7 @@ namespace bgfx
 			CHECK_HANDLE_LEAK_NAME   ("FrameBufferHandle",         m_frameBufferHandle,        FrameBufferRef, m_frameBufferRef);
 			CHECK_HANDLE_LEAK_RC_NAME("UniformHandle",             m_uniformHandle,            UniformRef,     m_uniformRef    );
 			CHECK_HANDLE_LEAK        ("OcclusionQueryHandle",      m_occlusionQueryHandle                                      );
+			CHECK_HANDLE_LEAK        ("DrawListHandle",            m_drawListHandle                                            );
 #undef CHECK_HANDLE_LEAK
 #undef CHECK_HANDLE_LEAK_NAME
 		}
@@ -2681,6 +3380,110 @@ namespace bgfx
 			m_occlusionQueryHandle.free(m_freeOcclusionQueryHandle[ii].idx);
 		}
 		m_numFreeOcclusionQueryHandles = 0;
+
+		for (uint16_t ii = 0, num = m_numFreeDrawListHandles; ii < num; ++ii)
+		{
+			const DrawListHandle handle = m_freeDrawListHandle[ii];
+			drawListDecRef(*m_drawList[handle.idx]);
+			bx::deleteObject(g_allocator, m_drawList[handle.idx]);
+			m_drawList[handle.idx] = NULL;
+			m_drawListHandle.free(handle.idx);
+		}
+		m_numFreeDrawListHandles = 0;
+	}
+
+	template<typename Ty>
+	static void addDrawListRef(DrawList::ArrayT<Ty>& _ref, EncoderImpl::HandleSet& _set, Ty _handle)
+	{
+		if (isValid(_handle)
+		&&  _set.insert(_handle.idx).second)
+		{
+			*_ref.add() = _handle;
+		}
+	}
+
+	void Context::drawListIncRef(DrawList& _drawList)
+	{
+		EncoderImpl::HandleSet program;
+		EncoderImpl::HandleSet texture;
+		EncoderImpl::HandleSet uniform;
+		EncoderImpl::HandleSet indexBuffer;
+		EncoderImpl::HandleSet vertexBuffer;
+
+		for (uint32_t ii = 0, num = _drawList.m_item.m_num; ii < num; ++ii)
+		{
+			const DrawList::Item& item = _drawList.m_item[ii];
+			const RenderDraw& draw = item.m_draw;
+
+			addDrawListRef(_drawList.m_programRef, program, item.m_key.m_program);
+			addDrawListRef(_drawList.m_indexBufferRef, indexBuffer, draw.m_indexBuffer);
+			addDrawListRef(_drawList.m_indexBufferRef, indexBuffer, draw.m_numIndirectBuffer);
+			addDrawListRef(_drawList.m_vertexBufferRef, vertexBuffer, draw.m_instanceDataBuffer);
+			addDrawListRef(_drawList.m_vertexBufferRef, vertexBuffer, VertexBufferHandle{draw.m_indirectBuffer.idx});
+
+			if (UINT32_MAX != draw.m_streamMask)
+			{
+				for (BitMaskToIndexIteratorT it(draw.m_streamMask); !it.isDone(); it.next() )
+				{
+					addDrawListRef(_drawList.m_vertexBufferRef, vertexBuffer, draw.m_stream[it.idx].m_handle);
+				}
+			}
+		}
+
+		for (uint32_t ii = 0, num = _drawList.m_bind.m_num; ii < num; ++ii)
+		{
+			const RenderBind& renderBind = _drawList.m_bind[ii];
+
+			for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
+			{
+				const Binding& bind = renderBind.m_bind[stage];
+
+				switch (bind.m_type)
+				{
+				case Binding::Image:
+				case Binding::Texture:      addDrawListRef(_drawList.m_textureRef,      texture,      TextureHandle{bind.m_idx}      ); break;
+				case Binding::IndexBuffer:  addDrawListRef(_drawList.m_indexBufferRef,  indexBuffer,  IndexBufferHandle{bind.m_idx}  ); break;
+				case Binding::VertexBuffer: addDrawListRef(_drawList.m_vertexBufferRef, vertexBuffer, VertexBufferHandle{bind.m_idx} ); break;
+				default: break;
+				}
+			}
+		}
+
+		// Recorded uniform opcodes store uniform handle as location.
+		for (uint32_t pos = 0, size = _drawList.m_uniform.m_num; pos < size;)
+		{
+			uint32_t opcode;
+			bx::memCopy(&opcode, &_drawList.m_uniform.m_data[pos], sizeof(uint32_t) );
+			pos += sizeof(uint32_t);
+
+			uint8_t  type;
+			uint16_t loc;
+			uint16_t num;
+			uint16_t copy;
+			UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
+
+			if (UniformType::Count > type)
+			{
+				addDrawListRef(_drawList.m_uniformRef, uniform, UniformHandle{loc});
+			}
+
+			pos += g_uniformTypeSize[type]*num;
+		}
+
+		for (uint32_t ii = 0, num = _drawList.m_programRef.m_num;      ii < num; ++ii) { programIncRef(_drawList.m_programRef[ii]);           }
+		for (uint32_t ii = 0, num = _drawList.m_textureRef.m_num;      ii < num; ++ii) { textureIncRef(_drawList.m_textureRef[ii]);           }
+		for (uint32_t ii = 0, num = _drawList.m_uniformRef.m_num;      ii < num; ++ii) { uniformIncRef(_drawList.m_uniformRef[ii]);           }
+		for (uint32_t ii = 0, num = _drawList.m_indexBufferRef.m_num;  ii < num; ++ii) { indexBufferIncRef(_drawList.m_indexBufferRef[ii]);   }
+		for (uint32_t ii = 0, num = _drawList.m_vertexBufferRef.m_num; ii < num; ++ii) { vertexBufferIncRef(_drawList.m_vertexBufferRef[ii]); }
+	}
+
+	void Context::drawListDecRef(const DrawList& _drawList)
+	{
+		for (uint32_t ii = 0, num = _drawList.m_programRef.m_num;      ii < num; ++ii) { programDecRef(_drawList.m_programRef[ii]);           }
+		for (uint32_t ii = 0, num = _drawList.m_textureRef.m_num;      ii < num; ++ii) { textureDecRef(_drawList.m_textureRef[ii]);           }
+		for (uint32_t ii = 0, num = _drawList.m_uniformRef.m_num;      ii < num; ++ii) { uniformDecRef(_drawList.m_uniformRef[ii]);           }
+		for (uint32_t ii = 0, num = _drawList.m_indexBufferRef.m_num;  ii < num; ++ii) { indexBufferDecRef(_drawList.m_indexBufferRef[ii]);   }
+		for (uint32_t ii = 0, num = _drawList.m_vertexBufferRef.m_num; ii < num; ++ii) { vertexBufferDecRef(_drawList.m_vertexBufferRef[ii]); }
 	}
 
 	void Context::freeAllHandles(Frame* _frame)
@@ -2784,6 +3587,8 @@ namespace bgfx
 		encoderApiWait();
 #endif // BGFX_CONFIG_MULTITHREADED
 
+		m_transformBuffer.flush();
+
 		m_encoderHandle->reset();
 		const uint16_t idx = m_encoderHandle->alloc();
 		BX_ASSERT(0 == idx, "Internal encoder handle is not 0 (idx %d).", idx); BX_UNUSED(idx);
@@ -2816,13 +3621,37 @@ namespace bgfx
 		apiSemPost();
 	}
 
+	uint8_t Context::getThreadSlot()
+	{
+#if BGFX_CONFIG_MULTITHREADED
+		if (BGFX_API_THREAD_MAGIC == s_threadIndex)
+		{
+			return UINT8_MAX;
+		}
+
+		// Slot assigned by previous context (before shutdown/init) is stale.
+		if (s_threadSlotGeneration != m_cmdThreadGeneration)
+		{
+			s_threadSlotGeneration = m_cmdThreadGeneration;
+
+			const uint32_t slot = bx::atomicFetchAndAdd<uint32_t>(&m_numCmdThreads, 1);
+			s_threadSlot = uint8_t(slot % BGFX_CONFIG_MAX_RESOURCE_THREADS);
+		}
+
+		return s_threadSlot;
+#else
+		return UINT8_MAX;
+#endif // BGFX_CONFIG_MULTITHREADED
+	}
+
 	void Context::swap()
 	{
 		freeDynamicBuffers();
 		m_submit->m_resolution = m_init.resolution;
 		m_init.resolution.reset &= ~BGFX_RESET_INTERNAL_FORCE;
 		m_submit->m_debug = m_debug;
-		m_submit->m_perfStats.numViews = 0;
+		m_submit->m_perfStats.numViews      = 0;
+		m_submit->m_perfStats.numGpuRegions = 0;
 
 		bx::memCopy(m_submit->m_viewRemap, m_viewRemap, sizeof(m_viewRemap) );
 
@@ -2840,6 +3669,15 @@ namespace bgfx
 		freeAllHandles(m_submit);
 		m_submit->resetFreeHandles();
 
+#if BGFX_CONFIG_MULTITHREADED
+		// Threads recording into per-thread command buffers hold their slot
+		// lock while using m_submit.
+		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_RESOURCE_THREADS; ++ii)
+		{
+			m_cmdThreadLock[ii].lock();
+		}
+#endif // BGFX_CONFIG_MULTITHREADED
+
 		m_submit->finish();
 
 		bx::swap(m_render, m_submit);
@@ -2855,6 +3693,13 @@ namespace bgfx
 		uint32_t nextFrameNum = m_render->m_frameNum + 1;
 		m_submit->start(nextFrameNum);
 
+#if BGFX_CONFIG_MULTITHREADED
+		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_RESOURCE_THREADS; ++ii)
+		{
+			m_cmdThreadLock[ii].unlock();
+		}
+#endif // BGFX_CONFIG_MULTITHREADED
+
 		bx::memSet(m_seq, 0, sizeof(m_seq) );
 
 		m_submit->m_textVideoMem->resize(
@@ -2936,17 +3781,50 @@ namespace bgfx
 		{
 			{
 				BGFX_PROFILER_SCOPE("bgfx/Exec commands pre", kColorResource);
+				captureCommands(m_render->m_frameNum, m_render->m_cmdPre);
 				rendererExecCommands(m_render->m_cmdPre);
+
+				for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_RESOURCE_THREADS; ++ii)
+				{
+					captureCommands(m_render->m_frameNum, m_render->m_cmdThread[ii]);
+					rendererExecCommands(m_render->m_cmdThread[ii]);
+				}
+			}
+
+			if (m_render->m_frameReplayChanged)
+			{
+				BGFX_PROFILER_SCOPE("bgfx/Exec commands replay", kColorResource);
+
+				captureUnload(m_frameReplay);
+				m_frameReplay = m_render->m_frameReplay;
+
+				if (NULL != m_frameReplay)
+				{
+					rendererExecCommands(*captureGetCommands(m_frameReplay) );
+				}
 			}
 
 			if (m_rendererInitialized)
 			{
 				{
 					BGFX_PROFILER_SCOPE("bgfx/Render submit", kColorSubmit);
-					m_renderCtx->submit(m_render, m_clearQuad, m_mipGen, m_textVideoMemBlitter);
+
+					if (NULL == m_frameReplay)
+					{
+						m_renderCtx->submit(m_render, m_clearQuad, m_mipGen, m_textVideoMemBlitter);
+					}
+					else
+					{
+						Frame* replay = captureReplayBegin(m_frameReplay, m_render);
+						m_renderCtx->submit(replay, m_clearQuad, m_mipGen, m_textVideoMemBlitter);
+						captureReplayEnd(m_frameReplay, m_render);
+					}
+
 					m_flipped = false;
 				}
 
+				traceFrame(m_render);
+
 				{
 					BGFX_PROFILER_SCOPE("bgfx/Screenshot", kColorResource);
 					for (uint8_t ii = 0, num = m_render->m_numScreenShots; ii < num; ++ii)
@@ -2959,6 +3837,7 @@ namespace bgfx
 
 			{
 				BGFX_PROFILER_SCOPE("bgfx/Exec commands post", kColorResource);
+				captureCommands(m_render->m_frameNum, m_render->m_cmdPost);
 				rendererExecCommands(m_render->m_cmdPost);
 			}
 
@@ -2986,8 +3865,10 @@ namespace bgfx
 			;
 	}
 
-	void rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end)
+	bool rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end, uint32_t& _bytesSkipped)
 	{
+		bool changed = false;
+
 		_uniformBuffer->reset(_begin);
 		while (_uniformBuffer->getPos() < _end)
 		{
@@ -3009,20 +3890,18 @@ namespace bgfx
 
 			if (UniformType::Count > type)
 			{
-				if (copy)
-				{
-					_renderCtx->updateUniform(loc, data, size);
-				}
-				else
-				{
-					_renderCtx->updateUniform(loc, *(const char**)(data), size);
-				}
+				const bool updated = _renderCtx->updateUniform(loc, copy ? data : *(const char**)(data), size);
+
+				changed |= updated;
+				_bytesSkipped += updated ? 0 : size;
 			}
 			else
 			{
 				_renderCtx->setMarker(data, uint16_t(size)-1);
 			}
 		}
+
+		return changed;
 	}
 
 	void Context::flushTextureUpdateBatch(CommandBuffer& _cmdbuf)
@@ -3668,6 +4547,12 @@ namespace bgfx
 					_cmdbuf.read(handle);
 
 					m_renderCtx->destroyProgram(handle);
+
+					if (isValid(m_instancedProgram[handle.idx]) )
+					{
+						m_instancedProgram[handle.idx] = BGFX_INVALID_HANDLE;
+						--m_numInstancedPrograms;
+					}
 				}
 				break;
 
@@ -3821,6 +4706,20 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::SetTextureMinLod:
+				{
+					BGFX_PROFILER_SCOPE("SetTextureMinLod", kColorResource);
+
+					TextureHandle handle;
+					_cmdbuf.read(handle);
+
+					uint8_t minLod;
+					_cmdbuf.read(minLod);
+
+					m_renderCtx->setTextureMinLod(handle, minLod);
+				}
+				break;
+
 			case CommandBuffer::DestroyTexture:
 				{
 					BGFX_PROFILER_SCOPE("DestroyTexture", kColorResource);
@@ -3961,6 +4860,30 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::SetInstancedProgram:
+				{
+					BGFX_PROFILER_SCOPE("SetInstancedProgram", kColorResource);
+
+					ProgramHandle handle;
+					_cmdbuf.read(handle);
+
+					ProgramHandle instanced;
+					_cmdbuf.read(instanced);
+
+					if (isValid(m_instancedProgram[handle.idx]) )
+					{
+						--m_numInstancedPrograms;
+					}
+
+					if (isValid(instanced) )
+					{
+						++m_numInstancedPrograms;
+					}
+
+					m_instancedProgram[handle.idx] = instanced;
+				}
+				break;
+
 			default:
 				BX_ASSERT(false, "Invalid command: %d", command);
 				break;
@@ -4051,6 +4974,9 @@ namespace bgfx
 		, maxTransientVbSize(BGFX_CONFIG_MAX_TRANSIENT_VERTEX_BUFFER_SIZE)
 		, maxTransientIbSize(BGFX_CONFIG_MAX_TRANSIENT_INDEX_BUFFER_SIZE)
 		, minUniformBufferSize(BGFX_CONFIG_MIN_UNIFORM_BUFFER_SIZE)
+		, dynamicIndexBufferSize(BGFX_CONFIG_DYNAMIC_INDEX_BUFFER_SIZE)
+		, dynamicVertexBufferSize(BGFX_CONFIG_DYNAMIC_VERTEX_BUFFER_SIZE)
+		, maxPersistentTransforms(BGFX_CONFIG_MAX_PERSISTENT_TRANSFORMS)
 	{
 	}
 
@@ -4091,6 +5017,8 @@ namespace bgfx
 		init.limits.maxEncoders       = bx::clamp<uint16_t>(init.limits.maxEncoders, 1, (0 != BGFX_CONFIG_MULTITHREADED) ? 128 : 1);
 		init.limits.numDrawCalls      = alignDrawCalls(bx::max(init.limits.numDrawCalls, kDrawCallBlock) );
 		init.limits.minResourceCbSize = bx::min<uint32_t>(init.limits.minResourceCbSize, BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE);
+		init.limits.dynamicIndexBufferSize  = bx::alignUp(bx::max<uint32_t>(init.limits.dynamicIndexBufferSize,  64<<10), 16);
+		init.limits.dynamicVertexBufferSize = bx::alignUp(bx::max<uint32_t>(init.limits.dynamicVertexBufferSize, 64<<10), 16);
 
 		struct ErrorState
 		{
@@ -4170,9 +5098,14 @@ namespace bgfx
 
 		errorState = ErrorState::ContextAllocated;
 
+		traceInit();
+
 		s_ctx = BX_ALIGNED_NEW(g_allocator, Context, Context::kAlignment);
 		if (s_ctx->init(init) )
 		{
+			// Resources created during init are recreated by replaying context.
+			captureInit(s_ctx->m_submit->m_frameNum);
+
 			BX_TRACE("Init complete.");
 			return true;
 		}
@@ -4184,6 +5117,7 @@ namespace bgfx
 		case ErrorState::ContextAllocated:
 			bx::deleteObject(g_allocator, s_ctx, Context::kAlignment);
 			s_ctx = NULL;
+			traceShutdown();
 			[[fallthrough]];
 
 		case ErrorState::Default:
@@ -4220,6 +5154,9 @@ namespace bgfx
 
 		bx::deleteObject(g_allocator, ctx, Context::kAlignment);
 
+		captureShutdown();
+		traceShutdown();
+
 		BX_TRACE("Shutdown complete.");
 
 		if (NULL != s_allocatorStub)
@@ -4264,16 +5201,26 @@ namespace bgfx
 		BGFX_ENCODER(setMarker(bx::StringView(_name, _len) ) );
 	}
 
+	void Encoder::profilerBeginGpu(const char* _name, int32_t _len)
+	{
+		BGFX_ENCODER(profilerBeginGpu(bx::StringView(_name, _len) ) );
+	}
+
+	void Encoder::profilerEndGpu()
+	{
+		BGFX_ENCODER(profilerEndGpu() );
+	}
+
 	void Encoder::setState(uint64_t _state, uint32_t _rgba)
 	{
 		BX_ASSERT(0 == (_state&BGFX_STATE_RESERVED_MASK), "Do not set state reserved flags!");
 		BGFX_ENCODER(setState(_state, _rgba) );
 	}
 
-	void Encoder::setCondition(OcclusionQueryHandle _handle, bool _visible)
+	void Encoder::setCondition(OcclusionQueryHandle _handle, bool _visible, bool _current)
 	{
 		BGFX_CHECK_CAPS(BGFX_CAPS_OCCLUSION_QUERY, "Occlusion query is not supported!");
-		BGFX_ENCODER(setCondition(_handle, _visible) );
+		BGFX_ENCODER(setCondition(_handle, _visible, _current) );
 	}
 
 	void Encoder::setStencil(uint32_t _fstencil, uint32_t _bstencil)
@@ -4301,11 +5248,81 @@ namespace bgfx
 		return BGFX_ENCODER(allocTransform(_transform, _num) );
 	}
 
+	void Encoder::allocTransientIndexBuffer(TransientIndexBuffer* _tib, uint32_t _num, bool _index32)
+	{
+		BX_ASSERT(NULL != _tib, "_tib can't be NULL");
+		BX_ASSERT(0 < _num, "Requesting 0 indices.");
+		BX_ASSERT(
+			  !_index32 || 0 != (g_caps.supported & BGFX_CAPS_INDEX32)
+			, "32-bit indices are not supported. Use bgfx::getCaps to check BGFX_CAPS_INDEX32 backend renderer capabilities."
+			);
+
+		BGFX_ENCODER(allocTransientIndexBuffer(_tib, _num, _index32) );
+
+		const uint32_t indexSize = _tib->isIndex16 ? 2 : 4;
+		BX_ASSERT(_num == _tib->size/indexSize
+			, "Failed to allocate transient index buffer (requested %d, available %d). "
+			  "Use bgfx::getAvailTransient* functions to ensure availability."
+			, _num
+			, _tib->size/indexSize
+			);
+		BX_UNUSED(indexSize);
+	}
+
+	void Encoder::allocTransientVertexBuffer(TransientVertexBuffer* _tvb, uint32_t _num, VertexLayoutHandle _layoutHandle)
+	{
+		BX_ASSERT(NULL != _tvb, "_tvb can't be NULL");
+		BX_ASSERT(0 < _num, "Requesting 0 vertices.");
+		BGFX_CHECK_HANDLE("allocTransientVertexBuffer", s_ctx->m_layoutHandle, _layoutHandle);
+
+		const uint16_t stride = s_ctx->m_vertexLayoutRef.m_stride[_layoutHandle.idx];
+		BGFX_ENCODER(allocTransientVertexBuffer(_tvb, _num, _layoutHandle, stride) );
+
+		BX_ASSERT(_num == _tvb->size / stride
+			, "Failed to allocate transient vertex buffer (requested %d, available %d). "
+			  "Use bgfx::getAvailTransient* functions to ensure availability."
+			, _num
+			, _tvb->size / stride
+			);
+	}
+
+	void Encoder::allocInstanceDataBuffer(InstanceDataBuffer* _idb, uint32_t _num, uint16_t _stride)
+	{
+		BGFX_CHECK_CAPS(BGFX_CAPS_INSTANCING, "Instancing is not supported!");
+		BX_ASSERT(bx::isAligned(_stride, 16), "Stride must be multiple of 16.");
+		BX_ASSERT(0 < _num, "Requesting 0 instanced data vertices.");
+
+		BGFX_ENCODER(allocInstanceDataBuffer(_idb, _num, _stride) );
+
+		BX_ASSERT(_num == _idb->size / _stride
+			, "Failed to allocate instance data buffer (requested %d, available %d). "
+			  "Use bgfx::getAvailTransient* functions to ensure availability."
+			, _num
+			, _idb->size / _stride
+			);
+	}
+
 	void Encoder::setTransform(uint32_t _cache, uint16_t _num)
 	{
 		BGFX_ENCODER(setTransform(_cache, _num) );
 	}
 
+	void Encoder::setPersistentTransform(uint32_t _index)
+	{
+		BX_ASSERT(_index < g_caps.limits.maxPersistentTransforms
+			, "Invalid persistent transform index %d (max: %d)."
+			, _index
+			, g_caps.limits.maxPersistentTransforms
+			);
+
+		const DynamicVertexBufferHandle handle = s_ctx->m_transformBuffer.m_handle;
+		if (isValid(handle) )
+		{
+			const DynamicVertexBuffer& dvb = s_ctx->m_dynamicVertexBuffers[handle.idx];
+			BGFX_ENCODER(setPersistentTransform(_index, dvb.m_handle) );
+		}
+	}
+
 	void Encoder::setUniform(UniformHandle _handle, const void* _value, uint16_t _num)
 	{
 		BGFX_CHECK_HANDLE("setUniform", s_ctx->m_uniformHandle, _handle);
@@ -4699,6 +5716,22 @@ namespace bgfx
 		BGFX_ENCODER(blit(_id, _dst, _dstMip, _dstX, _dstY, _dstZ, _src, _srcMip, _srcX, _srcY, _srcZ, width, height, depth) );
 	}
 
+	void Encoder::beginDrawList()
+	{
+		BGFX_ENCODER(beginDrawList() );
+	}
+
+	DrawListHandle Encoder::endDrawList()
+	{
+		return s_ctx->createDrawList(BGFX_ENCODER(endDrawList() ) );
+	}
+
+	void Encoder::submit(ViewId _id, DrawListHandle _drawList, const void* _mtx)
+	{
+		BGFX_CHECK_HANDLE("submit", s_ctx->m_drawListHandle, _drawList);
+		BGFX_ENCODER(submit(_id, *s_ctx->m_drawList[_drawList.idx], (const float*)_mtx) );
+	}
+
 #undef BGFX_ENCODER
 
 	void end(Encoder* _encoder)
@@ -4910,6 +5943,22 @@ namespace bgfx
 		s_ctx->destroyDynamicVertexBuffer(_handle);
 	}
 
+	uint32_t allocPersistentTransform(uint16_t _num)
+	{
+		return s_ctx->allocPersistentTransform(_num);
+	}
+
+	void freePersistentTransform(uint32_t _index)
+	{
+		s_ctx->freePersistentTransform(_index);
+	}
+
+	void updatePersistentTransform(uint32_t _index, const void* _mtx, uint16_t _num)
+	{
+		BX_ASSERT(NULL != _mtx, "_mtx can't be NULL");
+		s_ctx->updatePersistentTransform(_index, _mtx, _num);
+	}
+
 	uint32_t getAvailTransientIndexBuffer(uint32_t _num, bool _index32)
 	{
 		BX_ASSERT(0 < _num, "Requesting 0 indices.");
@@ -5065,6 +6114,12 @@ namespace bgfx
 		s_ctx->destroyProgram(_handle);
 	}
 
+	void setInstancedProgram(ProgramHandle _handle, ProgramHandle _instanced)
+	{
+		BGFX_CHECK_CAPS(BGFX_CAPS_INSTANCING, "Instancing is not supported!");
+		s_ctx->setInstancedProgram(_handle, _instanced);
+	}
+
 	void isFrameBufferValid(uint8_t _num, const Attachment* _attachment, bx::Error* _err)
 	{
 		BX_ERROR_SCOPE(_err, "Frame buffer validation");
@@ -5961,6 +7016,11 @@ namespace bgfx
 		s_ctx->clearTexture(_handle, _mip, _numMips, _layer, _numLayers);
 	}
 
+	void setTextureMinLod(TextureHandle _handle, uint8_t _minLod)
+	{
+		s_ctx->setTextureMinLod(_handle, _minLod);
+	}
+
 	FrameBufferHandle createFrameBuffer(uint16_t _width, uint16_t _height, TextureFormat::Enum _format, uint64_t _textureFlags)
 	{
 		_textureFlags |= _textureFlags&BGFX_TEXTURE_RT_MSAA_MASK ? 0 : BGFX_TEXTURE_RT;
@@ -6225,16 +7285,28 @@ namespace bgfx
 		s_ctx->m_encoder0->setMarker(_name, _len);
 	}
 
+	void profilerBeginGpu(const char* _name, int32_t _len)
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->profilerBeginGpu(_name, _len);
+	}
+
+	void profilerEndGpu()
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->profilerEndGpu();
+	}
+
 	void setState(uint64_t _state, uint32_t _rgba)
 	{
 		BGFX_CHECK_ENCODER0();
 		s_ctx->m_encoder0->setState(_state, _rgba);
 	}
 
-	void setCondition(OcclusionQueryHandle _handle, bool _visible)
+	void setCondition(OcclusionQueryHandle _handle, bool _visible, bool _current)
 	{
 		BGFX_CHECK_ENCODER0();
-		s_ctx->m_encoder0->setCondition(_handle, _visible);
+		s_ctx->m_encoder0->setCondition(_handle, _visible, _current);
 	}
 
 	void setStencil(uint32_t _fstencil, uint32_t _bstencil)
@@ -6273,6 +7345,12 @@ namespace bgfx
 		s_ctx->m_encoder0->setTransform(_cache, _num);
 	}
 
+	void setPersistentTransform(uint32_t _index)
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->setPersistentTransform(_index);
+	}
+
 	void setUniform(UniformHandle _handle, const void* _value, uint16_t _num)
 	{
 		BGFX_CHECK_ENCODER0();
@@ -6532,12 +7610,54 @@ namespace bgfx
 		s_ctx->m_encoder0->blit(_id, _dst, _dstMip, _dstX, _dstY, _dstZ, _src, _srcMip, _srcX, _srcY, _srcZ, _width, _height, _depth);
 	}
 
+	void beginDrawList()
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->beginDrawList();
+	}
+
+	DrawListHandle endDrawList()
+	{
+		BGFX_CHECK_ENCODER0();
+		return s_ctx->m_encoder0->endDrawList();
+	}
+
+	void submit(ViewId _id, DrawListHandle _drawList, const void* _mtx)
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->submit(_id, _drawList, _mtx);
+	}
+
+	void destroy(DrawListHandle _handle)
+	{
+		s_ctx->destroyDrawList(_handle);
+	}
+
 	void requestScreenShot(FrameBufferHandle _handle, const char* _filePath)
 	{
 		BGFX_CHECK_API_THREAD();
 		s_ctx->requestScreenShot(_handle, _filePath);
 	}
 
+	bool saveTrace(const char* _filePath)
+	{
+		BX_ASSERT(NULL != _filePath, "File path must not be NULL.");
+		return traceSave(_filePath);
+	}
+
+	void requestFrameCapture(const char* _filePath)
+	{
+		BGFX_CHECK_API_THREAD();
+		BX_ASSERT(NULL != _filePath, "File path must not be NULL.");
+		s_ctx->requestFrameCapture(_filePath);
+	}
+
+	bool replayFrameCapture(const char* _filePath)
+	{
+		BGFX_CHECK_API_THREAD();
+		return s_ctx->replayFrameCapture(_filePath);
+	}
+
 #undef BGFX_CHECK_ENCODER0
 
 } // namespace bgfx
@@ -6690,6 +7810,7 @@ static_assert(FLAGS_MASK_TEST(0
 	) );
 
 static_assert(FLAGS_MASK_TEST(0
+	| BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT
 	| BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE
 	, BGFX_SUBMIT_INTERNAL_RESERVED_MASK
 	) );
@@ -6734,6 +7855,7 @@ static_assert( (0
 	| BGFX_CAPS_ALPHA_TO_COVERAGE
 	| BGFX_CAPS_BLEND_INDEPENDENT
 	| BGFX_CAPS_COMPUTE
+	| BGFX_CAPS_CONDITIONAL_RENDER
 	| BGFX_CAPS_CONSERVATIVE_RASTER
 	| BGFX_CAPS_DRAW_INDIRECT
 	| BGFX_CAPS_FRAGMENT_DEPTH
@@ -6764,6 +7886,7 @@ static_assert( (0
 	^ BGFX_CAPS_ALPHA_TO_COVERAGE
 	^ BGFX_CAPS_BLEND_INDEPENDENT
 	^ BGFX_CAPS_COMPUTE
+	^ BGFX_CAPS_CONDITIONAL_RENDER
 	^ BGFX_CAPS_CONSERVATIVE_RASTER
 	^ BGFX_CAPS_DRAW_INDIRECT
 	^ BGFX_CAPS_FRAGMENT_DEPTH
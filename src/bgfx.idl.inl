@@ -343,6 +343,21 @@ BGFX_C_API void bgfx_destroy_dynamic_vertex_buffer(bgfx_dynamic_vertex_buffer_ha
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API uint32_t bgfx_alloc_persistent_transform(uint16_t _num)
+{
+	return bgfx::allocPersistentTransform(_num);
+}
+
+BGFX_C_API void bgfx_free_persistent_transform(uint32_t _index)
+{
+	bgfx::freePersistentTransform(_index);
+}
+
+BGFX_C_API void bgfx_update_persistent_transform(uint32_t _index, const void* _mtx, uint16_t _num)
+{
+	bgfx::updatePersistentTransform(_index, _mtx, _num);
+}
+
 BGFX_C_API uint32_t bgfx_get_avail_transient_index_buffer(uint32_t _num, bool _index32)
 {
 	return bgfx::getAvailTransientIndexBuffer(_num, _index32);
@@ -442,6 +457,13 @@ BGFX_C_API void bgfx_destroy_program(bgfx_program_handle_t _handle)
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API void bgfx_set_instanced_program(bgfx_program_handle_t _handle, bgfx_program_handle_t _instanced)
+{
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } handle = { _handle };
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } instanced = { _instanced };
+	bgfx::setInstancedProgram(handle.cpp, instanced.cpp);
+}
+
 BGFX_C_API bool bgfx_is_texture_valid(uint16_t _depth, bool _cubeMap, uint16_t _numLayers, bgfx_texture_format_t _format, uint64_t _flags)
 {
 	return bgfx::isTextureValid(_depth, _cubeMap, _numLayers, (bgfx::TextureFormat::Enum)_format, _flags);
@@ -528,6 +550,12 @@ BGFX_C_API uint32_t bgfx_read_texture(bgfx_texture_handle_t _handle, void* _data
 	return bgfx::readTexture(handle.cpp, _data, _layer, _mip);
 }
 
+BGFX_C_API void bgfx_set_texture_min_lod(bgfx_texture_handle_t _handle, uint8_t _minLod)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	bgfx::setTextureMinLod(handle.cpp, _minLod);
+}
+
 BGFX_C_API void bgfx_set_texture_name(bgfx_texture_handle_t _handle, const char* _name, int32_t _len)
 {
 	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
@@ -739,17 +767,29 @@ BGFX_C_API void bgfx_encoder_set_marker(bgfx_encoder_t* _this, const char* _name
 	This->setMarker(_name, _len);
 }
 
+BGFX_C_API void bgfx_encoder_profiler_begin_gpu(bgfx_encoder_t* _this, const char* _name, int32_t _len)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	This->profilerBeginGpu(_name, _len);
+}
+
+BGFX_C_API void bgfx_encoder_profiler_end_gpu(bgfx_encoder_t* _this)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	This->profilerEndGpu();
+}
+
 BGFX_C_API void bgfx_encoder_set_state(bgfx_encoder_t* _this, uint64_t _state, uint32_t _rgba)
 {
 	bgfx::Encoder* This = (bgfx::Encoder*)_this;
 	This->setState(_state, _rgba);
 }
 
-BGFX_C_API void bgfx_encoder_set_condition(bgfx_encoder_t* _this, bgfx_occlusion_query_handle_t _handle, bool _visible)
+BGFX_C_API void bgfx_encoder_set_condition(bgfx_encoder_t* _this, bgfx_occlusion_query_handle_t _handle, bool _visible, bool _current)
 {
 	bgfx::Encoder* This = (bgfx::Encoder*)_this;
 	union { bgfx_occlusion_query_handle_t c; bgfx::OcclusionQueryHandle cpp; } handle = { _handle };
-	This->setCondition(handle.cpp, _visible);
+	This->setCondition(handle.cpp, _visible, _current);
 }
 
 BGFX_C_API void bgfx_encoder_set_stencil(bgfx_encoder_t* _this, uint32_t _fstencil, uint32_t _bstencil)
@@ -782,12 +822,37 @@ BGFX_C_API void bgfx_encoder_set_transform_cached(bgfx_encoder_t* _this, uint32_
 	This->setTransform(_cache, _num);
 }
 
+BGFX_C_API void bgfx_encoder_set_persistent_transform(bgfx_encoder_t* _this, uint32_t _index)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	This->setPersistentTransform(_index);
+}
+
 BGFX_C_API uint32_t bgfx_encoder_alloc_transform(bgfx_encoder_t* _this, bgfx_transform_t* _transform, uint16_t _num)
 {
 	bgfx::Encoder* This = (bgfx::Encoder*)_this;
 	return This->allocTransform((bgfx::Transform*)_transform, _num);
 }
 
+BGFX_C_API void bgfx_encoder_alloc_transient_index_buffer(bgfx_encoder_t* _this, bgfx_transient_index_buffer_t* _tib, uint32_t _num, bool _index32)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	This->allocTransientIndexBuffer((bgfx::TransientIndexBuffer*)_tib, _num, _index32);
+}
+
+BGFX_C_API void bgfx_encoder_alloc_transient_vertex_buffer(bgfx_encoder_t* _this, bgfx_transient_vertex_buffer_t* _tvb, uint32_t _num, bgfx_vertex_layout_handle_t _layoutHandle)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	union { bgfx_vertex_layout_handle_t c; bgfx::VertexLayoutHandle cpp; } layoutHandle = { _layoutHandle };
+	This->allocTransientVertexBuffer((bgfx::TransientVertexBuffer*)_tvb, _num, layoutHandle.cpp);
+}
+
+BGFX_C_API void bgfx_encoder_alloc_instance_data_buffer(bgfx_encoder_t* _this, bgfx_instance_data_buffer_t* _idb, uint32_t _num, uint16_t _stride)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	This->allocInstanceDataBuffer((bgfx::InstanceDataBuffer*)_idb, _num, _stride);
+}
+
 BGFX_C_API void bgfx_encoder_set_uniform(bgfx_encoder_t* _this, bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num)
 {
 	bgfx::Encoder* This = (bgfx::Encoder*)_this;
@@ -1034,12 +1099,48 @@ BGFX_C_API void bgfx_encoder_blit(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgf
 	This->blit((bgfx::ViewId)_id, dst.cpp, _dstMip, _dstX, _dstY, _dstZ, src.cpp, _srcMip, _srcX, _srcY, _srcZ, _width, _height, _depth);
 }
 
+BGFX_C_API void bgfx_encoder_begin_draw_list(bgfx_encoder_t* _this)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	This->beginDrawList();
+}
+
+BGFX_C_API bgfx_draw_list_handle_t bgfx_encoder_end_draw_list(bgfx_encoder_t* _this)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	union { bgfx_draw_list_handle_t c; bgfx::DrawListHandle cpp; } handle_ret;
+	handle_ret.cpp = This->endDrawList();
+	return handle_ret.c;
+}
+
+BGFX_C_API void bgfx_encoder_submit_draw_list(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_draw_list_handle_t _drawList, const void* _mtx)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	union { bgfx_draw_list_handle_t c; bgfx::DrawListHandle cpp; } drawList = { _drawList };
+	This->submit((bgfx::ViewId)_id, drawList.cpp, _mtx);
+}
+
 BGFX_C_API void bgfx_request_screen_shot(bgfx_frame_buffer_handle_t _handle, const char* _filePath)
 {
 	union { bgfx_frame_buffer_handle_t c; bgfx::FrameBufferHandle cpp; } handle = { _handle };
 	bgfx::requestScreenShot(handle.cpp, _filePath);
 }
 
+BGFX_C_API bool bgfx_save_trace(const char* _filePath)
+{
+	return bgfx::saveTrace(_filePath);
+}
+
+BGFX_C_API void bgfx_request_frame_capture(const char* _filePath)
+{
+	bgfx::requestFrameCapture(_filePath);
+}
+
+BGFX_C_API bool bgfx_replay_frame_capture(const char* _filePath)
+{
+	return bgfx::replayFrameCapture(_filePath);
+}
+
 BGFX_C_API bgfx_render_frame_t bgfx_render_frame(int32_t _msecs)
 {
 	return (bgfx_render_frame_t)bgfx::renderFrame(_msecs);
@@ -1073,15 +1174,25 @@ BGFX_C_API void bgfx_set_marker(const char* _name, int32_t _len)
 	bgfx::setMarker(_name, _len);
 }
 
+BGFX_C_API void bgfx_profiler_begin_gpu(const char* _name, int32_t _len)
+{
+	bgfx::profilerBeginGpu(_name, _len);
+}
+
+BGFX_C_API void bgfx_profiler_end_gpu(void)
+{
+	bgfx::profilerEndGpu();
+}
+
 BGFX_C_API void bgfx_set_state(uint64_t _state, uint32_t _rgba)
 {
 	bgfx::setState(_state, _rgba);
 }
 
-BGFX_C_API void bgfx_set_condition(bgfx_occlusion_query_handle_t _handle, bool _visible)
+BGFX_C_API void bgfx_set_condition(bgfx_occlusion_query_handle_t _handle, bool _visible, bool _current)
 {
 	union { bgfx_occlusion_query_handle_t c; bgfx::OcclusionQueryHandle cpp; } handle = { _handle };
-	bgfx::setCondition(handle.cpp, _visible);
+	bgfx::setCondition(handle.cpp, _visible, _current);
 }
 
 BGFX_C_API void bgfx_set_stencil(uint32_t _fstencil, uint32_t _bstencil)
@@ -1109,6 +1220,11 @@ BGFX_C_API void bgfx_set_transform_cached(uint32_t _cache, uint16_t _num)
 	bgfx::setTransform(_cache, _num);
 }
 
+BGFX_C_API void bgfx_set_persistent_transform(uint32_t _index)
+{
+	bgfx::setPersistentTransform(_index);
+}
+
 BGFX_C_API uint32_t bgfx_alloc_transform(bgfx_transform_t* _transform, uint16_t _num)
 {
 	return bgfx::allocTransform((bgfx::Transform*)_transform, _num);
@@ -1315,6 +1431,30 @@ BGFX_C_API void bgfx_blit(bgfx_view_id_t _id, bgfx_texture_handle_t _dst, uint8_
 	bgfx::blit((bgfx::ViewId)_id, dst.cpp, _dstMip, _dstX, _dstY, _dstZ, src.cpp, _srcMip, _srcX, _srcY, _srcZ, _width, _height, _depth);
 }
 
+BGFX_C_API void bgfx_begin_draw_list(void)
+{
+	bgfx::beginDrawList();
+}
+
+BGFX_C_API bgfx_draw_list_handle_t bgfx_end_draw_list(void)
+{
+	union { bgfx_draw_list_handle_t c; bgfx::DrawListHandle cpp; } handle_ret;
+	handle_ret.cpp = bgfx::endDrawList();
+	return handle_ret.c;
+}
+
+BGFX_C_API void bgfx_submit_draw_list(bgfx_view_id_t _id, bgfx_draw_list_handle_t _drawList, const void* _mtx)
+{
+	union { bgfx_draw_list_handle_t c; bgfx::DrawListHandle cpp; } drawList = { _drawList };
+	bgfx::submit((bgfx::ViewId)_id, drawList.cpp, _mtx);
+}
+
+BGFX_C_API void bgfx_destroy_draw_list(bgfx_draw_list_handle_t _handle)
+{
+	union { bgfx_draw_list_handle_t c; bgfx::DrawListHandle cpp; } handle = { _handle };
+	bgfx::destroy(handle.cpp);
+}
+
 
 /* user define functions */
 BGFX_C_API void bgfx_init_ctor(bgfx_init_t* _init)
@@ -1405,6 +1545,9 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_create_dynamic_vertex_buffer_mem,
 			bgfx_update_dynamic_vertex_buffer,
 			bgfx_destroy_dynamic_vertex_buffer,
+			bgfx_alloc_persistent_transform,
+			bgfx_free_persistent_transform,
+			bgfx_update_persistent_transform,
 			bgfx_get_avail_transient_index_buffer,
 			bgfx_get_avail_transient_vertex_buffer,
 			bgfx_get_avail_instance_data_buffer,
@@ -1421,6 +1564,7 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_create_program,
 			bgfx_create_compute_program,
 			bgfx_destroy_program,
+			bgfx_set_instanced_program,
 			bgfx_is_texture_valid,
 			bgfx_is_video_codec_valid,
 			bgfx_is_frame_buffer_valid,
@@ -1435,6 +1579,7 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_update_texture_cube,
 			bgfx_clear_texture,
 			bgfx_read_texture,
+			bgfx_set_texture_min_lod,
 			bgfx_set_texture_name,
 			bgfx_get_direct_access_ptr,
 			bgfx_destroy_texture,
@@ -1471,6 +1616,8 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_encoder_begin,
 			bgfx_encoder_end,
 			bgfx_encoder_set_marker,
+			bgfx_encoder_profiler_begin_gpu,
+			bgfx_encoder_profiler_end_gpu,
 			bgfx_encoder_set_state,
 			bgfx_encoder_set_condition,
 			bgfx_encoder_set_stencil,
@@ -1478,7 +1625,11 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_encoder_set_scissor_cached,
 			bgfx_encoder_set_transform,
 			bgfx_encoder_set_transform_cached,
+			bgfx_encoder_set_persistent_transform,
 			bgfx_encoder_alloc_transform,
+			bgfx_encoder_alloc_transient_index_buffer,
+			bgfx_encoder_alloc_transient_vertex_buffer,
+			bgfx_encoder_alloc_instance_data_buffer,
 			bgfx_encoder_set_uniform,
 			bgfx_set_view_uniform,
 			bgfx_set_frame_uniform,
@@ -1514,13 +1665,21 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_encoder_dispatch_indirect,
 			bgfx_encoder_discard,
 			bgfx_encoder_blit,
+			bgfx_encoder_begin_draw_list,
+			bgfx_encoder_end_draw_list,
+			bgfx_encoder_submit_draw_list,
 			bgfx_request_screen_shot,
+			bgfx_save_trace,
+			bgfx_request_frame_capture,
+			bgfx_replay_frame_capture,
 			bgfx_render_frame,
 			bgfx_set_platform_data,
 			bgfx_get_internal_data,
 			bgfx_override_internal_texture_ptr,
 			bgfx_override_internal_texture,
 			bgfx_set_marker,
+			bgfx_profiler_begin_gpu,
+			bgfx_profiler_end_gpu,
 			bgfx_set_state,
 			bgfx_set_condition,
 			bgfx_set_stencil,
@@ -1528,6 +1687,7 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_set_scissor_cached,
 			bgfx_set_transform,
 			bgfx_set_transform_cached,
+			bgfx_set_persistent_transform,
 			bgfx_alloc_transform,
 			bgfx_set_uniform,
 			bgfx_set_index_buffer,
@@ -1561,7 +1721,11 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_dispatch,
 			bgfx_dispatch_indirect,
 			bgfx_discard,
-			bgfx_blit
+			bgfx_blit,
+			bgfx_begin_draw_list,
+			bgfx_end_draw_list,
+			bgfx_submit_draw_list,
+			bgfx_destroy_draw_list
 		};
 
 		return &s_bgfx_interface;
@@ -330,6 +330,26 @@ uniform vec4 bgfx_indirectArgBase;
 	_buffer[(_offset)*2+0] = uvec4(_numIndices, _numInstances, floatBitsToUint(bgfx_indirectArgBase.x) + uint(_startIndex), _startVertex); \
 	_buffer[(_offset)*2+1] = uvec4(_startInstance, 0u, 0u, 0u)
 
+#ifndef BGFX_TRANSFORM_BUFFER_STAGE
+#	define BGFX_TRANSFORM_BUFFER_STAGE 15
+#endif // BGFX_TRANSFORM_BUFFER_STAGE
+
+// Persistent transform buffer, see `bgfx::setPersistentTransform`. Declare it
+// with PERSISTENT_TRANSFORMS() at global scope.
+#define PERSISTENT_TRANSFORMS()                                               \
+	BUFFER_RO(bgfx_transformBuffer, vec4, BGFX_TRANSFORM_BUFFER_STAGE);       \
+	uniform vec4 bgfx_transformIndex
+
+#define persistentTransformIndex() floatBitsToUint(bgfx_transformIndex.x)
+
+#define persistentTransform(_idx)                \
+	mtxFromCols(                                 \
+		  bgfx_transformBuffer[uint(_idx)*4u+0u] \
+		, bgfx_transformBuffer[uint(_idx)*4u+1u] \
+		, bgfx_transformBuffer[uint(_idx)*4u+2u] \
+		, bgfx_transformBuffer[uint(_idx)*4u+3u] \
+		)
+
 #endif // __cplusplus
 
 #endif // BGFX_COMPUTE_H_HEADER_GUARD
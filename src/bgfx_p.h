@@ -51,12 +51,12 @@
 #	define BGFX_MUTEX_SCOPE(_mutex) BX_NOOP()
 #endif // BGFX_CONFIG_MULTITHREADED
 
-#if BGFX_CONFIG_PROFILER
+#if BGFX_CONFIG_PROFILER || BGFX_CONFIG_TRACE
 #	define BGFX_PROFILER_SCOPE(_name, _abgr)            ProfilerScope BX_CONCATENATE(profilerScope, __LINE__)(_name, _abgr, __FILE__, uint16_t(__LINE__) )
-#	define BGFX_PROFILER_BEGIN(_name, _abgr)            g_callback->profilerBegin(_name, _abgr, __FILE__, uint16_t(__LINE__) )
-#	define BGFX_PROFILER_BEGIN_LITERAL(_name, _abgr)    g_callback->profilerBeginLiteral(_name, _abgr, __FILE__, uint16_t(__LINE__) )
-#	define BGFX_PROFILER_END()                          g_callback->profilerEnd()
-#	define BGFX_PROFILER_SET_CURRENT_THREAD_NAME(_name) BX_NOOP()
+#	define BGFX_PROFILER_BEGIN(_name, _abgr)            profilerBegin(_name, _abgr, __FILE__, uint16_t(__LINE__) )
+#	define BGFX_PROFILER_BEGIN_LITERAL(_name, _abgr)    profilerBeginLiteral(_name, _abgr, __FILE__, uint16_t(__LINE__) )
+#	define BGFX_PROFILER_END()                          profilerEnd()
+#	define BGFX_PROFILER_SET_CURRENT_THREAD_NAME(_name) traceSetThreadName(_name)
 #else
 #	define BGFX_PROFILER_SCOPE(_name, _abgr)            BX_NOOP()
 #	define BGFX_PROFILER_BEGIN(_name, _abgr)            BX_NOOP()
@@ -142,7 +142,9 @@ namespace bgfx
 #include <bx/timer.h>
 
 #include <bimg/bimg.h>
+#include "capture.h"
 #include "shader.h"
+#include "trace.h"
 #include "vertexlayout.h"
 #include "version.h"
 
@@ -228,6 +230,7 @@ namespace stl = std;
 #define BGFX_STATE_INTERNAL_OCCLUSION_QUERY    UINT64_C(0x4000000000000000)
 
 #define BGFX_SUBMIT_INTERNAL_NONE              UINT8_C(0x00)
+#define BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT UINT8_C(0x20)
 #define BGFX_SUBMIT_INTERNAL_INDEX32           UINT8_C(0x40)
 #define BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE UINT8_C(0x80)
 #define BGFX_SUBMIT_INTERNAL_RESERVED_MASK     UINT8_C(0xff)
@@ -587,16 +590,46 @@ namespace bgfx
 	extern bx::AllocatorI* g_allocator;
 	extern Caps g_caps;
 
+	inline void profilerBegin(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line)
+	{
+		if (BX_ENABLED(BGFX_CONFIG_PROFILER) )
+		{
+			g_callback->profilerBegin(_name, _abgr, _filePath, _line);
+		}
+
+		traceBegin(_name);
+	}
+
+	inline void profilerBeginLiteral(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line)
+	{
+		if (BX_ENABLED(BGFX_CONFIG_PROFILER) )
+		{
+			g_callback->profilerBeginLiteral(_name, _abgr, _filePath, _line);
+		}
+
+		traceBegin(_name);
+	}
+
+	inline void profilerEnd()
+	{
+		traceEnd();
+
+		if (BX_ENABLED(BGFX_CONFIG_PROFILER) )
+		{
+			g_callback->profilerEnd();
+		}
+	}
+
 	struct ProfilerScope
 	{
 		ProfilerScope(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line)
 		{
-			g_callback->profilerBeginLiteral(_name, _abgr, _filePath, _line);
+			profilerBeginLiteral(_name, _abgr, _filePath, _line);
 		}
 
 		~ProfilerScope()
 		{
-			g_callback->profilerEnd();
+			profilerEnd();
 		}
 	};
 
@@ -985,6 +1018,7 @@ namespace bgfx
 	{
 		enum Enum
 		{
+			// Per-view, must be before Model.
 			ViewRect,
 			ViewTexel,
 			View,
@@ -993,12 +1027,15 @@ namespace bgfx
 			InvProj,
 			ViewProj,
 			InvViewProj,
+
+			// Per-draw.
 			Model,
 			ModelView,
 			InvModelView,
 			ModelViewProj,
 			AlphaRef,
 			IndirectArgBase,
+			TransformIndex,
 
 			Count
 		};
@@ -1058,11 +1095,13 @@ namespace bgfx
 			UpdateTexture,
 			ClearTexture,
 			ResizeTexture,
+			SetTextureMinLod,
 			CreateFrameBuffer,
 			CreateUniform,
 			UpdateViewName,
 			InvalidateOcclusionQuery,
 			SetName,
+			SetInstancedProgram,
 			End,
 			RendererShutdownEnd,
 			DestroyVertexLayout,
@@ -1464,6 +1503,40 @@ namespace bgfx
 			return ViewId( (_key & kSortKeyViewMask) >> kSortKeyViewBitShift);
 		}
 
+		static ProgramHandle decodeDrawProgram(uint64_t _key)
+		{
+			const uint64_t type = _key & kSortKeyDrawTypeMask;
+
+			if (type == kSortKeyDrawTypeDepth)
+			{
+				return { uint16_t( (_key & kSortKeyDraw1ProgramMask) >> kSortKeyDraw1ProgramShift) };
+			}
+
+			if (type == kSortKeyDrawTypeSequence)
+			{
+				return { uint16_t( (_key & kSortKeyDraw2ProgramMask) >> kSortKeyDraw2ProgramShift) };
+			}
+
+			return { uint16_t( (_key & kSortKeyDraw0ProgramMask) >> kSortKeyDraw0ProgramShift) };
+		}
+
+		static uint64_t replaceDrawProgram(uint64_t _key, ProgramHandle _program)
+		{
+			const uint64_t type = _key & kSortKeyDrawTypeMask;
+
+			if (type == kSortKeyDrawTypeDepth)
+			{
+				return (_key & ~kSortKeyDraw1ProgramMask) | ( (uint64_t(_program.idx) << kSortKeyDraw1ProgramShift) & kSortKeyDraw1ProgramMask);
+			}
+
+			if (type == kSortKeyDrawTypeSequence)
+			{
+				return (_key & ~kSortKeyDraw2ProgramMask) | ( (uint64_t(_program.idx) << kSortKeyDraw2ProgramShift) & kSortKeyDraw2ProgramMask);
+			}
+
+			return (_key & ~kSortKeyDraw0ProgramMask) | ( (uint64_t(_program.idx) << kSortKeyDraw0ProgramShift) & kSortKeyDraw0ProgramMask);
+		}
+
 		static uint64_t remapView(uint64_t _key, ViewId _viewRemap[BGFX_CONFIG_MAX_VIEWS])
 		{
 			const ViewId   oldView = decodeView(_key);
@@ -1987,16 +2060,16 @@ namespace bgfx
 			bx::free(g_allocator, _uniformBuffer);
 		}
 
-		static void update(UniformBuffer** _uniformBuffer)
+		static void update(UniformBuffer** _uniformBuffer, uint32_t _reserve = 0)
 		{
 			static constexpr uint32_t kThreshold = BGFX_CONFIG_UNIFORM_BUFFER_RESIZE_THRESHOLD_SIZE;
 			static constexpr uint32_t kIncrement = BGFX_CONFIG_UNIFORM_BUFFER_RESIZE_INCREMENT_SIZE;
 
 			UniformBuffer* uniformBuffer = *_uniformBuffer;
-			if (kThreshold >= uniformBuffer->m_size - uniformBuffer->m_pos)
+			if (kThreshold + _reserve >= uniformBuffer->m_size - uniformBuffer->m_pos)
 			{
 				const uint32_t size = uniformBuffer->m_size
-					+ bx::max(kIncrement, uniformBuffer->m_size/2)
+					+ bx::max(bx::max(kIncrement, uniformBuffer->m_size/2), _reserve)
 					;
 				resize(_uniformBuffer, size);
 			}
@@ -2082,6 +2155,17 @@ namespace bgfx
 			return m_pos;
 		}
 
+		uint32_t getHwm() const
+		{
+			return m_hwm;
+		}
+
+		const char* toPtr(uint32_t _pos) const
+		{
+			BX_ASSERT(_pos <= m_pos, "Out of bounds %d (pos: %d).", _pos, m_pos);
+			return &m_buffer[_pos];
+		}
+
 		void reset(uint32_t _pos = 0)
 		{
 			m_pos = _pos;
@@ -2336,8 +2420,9 @@ namespace bgfx
 
 			if (0 != (_flags & BGFX_DISCARD_TRANSFORM) )
 			{
-				m_startMatrix = 0;
-				m_numMatrices = 1;
+				m_startMatrix    = 0;
+				m_numMatrices    = 1;
+				m_transformIndex = 0;
 			}
 
 			if (0 != (_flags & BGFX_DISCARD_INSTANCE_DATA) )
@@ -2397,6 +2482,7 @@ namespace bgfx
 		uint32_t m_uniformBegin;
 		uint32_t m_uniformEnd;
 		uint32_t m_startMatrix;
+		uint32_t m_transformIndex;
 		uint32_t m_startIndex;
 		uint32_t m_numIndices;
 		uint32_t m_numVertices;
@@ -2418,6 +2504,7 @@ namespace bgfx
 		IndirectBufferHandle m_indirectBuffer;
 		IndexBufferHandle    m_numIndirectBuffer;
 		OcclusionQueryHandle m_occlusionQuery;
+		uint16_t             m_gpuRegion;
 	};
 
 	BX_ALIGN_DECL_CACHE_LINE(struct) RenderCompute
@@ -2433,8 +2520,9 @@ namespace bgfx
 
 			if (0 != (_flags & BGFX_DISCARD_TRANSFORM) )
 			{
-				m_startMatrix = 0;
-				m_numMatrices = 0;
+				m_startMatrix    = 0;
+				m_numMatrices    = 0;
+				m_transformIndex = 0;
 			}
 
 			m_numX           = 0;
@@ -2442,6 +2530,7 @@ namespace bgfx
 			m_numZ           = 0;
 			m_submitFlags    = 0;
 			m_indirectBuffer = BGFX_INVALID_HANDLE;
+			m_occlusionQuery = BGFX_INVALID_HANDLE;
 			m_startIndirect  = 0;
 			m_numIndirect    = UINT32_MAX;
 			m_bindIdx        = 0;
@@ -2451,8 +2540,10 @@ namespace bgfx
 		uint32_t m_uniformBegin;
 		uint32_t m_uniformEnd;
 		uint32_t m_startMatrix;
+		uint32_t m_transformIndex;
 		uint32_t m_startIndex;
 		IndirectBufferHandle m_indirectBuffer;
+		OcclusionQueryHandle m_occlusionQuery;
 
 		uint32_t m_numX;
 		uint32_t m_numY;
@@ -2461,6 +2552,7 @@ namespace bgfx
 		uint32_t m_numIndirect;
 		uint32_t m_bindIdx;
 		uint16_t m_numMatrices;
+		uint16_t m_gpuRegion;
 		uint8_t  m_submitFlags;
 		uint8_t  m_uniformIdx;
 	};
@@ -2494,6 +2586,8 @@ namespace bgfx
 		bx::FixedString64 m_name;
 		uint32_t m_size;
 		uint16_t m_flags;
+		int16_t  m_refCount;
+		bool     m_shared;
 	};
 
 	struct VertexBuffer
@@ -2501,6 +2595,9 @@ namespace bgfx
 		bx::FixedString64 m_name;
 		uint32_t m_size;
 		uint16_t m_stride;
+		uint16_t m_flags;
+		int16_t  m_refCount;
+		bool     m_shared;
 	};
 
 	struct DynamicIndexBuffer
@@ -2557,9 +2654,10 @@ namespace bgfx
 
 	struct ProgramRef
 	{
-		ShaderHandle m_vsh;
-		ShaderHandle m_fsh;
-		int16_t      m_refCount;
+		ShaderHandle  m_vsh;
+		ShaderHandle  m_fsh;
+		ProgramHandle m_instanced;
+		int16_t       m_refCount;
 	};
 
 	struct UniformRef
@@ -2598,6 +2696,7 @@ namespace bgfx
 			m_format      = uint8_t(_format);
 			m_numSamples  = 1 << bx::satSub<uint32_t>(uint32_t( (_flags & BGFX_TEXTURE_RT_MSAA_MASK) >> BGFX_TEXTURE_RT_MSAA_SHIFT), 1u);
 			m_numMips     = _numMips;
+			m_minLod      = 0;
 			m_numLayers   = _numLayers;
 			m_owned       = false;
 			m_immutable   = _immutable;
@@ -2640,6 +2739,26 @@ namespace bgfx
 			return 1 < m_numMips;
 		}
 
+		// Size of mips starting from min LOD.
+		uint32_t getResidentSize() const
+		{
+			if (0 == m_minLod)
+			{
+				return m_storageSize;
+			}
+
+			return bimg::imageGetSize(
+				  NULL
+				, bx::max<uint16_t>(1, m_width  >> m_minLod)
+				, bx::max<uint16_t>(1, m_height >> m_minLod)
+				, bx::max<uint16_t>(1, m_depth  >> m_minLod)
+				, m_cubeMap
+				, 1 < m_numMips - m_minLod
+				, m_numLayers
+				, bimg::TextureFormat::Enum(m_format)
+				);
+		}
+
 		bx::FixedString64 m_name;
 		void*    m_ptr;
 		uint64_t m_flags;
@@ -2652,6 +2771,7 @@ namespace bgfx
 		uint8_t  m_format;
 		uint8_t  m_numSamples;
 		uint8_t  m_numMips;
+		uint8_t  m_minLod;
 		uint16_t m_numLayers;
 		bool     m_owned;
 		bool     m_immutable;
@@ -2956,6 +3076,48 @@ namespace bgfx
 		RectCache m_rectCache;
 	};
 
+	static constexpr uint16_t kInvalidGpuRegion = UINT16_MAX;
+
+	static_assert(BGFX_CONFIG_MAX_GPU_REGIONS < kInvalidGpuRegion);
+
+	struct GpuRegion
+	{
+		char     m_name[sizeof(GpuRegionStats::name)];
+		uint32_t m_first; //!< First sorted render item.
+		uint32_t m_last;  //!< Last sorted render item.
+		uint16_t m_parent;
+		uint16_t m_slot;  //!< Query slot, only regions with render items are timed.
+	};
+
+	// Timestamp events ordered by sorted render item position. Region begins before its first
+	// item, and ends before item after its last item.
+	struct GpuRegionEvent
+	{
+		static uint64_t encode(uint32_t _item, bool _begin, uint16_t _region)
+		{
+			return 0
+				| (uint64_t(_item)   << 32)
+				| (uint64_t(_begin)  << 16)
+				|  uint64_t(_region)
+				;
+		}
+
+		static uint32_t getItem(uint64_t _event)
+		{
+			return uint32_t(_event >> 32);
+		}
+
+		static bool isBegin(uint64_t _event)
+		{
+			return 0 != (_event & (UINT64_C(1) << 16) );
+		}
+
+		static uint16_t getRegion(uint64_t _event)
+		{
+			return uint16_t(_event);
+		}
+	};
+
 	struct ScreenShot
 	{
 		bx::FilePath filePath;
@@ -2979,15 +3141,23 @@ namespace bgfx
 			, m_waitSubmit(0)
 			, m_waitRender(0)
 			, m_frameNum(0)
+			, m_frameReplay(NULL)
 			, m_capture(false)
 			, m_flush(false)
 			, m_needBindDedup(false)
+			, m_frameCapture(false)
+			, m_frameReplayChanged(false)
+			, m_replay(false)
 		{
 			m_numRenderItems = 0;
 			m_numRenderBinds = 0;
+			m_numGpuRegions       = 0;
+			m_numGpuRegionEvents  = 0;
+			m_numGpuRegionSlots   = 0;
 			bx::memSet(m_occlusion, 0xff, sizeof(m_occlusion) );
 
-			m_perfStats.viewStats = m_viewStats;
+			m_perfStats.viewStats      = m_viewStats;
+			m_perfStats.gpuRegionStats = m_gpuRegionStats;
 		}
 
 		~Frame()
@@ -3155,24 +3325,44 @@ namespace bgfx
 			m_numRenderItems = 0;
 			m_numRenderBinds = 0;
 			m_numBlitItems   = 0;
+			m_numGpuRegions      = 0;
+			m_numGpuRegionEvents = 0;
+			m_numGpuRegionSlots  = 0;
 			m_iboffset = 0;
 			m_vboffset = 0;
 			m_cmdPre.start();
 			m_cmdPost.start();
+
+			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_RESOURCE_THREADS; ++ii)
+			{
+				m_cmdThread[ii].start();
+			}
+
 			m_capture = false;
 			m_flush   = false;
 			m_numScreenShots = 0;
 			m_frameNum = frameNum;
+
+			m_frameReplay        = NULL;
+			m_frameCapture       = false;
+			m_frameReplayChanged = false;
 		}
 
 		void finish()
 		{
 			m_cmdPre.finish();
 			m_cmdPost.finish();
+
+			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_RESOURCE_THREADS; ++ii)
+			{
+				m_cmdThread[ii].finish();
+			}
 		}
 
 		void sort();
 		void dedupBind();
+		void mergeInstances();
+		void sortGpuRegions();
 
 		uint32_t getAvailTransientIndexBuffer(uint32_t _num, uint16_t _indexSize)
 		{
@@ -3185,12 +3375,8 @@ namespace bgfx
 
 		uint32_t allocTransientIndexBuffer(uint32_t& _num, uint16_t _indexSize)
 		{
-			uint32_t offset = bx::strideAlign(m_iboffset, _indexSize);
-			uint32_t num    = getAvailTransientIndexBuffer(_num, _indexSize);
-			m_iboffset = offset + num*_indexSize;
-			_num = num;
-
-			return offset;
+			uint32_t numRetries;
+			return allocTransient(&m_iboffset, g_caps.limits.maxTransientIbSize, _num, _indexSize, numRetries);
 		}
 
 		uint32_t getAvailTransientVertexBuffer(uint32_t _num, uint16_t _stride)
@@ -3204,12 +3390,32 @@ namespace bgfx
 
 		uint32_t allocTransientVertexBuffer(uint32_t& _num, uint16_t _stride)
 		{
-			uint32_t offset = bx::strideAlign(m_vboffset, _stride);
-			uint32_t num    = getAvailTransientVertexBuffer(_num, _stride);
-			m_vboffset = offset + num * _stride;
-			_num = num;
+			uint32_t numRetries;
+			return allocTransient(&m_vboffset, g_caps.limits.maxTransientVbSize, _num, _stride, numRetries);
+		}
 
-			return offset;
+		// Transient offsets are bumped by API thread under resource API lock,
+		// and by encoders reserving slabs without it, so they are updated
+		// with CAS.
+		static uint32_t allocTransient(uint32_t* _offset, uint32_t _max, uint32_t& _num, uint16_t _stride, uint32_t& _numRetries)
+		{
+			_numRetries = 0;
+
+			for (;;)
+			{
+				const uint32_t current = *(volatile uint32_t*)_offset;
+				const uint32_t offset  = bx::min(bx::strideAlign(current, _stride), _max);
+				const uint32_t end     = bx::min<uint32_t>(offset + _num*_stride, _max);
+				const uint32_t num     = (end - offset)/_stride;
+
+				if (current == bx::atomicCompareAndSwap<uint32_t>(_offset, current, offset + num*_stride) )
+				{
+					_num = num;
+					return offset;
+				}
+
+				++_numRetries;
+			}
 		}
 
 		bool free(IndexBufferHandle _handle)
@@ -3297,6 +3503,12 @@ namespace bgfx
 		uint32_t m_numRenderBinds;
 		uint32_t m_numBlitItems;
 
+		GpuRegion m_gpuRegion[BGFX_CONFIG_MAX_GPU_REGIONS];
+		uint64_t  m_gpuRegionEvent[BGFX_CONFIG_MAX_GPU_REGIONS*2];
+		uint32_t  m_numGpuRegions;
+		uint32_t  m_numGpuRegionEvents;
+		uint16_t  m_numGpuRegionSlots;
+
 		uint32_t m_iboffset;
 		uint32_t m_vboffset;
 		TransientIndexBuffer* m_transientIb;
@@ -3310,6 +3522,7 @@ namespace bgfx
 
 		CommandBuffer m_cmdPre;
 		CommandBuffer m_cmdPost;
+		CommandBuffer m_cmdThread[BGFX_CONFIG_MAX_RESOURCE_THREADS]; // Executed after m_cmdPre, in slot order.
 
 		template<typename Ty, uint32_t Max>
 		struct FreeHandle
@@ -3380,15 +3593,86 @@ namespace bgfx
 
 		Stats     m_perfStats;
 		ViewStats m_viewStats[BGFX_CONFIG_MAX_VIEWS];
+		GpuRegionStats m_gpuRegionStats[BGFX_CONFIG_MAX_GPU_REGIONS];
 
 		int64_t m_waitSubmit;
 		int64_t m_waitRender;
 
 		uint32_t m_frameNum;
 
+		bx::FilePath m_frameCaptureFilePath;
+		FrameReplay* m_frameReplay;
+
 		bool m_capture;
 		bool m_flush;
 		bool m_needBindDedup;
+		bool m_frameCapture;
+		bool m_frameReplayChanged;
+		bool m_replay; //!< Captured frame, already sorted.
+	};
+
+	struct DrawList
+	{
+		template<typename Ty>
+		struct ArrayT
+		{
+			ArrayT()
+				: m_data(NULL)
+				, m_num(0)
+				, m_max(0)
+			{
+			}
+
+			~ArrayT()
+			{
+				bx::free(g_allocator, m_data, BX_ALIGNOF(Ty) );
+			}
+
+			Ty* add(uint32_t _num = 1)
+			{
+				if (m_num + _num > m_max)
+				{
+					m_max  = bx::max(m_num + _num, m_max*2);
+					m_data = (Ty*)bx::realloc(g_allocator, m_data, sizeof(Ty)*m_max, BX_ALIGNOF(Ty) );
+				}
+
+				Ty* result = &m_data[m_num];
+				m_num += _num;
+				return result;
+			}
+
+			Ty& operator[](uint32_t _idx) const
+			{
+				BX_ASSERT(_idx < m_num, "Out of bounds %d (num: %d).", _idx, m_num);
+				return m_data[_idx];
+			}
+
+			Ty*      m_data;
+			uint32_t m_num;
+			uint32_t m_max;
+		};
+
+		// Matrix, scissor, bind and uniform references in recorded draw are
+		// relative to draw list storage, and they are rebased on replay.
+		struct Item
+		{
+			RenderDraw m_draw;
+			SortKey    m_key;
+		};
+
+		ArrayT<Item>       m_item;
+		ArrayT<RenderBind> m_bind;
+		ArrayT<Matrix4>    m_matrix;
+		ArrayT<Rect>       m_rect;
+		ArrayT<char>       m_uniform;
+
+		// Resources referenced by recorded draws. Draw list holds one reference
+		// to each of them, and releases it when draw list is destroyed.
+		ArrayT<ProgramHandle>      m_programRef;
+		ArrayT<TextureHandle>      m_textureRef;
+		ArrayT<UniformHandle>      m_uniformRef;
+		ArrayT<IndexBufferHandle>  m_indexBufferRef;
+		ArrayT<VertexBufferHandle> m_vertexBufferRef;
 	};
 
 	BX_ALIGN_DECL_CACHE_LINE(struct) EncoderImpl
@@ -3403,7 +3687,8 @@ namespace bgfx
 			bx::memSet(&m_bind, 0, sizeof(m_bind) );
 
 			m_key.reset();
-			m_discard = false;
+			m_discard  = false;
+			m_drawList = NULL;
 			m_draw.clear(BGFX_DISCARD_ALL);
 			m_compute.clear(BGFX_DISCARD_ALL);
 			m_bind.clear(BGFX_DISCARD_ALL);
@@ -3425,10 +3710,27 @@ namespace bgfx
 			m_numSubmitted = 0;
 			m_numDropped   = 0;
 
+			m_gpuRegion      = kInvalidGpuRegion;
+			m_gpuRegionDepth = 0;
+
+			m_tvbSlab.reset();
+			m_tibSlab.reset();
+			m_transientReserveTime  = 0;
+			m_numTransientAllocs    = 0;
+			m_numTransientSlabs     = 0;
+			m_numTransientContended = 0;
+
 			m_bindHashMap.clear();
 			m_bindLlastIdx  = 0;
 			m_bindEmptyIdx = UINT32_MAX;
 			m_bindDirty    = true;
+
+			BX_WARN(NULL == m_drawList, "Draw list recording must end within the same frame. Recorded draw list is discarded.");
+			if (NULL != m_drawList)
+			{
+				bx::deleteObject(g_allocator, m_drawList);
+				m_drawList = NULL;
+			}
 		}
 
 		void end(bool _finalize)
@@ -3441,6 +3743,11 @@ namespace bgfx
 				m_cpuTimeEnd = bx::getHPCounter();
 			}
 
+			BX_WARN(0 == m_gpuRegionDepth
+				, "profilerBeginGpu without matching profilerEndGpu (depth %d)."
+				, m_gpuRegionDepth
+				);
+
 			if (BX_ENABLED(BGFX_CONFIG_DEBUG_OCCLUSION) )
 			{
 				m_occlusionQuerySet.clear();
@@ -3452,16 +3759,16 @@ namespace bgfx
 			}
 		}
 
-		uint32_t bindStateIndex()
+		uint32_t bindStateIndex(const RenderBind& _bind)
 		{
-			const uint32_t hash = bx::hash<bx::HashMurmur3>(m_bind.m_bind, sizeof(m_bind.m_bind) );
+			const uint32_t hash = bx::hash<bx::HashMurmur3>(_bind.m_bind, sizeof(_bind.m_bind) );
 
 			BindHashMap::const_iterator it = m_bindHashMap.find(hash);
 			if (it != m_bindHashMap.end() )
 			{
 				const uint32_t idx = it->second;
 
-				BX_ASSERT(0 == bx::memCmp(&m_frame->m_renderBind[idx], &m_bind, sizeof(m_bind) )
+				BX_ASSERT(0 == bx::memCmp(&m_frame->m_renderBind[idx], &_bind, sizeof(_bind) )
 					, "RenderBind hash collision (hash 0x%08x)."
 					, hash
 					);
@@ -3470,7 +3777,7 @@ namespace bgfx
 			}
 
 			const uint32_t idx = bx::atomicFetchAndAddsat<uint32_t>(&m_frame->m_numRenderBinds, 1, m_frame->m_maxDrawCalls);
-			m_frame->m_renderBind[idx] = m_bind;
+			m_frame->m_renderBind[idx] = _bind;
 			m_bindHashMap.insert(stl::make_pair(hash, idx) );
 
 			return idx;
@@ -3480,7 +3787,7 @@ namespace bgfx
 		{
 			if (m_bindDirty)
 			{
-				m_bindLlastIdx = bindStateIndex();
+				m_bindLlastIdx = bindStateIndex(m_bind);
 				m_bindDirty    = false;
 			}
 			else
@@ -3494,6 +3801,22 @@ namespace bgfx
 			return m_bindLlastIdx;
 		}
 
+		uint32_t getNumVertices() const
+		{
+			if (UINT32_MAX != m_draw.m_streamMask)
+			{
+				uint32_t numVertices = UINT32_MAX;
+				for (BitMaskToIndexIteratorT it(m_draw.m_streamMask); !it.isDone(); it.next() )
+				{
+					numVertices = bx::min(numVertices, m_numVertices[it.idx]);
+				}
+
+				return numVertices;
+			}
+
+			return m_numVertices[0];
+		}
+
 		void clearBind(uint8_t _flags)
 		{
 			m_bind.clear(_flags);
@@ -3502,7 +3825,7 @@ namespace bgfx
 			{
 				if (UINT32_MAX == m_bindEmptyIdx)
 				{
-					m_bindEmptyIdx = bindStateIndex();
+					m_bindEmptyIdx = bindStateIndex(m_bind);
 				}
 
 				m_bindLlastIdx = m_bindEmptyIdx;
@@ -3517,6 +3840,50 @@ namespace bgfx
 			uniformBuffer->writeMarker(_name);
 		}
 
+		void profilerBeginGpu(const bx::StringView& _name)
+		{
+			if (BGFX_CONFIG_MAX_GPU_REGION_DEPTH == m_gpuRegionDepth)
+			{
+				BX_TRACE("GPU region nesting is too deep (max: %d).", BGFX_CONFIG_MAX_GPU_REGION_DEPTH);
+				++m_gpuRegionDepth;
+				return;
+			}
+
+			m_gpuRegionStack[m_gpuRegionDepth++] = m_gpuRegion;
+
+			const uint32_t idx = bx::atomicFetchAndAddsat<uint32_t>(&m_frame->m_numGpuRegions, 1, BGFX_CONFIG_MAX_GPU_REGIONS);
+
+			BX_WARN(idx < BGFX_CONFIG_MAX_GPU_REGIONS
+				, "Exceeded number of GPU regions per frame. BGFX_CONFIG_MAX_GPU_REGIONS is %d."
+				, BGFX_CONFIG_MAX_GPU_REGIONS
+				);
+
+			// Items of dropped region are attributed to its parent.
+			if (idx < BGFX_CONFIG_MAX_GPU_REGIONS)
+			{
+				GpuRegion& region = m_frame->m_gpuRegion[idx];
+				bx::strCopy(region.m_name, BX_COUNTOF(region.m_name), _name);
+				region.m_parent = m_gpuRegion;
+
+				m_gpuRegion = uint16_t(idx);
+			}
+		}
+
+		void profilerEndGpu()
+		{
+			BX_ASSERT(0 != m_gpuRegionDepth, "profilerEndGpu without matching profilerBeginGpu.");
+
+			if (0 != m_gpuRegionDepth)
+			{
+				--m_gpuRegionDepth;
+
+				if (m_gpuRegionDepth < BGFX_CONFIG_MAX_GPU_REGION_DEPTH)
+				{
+					m_gpuRegion = m_gpuRegionStack[m_gpuRegionDepth];
+				}
+			}
+		}
+
 		void setUniform(UniformType::Enum _type, UniformHandle _handle, const void* _value, uint16_t _num)
 		{
 			if (BX_ENABLED(BGFX_CONFIG_DEBUG_UNIFORM) )
@@ -3569,10 +3936,11 @@ namespace bgfx
 			m_draw.m_rgba       = _rgba;
 		}
 
-		void setCondition(OcclusionQueryHandle _handle, bool _visible)
+		void setCondition(OcclusionQueryHandle _handle, bool _visible, bool _current)
 		{
 			m_draw.m_occlusionQuery = _handle;
 			m_draw.m_submitFlags   |= _visible ? BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE : 0;
+			m_draw.m_submitFlags   |= _current ? BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT : 0;
 		}
 
 		void setStencil(uint32_t _fstencil, uint32_t _bstencil)
@@ -3592,6 +3960,12 @@ namespace bgfx
 			m_draw.m_scissor = _cache;
 		}
 
+		void setPersistentTransform(uint32_t _index, VertexBufferHandle _handle)
+		{
+			m_draw.m_transformIndex = _index;
+			setBuffer(BGFX_CONFIG_TRANSFORM_BUFFER_STAGE, _handle, Access::Read);
+		}
+
 		uint32_t setTransform(const void* _mtx, uint16_t _num)
 		{
 			m_draw.m_startMatrix = m_frame->m_frameCache.m_matrixCache.add(_mtx, &_num);
@@ -3610,6 +3984,101 @@ namespace bgfx
 			return first;
 		}
 
+		struct TransientSlab
+		{
+			void reset()
+			{
+				m_offset = 0;
+				m_end    = 0;
+			}
+
+			uint32_t m_offset;
+			uint32_t m_end;
+		};
+
+		uint32_t allocTransient(TransientSlab& _slab, uint32_t* _frameOffset, uint32_t _max, uint32_t& _num, uint16_t _stride)
+		{
+			++m_numTransientAllocs;
+
+			const uint32_t size = _num*_stride;
+			uint32_t offset = bx::strideAlign(_slab.m_offset, _stride);
+
+			if (offset + size > _slab.m_end)
+			{
+				const int64_t start = bx::getHPCounter();
+
+				uint32_t numRetries;
+				uint32_t num = bx::alignUp(bx::max<uint32_t>(BGFX_CONFIG_TRANSIENT_SLAB_SIZE, size + _stride), 16) / 16;
+				const uint32_t slab = Frame::allocTransient(_frameOffset, _max, num, 16, numRetries);
+
+				m_transientReserveTime  += bx::getHPCounter() - start;
+				m_numTransientContended += numRetries;
+				++m_numTransientSlabs;
+
+				if (0 < num)
+				{
+					if (slab != _slab.m_end)
+					{
+						_slab.m_offset = slab;
+					}
+
+					_slab.m_end = slab + num*16;
+					offset = bx::strideAlign(_slab.m_offset, _stride);
+				}
+			}
+
+			offset = bx::min(offset, _slab.m_end);
+			const uint32_t num = (bx::min(offset + size, _slab.m_end) - offset)/_stride;
+			_slab.m_offset = offset + num*_stride;
+			_num = num;
+
+			return offset;
+		}
+
+		void allocTransientIndexBuffer(TransientIndexBuffer* _tib, uint32_t _num, bool _index32)
+		{
+			const bool isIndex16     = !_index32;
+			const uint16_t indexSize = isIndex16 ? 2 : 4;
+			const uint32_t offset    = allocTransient(m_tibSlab, &m_frame->m_iboffset, g_caps.limits.maxTransientIbSize, _num, indexSize);
+
+			const TransientIndexBuffer& tib = *m_frame->m_transientIb;
+
+			_tib->data       = &tib.data[offset];
+			_tib->size       = _num * indexSize;
+			_tib->handle     = tib.handle;
+			_tib->startIndex = offset / indexSize;
+			_tib->isIndex16  = isIndex16;
+		}
+
+		void allocTransientVertexBuffer(TransientVertexBuffer* _tvb, uint32_t _num, VertexLayoutHandle _layoutHandle, uint16_t _stride)
+		{
+			const uint32_t offset = allocTransient(m_tvbSlab, &m_frame->m_vboffset, g_caps.limits.maxTransientVbSize, _num, _stride);
+
+			const TransientVertexBuffer& tvb = *m_frame->m_transientVb;
+
+			_tvb->data         = &tvb.data[offset];
+			_tvb->size         = _num * _stride;
+			_tvb->startVertex  = offset / _stride;
+			_tvb->stride       = _stride;
+			_tvb->handle       = tvb.handle;
+			_tvb->layoutHandle = _layoutHandle;
+		}
+
+		void allocInstanceDataBuffer(InstanceDataBuffer* _idb, uint32_t _num, uint16_t _stride)
+		{
+			const uint16_t stride = bx::alignUp(_stride, 16);
+			const uint32_t offset = allocTransient(m_tvbSlab, &m_frame->m_vboffset, g_caps.limits.maxTransientVbSize, _num, stride);
+
+			const TransientVertexBuffer& tvb = *m_frame->m_transientVb;
+
+			_idb->data   = &tvb.data[offset];
+			_idb->size   = _num * stride;
+			_idb->offset = offset;
+			_idb->num    = _num;
+			_idb->stride = stride;
+			_idb->handle = tvb.handle;
+		}
+
 		void setTransform(uint32_t _cache, uint16_t _num)
 		{
 			const MatrixCache& matrixCache = m_frame->m_frameCache.m_matrixCache;
@@ -3870,6 +4339,37 @@ namespace bgfx
 
 		void blit(ViewId _id, TextureHandle _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, TextureHandle _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth);
 
+		void beginDrawList()
+		{
+			BX_ASSERT(NULL == m_drawList, "Draw list recording already started.");
+			if (NULL == m_drawList)
+			{
+				m_drawList = BX_NEW(g_allocator, DrawList);
+				m_drawListUniformBase = m_uniformBegin;
+				m_drawListUniformPos  = m_uniformBegin;
+			}
+		}
+
+		DrawList* endDrawList()
+		{
+			BX_ASSERT(NULL != m_drawList, "Draw list recording is not started.");
+			DrawList* drawList = m_drawList;
+			m_drawList = NULL;
+
+			if (NULL != drawList
+			&&  0 == drawList->m_item.m_num)
+			{
+				bx::deleteObject(g_allocator, drawList);
+				drawList = NULL;
+			}
+
+			return drawList;
+		}
+
+		void record(ProgramHandle _program, OcclusionQueryHandle _occlusionQuery, uint32_t _depth);
+
+		void submit(ViewId _id, const DrawList& _drawList, const float* _mtx);
+
 		Frame* m_frame;
 
 		SortKey m_key;
@@ -3881,12 +4381,27 @@ namespace bgfx
 		uint32_t m_numSubmitted;
 		uint32_t m_numDropped;
 
+		uint16_t m_gpuRegion;
+		uint16_t m_gpuRegionStack[BGFX_CONFIG_MAX_GPU_REGION_DEPTH];
+		uint32_t m_gpuRegionDepth;
+
+		TransientSlab m_tvbSlab;
+		TransientSlab m_tibSlab;
+		int64_t  m_transientReserveTime;
+		uint32_t m_numTransientAllocs;
+		uint32_t m_numTransientSlabs;
+		uint32_t m_numTransientContended;
+
 		uint32_t m_uniformBegin;
 		uint32_t m_uniformEnd;
 		uint32_t m_numVertices[BGFX_CONFIG_MAX_VERTEX_STREAMS];
 		uint8_t  m_uniformIdx;
 		bool     m_discard;
 
+		DrawList* m_drawList;
+		uint32_t  m_drawListUniformBase;
+		uint32_t  m_drawListUniformPos;
+
 		typedef stl::unordered_set<uint16_t> HandleSet;
 		HandleSet m_uniformSet;
 		HandleSet m_occlusionQuerySet;
@@ -4000,12 +4515,13 @@ namespace bgfx
 		VertexLayoutHandle m_dynamicVertexBufferRef[BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS];
 	};
 
-	// First-fit non-local allocator.
+	// Two-level segregated fit (TLSF) non-local allocator.
 	//
-	// The free list is kept sorted by address at all times, which:
-	//  - Enables O(1) adjacent-block coalescing on free.
-	//  - Provides cache-friendly iteration (contiguous vector storage).
-	//  - Uses binary search for sorted insertion, replacing the O(n) push_front.
+	// Free blocks are binned by size class, first level is power of two,
+	// second level splits each power of two range into kSlCount linear
+	// classes. Non-empty classes are tracked in bitmaps, so finding a fit
+	// is a couple of bit scans, and alloc/free are O(1). Blocks keep links
+	// to their address-order neighbours within slab for coalescing on free.
 	//
 	class NonLocalAllocator
 	{
@@ -4016,6 +4532,7 @@ namespace bgfx
 			: m_totalUsed(0)
 			, m_totalAvailable(0)
 		{
+			reset();
 		}
 
 		~NonLocalAllocator()
@@ -4024,31 +4541,72 @@ namespace bgfx
 
 		void reset()
 		{
-			m_free.clear();
+			m_block.clear();
+			m_unusedBlock.clear();
+			m_orphan.clear();
 			m_used.clear();
-			m_slab.clear();
 			m_totalUsed = 0;
+			m_numFree   = 0;
+
+			m_flBitmap = 0;
+			bx::memSet(m_slBitmap, 0, sizeof(m_slBitmap) );
+			bx::memSet(m_head, 0xff, sizeof(m_head) );
 		}
 
 		void add(uint64_t _ptr, uint32_t _size)
 		{
-			m_slab.insert(stl::make_pair(_ptr, _size) );
-			insertFreeBlock(_ptr, _size);
+			const uint32_t idx = allocBlock();
+			Block& block = m_block[idx];
+			block.m_ptr      = _ptr;
+			block.m_size     = _size;
+			block.m_prevPhys = kInvalidIndex;
+			block.m_nextPhys = kInvalidIndex;
+
+			insertFreeBlock(idx);
+			queueOrphan(idx);
+			m_totalAvailable += _size;
+		}
+
+		/// Adds region that is used whole by single allocation, and returns its
+		/// block. Region can be reclaimed with removeOrphaned() once freed.
+		uint64_t addUsed(uint64_t _ptr, uint32_t _size)
+		{
+			const uint32_t idx = allocBlock();
+			Block& block = m_block[idx];
+			block.m_ptr      = _ptr;
+			block.m_size     = _size;
+			block.m_prevPhys = kInvalidIndex;
+			block.m_nextPhys = kInvalidIndex;
+
+			m_used.insert(stl::make_pair(_ptr, idx) );
+			m_totalUsed      += _size;
 			m_totalAvailable += _size;
+
+			return _ptr;
 		}
 
 		uint64_t remove()
 		{
 			BX_ASSERT(0 == m_used.size(), "");
 
-			if (0 < m_free.size() )
+			if (0 != m_flBitmap)
 			{
-				Free freeBlock = m_free.front();
-				m_free.erase(m_free.begin() );
-				m_slab.erase(m_slab.find(freeBlock.m_ptr));
-				m_totalAvailable -= freeBlock.m_size;
-				return freeBlock.m_ptr;
-			}
+				const uint32_t fl  = bx::countTrailingZeros<uint32_t>(m_flBitmap);
+				const uint32_t sl  = bx::countTrailingZeros<uint32_t>(m_slBitmap[fl]);
+				const uint32_t idx = m_head[fl][sl];
+				const Block& block = m_block[idx];
+
+				BX_ASSERT(kInvalidIndex == block.m_prevPhys
+					&& kInvalidIndex == block.m_nextPhys
+					, "All blocks are free, they must be coalesced into slabs."
+					);
+
+				const uint64_t ptr = block.m_ptr;
+				m_totalAvailable -= block.m_size;
+				removeFreeBlock(idx);
+				freeBlock(idx);
+				return ptr;
+			}
 
 			return 0;
 		}
@@ -4058,17 +4616,23 @@ namespace bgfx
 		/// GPU buffers whose sub-allocations have all been released.
 		uint64_t removeOrphaned()
 		{
-			for (FreeList::iterator it = m_free.begin(), itEnd = m_free.end(); it != itEnd; ++it)
+			while (!m_orphan.empty() )
 			{
-				SlabList::iterator slabIt = m_slab.find(it->m_ptr);
-				if (slabIt != m_slab.end()
-				&&  slabIt->second == it->m_size)
-				{
-					m_totalAvailable -= it->m_size;
+				const uint32_t idx = m_orphan.back();
+				m_orphan.pop_back();
+
+				// Slab might have been allocated from since it was queued.
+				Block& block = m_block[idx];
+				block.m_orphan = false;
 
-					uint64_t ptr = it->m_ptr;
-					m_free.erase(it);
-					m_slab.erase(slabIt);
+				if (block.m_free
+				&&  kInvalidIndex == block.m_prevPhys
+				&&  kInvalidIndex == block.m_nextPhys)
+				{
+					const uint64_t ptr = block.m_ptr;
+					m_totalAvailable -= block.m_size;
+					removeFreeBlock(idx);
+					freeBlock(idx);
 					return ptr;
 				}
 			}
@@ -4080,31 +4644,42 @@ namespace bgfx
 		{
 			_size = bx::max(_size, 16u);
 
-			for (FreeList::iterator it = m_free.begin(), itEnd = m_free.end(); it != itEnd; ++it)
+			const uint32_t idx = findFit(_size);
+			if (kInvalidIndex == idx)
 			{
-				if (it->m_size >= _size)
-				{
-					uint64_t ptr = it->m_ptr;
+				// there is no block large enough.
+				return kInvalidBlock;
+			}
 
-					m_used.insert(stl::make_pair(ptr, _size) );
-					m_totalUsed += _size;
+			removeFreeBlock(idx);
 
-					if (it->m_size != _size)
-					{
-						it->m_size -= _size;
-						it->m_ptr  += _size;
-					}
-					else
-					{
-						m_free.erase(it);
-					}
+			if (m_block[idx].m_size != _size)
+			{
+				// Split, remainder goes back to free list.
+				const uint32_t rest = allocBlock();
+				Block& block     = m_block[idx];
+				Block& restBlock = m_block[rest];
+				restBlock.m_ptr      = block.m_ptr  + _size;
+				restBlock.m_size     = block.m_size - _size;
+				restBlock.m_prevPhys = idx;
+				restBlock.m_nextPhys = block.m_nextPhys;
 
-					return ptr;
+				if (kInvalidIndex != block.m_nextPhys)
+				{
+					m_block[block.m_nextPhys].m_prevPhys = rest;
 				}
+
+				block.m_size     = _size;
+				block.m_nextPhys = rest;
+
+				insertFreeBlock(rest);
 			}
 
-			// there is no block large enough.
-			return kInvalidBlock;
+			const uint64_t ptr = m_block[idx].m_ptr;
+			m_used.insert(stl::make_pair(ptr, idx) );
+			m_totalUsed += _size;
+
+			return ptr;
 		}
 
 		void free(uint64_t _block)
@@ -4112,14 +4687,35 @@ namespace bgfx
 			UsedList::iterator it = m_used.find(_block);
 			if (it != m_used.end() )
 			{
-				const uint64_t ptr  = it->first;
-				const uint32_t size = it->second;
-
-				m_totalUsed -= size;
+				uint32_t idx = it->second;
 				m_used.erase(it);
+				m_totalUsed -= m_block[idx].m_size;
+
+				// Coalesce with free neighbours.
+				const uint32_t next = m_block[idx].m_nextPhys;
+				if (kInvalidIndex != next
+				&&  m_block[next].m_free)
+				{
+					removeFreeBlock(next);
+					merge(idx, next);
+				}
+
+				const uint32_t prev = m_block[idx].m_prevPhys;
+				if (kInvalidIndex != prev
+				&&  m_block[prev].m_free)
+				{
+					removeFreeBlock(prev);
+					merge(prev, idx);
+					idx = prev;
+				}
 
-				// Insert into sorted free list and coalesce with adjacent blocks.
-				insertFreeBlock(ptr, size);
+				insertFreeBlock(idx);
+
+				if (kInvalidIndex == m_block[idx].m_prevPhys
+				&&  kInvalidIndex == m_block[idx].m_nextPhys)
+				{
+					queueOrphan(idx);
+				}
 			}
 		}
 
@@ -4133,87 +4729,295 @@ namespace bgfx
 			return m_totalAvailable;
 		}
 
-	private:
-		struct Free
+		/// Number of free blocks, together with largest free block it
+		/// describes how fragmented available space is.
+		uint32_t getNumFreeBlocks() const
 		{
-			Free(uint64_t _ptr, uint32_t _size)
-				: m_ptr(_ptr)
-				, m_size(_size)
-			{
-			}
+			return m_numFree;
+		}
 
-			bool operator<(const Free& rhs) const
+		uint32_t getLargestFreeBlock() const
+		{
+			if (0 == m_flBitmap)
 			{
-				return m_ptr < rhs.m_ptr;
+				return 0;
 			}
 
-			bool operator>(const Free& rhs) const
+			const uint32_t fl = 31 - bx::countLeadingZeros<uint32_t>(m_flBitmap);
+			const uint32_t sl = 31 - bx::countLeadingZeros<uint32_t>(m_slBitmap[fl]);
+
+			uint32_t largest = 0;
+			for (uint32_t idx = m_head[fl][sl]; kInvalidIndex != idx; idx = m_block[idx].m_nextFree)
 			{
-				return m_ptr > rhs.m_ptr;
+				largest = bx::max(largest, m_block[idx].m_size);
 			}
 
+			return largest;
+		}
+
+	private:
+		static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+		static constexpr uint32_t kSlBits       = 4;
+		static constexpr uint32_t kSlCount      = 1<<kSlBits;
+		static constexpr uint32_t kFlCount      = 32;
+
+		struct Block
+		{
 			uint64_t m_ptr;
 			uint32_t m_size;
+			uint32_t m_prevPhys;
+			uint32_t m_nextPhys;
+			uint32_t m_prevFree;
+			uint32_t m_nextFree;
+			bool     m_free;
+			bool     m_orphan;
 		};
 
-		// Insert a free block at its sorted position and coalesce with
-		// adjacent neighbors. Uses bx::upperBound to find the insertion
-		// point in O(log n), then checks the immediate neighbors for
-		// merge opportunities.
-		void insertFreeBlock(uint64_t _ptr, uint32_t _size)
-		{
-			// Use bx::upperBound to find the insertion point (first element with m_ptr > _ptr).
-			const Free key(_ptr, 0);
-			const uint32_t idx = 0 < m_free.size()
-				? bx::upperBound(key, m_free.data(), uint32_t(m_free.size() ) )
-				: 0
-				;
+		static void mapping(uint32_t _size, uint32_t& _fl, uint32_t& _sl)
+		{
+			if (_size < kSlCount)
+			{
+				_fl = 0;
+				_sl = _size;
+			}
+			else
+			{
+				_fl = 31 - bx::countLeadingZeros<uint32_t>(_size);
+				_sl = (_size >> (_fl - kSlBits) ) ^ kSlCount;
+			}
+		}
 
-			// Check if we can merge with the previous block.
-			const bool mergePrev = idx > 0
-				&& (m_free[idx - 1].m_ptr + m_free[idx - 1].m_size) == _ptr
-				;
+		uint32_t findFit(uint32_t _size) const
+		{
+			// Round up to the next size class, so that any block in it fits.
+			uint64_t size = _size;
+			if (size >= kSlCount)
+			{
+				const uint32_t fl = 31 - bx::countLeadingZeros<uint32_t>(_size);
+				size += (UINT64_C(1) << (fl - kSlBits) ) - 1;
+			}
 
-			// Check if we can merge with the next block.
-			const bool mergeNext = idx < uint32_t(m_free.size() )
-				&& (_ptr + _size) == m_free[idx].m_ptr
-				;
+			uint32_t fl = kFlCount, sl = 0;
+			uint32_t slMap = 0;
+
+			if (size <= UINT32_MAX)
+			{
+				mapping(uint32_t(size), fl, sl);
+
+				slMap = m_slBitmap[fl] & (UINT32_MAX << sl);
+				if (0 == slMap)
+				{
+					const uint32_t flMap = fl + 1 < kFlCount
+						? m_flBitmap & (UINT32_MAX << (fl + 1) )
+						: 0
+						;
+
+					if (0 != flMap)
+					{
+						fl    = bx::countTrailingZeros<uint32_t>(flMap);
+						slMap = m_slBitmap[fl];
+					}
+				}
+			}
 
-			if (mergePrev && mergeNext)
+			if (0 != slMap)
 			{
-				// Merge all three: extend previous to cover current + next.
-				m_free[idx - 1].m_size += _size + m_free[idx].m_size;
-				m_free.erase(m_free.begin() + idx);
+				sl = bx::countTrailingZeros<uint32_t>(slMap);
+				return m_head[fl][sl];
 			}
-			else if (mergePrev)
+
+			// Nothing in larger classes, block that fits might still be in
+			// the requested size class.
+			mapping(_size, fl, sl);
+
+			for (uint32_t idx = m_head[fl][sl]; kInvalidIndex != idx; idx = m_block[idx].m_nextFree)
+			{
+				if (m_block[idx].m_size >= _size)
+				{
+					return idx;
+				}
+			}
+
+			return kInvalidIndex;
+		}
+
+		// Slab head block keeps its index for slab lifetime, since blocks
+		// are only ever merged into their previous neighbour. Flag keeps
+		// the slab queued at most once.
+		void queueOrphan(uint32_t _idx)
+		{
+			if (!m_block[_idx].m_orphan)
+			{
+				m_block[_idx].m_orphan = true;
+				m_orphan.push_back(_idx);
+			}
+		}
+
+		void insertFreeBlock(uint32_t _idx)
+		{
+			Block& block = m_block[_idx];
+
+			uint32_t fl, sl;
+			mapping(block.m_size, fl, sl);
+
+			block.m_free     = true;
+			block.m_prevFree = kInvalidIndex;
+			block.m_nextFree = m_head[fl][sl];
+
+			if (kInvalidIndex != block.m_nextFree)
+			{
+				m_block[block.m_nextFree].m_prevFree = _idx;
+			}
+
+			m_head[fl][sl] = _idx;
+			m_flBitmap    |= 1u << fl;
+			m_slBitmap[fl]|= 1u << sl;
+			++m_numFree;
+		}
+
+		void removeFreeBlock(uint32_t _idx)
+		{
+			Block& block = m_block[_idx];
+
+			uint32_t fl, sl;
+			mapping(block.m_size, fl, sl);
+
+			if (kInvalidIndex != block.m_prevFree)
+			{
+				m_block[block.m_prevFree].m_nextFree = block.m_nextFree;
+			}
+			else
+			{
+				m_head[fl][sl] = block.m_nextFree;
+
+				if (kInvalidIndex == block.m_nextFree)
+				{
+					m_slBitmap[fl] &= ~(1u << sl);
+
+					if (0 == m_slBitmap[fl])
+					{
+						m_flBitmap &= ~(1u << fl);
+					}
+				}
+			}
+
+			if (kInvalidIndex != block.m_nextFree)
+			{
+				m_block[block.m_nextFree].m_prevFree = block.m_prevFree;
+			}
+
+			block.m_free = false;
+			--m_numFree;
+		}
+
+		// Merge _next into _idx, both must be out of free list.
+		void merge(uint32_t _idx, uint32_t _next)
+		{
+			Block& block     = m_block[_idx];
+			Block& nextBlock = m_block[_next];
+
+			block.m_size    += nextBlock.m_size;
+			block.m_nextPhys = nextBlock.m_nextPhys;
+
+			if (kInvalidIndex != nextBlock.m_nextPhys)
 			{
-				// Extend previous block.
-				m_free[idx - 1].m_size += _size;
+				m_block[nextBlock.m_nextPhys].m_prevPhys = _idx;
 			}
-			else if (mergeNext)
+
+			freeBlock(_next);
+		}
+
+		uint32_t allocBlock()
+		{
+			uint32_t idx;
+
+			if (!m_unusedBlock.empty() )
 			{
-				// Extend next block backward.
-				m_free[idx].m_ptr   = _ptr;
-				m_free[idx].m_size += _size;
+				idx = m_unusedBlock.back();
+				m_unusedBlock.pop_back();
 			}
 			else
 			{
-				// No merge possible — insert new block at sorted position.
-				m_free.insert(m_free.begin() + idx, Free(_ptr, _size) );
+				idx = uint32_t(m_block.size() );
+				m_block.push_back(Block() );
 			}
+
+			Block& block = m_block[idx];
+			block.m_free   = false;
+			block.m_orphan = false;
+
+			return idx;
 		}
 
-		typedef stl::vector<Free> FreeList;
-		FreeList m_free;
+		void freeBlock(uint32_t _idx)
+		{
+			Block& block = m_block[_idx];
+
+			// Drop queued orphan entry, so that orphan sweep can't act on reused block.
+			if (block.m_orphan)
+			{
+				for (uint32_t ii = 0, num = uint32_t(m_orphan.size() ); ii < num; ++ii)
+				{
+					if (_idx == m_orphan[ii])
+					{
+						m_orphan.erase(m_orphan.begin() + ii);
+						break;
+					}
+				}
+			}
+
+			block.m_free   = false;
+			block.m_orphan = false;
+			m_unusedBlock.push_back(_idx);
+		}
+
+		typedef stl::vector<Block> BlockArray;
+		BlockArray m_block;
+
+		typedef stl::vector<uint32_t> IndexArray;
+		IndexArray m_unusedBlock;
+
+		IndexArray m_orphan;
 
 		typedef stl::unordered_map<uint64_t, uint32_t> UsedList;
 		UsedList m_used;
 
-		typedef stl::unordered_map<uint64_t, uint32_t> SlabList;
-		SlabList m_slab;
+		uint32_t m_flBitmap;
+		uint32_t m_slBitmap[kFlCount];
+		uint32_t m_head[kFlCount][kSlCount];
 
 		uint32_t m_totalUsed;
 		uint32_t m_totalAvailable;
+		uint32_t m_numFree;
+	};
+
+	/// Persistent transform buffer. Matrices live at stable indices across
+	/// frames, CPU copy is kept to skip unchanged matrices, and only dirty
+	/// ranges are uploaded on frame.
+	struct TransformBuffer
+	{
+		TransformBuffer()
+			: m_handle(BGFX_INVALID_HANDLE)
+			, m_data(NULL)
+			, m_dirty(NULL)
+			, m_maxTransforms(0)
+		{
+		}
+
+		void init(uint32_t _maxTransforms);
+		void shutdown();
+
+		uint32_t alloc(uint16_t _num);
+		void free(uint32_t _index);
+		void update(uint32_t _index, const void* _mtx, uint16_t _num);
+		void markDirty(uint32_t _index, uint16_t _num);
+		void flush();
+
+		DynamicVertexBufferHandle m_handle;
+		NonLocalAllocator m_alloc;
+		float*    m_data;
+		uint64_t* m_dirty;
+		uint32_t  m_maxTransforms;
 	};
 
 	struct UniformCache
@@ -4522,6 +5326,7 @@ namespace bgfx
 		virtual void clearTexture(TextureHandle _handle, uint8_t _mip, uint8_t _numMips, uint16_t _layer, uint16_t _numLayers) = 0;
 		virtual void readTexture(TextureHandle _handle, void* _data, uint16_t _layer, uint8_t _mip) = 0;
 		virtual void resizeTexture(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, uint16_t _numLayers) = 0;
+		virtual void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) = 0;
 		virtual void overrideInternal(TextureHandle _handle, uintptr_t _ptr, uint16_t _layerIndex) = 0;
 		virtual uintptr_t getInternal(TextureHandle _handle) = 0;
 		virtual void destroyTexture(TextureHandle _handle) = 0;
@@ -4532,7 +5337,7 @@ namespace bgfx
 		virtual void destroyUniform(UniformHandle _handle) = 0;
 		virtual void requestScreenShot(FrameBufferHandle _handle, const char* _filePath) = 0;
 		virtual void updateViewName(ViewId _id, const char* _name) = 0;
-		virtual void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) = 0;
+		virtual bool updateUniform(uint16_t _loc, const void* _data, uint32_t _size) = 0;
 		virtual void invalidateOcclusionQuery(OcclusionQueryHandle _handle) = 0;
 		virtual void setMarker(const char* _name, uint16_t _len) = 0;
 		virtual void setName(Handle _handle, const char* _name, uint16_t _len) = 0;
@@ -4546,7 +5351,9 @@ namespace bgfx
 	{
 	}
 
-	void rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end);
+	/// Returns true if any uniform value changed. Size of values that were identical to already
+	/// set ones is added to `_bytesSkipped`.
+	bool rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end, uint32_t& _bytesSkipped);
 
 #if BGFX_CONFIG_DEBUG
 #	define BGFX_API_FUNC(_func) BX_NO_INLINE _func
@@ -4568,12 +5375,15 @@ namespace bgfx
 			, m_numFreeDynamicIndexBufferHandles(0)
 			, m_numFreeDynamicVertexBufferHandles(0)
 			, m_numFreeOcclusionQueryHandles(0)
+			, m_numFreeDrawListHandles(0)
 			, m_colorPaletteDirty(2)
 			, m_frames(0)
 			, m_debug(BGFX_DEBUG_NONE)
 			, m_rtMemoryUsed(0)
 			, m_textureMemoryUsed(0)
+			, m_textureMemoryResident(0)
 			, m_renderCtx(NULL)
+			, m_frameReplay(NULL)
 			, m_headless(false)
 			, m_rendererInitialized(false)
 			, m_exit(false)
@@ -4624,6 +5434,71 @@ namespace bgfx
 			return cmdbuf;
 		}
 
+		// Returns calling thread's resource command buffer slot, or UINT8_MAX
+		// for API thread. When there are more threads than slots, slots are
+		// shared, which is safe since each slot has its own lock.
+		uint8_t getThreadSlot();
+
+		// Texture and dynamic buffer updates from non-API threads are
+		// recorded into per-thread command buffer, guarded by per-slot lock
+		// which is contended only by Context::swap. Otherwise resource API
+		// lock is taken, and m_cmdPre is used.
+		class ThreadCommandBufferScope
+		{
+			BX_CLASS(ThreadCommandBufferScope
+				, NO_DEFAULT_CTOR
+				, NO_COPY
+				);
+
+		public:
+			ThreadCommandBufferScope(Context& _ctx)
+				: m_ctx(_ctx)
+				, m_slot(_ctx.getThreadSlot() )
+			{
+#if BGFX_CONFIG_MULTITHREADED
+				if (UINT8_MAX == m_slot)
+				{
+					m_ctx.m_resourceApiLock.lock();
+				}
+				else
+				{
+					m_ctx.m_cmdThreadLock[m_slot].lock();
+				}
+#endif // BGFX_CONFIG_MULTITHREADED
+			}
+
+			~ThreadCommandBufferScope()
+			{
+#if BGFX_CONFIG_MULTITHREADED
+				if (UINT8_MAX == m_slot)
+				{
+					m_ctx.m_resourceApiLock.unlock();
+				}
+				else
+				{
+					m_ctx.m_cmdThreadLock[m_slot].unlock();
+				}
+#endif // BGFX_CONFIG_MULTITHREADED
+			}
+
+			CommandBuffer& get(CommandBuffer::Enum _cmd)
+			{
+				if (UINT8_MAX == m_slot)
+				{
+					return m_ctx.getCommandBuffer(_cmd);
+				}
+
+				CommandBuffer& cmdbuf = m_ctx.m_submit->m_cmdThread[m_slot];
+				uint8_t cmd = (uint8_t)_cmd;
+				cmdbuf.write(cmd);
+				return cmdbuf;
+			}
+
+		private:
+			Context& m_ctx;
+			uint8_t  m_slot;
+		};
+
 		BGFX_API_FUNC(void reset(uint32_t _width, uint32_t _height, uint32_t _flags, TextureFormat::Enum _formatColor) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -4774,11 +5649,19 @@ namespace bgfx
 			stats.numVertexBuffers        = m_vertexBufferHandle.getNumHandles();
 			stats.numVertexLayouts        = m_layoutHandle.getNumHandles();
 
-			stats.textureMemoryUsed = m_textureMemoryUsed;
-			stats.rtMemoryUsed      = m_rtMemoryUsed;
+			stats.textureMemoryUsed     = m_textureMemoryUsed;
+			stats.rtMemoryUsed          = m_rtMemoryUsed;
+			stats.textureMemoryResident = m_textureMemoryResident;
 
 			stats.numDrawCallsPeak  = m_numDrawCallsPeak;
 
+			stats.dynIbNumFreeBlocks      = m_dynIndexBufferAllocator.getNumFreeBlocks();
+			stats.dynIbLargestFreeBlock   = m_dynIndexBufferAllocator.getLargestFreeBlock();
+			stats.dynVbNumFreeBlocks      = m_dynVertexBufferAllocator.getNumFreeBlocks();
+			stats.dynVbLargestFreeBlock   = m_dynVertexBufferAllocator.getLargestFreeBlock();
+			stats.uniformNumFreeBlocks    = m_uniformCache.m_uniformStoreAlloc.getNumFreeBlocks();
+			stats.uniformLargestFreeBlock = m_uniformCache.m_uniformStoreAlloc.getLargestFreeBlock();
+
 			return &stats;
 		}
 
@@ -4792,8 +5675,10 @@ namespace bgfx
 			if (isValid(handle) )
 			{
 				IndexBuffer& ib = m_indexBuffers[handle.idx];
-				ib.m_size  = _mem->size;
-				ib.m_flags = _flags;
+				ib.m_size     = _mem->size;
+				ib.m_flags    = _flags;
+				ib.m_refCount = 1;
+				ib.m_shared   = false;
 
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateIndexBuffer);
 				cmdbuf.write(handle);
@@ -4827,14 +5712,29 @@ namespace bgfx
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
 			BGFX_CHECK_HANDLE("destroyIndexBuffer", m_indexBufferHandle, _handle);
-			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
-			BX_ASSERT(ok, "Index buffer handle %d is already destroyed!", _handle.idx);
+			indexBufferDecRef(_handle);
+		}
 
+		void indexBufferIncRef(IndexBufferHandle _handle)
+		{
 			IndexBuffer& ref = m_indexBuffers[_handle.idx];
-			ref.m_name.clear();
+			++ref.m_refCount;
+		}
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyIndexBuffer);
-			cmdbuf.write(_handle);
+		void indexBufferDecRef(IndexBufferHandle _handle)
+		{
+			IndexBuffer& ref = m_indexBuffers[_handle.idx];
+			int32_t refs = --ref.m_refCount;
+			if (0 == refs)
+			{
+				bool ok = m_submit->free(_handle); BX_UNUSED(ok);
+				BX_ASSERT(ok, "Index buffer handle %d is already destroyed!", _handle.idx);
+
+				ref.m_name.clear();
+
+				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyIndexBuffer);
+				cmdbuf.write(_handle);
+			}
 		}
 
 		VertexLayoutHandle findOrCreateVertexLayout(const VertexLayout& _layout, bool _refCountOnCreation = false)
@@ -4910,8 +5810,11 @@ namespace bgfx
 				m_vertexLayoutRef.add(handle, layoutHandle, _layout.m_hash);
 
 				VertexBuffer& vb = m_vertexBuffers[handle.idx];
-				vb.m_size   = _mem->size;
-				vb.m_stride = _layout.m_stride;
+				vb.m_size     = _mem->size;
+				vb.m_stride   = _layout.m_stride;
+				vb.m_flags    = _flags;
+				vb.m_refCount = 1;
+				vb.m_shared   = false;
 
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateVertexBuffer);
 				cmdbuf.write(handle);
@@ -4947,14 +5850,32 @@ namespace bgfx
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
 			BGFX_CHECK_HANDLE("destroyVertexBuffer", m_vertexBufferHandle, _handle);
-			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
-			BX_ASSERT(ok, "Vertex buffer handle %d is already destroyed!", _handle.idx);
+			vertexBufferDecRef(_handle);
+		}
 
+		void vertexBufferIncRef(VertexBufferHandle _handle)
+		{
 			VertexBuffer& ref = m_vertexBuffers[_handle.idx];
-			ref.m_name.clear();
+			++ref.m_refCount;
+		}
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyVertexBuffer);
-			cmdbuf.write(_handle);
+		void vertexBufferDecRef(VertexBufferHandle _handle)
+		{
+			VertexBuffer& ref = m_vertexBuffers[_handle.idx];
+			int32_t refs = --ref.m_refCount;
+			if (0 == refs)
+			{
+				bool ok = m_submit->free(_handle); BX_UNUSED(ok);
+				BX_ASSERT(ok, "Vertex buffer handle %d is already destroyed!", _handle.idx);
+
+				ref.m_name.clear();
+
+				CommandBuffer& cmdbuf = getCommandBuffer(0 != (ref.m_flags & BGFX_BUFFER_DRAW_INDIRECT)
+					? CommandBuffer::DestroyDynamicVertexBuffer
+					: CommandBuffer::DestroyVertexBuffer
+					);
+				cmdbuf.write(_handle);
+			}
 		}
 
 		void destroyVertexBufferInternal(VertexBufferHandle _handle)
@@ -4972,7 +5893,17 @@ namespace bgfx
 
 		uint64_t allocDynamicIndexBuffer(uint32_t _size, uint16_t _flags)
 		{
-			uint64_t ptr = m_dynIndexBufferAllocator.alloc(_size);
+			// Allocations that would take a large part of the page get a dedicated
+			// buffer. Once released it's destroyed, instead of being kept alive by
+			// small allocations landing in its remainder.
+			const uint32_t pageSize  = m_init.limits.dynamicIndexBufferSize;
+			const bool     dedicated = _size > pageSize/4;
+
+			uint64_t ptr = dedicated
+				? NonLocalAllocator::kInvalidBlock
+				: m_dynIndexBufferAllocator.alloc(_size)
+				;
+
 			if (ptr == NonLocalAllocator::kInvalidBlock)
 			{
 				IndexBufferHandle indexBufferHandle = { m_indexBufferHandle.alloc() };
@@ -4982,18 +5913,33 @@ namespace bgfx
 					return NonLocalAllocator::kInvalidBlock;
 				}
 
-				const uint32_t allocSize = bx::max<uint32_t>(BGFX_CONFIG_DYNAMIC_INDEX_BUFFER_SIZE, bx::alignUp(_size, 1<<20) );
+				const uint32_t allocSize = dedicated
+					? bx::alignUp(_size, 16)
+					: pageSize
+					;
 
 				IndexBuffer& ib = m_indexBuffers[indexBufferHandle.idx];
-				ib.m_size = allocSize;
+				ib.m_size     = allocSize;
+				ib.m_flags    = _flags;
+				ib.m_refCount = 1;
+				ib.m_shared   = true;
 
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateDynamicIndexBuffer);
 				cmdbuf.write(indexBufferHandle);
 				cmdbuf.write(allocSize);
 				cmdbuf.write(_flags);
 
-				m_dynIndexBufferAllocator.add(uint64_t(indexBufferHandle.idx) << 32, allocSize);
-				ptr = m_dynIndexBufferAllocator.alloc(_size);
+				// Dedicated buffer is used whole, it must not be handed out by
+				// general alloc, which might pick free block in other page.
+				if (dedicated)
+				{
+					ptr = m_dynIndexBufferAllocator.addUsed(uint64_t(indexBufferHandle.idx) << 32, allocSize);
+				}
+				else
+				{
+					m_dynIndexBufferAllocator.add(uint64_t(indexBufferHandle.idx) << 32, allocSize);
+					ptr = m_dynIndexBufferAllocator.alloc(_size);
+				}
 			}
 
 			return ptr;
@@ -5009,7 +5955,10 @@ namespace bgfx
 			}
 
 			IndexBuffer& ib = m_indexBuffers[indexBufferHandle.idx];
-			ib.m_size = _size;
+			ib.m_size     = _size;
+			ib.m_flags    = _flags;
+			ib.m_refCount = 1;
+			ib.m_shared   = false;
 
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateDynamicIndexBuffer);
 			cmdbuf.write(indexBufferHandle);
@@ -5078,41 +6027,52 @@ namespace bgfx
 
 		BGFX_API_FUNC(void update(DynamicIndexBufferHandle _handle, uint32_t _startIndex, const Memory* _mem) )
 		{
-			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			IndexBufferHandle handle;
+			uint32_t offset;
+			uint32_t size;
 
-			BGFX_CHECK_HANDLE("updateDynamicIndexBuffer", m_dynamicIndexBufferHandle, _handle);
+			// Handle tables and buffer sizes are shared with create, destroy and resize on
+			// other threads, only command buffer write is done without resource API lock.
+			{
+				BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
-			DynamicIndexBuffer& dib = m_dynamicIndexBuffers[_handle.idx];
-			BX_ASSERT(0 == (dib.m_flags & BGFX_BUFFER_COMPUTE_WRITE), "Can't update GPU write buffer from CPU.");
-			const uint32_t indexSize = 0 == (dib.m_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
+				BGFX_CHECK_HANDLE("updateDynamicIndexBuffer", m_dynamicIndexBufferHandle, _handle);
 
-			if (dib.m_size < _mem->size
-			&&  0 != (dib.m_flags & BGFX_BUFFER_ALLOW_RESIZE) )
-			{
-				destroy(dib);
+				DynamicIndexBuffer& dib = m_dynamicIndexBuffers[_handle.idx];
+				BX_ASSERT(0 == (dib.m_flags & BGFX_BUFFER_COMPUTE_WRITE), "Can't update GPU write buffer from CPU.");
+				const uint32_t indexSize = 0 == (dib.m_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
 
-				const uint64_t ptr = (0 != (dib.m_flags & BGFX_BUFFER_COMPUTE_READ) )
-					? allocIndexBuffer(_mem->size, dib.m_flags)
-					: allocDynamicIndexBuffer(_mem->size, dib.m_flags)
-					;
+				if (dib.m_size < _mem->size
+				&&  0 != (dib.m_flags & BGFX_BUFFER_ALLOW_RESIZE) )
+				{
+					destroy(dib);
 
-				dib.m_handle.idx = uint16_t(ptr>>32);
-				dib.m_offset     = uint32_t(ptr);
-				dib.m_size       = _mem->size;
-				dib.m_startIndex = bx::strideAlign(dib.m_offset, indexSize)/indexSize;
+					const uint64_t ptr = (0 != (dib.m_flags & BGFX_BUFFER_COMPUTE_READ) )
+						? allocIndexBuffer(_mem->size, dib.m_flags)
+						: allocDynamicIndexBuffer(_mem->size, dib.m_flags)
+						;
+
+					dib.m_handle.idx = uint16_t(ptr>>32);
+					dib.m_offset     = uint32_t(ptr);
+					dib.m_size       = _mem->size;
+					dib.m_startIndex = bx::strideAlign(dib.m_offset, indexSize)/indexSize;
+				}
+
+				handle = dib.m_handle;
+				offset = (dib.m_startIndex + _startIndex)*indexSize;
+				size   = bx::min<uint32_t>(offset
+					+ bx::min(bx::satSub<uint32_t>(dib.m_size, _startIndex*indexSize), _mem->size)
+					, m_indexBuffers[dib.m_handle.idx].m_size) - offset
+					;
+				BX_ASSERT(_mem->size <= size, "Truncating dynamic index buffer update (size %d, mem size %d)."
+					, size
+					, _mem->size
+					);
 			}
 
-			const uint32_t offset = (dib.m_startIndex + _startIndex)*indexSize;
-			const uint32_t size   = bx::min<uint32_t>(offset
-				+ bx::min(bx::satSub<uint32_t>(dib.m_size, _startIndex*indexSize), _mem->size)
-				, m_indexBuffers[dib.m_handle.idx].m_size) - offset
-				;
-			BX_ASSERT(_mem->size <= size, "Truncating dynamic index buffer update (size %d, mem size %d)."
-				, size
-				, _mem->size
-				);
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateDynamicIndexBuffer);
-			cmdbuf.write(dib.m_handle);
+			ThreadCommandBufferScope scope(*this);
+			CommandBuffer& cmdbuf = scope.get(CommandBuffer::UpdateDynamicIndexBuffer);
+			cmdbuf.write(handle);
 			cmdbuf.write(offset);
 			cmdbuf.write(size);
 			cmdbuf.write(_mem);
@@ -5155,7 +6115,17 @@ namespace bgfx
 
 		uint64_t allocDynamicVertexBuffer(uint32_t _size, uint16_t _flags)
 		{
-			uint64_t ptr = m_dynVertexBufferAllocator.alloc(_size);
+			// Allocations that would take a large part of the page get a dedicated
+			// buffer. Once released it's destroyed, instead of being kept alive by
+			// small allocations landing in its remainder.
+			const uint32_t pageSize  = m_init.limits.dynamicVertexBufferSize;
+			const bool     dedicated = _size > pageSize/4;
+
+			uint64_t ptr = dedicated
+				? NonLocalAllocator::kInvalidBlock
+				: m_dynVertexBufferAllocator.alloc(_size)
+				;
+
 			if (ptr == NonLocalAllocator::kInvalidBlock)
 			{
 				VertexBufferHandle vertexBufferHandle = { m_vertexBufferHandle.alloc() };
@@ -5165,19 +6135,34 @@ namespace bgfx
 					return NonLocalAllocator::kInvalidBlock;
 				}
 
-				const uint32_t allocSize = bx::max<uint32_t>(BGFX_CONFIG_DYNAMIC_VERTEX_BUFFER_SIZE, bx::alignUp(_size, 1<<20) );
+				const uint32_t allocSize = dedicated
+					? bx::alignUp(_size, 16)
+					: pageSize
+					;
 
 				VertexBuffer& vb = m_vertexBuffers[vertexBufferHandle.idx];
-				vb.m_size   = allocSize;
-				vb.m_stride = 0;
+				vb.m_size     = allocSize;
+				vb.m_stride   = 0;
+				vb.m_flags    = _flags;
+				vb.m_refCount = 1;
+				vb.m_shared   = true;
 
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateDynamicVertexBuffer);
 				cmdbuf.write(vertexBufferHandle);
 				cmdbuf.write(allocSize);
 				cmdbuf.write(_flags);
 
-				m_dynVertexBufferAllocator.add(uint64_t(vertexBufferHandle.idx) << 32, allocSize);
-				ptr = m_dynVertexBufferAllocator.alloc(_size);
+				// Dedicated buffer is used whole, it must not be handed out by
+				// general alloc, which might pick free block in other page.
+				if (dedicated)
+				{
+					ptr = m_dynVertexBufferAllocator.addUsed(uint64_t(vertexBufferHandle.idx) << 32, allocSize);
+				}
+				else
+				{
+					m_dynVertexBufferAllocator.add(uint64_t(vertexBufferHandle.idx) << 32, allocSize);
+					ptr = m_dynVertexBufferAllocator.alloc(_size);
+				}
 			}
 
 			return ptr;
@@ -5194,8 +6179,11 @@ namespace bgfx
 			}
 
 			VertexBuffer& vb = m_vertexBuffers[vertexBufferHandle.idx];
-			vb.m_size   = _size;
-			vb.m_stride = 0;
+			vb.m_size     = _size;
+			vb.m_stride   = 0;
+			vb.m_flags    = _flags;
+			vb.m_refCount = 1;
+			vb.m_shared   = false;
 
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateDynamicVertexBuffer);
 			cmdbuf.write(vertexBufferHandle);
@@ -5274,44 +6262,54 @@ namespace bgfx
 
 		BGFX_API_FUNC(void update(DynamicVertexBufferHandle _handle, uint32_t _startVertex, const Memory* _mem) )
 		{
-			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			VertexBufferHandle handle;
+			uint32_t offset;
+			uint32_t size;
 
-			BGFX_CHECK_HANDLE("updateDynamicVertexBuffer", m_dynamicVertexBufferHandle, _handle);
+			// Handle tables and buffer sizes are shared with create, destroy and resize on
+			// other threads, only command buffer write is done without resource API lock.
+			{
+				BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
-			DynamicVertexBuffer& dvb = m_dynamicVertexBuffers[_handle.idx];
-			BX_ASSERT(0 == (dvb.m_flags & BGFX_BUFFER_COMPUTE_WRITE), "Can't update GPU write buffer from CPU.");
+				BGFX_CHECK_HANDLE("updateDynamicVertexBuffer", m_dynamicVertexBufferHandle, _handle);
 
-			if (dvb.m_size < _mem->size
-			&&  0 != (dvb.m_flags & BGFX_BUFFER_ALLOW_RESIZE) )
-			{
-				destroy(dvb);
+				DynamicVertexBuffer& dvb = m_dynamicVertexBuffers[_handle.idx];
+				BX_ASSERT(0 == (dvb.m_flags & BGFX_BUFFER_COMPUTE_WRITE), "Can't update GPU write buffer from CPU.");
 
-				const uint32_t size = bx::strideAlign<16>(_mem->size, dvb.m_stride)+dvb.m_stride;
+				if (dvb.m_size < _mem->size
+				&&  0 != (dvb.m_flags & BGFX_BUFFER_ALLOW_RESIZE) )
+				{
+					destroy(dvb);
 
-				const uint64_t ptr = (0 != (dvb.m_flags & BGFX_BUFFER_COMPUTE_READ) )
-					? allocVertexBuffer(size, dvb.m_flags)
-					: allocDynamicVertexBuffer(size, dvb.m_flags)
-					;
+					const uint32_t allocSize = bx::strideAlign<16>(_mem->size, dvb.m_stride)+dvb.m_stride;
 
-				dvb.m_handle.idx  = uint16_t(ptr>>32);
-				dvb.m_offset      = uint32_t(ptr);
-				dvb.m_size        = size;
-				dvb.m_numVertices = _mem->size / dvb.m_stride;
-				dvb.m_startVertex = bx::strideAlign(dvb.m_offset, dvb.m_stride)/dvb.m_stride;
-			}
+					const uint64_t ptr = (0 != (dvb.m_flags & BGFX_BUFFER_COMPUTE_READ) )
+						? allocVertexBuffer(allocSize, dvb.m_flags)
+						: allocDynamicVertexBuffer(allocSize, dvb.m_flags)
+						;
 
-			const uint32_t offset = (dvb.m_startVertex + _startVertex)*dvb.m_stride;
-			const uint32_t size   = bx::min<uint32_t>(offset
-				+ bx::min(bx::satSub<uint32_t>(dvb.m_size, _startVertex*dvb.m_stride), _mem->size)
-				, m_vertexBuffers[dvb.m_handle.idx].m_size) - offset
-				;
-			BX_ASSERT(_mem->size <= size, "Truncating dynamic vertex buffer update (size %d, mem size %d)."
-				, size
-				, _mem->size
-				);
+					dvb.m_handle.idx  = uint16_t(ptr>>32);
+					dvb.m_offset      = uint32_t(ptr);
+					dvb.m_size        = allocSize;
+					dvb.m_numVertices = _mem->size / dvb.m_stride;
+					dvb.m_startVertex = bx::strideAlign(dvb.m_offset, dvb.m_stride)/dvb.m_stride;
+				}
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateDynamicVertexBuffer);
-			cmdbuf.write(dvb.m_handle);
+				handle = dvb.m_handle;
+				offset = (dvb.m_startVertex + _startVertex)*dvb.m_stride;
+				size   = bx::min<uint32_t>(offset
+					+ bx::min(bx::satSub<uint32_t>(dvb.m_size, _startVertex*dvb.m_stride), _mem->size)
+					, m_vertexBuffers[dvb.m_handle.idx].m_size) - offset
+					;
+				BX_ASSERT(_mem->size <= size, "Truncating dynamic vertex buffer update (size %d, mem size %d)."
+					, size
+					, _mem->size
+					);
+			}
+
+			ThreadCommandBufferScope scope(*this);
+			CommandBuffer& cmdbuf = scope.get(CommandBuffer::UpdateDynamicVertexBuffer);
+			cmdbuf.write(handle);
 			cmdbuf.write(offset);
 			cmdbuf.write(size);
 			cmdbuf.write(_mem);
@@ -5362,6 +6360,32 @@ namespace bgfx
 			m_dynamicVertexBufferHandle.free(_handle.idx);
 		}
 
+		BGFX_API_FUNC(uint32_t allocPersistentTransform(uint16_t _num) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			return m_transformBuffer.alloc(_num);
+		}
+
+		BGFX_API_FUNC(void freePersistentTransform(uint32_t _index) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			m_transformBuffer.free(_index);
+		}
+
+		BGFX_API_FUNC(void updatePersistentTransform(uint32_t _index, const void* _mtx, uint16_t _num) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BX_ASSERT(_index + _num <= m_transformBuffer.m_maxTransforms
+				, "Persistent transform index out of bounds %d (max: %d)."
+				, _index + _num
+				, m_transformBuffer.m_maxTransforms
+				);
+			m_transformBuffer.update(_index, _mtx, _num);
+		}
+
 		BGFX_API_FUNC(uint32_t getAvailTransientIndexBuffer(uint32_t _num, bool _index32) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -5392,6 +6416,12 @@ namespace bgfx
 				uint16_t flags = BGFX_BUFFER_NONE;
 				cmdbuf.write(flags);
 
+				IndexBuffer& ib = m_indexBuffers[handle.idx];
+				ib.m_size     = _size;
+				ib.m_flags    = flags;
+				ib.m_refCount = 1;
+				ib.m_shared   = true;
+
 				const uint32_t size = 0
 					+ bx::alignUp<uint32_t>(sizeof(TransientIndexBuffer), 16)
 					+ bx::alignUp(_size, 16)
@@ -5459,6 +6489,13 @@ namespace bgfx
 				uint16_t flags = BGFX_BUFFER_NONE;
 				cmdbuf.write(flags);
 
+				VertexBuffer& vb = m_vertexBuffers[handle.idx];
+				vb.m_size     = _size;
+				vb.m_stride   = stride;
+				vb.m_flags    = flags;
+				vb.m_refCount = 1;
+				vb.m_shared   = true;
+
 				const uint32_t size = 0
 					+ bx::alignUp<uint32_t>(sizeof(TransientVertexBuffer), 16)
 					+ bx::alignUp(_size, 16)
@@ -5529,6 +6566,13 @@ namespace bgfx
 				const uint32_t size  = _num * BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
 				const uint16_t flags = BGFX_BUFFER_DRAW_INDIRECT;
 
+				VertexBuffer& vb = m_vertexBuffers[handle.idx];
+				vb.m_size     = size;
+				vb.m_stride   = 0;
+				vb.m_flags    = flags;
+				vb.m_refCount = 1;
+				vb.m_shared   = false;
+
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateDynamicVertexBuffer);
 				cmdbuf.write(handle);
 				cmdbuf.write(size);
@@ -5543,10 +6587,7 @@ namespace bgfx
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 			VertexBufferHandle handle = { _handle.idx };
 			BGFX_CHECK_HANDLE("destroyDrawIndirectBuffer", m_vertexBufferHandle, handle);
-
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyDynamicVertexBuffer);
-			cmdbuf.write(handle);
-			m_submit->free(handle);
+			vertexBufferDecRef(handle);
 		}
 
 		BGFX_API_FUNC(ShaderHandle createShader(const Memory* _mem) )
@@ -5858,6 +6899,7 @@ namespace bgfx
 					ProgramRef& pr = m_programRef[handle.idx];
 					pr.m_vsh = _vsh;
 					pr.m_fsh = _fsh;
+					pr.m_instanced = BGFX_INVALID_HANDLE;
 					pr.m_refCount = 1;
 
 					const uint32_t key = uint32_t(_fsh.idx<<16)|_vsh.idx;
@@ -5910,6 +6952,7 @@ namespace bgfx
 					pr.m_vsh = _vsh;
 					ShaderHandle fsh = BGFX_INVALID_HANDLE;
 					pr.m_fsh = fsh;
+					pr.m_instanced = BGFX_INVALID_HANDLE;
 					pr.m_refCount = 1;
 
 					const uint32_t key = uint32_t(_vsh.idx);
@@ -5931,12 +6974,20 @@ namespace bgfx
 			return handle;
 		}
 
-		BGFX_API_FUNC(void destroyProgram(ProgramHandle _handle) )
+		void programIncRef(ProgramHandle _handle)
 		{
-			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			ProgramRef& pr = m_programRef[_handle.idx];
+			++pr.m_refCount;
+			shaderIncRef(pr.m_vsh);
 
-			BGFX_CHECK_HANDLE("destroyProgram", m_programHandle, _handle);
+			if (isValid(pr.m_fsh) )
+			{
+				shaderIncRef(pr.m_fsh);
+			}
+		}
 
+		void programDecRef(ProgramHandle _handle)
+		{
 			ProgramRef& pr = m_programRef[_handle.idx];
 			shaderDecRef(pr.m_vsh);
 
@@ -5955,9 +7006,59 @@ namespace bgfx
 				cmdbuf.write(_handle);
 
 				m_programHashMap.removeByHandle(_handle.idx);
+
+				if (isValid(pr.m_instanced) )
+				{
+					const ProgramHandle instanced = pr.m_instanced;
+					pr.m_instanced = BGFX_INVALID_HANDLE;
+					programDecRef(instanced);
+				}
 			}
 		}
 
+		BGFX_API_FUNC(void destroyProgram(ProgramHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("destroyProgram", m_programHandle, _handle);
+
+			programDecRef(_handle);
+		}
+
+		BGFX_API_FUNC(void setInstancedProgram(ProgramHandle _handle, ProgramHandle _instanced) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("setInstancedProgram", m_programHandle, _handle);
+			BGFX_CHECK_HANDLE_INVALID_OK("setInstancedProgram", m_programHandle, _instanced);
+
+			ProgramRef& pr = m_programRef[_handle.idx];
+			BX_ASSERT(isValid(pr.m_fsh), "Compute program can't have instanced variant.");
+			BX_ASSERT(_handle.idx != _instanced.idx, "Program can't be its own instanced variant.");
+
+			if (pr.m_instanced.idx == _instanced.idx)
+			{
+				return;
+			}
+
+			if (isValid(_instanced) )
+			{
+				BX_ASSERT(isValid(m_programRef[_instanced.idx].m_fsh), "Instanced variant must not be compute program.");
+				programIncRef(_instanced);
+			}
+
+			if (isValid(pr.m_instanced) )
+			{
+				programDecRef(pr.m_instanced);
+			}
+
+			pr.m_instanced = _instanced;
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::SetInstancedProgram);
+			cmdbuf.write(_handle);
+			cmdbuf.write(_instanced);
+		}
+
 		BGFX_API_FUNC(TextureHandle createTexture(const Memory* _mem, uint64_t _flags, uint8_t _skip, TextureInfo* _info, BackbufferRatio::Enum _ratio, bool _immutable, uint64_t _external) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -6022,14 +7123,7 @@ namespace bgfx
 				, _flags
 				);
 
-			if (ref.isRt() )
-			{
-				m_rtMemoryUsed += int64_t(ref.m_storageSize);
-			}
-			else
-			{
-				m_textureMemoryUsed += int64_t(ref.m_storageSize);
-			}
+			textureMemoryUsed(ref, int64_t(ref.m_storageSize), int64_t(ref.m_storageSize) );
 
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateTexture);
 			cmdbuf.write(handle);
@@ -6110,6 +7204,10 @@ namespace bgfx
 			TextureRef& ref = m_textureRef[_handle.idx];
 			BX_ASSERT(BackbufferRatio::Count != ref.m_bbRatio, "");
 
+			// Renderer recreates resized texture with whole mip chain resident.
+			textureMemoryUsed(ref, 0, int64_t(ref.m_storageSize) - int64_t(ref.getResidentSize() ) );
+			ref.m_minLod = 0;
+
 			getTextureSizeFromRatio(BackbufferRatio::Enum(ref.m_bbRatio), _width, _height);
 			_numMips = calcNumMips(1 < _numMips, _width, _height);
 
@@ -6133,6 +7231,49 @@ namespace bgfx
 			cmdbuf.write(_numLayers);
 		}
 
+		BGFX_API_FUNC(void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("setTextureMinLod", m_textureHandle, _handle);
+
+			TextureRef& ref = m_textureRef[_handle.idx];
+			BX_WARN(_minLod < ref.m_numMips
+				, "Texture (handle %d, '%S') min LOD %d is out of range, num mips %d."
+				, _handle.idx
+				, &ref.m_name
+				, _minLod
+				, ref.m_numMips
+				);
+			_minLod = bx::min<uint8_t>(_minLod, uint8_t(ref.m_numMips-1) );
+
+			if (_minLod == ref.m_minLod)
+			{
+				return;
+			}
+
+			const int64_t size = int64_t(ref.getResidentSize() );
+			ref.m_minLod = _minLod;
+			textureMemoryUsed(ref, 0, int64_t(ref.getResidentSize() ) - size);
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::SetTextureMinLod);
+			cmdbuf.write(_handle);
+			cmdbuf.write(_minLod);
+		}
+
+		// Renderer allocates whole mip chain, only resident size depends on min LOD.
+		void textureMemoryUsed(const TextureRef& _ref, int64_t _size, int64_t _residentSize)
+		{
+			if (_ref.isRt() )
+			{
+				m_rtMemoryUsed += _size;
+			}
+			else
+			{
+				m_textureMemoryUsed     += _size;
+				m_textureMemoryResident += _residentSize;
+			}
+		}
+
 		void textureTakeOwnership(TextureHandle _handle)
 		{
 			TextureRef& ref = m_textureRef[_handle.idx];
@@ -6157,14 +7298,7 @@ namespace bgfx
 			{
 				ref.m_name.clear();
 
-				if (ref.isRt() )
-				{
-					m_rtMemoryUsed -= int64_t(ref.m_storageSize);
-				}
-				else
-				{
-					m_textureMemoryUsed -= int64_t(ref.m_storageSize);
-				}
+				textureMemoryUsed(ref, -int64_t(ref.m_storageSize), -int64_t(ref.getResidentSize() ) );
 
 				bool ok = m_submit->free(_handle); BX_UNUSED(ok);
 				BX_ASSERT(ok, "Texture handle %d is already destroyed!", _handle.idx);
@@ -6188,17 +7322,21 @@ namespace bgfx
 			, const Memory* _mem
 		) )
 		{
-			BGFX_MUTEX_SCOPE(m_resourceApiLock);
-
-			const TextureRef& ref = m_textureRef[_handle.idx];
-			if (ref.m_immutable)
 			{
-				BX_WARN(false, "Can't update immutable texture.");
-				release(_mem);
-				return;
-			}
+				// Texture table is shared with create and destroy on other threads, only
+				// command buffer write is done without resource API lock.
+				BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+				BGFX_CHECK_HANDLE("updateTexture", m_textureHandle, _handle);
+
+				const TextureRef& ref = m_textureRef[_handle.idx];
+				if (ref.m_immutable)
+				{
+					BX_WARN(false, "Can't update immutable texture.");
+					release(_mem);
+					return;
+				}
 
-			{
 				const bimg::TextureFormat::Enum format = bimg::TextureFormat::Enum(ref.m_format);
 				const bimg::ImageBlockInfo& blockInfo = bimg::getBlockInfo(format);
 
@@ -6240,7 +7378,8 @@ namespace bgfx
 				}
 			}
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateTexture);
+			ThreadCommandBufferScope scope(*this);
+			CommandBuffer& cmdbuf = scope.get(CommandBuffer::UpdateTexture);
 			cmdbuf.write(_handle);
 			cmdbuf.write(_side);
 			cmdbuf.write(_mip);
@@ -6258,9 +7397,14 @@ namespace bgfx
 
 		BGFX_API_FUNC(void clearTexture(TextureHandle _handle, uint8_t _mip, uint8_t _numMips, uint16_t _layer, uint16_t _numLayers) )
 		{
-			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			{
+				BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+				BGFX_CHECK_HANDLE("clearTexture", m_textureHandle, _handle);
+			}
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::ClearTexture);
+			ThreadCommandBufferScope scope(*this);
+			CommandBuffer& cmdbuf = scope.get(CommandBuffer::ClearTexture);
 			cmdbuf.write(_handle);
 			cmdbuf.write(_mip);
 			cmdbuf.write(_numMips);
@@ -6515,7 +7659,17 @@ namespace bgfx
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
 			BGFX_CHECK_HANDLE("destroyUniform", m_uniformHandle, _handle);
+			uniformDecRef(_handle);
+		}
 
+		void uniformIncRef(UniformHandle _handle)
+		{
+			UniformRef& uniform = m_uniformRef[_handle.idx];
+			++uniform.m_refCount;
+		}
+
+		void uniformDecRef(UniformHandle _handle)
+		{
 			UniformRef& uniform = m_uniformRef[_handle.idx];
 			BX_ASSERT(uniform.m_refCount > 0, "Destroying already destroyed uniform %d.", _handle.idx);
 			int32_t refs = --uniform.m_refCount;
@@ -6579,6 +7733,42 @@ namespace bgfx
 			m_freeOcclusionQueryHandle[m_numFreeOcclusionQueryHandles++] = _handle;
 		}
 
+		BGFX_API_FUNC(DrawListHandle createDrawList(DrawList* _drawList) )
+		{
+			if (NULL == _drawList)
+			{
+				return BGFX_INVALID_HANDLE;
+			}
+
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			DrawListHandle handle = { m_drawListHandle.alloc() };
+
+			BX_WARN(isValid(handle), "Failed to allocate draw list handle.");
+			if (!isValid(handle) )
+			{
+				bx::deleteObject(g_allocator, _drawList);
+				return handle;
+			}
+
+			drawListIncRef(*_drawList);
+			m_drawList[handle.idx] = _drawList;
+
+			return handle;
+		}
+
+		void drawListIncRef(DrawList& _drawList);
+		void drawListDecRef(const DrawList& _drawList);
+
+		BGFX_API_FUNC(void destroyDrawList(DrawListHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("destroyDrawList", m_drawListHandle, _handle);
+
+			m_freeDrawListHandle[m_numFreeDrawListHandles++] = _handle;
+		}
+
 		BGFX_API_FUNC(void requestScreenShot(FrameBufferHandle _handle, const char* _filePath) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -6616,6 +7806,42 @@ namespace bgfx
 			screenShot.filePath.set(_filePath);
 		}
 
+		BGFX_API_FUNC(void requestFrameCapture(const char* _filePath) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			m_submit->m_frameCapture = true;
+			m_submit->m_frameCaptureFilePath.set(_filePath);
+		}
+
+		BGFX_API_FUNC(bool replayFrameCapture(const char* _filePath) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			if (m_submit->m_frameReplayChanged)
+			{
+				BX_TRACE("Frame replay is already changed in this frame.");
+				return false;
+			}
+
+			FrameReplay* replay = NULL;
+
+			if (NULL != _filePath)
+			{
+				replay = captureLoad(_filePath);
+
+				if (NULL == replay)
+				{
+					return false;
+				}
+			}
+
+			m_submit->m_frameReplay        = replay;
+			m_submit->m_frameReplayChanged = true;
+
+			return true;
+		}
+
 		BGFX_API_FUNC(void setPaletteColor(uint8_t _index, const float _rgba[4]) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -6722,9 +7948,9 @@ namespace bgfx
 
 		BGFX_API_FUNC(uint32_t frame(uint8_t _flags = BGFX_FRAME_NONE) );
 
-		uint32_t getSeqIncr(ViewId _id)
+		uint32_t getSeqIncr(ViewId _id, uint32_t _num = 1)
 		{
-			return bx::atomicFetchAndAdd<uint32_t>(&m_seq[_id], 1);
+			return bx::atomicFetchAndAdd<uint32_t>(&m_seq[_id], _num);
 		}
 
 		void dumpViewStats();
@@ -6804,8 +8030,12 @@ namespace bgfx
 			for (uint16_t ii = 0; ii < numEncoders; ++ii)
 			{
 				uint16_t idx = m_encoderHandle->getHandleAt(ii);
-				m_encoderStats[ii].cpuTimeBegin = m_encoder[idx].m_cpuTimeBegin;
-				m_encoderStats[ii].cpuTimeEnd   = m_encoder[idx].m_cpuTimeEnd;
+				m_encoderStats[ii].cpuTimeBegin          = m_encoder[idx].m_cpuTimeBegin;
+				m_encoderStats[ii].cpuTimeEnd            = m_encoder[idx].m_cpuTimeEnd;
+				m_encoderStats[ii].transientReserveTime  = m_encoder[idx].m_transientReserveTime;
+				m_encoderStats[ii].numTransientAllocs    = m_encoder[idx].m_numTransientAllocs;
+				m_encoderStats[ii].numTransientSlabs     = m_encoder[idx].m_numTransientSlabs;
+				m_encoderStats[ii].numTransientContended = m_encoder[idx].m_numTransientContended;
 
 				numSubmittingEncoders   += 0 < m_encoder[idx].m_numSubmitted;
 				numRenderItemsRequested += m_encoder[idx].m_numSubmitted + m_encoder[idx].m_numDropped;
@@ -6823,6 +8053,9 @@ namespace bgfx
 		bx::Mutex     m_encoderApiLock;
 		bx::Mutex     m_encoderBeginLock;
 		bx::Mutex     m_resourceApiLock;
+		bx::Mutex     m_cmdThreadLock[BGFX_CONFIG_MAX_RESOURCE_THREADS];
+		uint32_t      m_numCmdThreads;
+		uint32_t      m_cmdThreadGeneration;
 		bx::Thread    m_thread;
 #else
 		void apiSemPost()
@@ -6845,8 +8078,12 @@ namespace bgfx
 
 		void encoderApiWait()
 		{
-			m_encoderStats[0].cpuTimeBegin = m_encoder[0].m_cpuTimeBegin;
-			m_encoderStats[0].cpuTimeEnd   = m_encoder[0].m_cpuTimeEnd;
+			m_encoderStats[0].cpuTimeBegin          = m_encoder[0].m_cpuTimeBegin;
+			m_encoderStats[0].cpuTimeEnd            = m_encoder[0].m_cpuTimeEnd;
+			m_encoderStats[0].transientReserveTime  = m_encoder[0].m_transientReserveTime;
+			m_encoderStats[0].numTransientAllocs    = m_encoder[0].m_numTransientAllocs;
+			m_encoderStats[0].numTransientSlabs     = m_encoder[0].m_numTransientSlabs;
+			m_encoderStats[0].numTransientContended = m_encoder[0].m_numTransientContended;
 			m_submit->m_perfStats.numEncoders = 1;
 			m_submit->m_needBindDedup = false;
 			m_submit->m_numRenderItemsRequested = m_encoder[0].m_numSubmitted + m_encoder[0].m_numDropped;
@@ -6872,6 +8109,11 @@ namespace bgfx
 		typedef stl::unordered_map<uint32_t, uint32_t> BindHashMap;
 		BindHashMap m_renderBindHashMap;
 
+		// Instanced program variants, updated on render thread by
+		// SetInstancedProgram/DestroyProgram commands.
+		ProgramHandle m_instancedProgram[BGFX_CONFIG_MAX_PROGRAMS];
+		uint16_t      m_numInstancedPrograms;
+
 		IndexBuffer  m_indexBuffers[BGFX_CONFIG_MAX_INDEX_BUFFERS];
 		VertexBuffer m_vertexBuffers[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
 
@@ -6881,9 +8123,11 @@ namespace bgfx
 		uint16_t m_numFreeDynamicIndexBufferHandles;
 		uint16_t m_numFreeDynamicVertexBufferHandles;
 		uint16_t m_numFreeOcclusionQueryHandles;
+		uint16_t m_numFreeDrawListHandles;
 		DynamicIndexBufferHandle  m_freeDynamicIndexBufferHandle[BGFX_CONFIG_MAX_DYNAMIC_INDEX_BUFFERS];
 		DynamicVertexBufferHandle m_freeDynamicVertexBufferHandle[BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS];
 		OcclusionQueryHandle      m_freeOcclusionQueryHandle[BGFX_CONFIG_MAX_OCCLUSION_QUERIES];
+		DrawListHandle            m_freeDrawListHandle[BGFX_CONFIG_MAX_DRAW_LISTS];
 
 		NonLocalAllocator m_dynIndexBufferAllocator;
 		bx::HandleAllocT<BGFX_CONFIG_MAX_DYNAMIC_INDEX_BUFFERS> m_dynamicIndexBufferHandle;
@@ -6900,6 +8144,9 @@ namespace bgfx
 		bx::HandleAllocT<BGFX_CONFIG_MAX_FRAME_BUFFERS> m_frameBufferHandle;
 		bx::HandleAllocT<BGFX_CONFIG_MAX_UNIFORMS> m_uniformHandle;
 		bx::HandleAllocT<BGFX_CONFIG_MAX_OCCLUSION_QUERIES> m_occlusionQueryHandle;
+		bx::HandleAllocT<BGFX_CONFIG_MAX_DRAW_LISTS> m_drawListHandle;
+
+		DrawList* m_drawList[BGFX_CONFIG_MAX_DRAW_LISTS];
 
 		typedef bx::HandleHashMapT<BGFX_CONFIG_MAX_UNIFORMS*2> UniformHashMap;
 		UniformHashMap m_uniformHashMap;
@@ -6934,13 +8181,16 @@ namespace bgfx
 
 		int64_t m_rtMemoryUsed;
 		int64_t m_textureMemoryUsed;
+		int64_t m_textureMemoryResident;
 
 		TextVideoMemBlitter m_textVideoMemBlitter;
 		ClearQuad m_clearQuad;
 		MipGen m_mipGen;
 		VideoDecode m_videoDecode;
+		TransformBuffer m_transformBuffer;
 
 		RendererContextI* m_renderCtx;
+		FrameReplay* m_frameReplay; //!< Owned by render thread.
 
 		bool m_headless;
 		bool m_rendererInitialized;
@@ -838,12 +838,23 @@ uniform mat4 u_proj;
 uniform mat4 u_invProj;
 uniform mat4 u_viewProj;
 uniform mat4 u_invViewProj;
+
+#if BGFX_SHADER_TYPE_VERTEX && BGFX_SHADER_INSTANCED
+// Instanced variant generated with `shaderc --instanced`. Model matrix is read
+// from instance data i_data0-3 into bgfx_instanceModel at the top of main(),
+// u_invModelView is not available.
+#	define u_modelView     mul(u_view, bgfx_instanceModel[0])
+#	define u_modelViewProj mul(u_viewProj, bgfx_instanceModel[0])
+#	define u_model         bgfx_instanceModel
+#else
 uniform mat4 u_modelView;
 uniform mat4 u_invModelView;
 uniform mat4 u_modelViewProj;
+uniform mat4 u_model[BGFX_CONFIG_MAX_BONES];
+#endif // BGFX_SHADER_TYPE_VERTEX && BGFX_SHADER_INSTANCED
+
 uniform vec4 u_alphaRef4;
 #define u_alphaRef u_alphaRef4.x
-uniform mat4 u_model[BGFX_CONFIG_MAX_BONES];
 
 #if BGFX_SHADER_LANGUAGE_GLSL
 uniform vec4 bgfx_ndc;
@@ -0,0 +1,1096 @@
+/*
+ * Copyright 2011-2026 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "bgfx_p.h"
+
+#if BGFX_CONFIG_CAPTURE
+
+#include <bx/file.h>
+
+namespace bgfx
+{
+	static constexpr uint32_t kCaptureMagic   = BX_MAKEFOURCC('B', 'G', 'F', 'C');
+	static constexpr uint32_t kCaptureVersion = 2;
+
+	// Frame data is stored as is, capture can be replayed only by bgfx built with the same
+	// configuration.
+	static const uint32_t s_captureLayout[] =
+	{
+		BGFX_CONFIG_MAX_VIEWS,
+		BGFX_CONFIG_MAX_OCCLUSION_QUERIES,
+		BGFX_CONFIG_MAX_COLOR_PALETTE,
+		sizeof(View),
+		sizeof(RenderItem),
+		sizeof(RenderBind),
+		sizeof(BlitItem),
+		sizeof(RenderItemCount),
+		sizeof(Matrix4),
+	};
+
+	struct CaptureLog
+	{
+		CaptureLog()
+			: m_data(NULL)
+			, m_size(0)
+			, m_capacity(0)
+		{
+		}
+
+		~CaptureLog()
+		{
+			bx::free(g_allocator, m_data);
+		}
+
+		void write(const void* _data, uint32_t _size)
+		{
+			if (m_size + _size > m_capacity)
+			{
+				m_capacity = bx::max(m_size + _size, m_capacity*2, uint32_t(64<<10) );
+				m_data     = (uint8_t*)bx::realloc(g_allocator, m_data, m_capacity);
+			}
+
+			bx::memCopy(&m_data[m_size], _data, _size);
+			m_size += _size;
+		}
+
+		template<typename Ty>
+		void write(const Ty& _value)
+		{
+			write(&_value, sizeof(Ty) );
+		}
+
+		uint8_t* m_data;
+		uint32_t m_size;
+		uint32_t m_capacity;
+	};
+
+	struct CaptureReader
+	{
+		CaptureReader(const uint8_t* _data, uint32_t _size)
+			: m_data(_data)
+			, m_size(_size)
+			, m_pos(0)
+			, m_ok(true)
+		{
+		}
+
+		const uint8_t* skip(uint32_t _size)
+		{
+			if (!m_ok
+			||  _size > m_size - m_pos)
+			{
+				m_ok = false;
+				return NULL;
+			}
+
+			const uint8_t* result = &m_data[m_pos];
+			m_pos += _size;
+
+			return result;
+		}
+
+		void read(void* _data, uint32_t _size)
+		{
+			const uint8_t* data = skip(_size);
+
+			if (NULL != data)
+			{
+				bx::memCopy(_data, data, _size);
+			}
+			else
+			{
+				bx::memSet(_data, 0, _size);
+			}
+		}
+
+		template<typename Ty>
+		Ty read()
+		{
+			Ty value;
+			read(&value, sizeof(Ty) );
+			return value;
+		}
+
+		const uint8_t* m_data;
+		uint32_t       m_size;
+		uint32_t       m_pos;
+		bool           m_ok;
+	};
+
+	struct CaptureContext
+	{
+		CaptureLog m_log;
+		uint32_t   m_frameNum;
+	};
+
+	struct FrameReplay
+	{
+		FrameReplay()
+		{
+			bx::memSet(m_windowFrameBuffer, 0, sizeof(m_windowFrameBuffer) );
+			bx::memSet(&m_transientVb, 0, sizeof(m_transientVb) );
+			bx::memSet(&m_transientIb, 0, sizeof(m_transientIb) );
+		}
+
+		Frame                 m_frame;
+		CommandBuffer         m_cmdbuf;
+		TransientVertexBuffer m_transientVb;
+		TransientIndexBuffer  m_transientIb;
+		bool                  m_windowFrameBuffer[BGFX_CONFIG_MAX_FRAME_BUFFERS];
+	};
+
+	static CaptureContext* s_capture = NULL;
+
+	// Reads command from command buffer, and writes it into capture log with memory contents
+	// stored inline.
+	struct CaptureCommandWriter
+	{
+		CaptureCommandWriter(CommandBuffer& _cmdbuf, CaptureLog& _log)
+			: m_cmdbuf(_cmdbuf)
+			, m_log(_log)
+			, m_discard(false)
+		{
+		}
+
+		template<typename Ty>
+		Ty value()
+		{
+			Ty val;
+			m_cmdbuf.read(val);
+			m_log.write(val);
+			return val;
+		}
+
+		void bytes(uint32_t _size)
+		{
+			m_log.write(m_cmdbuf.skip(_size), _size);
+		}
+
+		void memory()
+		{
+			const Memory* mem;
+			m_cmdbuf.read(mem);
+			writeMemory(mem);
+		}
+
+		void textureMemory()
+		{
+			const Memory* mem;
+			m_cmdbuf.read(mem);
+
+			bx::MemoryReader reader(mem->data, mem->size);
+			bx::Error err;
+
+			uint32_t magic = 0;
+			bx::read(&reader, magic, &err);
+
+			const bool textureCreate = kChunkMagicTex == magic;
+			m_log.write(textureCreate);
+
+			if (textureCreate)
+			{
+				TextureCreate tc;
+				bx::read(&reader, tc, &err);
+
+				m_log.write(tc);
+				writeMemory(tc.m_mem);
+			}
+			else
+			{
+				writeMemory(mem);
+			}
+		}
+
+		void nativeHandle()
+		{
+			value<uint64_t>();
+		}
+
+		void windowFrameBuffer(FrameBufferHandle /*_handle*/)
+		{
+		}
+
+		void destroyFrameBuffer(FrameBufferHandle /*_handle*/)
+		{
+		}
+
+		void discard()
+		{
+			m_discard = true;
+		}
+
+		void writeMemory(const Memory* _mem)
+		{
+			if (NULL == _mem)
+			{
+				m_log.write(UINT32_MAX);
+			}
+			else
+			{
+				m_log.write(_mem->size);
+				m_log.write(_mem->data, _mem->size);
+			}
+		}
+
+		CommandBuffer& m_cmdbuf;
+		CaptureLog&    m_log;
+		bool           m_discard;
+	};
+
+	// Reads command from capture log, and writes it into command buffer.
+	struct CaptureCommandReader
+	{
+		CaptureCommandReader(CaptureReader& _reader, FrameReplay& _replay)
+			: m_reader(_reader)
+			, m_replay(_replay)
+			, m_discard(false)
+		{
+		}
+
+		template<typename Ty>
+		Ty value()
+		{
+			const Ty val = m_reader.read<Ty>();
+			m_replay.m_cmdbuf.write(val);
+			return val;
+		}
+
+		void bytes(uint32_t _size)
+		{
+			const uint8_t* data = m_reader.skip(_size);
+
+			if (NULL != data)
+			{
+				m_replay.m_cmdbuf.write(data, _size);
+			}
+		}
+
+		void memory()
+		{
+			m_replay.m_cmdbuf.write(readMemory() );
+		}
+
+		void textureMemory()
+		{
+			if (m_reader.read<bool>() )
+			{
+				TextureCreate tc = m_reader.read<TextureCreate>();
+				tc.m_mem = readMemory();
+
+				const Memory* mem = alloc(sizeof(uint32_t) + sizeof(TextureCreate) );
+				bx::StaticMemoryBlockWriter writer(mem->data, mem->size);
+				bx::write(&writer, kChunkMagicTex, bx::ErrorAssert{});
+				bx::write(&writer, tc, bx::ErrorAssert{});
+
+				m_replay.m_cmdbuf.write(mem);
+			}
+			else
+			{
+				memory();
+			}
+		}
+
+		void nativeHandle()
+		{
+			// Native textures of capturing application are not available, create regular texture instead.
+			m_reader.read<uint64_t>();
+			m_replay.m_cmdbuf.write(uint64_t(0) );
+		}
+
+		void windowFrameBuffer(FrameBufferHandle _handle)
+		{
+			// Window is not available, views rendering into window frame buffer will render into
+			// back buffer instead.
+			m_replay.m_windowFrameBuffer[_handle.idx] = true;
+			discard();
+		}
+
+		void destroyFrameBuffer(FrameBufferHandle _handle)
+		{
+			if (m_replay.m_windowFrameBuffer[_handle.idx])
+			{
+				m_replay.m_windowFrameBuffer[_handle.idx] = false;
+				discard();
+			}
+		}
+
+		void discard()
+		{
+			m_discard = true;
+		}
+
+		const Memory* readMemory()
+		{
+			const uint32_t size = m_reader.read<uint32_t>();
+
+			if (UINT32_MAX == size)
+			{
+				return NULL;
+			}
+
+			const uint8_t* data = m_reader.skip(size);
+
+			const Memory* mem = alloc(NULL == data ? 0 : size);
+			bx::memCopy(mem->data, data, mem->size);
+
+			return mem;
+		}
+
+		CaptureReader& m_reader;
+		FrameReplay&   m_replay;
+		bool           m_discard;
+	};
+
+	// Visits fields of resource command in the same order as `Context::rendererExecCommands`
+	// reads them. Returns false when command buffer end is reached.
+	template<typename VisitorT>
+	static bool visitCommand(VisitorT& _visitor, uint8_t _command)
+	{
+		switch (_command)
+		{
+		case CommandBuffer::RendererInit:
+			_visitor.template value<Init>();
+			_visitor.discard();
+			break;
+
+		case CommandBuffer::RendererShutdownBegin:
+			_visitor.discard();
+			break;
+
+		case CommandBuffer::RendererShutdownEnd:
+		case CommandBuffer::End:
+			return false;
+
+		case CommandBuffer::CreateVertexLayout:
+			_visitor.template value<VertexLayoutHandle>();
+			_visitor.template value<VertexLayout>();
+			break;
+
+		case CommandBuffer::CreateIndexBuffer:
+			_visitor.template value<IndexBufferHandle>();
+			_visitor.memory();
+			_visitor.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::CreateVertexBuffer:
+			_visitor.template value<VertexBufferHandle>();
+			_visitor.memory();
+			_visitor.template value<VertexLayoutHandle>();
+			_visitor.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::CreateDynamicIndexBuffer:
+			_visitor.template value<IndexBufferHandle>();
+			_visitor.template value<uint32_t>();
+			_visitor.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::UpdateDynamicIndexBuffer:
+			_visitor.template value<IndexBufferHandle>();
+			_visitor.template value<uint32_t>();
+			_visitor.template value<uint32_t>();
+			_visitor.memory();
+			break;
+
+		case CommandBuffer::CreateDynamicVertexBuffer:
+			_visitor.template value<VertexBufferHandle>();
+			_visitor.template value<uint32_t>();
+			_visitor.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::UpdateDynamicVertexBuffer:
+			_visitor.template value<VertexBufferHandle>();
+			_visitor.template value<uint32_t>();
+			_visitor.template value<uint32_t>();
+			_visitor.memory();
+			break;
+
+		case CommandBuffer::CreateShader:
+			_visitor.template value<ShaderHandle>();
+			_visitor.memory();
+			break;
+
+		case CommandBuffer::CreateProgram:
+			_visitor.template value<ProgramHandle>();
+			_visitor.template value<ShaderHandle>();
+			_visitor.template value<ShaderHandle>();
+			break;
+
+		case CommandBuffer::CreateTexture:
+			_visitor.template value<TextureHandle>();
+			_visitor.textureMemory();
+			_visitor.template value<uint64_t>();
+			_visitor.template value<uint8_t>();
+			_visitor.nativeHandle();
+			break;
+
+		case CommandBuffer::UpdateTexture:
+			_visitor.template value<TextureHandle>();
+			_visitor.template value<uint8_t>();
+			_visitor.template value<uint8_t>();
+			_visitor.template value<Rect>();
+			_visitor.template value<uint16_t>();
+			_visitor.template value<uint16_t>();
+			_visitor.template value<uint16_t>();
+			_visitor.memory();
+			break;
+
+		case CommandBuffer::ClearTexture:
+			_visitor.template value<TextureHandle>();
+			_visitor.template value<uint8_t>();
+			_visitor.template value<uint8_t>();
+			_visitor.template value<uint16_t>();
+			_visitor.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::ReadTexture:
+			// Destination memory belongs to capturing application.
+			_visitor.template value<TextureHandle>();
+			_visitor.template value<void*>();
+			_visitor.template value<uint16_t>();
+			_visitor.template value<uint8_t>();
+			_visitor.discard();
+			break;
+
+		case CommandBuffer::ResizeTexture:
+			_visitor.template value<TextureHandle>();
+			_visitor.template value<uint16_t>();
+			_visitor.template value<uint16_t>();
+			_visitor.template value<uint8_t>();
+			_visitor.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::SetTextureMinLod:
+			_visitor.template value<TextureHandle>();
+			_visitor.template value<uint8_t>();
+			break;
+
+		case CommandBuffer::CreateFrameBuffer:
+			{
+				const FrameBufferHandle handle = _visitor.template value<FrameBufferHandle>();
+
+				if (_visitor.template value<bool>() )
+				{
+					_visitor.template value<void*>();
+					_visitor.template value<uint16_t>();
+					_visitor.template value<uint16_t>();
+					_visitor.template value<TextureFormat::Enum>();
+					_visitor.template value<TextureFormat::Enum>();
+					_visitor.windowFrameBuffer(handle);
+				}
+				else
+				{
+					const uint8_t num = _visitor.template value<uint8_t>();
+					_visitor.bytes(sizeof(Attachment) * num);
+				}
+			}
+			break;
+
+		case CommandBuffer::CreateUniform:
+			{
+				_visitor.template value<UniformHandle>();
+				_visitor.template value<UniformType::Enum>();
+				_visitor.template value<uint16_t>();
+				const uint8_t len = _visitor.template value<uint8_t>();
+				_visitor.bytes(len);
+			}
+			break;
+
+		case CommandBuffer::UpdateViewName:
+			{
+				_visitor.template value<ViewId>();
+				const uint16_t len = _visitor.template value<uint16_t>();
+				_visitor.bytes(len);
+			}
+			break;
+
+		case CommandBuffer::InvalidateOcclusionQuery:
+			_visitor.template value<OcclusionQueryHandle>();
+			break;
+
+		case CommandBuffer::SetName:
+			{
+				_visitor.template value<Handle>();
+				const uint16_t len = _visitor.template value<uint16_t>();
+				_visitor.bytes(len);
+			}
+			break;
+
+		case CommandBuffer::SetInstancedProgram:
+			_visitor.template value<ProgramHandle>();
+			_visitor.template value<ProgramHandle>();
+			break;
+
+		case CommandBuffer::DestroyVertexLayout:
+			_visitor.template value<VertexLayoutHandle>();
+			break;
+
+		case CommandBuffer::DestroyIndexBuffer:
+		case CommandBuffer::DestroyDynamicIndexBuffer:
+			_visitor.template value<IndexBufferHandle>();
+			break;
+
+		case CommandBuffer::DestroyVertexBuffer:
+		case CommandBuffer::DestroyDynamicVertexBuffer:
+			_visitor.template value<VertexBufferHandle>();
+			break;
+
+		case CommandBuffer::DestroyShader:
+			_visitor.template value<ShaderHandle>();
+			break;
+
+		case CommandBuffer::DestroyProgram:
+			_visitor.template value<ProgramHandle>();
+			break;
+
+		case CommandBuffer::DestroyTexture:
+			_visitor.template value<TextureHandle>();
+			break;
+
+		case CommandBuffer::DestroyFrameBuffer:
+			_visitor.destroyFrameBuffer(_visitor.template value<FrameBufferHandle>() );
+			break;
+
+		case CommandBuffer::DestroyUniform:
+			_visitor.template value<UniformHandle>();
+			break;
+
+		default:
+			BX_ASSERT(false, "Invalid command: %d", _command);
+			return false;
+		}
+
+		return true;
+	}
+
+	void captureInit(uint32_t _frameNum)
+	{
+		CaptureContext* capture = BX_NEW(g_allocator, CaptureContext);
+		capture->m_frameNum = _frameNum;
+
+		s_capture = capture;
+	}
+
+	void captureShutdown()
+	{
+		CaptureContext* capture = s_capture;
+		s_capture = NULL;
+
+		if (NULL != capture)
+		{
+			bx::deleteObject(g_allocator, capture);
+		}
+	}
+
+	void captureCommands(uint32_t _frameNum, CommandBuffer& _cmdbuf)
+	{
+		CaptureContext* capture = s_capture;
+
+		if (NULL == capture
+		||  _frameNum < capture->m_frameNum)
+		{
+			return;
+		}
+
+		BGFX_PROFILER_SCOPE("bgfx/Capture commands", kColorResource);
+
+		CaptureLog& log = capture->m_log;
+		CaptureCommandWriter writer(_cmdbuf, log);
+
+		_cmdbuf.reset();
+
+		for (bool more = true; more;)
+		{
+			uint8_t command;
+			_cmdbuf.read(command);
+
+			const uint32_t pos = log.m_size;
+			log.write(command);
+
+			writer.m_discard = false;
+			more = visitCommand(writer, command);
+
+			if (writer.m_discard
+			||  !more)
+			{
+				log.m_size = pos;
+			}
+		}
+	}
+
+	static void writeFrame(bx::WriterI* _writer, const Frame* _frame, bx::Error* _err)
+	{
+		bx::write(_writer, _frame->m_viewRemap,    int32_t(sizeof(_frame->m_viewRemap) ),    _err);
+		bx::write(_writer, _frame->m_viewOrder,    int32_t(sizeof(_frame->m_viewOrder) ),    _err);
+		bx::write(_writer, _frame->m_colorPalette, int32_t(sizeof(_frame->m_colorPalette) ), _err);
+		bx::write(_writer, _frame->m_view,         int32_t(sizeof(_frame->m_view) ),         _err);
+		bx::write(_writer, _frame->m_occlusion,    int32_t(sizeof(_frame->m_occlusion) ),    _err);
+
+		// Merged instances leave sort values pointing past number of render items.
+		const uint32_t numRenderItems = _frame->m_numRenderItems;
+		uint32_t numItems = 0;
+		for (uint32_t ii = 0; ii < numRenderItems; ++ii)
+		{
+			numItems = bx::max<uint32_t>(numItems, _frame->m_sortValues[ii]+1);
+		}
+
+		bx::write(_writer, numRenderItems, _err);
+		bx::write(_writer, _frame->m_sortKeys,   int32_t(sizeof(uint64_t)       *numRenderItems), _err);
+		bx::write(_writer, _frame->m_sortValues, int32_t(sizeof(RenderItemCount)*numRenderItems), _err);
+
+		bx::write(_writer, numItems, _err);
+		for (uint32_t ii = 0; ii < numItems; ++ii)
+		{
+			bx::write(_writer, _frame->m_renderItem[ii], _err);
+		}
+
+		bx::write(_writer, _frame->m_numRenderBinds, _err);
+		for (uint32_t ii = 0, num = _frame->m_numRenderBinds; ii < num; ++ii)
+		{
+			bx::write(_writer, _frame->m_renderBind[ii], _err);
+		}
+
+		bx::write(_writer, _frame->m_numBlitItems, _err);
+		bx::write(_writer, _frame->m_blitKeys, int32_t(sizeof(uint32_t)*_frame->m_numBlitItems), _err);
+		for (uint32_t ii = 0, num = _frame->m_numBlitItems; ii < num; ++ii)
+		{
+			bx::write(_writer, _frame->m_blitItem[ii], _err);
+		}
+
+		const MatrixCache& matrixCache = _frame->m_frameCache.m_matrixCache;
+		bx::write(_writer, matrixCache.m_num, _err);
+		bx::write(_writer, matrixCache.m_cache, int32_t(sizeof(Matrix4)*matrixCache.m_num), _err);
+
+		const RectCache& rectCache = _frame->m_frameCache.m_rectCache;
+		bx::write(_writer, rectCache.m_num, _err);
+		for (uint32_t ii = 0, num = rectCache.m_num; ii < num; ++ii)
+		{
+			bx::write(_writer, rectCache.m_cache[ii], _err);
+		}
+
+		const uint32_t numEncoders = g_caps.limits.maxEncoders;
+		bx::write(_writer, numEncoders, _err);
+		for (uint32_t ii = 0; ii < numEncoders; ++ii)
+		{
+			const UniformBuffer* uniformBuffer = _frame->m_uniformBuffer[ii];
+			const uint32_t size = NULL == uniformBuffer ? 0 : uniformBuffer->getHwm();
+
+			bx::write(_writer, size, _err);
+
+			if (0 < size)
+			{
+				bx::write(_writer, uniformBuffer->toPtr(0), int32_t(size), _err);
+			}
+		}
+
+		const UniformCacheFrame& uniformCacheFrame = _frame->m_uniformCacheFrame;
+		uint32_t dataSize = 0;
+		for (uint32_t ii = 0, num = uniformCacheFrame.m_numItems; ii < num; ++ii)
+		{
+			UniformCacheKey key;
+			key.decode(uniformCacheFrame.m_keys[ii]);
+			dataSize = bx::max<uint32_t>(dataSize, key.m_offset + key.m_size);
+		}
+
+		bx::write(_writer, uniformCacheFrame.m_numItems, _err);
+		bx::write(_writer, uniformCacheFrame.m_keys, int32_t(sizeof(uint64_t)*(uniformCacheFrame.m_numItems+1) ), _err);
+		bx::write(_writer, dataSize, _err);
+		bx::write(_writer, uniformCacheFrame.m_data, int32_t(dataSize), _err);
+
+		const TransientVertexBuffer* tvb = _frame->m_transientVb;
+		const uint32_t vboffset = NULL == tvb ? 0 : _frame->m_vboffset;
+		bx::write(_writer, NULL == tvb ? VertexBufferHandle(BGFX_INVALID_HANDLE) : tvb->handle, _err);
+		bx::write(_writer, vboffset, _err);
+		bx::write(_writer, NULL == tvb ? NULL : tvb->data, int32_t(vboffset), _err);
+
+		const TransientIndexBuffer* tib = _frame->m_transientIb;
+		const uint32_t iboffset = NULL == tib ? 0 : _frame->m_iboffset;
+		bx::write(_writer, NULL == tib ? IndexBufferHandle(BGFX_INVALID_HANDLE) : tib->handle, _err);
+		bx::write(_writer, iboffset, _err);
+		bx::write(_writer, NULL == tib ? NULL : tib->data, int32_t(iboffset), _err);
+	}
+
+	bool captureFrame(const Frame* _frame, const char* _filePath)
+	{
+		CaptureContext* capture = s_capture;
+
+		if (NULL == capture
+		||  _frame->m_frameNum < capture->m_frameNum)
+		{
+			BX_TRACE("Frame capture: Resource commands are not recorded for frame %d.", _frame->m_frameNum);
+			return false;
+		}
+
+		BGFX_PROFILER_SCOPE("bgfx/Capture frame", kColorResource);
+
+		bx::FileWriter writer;
+		if (!bx::open(&writer, _filePath) )
+		{
+			BX_TRACE("Frame capture: Failed to open file %s.", _filePath);
+			return false;
+		}
+
+		const CaptureLog& log = capture->m_log;
+		const uint8_t end = CommandBuffer::End;
+
+		bx::Error err;
+		bx::write(&writer, kCaptureMagic, &err);
+		bx::write(&writer, kCaptureVersion, &err);
+		bx::write(&writer, s_captureLayout, int32_t(sizeof(s_captureLayout) ), &err);
+		bx::write(&writer, uint8_t(g_caps.rendererType), &err);
+
+		bx::write(&writer, log.m_size + 1, &err);
+		bx::write(&writer, log.m_data, int32_t(log.m_size), &err);
+		bx::write(&writer, end, &err);
+
+		writeFrame(&writer, _frame, &err);
+
+		bx::close(&writer);
+
+		BX_TRACE("Frame capture: Frame %d saved to %s (%d bytes of resource commands)."
+			, _frame->m_frameNum
+			, _filePath
+			, log.m_size
+			);
+
+		return err.isOk();
+	}
+
+	static bool readCommands(CaptureReader& _reader, FrameReplay& _replay)
+	{
+		const uint32_t size = _reader.read<uint32_t>();
+		const uint8_t* data = _reader.skip(size);
+
+		if (NULL == data)
+		{
+			return false;
+		}
+
+		CaptureReader reader(data, size);
+		CaptureCommandReader commandReader(reader, _replay);
+
+		CommandBuffer& cmdbuf = _replay.m_cmdbuf;
+		cmdbuf.start();
+
+		for (bool more = true; more && reader.m_ok;)
+		{
+			const uint8_t command = reader.read<uint8_t>();
+
+			const uint32_t pos = cmdbuf.m_pos;
+			cmdbuf.write(command);
+
+			commandReader.m_discard = false;
+			more = visitCommand(commandReader, command);
+
+			if (commandReader.m_discard
+			||  !more)
+			{
+				cmdbuf.m_pos = pos;
+			}
+		}
+
+		cmdbuf.finish();
+
+		return reader.m_ok;
+	}
+
+	static bool readFrame(CaptureReader& _reader, FrameReplay& _replay)
+	{
+		Frame& frame = _replay.m_frame;
+
+		_reader.read(frame.m_viewRemap,    sizeof(frame.m_viewRemap)    );
+		_reader.read(frame.m_viewOrder,    sizeof(frame.m_viewOrder)    );
+		_reader.read(frame.m_colorPalette, sizeof(frame.m_colorPalette) );
+		_reader.read(frame.m_view,         sizeof(frame.m_view)         );
+		_reader.read(frame.m_occlusion,    sizeof(frame.m_occlusion)    );
+
+		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+		{
+			View& view = frame.m_view[ii];
+
+			if (isValid(view.m_fbh)
+			&&  _replay.m_windowFrameBuffer[view.m_fbh.idx])
+			{
+				view.m_fbh = BGFX_INVALID_HANDLE;
+			}
+		}
+
+		const uint32_t numRenderItems = _reader.read<uint32_t>();
+		if (numRenderItems > frame.m_maxDrawCalls)
+		{
+			BX_TRACE("Frame capture: Too many render items %d (max: %d).", numRenderItems, frame.m_maxDrawCalls);
+			return false;
+		}
+
+		frame.m_numRenderItems = numRenderItems;
+		_reader.read(frame.m_sortKeys,   sizeof(uint64_t)       *numRenderItems);
+		_reader.read(frame.m_sortValues, sizeof(RenderItemCount)*numRenderItems);
+
+		const uint32_t numItems = _reader.read<uint32_t>();
+		if (numItems > frame.m_maxDrawCalls)
+		{
+			return false;
+		}
+
+		for (uint32_t ii = 0; ii < numItems; ++ii)
+		{
+			_reader.read(&frame.m_renderItem[ii], sizeof(RenderItem) );
+		}
+
+		const uint32_t numRenderBinds = _reader.read<uint32_t>();
+		if (numRenderBinds > frame.m_maxDrawCalls)
+		{
+			return false;
+		}
+
+		frame.m_numRenderBinds = numRenderBinds;
+		for (uint32_t ii = 0; ii < numRenderBinds; ++ii)
+		{
+			_reader.read(&frame.m_renderBind[ii], sizeof(RenderBind) );
+		}
+
+		const uint32_t numBlitItems = _reader.read<uint32_t>();
+		if (numBlitItems > BGFX_CONFIG_MAX_BLIT_ITEMS)
+		{
+			return false;
+		}
+
+		frame.m_numBlitItems = numBlitItems;
+		frame.reserveBlitKeys(numBlitItems);
+		_reader.read(frame.m_blitKeys, sizeof(uint32_t)*numBlitItems);
+		for (uint32_t ii = 0; ii < numBlitItems; ++ii)
+		{
+			_reader.read(&frame.m_blitItem[ii], sizeof(BlitItem) );
+		}
+
+		MatrixCache& matrixCache = frame.m_frameCache.m_matrixCache;
+		const uint32_t numMatrices = _reader.read<uint32_t>();
+		if (numMatrices > matrixCache.m_capacity)
+		{
+			BX_TRACE("Frame capture: Too many matrices %d (max: %d).", numMatrices, matrixCache.m_capacity);
+			return false;
+		}
+
+		if (numMatrices > matrixCache.m_max)
+		{
+			matrixCache.resize(numMatrices);
+		}
+
+		matrixCache.m_num = numMatrices;
+		_reader.read(matrixCache.m_cache, sizeof(Matrix4)*numMatrices);
+
+		RectCache& rectCache = frame.m_frameCache.m_rectCache;
+		const uint32_t numRects = _reader.read<uint32_t>();
+		if (numRects > rectCache.m_max)
+		{
+			return false;
+		}
+
+		rectCache.m_num = numRects;
+		for (uint32_t ii = 0; ii < numRects; ++ii)
+		{
+			_reader.read(&rectCache.m_cache[ii], sizeof(Rect) );
+		}
+
+		const uint32_t numEncoders = _reader.read<uint32_t>();
+		if (numEncoders > g_caps.limits.maxEncoders)
+		{
+			BX_TRACE("Frame capture: Too many encoders %d (max: %d).", numEncoders, g_caps.limits.maxEncoders);
+			return false;
+		}
+
+		for (uint32_t ii = 0; ii < numEncoders; ++ii)
+		{
+			const uint32_t size = _reader.read<uint32_t>();
+
+			if (0 < size)
+			{
+				const uint8_t* data = _reader.skip(size);
+
+				if (NULL == data)
+				{
+					return false;
+				}
+
+				UniformBuffer*& uniformBuffer = frame.m_uniformBuffer[ii];
+				uniformBuffer = UniformBuffer::create(size + 16);
+				uniformBuffer->write(data, size);
+				uniformBuffer->reset();
+			}
+		}
+
+		UniformCacheFrame& uniformCacheFrame = frame.m_uniformCacheFrame;
+		const uint32_t numUniformItems = _reader.read<uint32_t>();
+		const uint8_t* keys = _reader.skip(sizeof(uint64_t)*(numUniformItems+1) );
+		const uint32_t dataSize = _reader.read<uint32_t>();
+		const uint8_t* data = _reader.skip(dataSize);
+
+		if (NULL == keys
+		||  NULL == data)
+		{
+			return false;
+		}
+
+		uniformCacheFrame.resize(numUniformItems, dataSize);
+		uniformCacheFrame.m_numItems = numUniformItems;
+		bx::memCopy(uniformCacheFrame.m_keys, keys, sizeof(uint64_t)*(numUniformItems+1) );
+		bx::memCopy(uniformCacheFrame.m_data, data, dataSize);
+
+		// Transient buffers are created by bgfx during init, and they have the same handles when
+		// capture is replayed by the same bgfx configuration.
+		TransientVertexBuffer& tvb = _replay.m_transientVb;
+		tvb.handle = _reader.read<VertexBufferHandle>();
+		tvb.size   = _reader.read<uint32_t>();
+
+		if (tvb.size > g_caps.limits.maxTransientVbSize)
+		{
+			return false;
+		}
+
+		tvb.data = (uint8_t*)bx::alloc(g_allocator, tvb.size);
+		tvb.layoutHandle = BGFX_INVALID_HANDLE;
+		_reader.read(tvb.data, tvb.size);
+
+		TransientIndexBuffer& tib = _replay.m_transientIb;
+		tib.handle = _reader.read<IndexBufferHandle>();
+		tib.size   = _reader.read<uint32_t>();
+
+		if (tib.size > g_caps.limits.maxTransientIbSize)
+		{
+			return false;
+		}
+
+		tib.data = (uint8_t*)bx::alloc(g_allocator, tib.size);
+		_reader.read(tib.data, tib.size);
+
+		frame.m_transientVb = &tvb;
+		frame.m_vboffset    = tvb.size;
+		frame.m_transientIb = &tib;
+		frame.m_iboffset    = tib.size;
+
+		// Frame is already sorted.
+		frame.m_replay = true;
+
+		return _reader.m_ok;
+	}
+
+	FrameReplay* captureLoad(const char* _filePath)
+	{
+		bx::FileReader fileReader;
+		if (!bx::open(&fileReader, _filePath) )
+		{
+			BX_TRACE("Frame capture: Failed to open file %s.", _filePath);
+			return NULL;
+		}
+
+		const uint32_t size = uint32_t(bx::getSize(&fileReader) );
+		uint8_t* data = (uint8_t*)bx::alloc(g_allocator, size);
+
+		bx::Error err;
+		bx::read(&fileReader, data, int32_t(size), &err);
+		bx::close(&fileReader);
+
+		CaptureReader reader(data, size);
+
+		const uint32_t magic   = reader.read<uint32_t>();
+		const uint32_t version = reader.read<uint32_t>();
+
+		uint32_t layout[BX_COUNTOF(s_captureLayout)];
+		reader.read(layout, sizeof(layout) );
+
+		const RendererType::Enum rendererType = RendererType::Enum(reader.read<uint8_t>() );
+
+		const bool valid = true
+			&& err.isOk()
+			&& reader.m_ok
+			&& kCaptureMagic   == magic
+			&& kCaptureVersion == version
+			&& 0 == bx::memCmp(layout, s_captureLayout, sizeof(layout) )
+			&& RendererType::Count > rendererType
+			;
+
+		FrameReplay* replay = NULL;
+
+		if (!valid)
+		{
+			BX_TRACE("Frame capture: File %s is not frame capture, or it's captured by different bgfx configuration.", _filePath);
+		}
+		else
+		{
+			BX_WARN(rendererType == g_caps.rendererType
+				, "Frame capture: Captured with %s renderer, shaders might fail to load with %s renderer."
+				, getRendererName(rendererType)
+				, getRendererName(g_caps.rendererType)
+				);
+
+			replay = BX_ALIGNED_NEW(g_allocator, FrameReplay, BX_ALIGNOF(FrameReplay) );
+			replay->m_frame.create(0, 0, g_caps.limits.maxDrawCalls, 0);
+
+			if (!readCommands(reader, *replay)
+			||  !readFrame(reader, *replay) )
+			{
+				BX_TRACE("Frame capture: Failed to read %s.", _filePath);
+				captureUnload(replay);
+				replay = NULL;
+			}
+		}
+
+		bx::free(g_allocator, data);
+
+		return replay;
+	}
+
+	void captureUnload(FrameReplay* _replay)
+	{
+		if (NULL != _replay)
+		{
+			bx::free(g_allocator, _replay->m_transientVb.data);
+			bx::free(g_allocator, _replay->m_transientIb.data);
+
+			_replay->m_frame.destroy();
+			bx::deleteObject(g_allocator, _replay, BX_ALIGNOF(FrameReplay) );
+		}
+	}
+
+	CommandBuffer* captureGetCommands(FrameReplay* _replay)
+	{
+		return &_replay->m_cmdbuf;
+	}
+
+	Frame* captureReplayBegin(FrameReplay* _replay, const Frame* _render)
+	{
+		Frame& frame = _replay->m_frame;
+		frame.m_frameNum   = _render->m_frameNum;
+		frame.m_resolution = _render->m_resolution;
+		frame.m_debug      = _render->m_debug;
+		frame.m_capture    = _render->m_capture;
+		frame.m_flush      = _render->m_flush;
+
+		ViewStats*      viewStats      = frame.m_perfStats.viewStats;
+		GpuRegionStats* gpuRegionStats = frame.m_perfStats.gpuRegionStats;
+		frame.m_perfStats = _render->m_perfStats;
+		frame.m_perfStats.viewStats      = viewStats;
+		frame.m_perfStats.gpuRegionStats = gpuRegionStats;
+
+		return &frame;
+	}
+
+	void captureReplayEnd(FrameReplay* _replay, Frame* _render)
+	{
+		const Frame& frame = _replay->m_frame;
+
+		ViewStats*      viewStats      = _render->m_perfStats.viewStats;
+		GpuRegionStats* gpuRegionStats = _render->m_perfStats.gpuRegionStats;
+		_render->m_perfStats = frame.m_perfStats;
+		_render->m_perfStats.viewStats      = viewStats;
+		_render->m_perfStats.gpuRegionStats = gpuRegionStats;
+
+		bx::memCopy(viewStats, frame.m_viewStats, sizeof(ViewStats)*frame.m_perfStats.numViews);
+		bx::memCopy(gpuRegionStats, frame.m_gpuRegionStats, sizeof(GpuRegionStats)*frame.m_perfStats.numGpuRegions);
+	}
+
+} // namespace bgfx
+
+#endif // BGFX_CONFIG_CAPTURE
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2011-2026 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_CAPTURE_H_HEADER_GUARD
+#define BGFX_CAPTURE_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+#include "config.h"
+
+namespace bgfx
+{
+	class CommandBuffer;
+	struct Frame;
+	struct FrameReplay;
+
+#if BGFX_CONFIG_CAPTURE
+	/// Start recording resource commands of frame `_frameNum` and all frames after it.
+	void captureInit(uint32_t _frameNum);
+
+	///
+	void captureShutdown();
+
+	/// Record resource commands before they are executed. Called by render thread.
+	void captureCommands(uint32_t _frameNum, CommandBuffer& _cmdbuf);
+
+	/// Write all recorded resource commands, and sorted frame. Called by render thread.
+	bool captureFrame(const Frame* _frame, const char* _filePath);
+
+	/// Load frame capture. Returns NULL if file is not valid frame capture.
+	FrameReplay* captureLoad(const char* _filePath);
+
+	///
+	void captureUnload(FrameReplay* _replay);
+
+	/// Commands creating captured resources. Must be executed once before first replayed frame.
+	CommandBuffer* captureGetCommands(FrameReplay* _replay);
+
+	/// Returns captured frame to be rendered instead of `_render`.
+	Frame* captureReplayBegin(FrameReplay* _replay, const Frame* _render);
+
+	/// Copy stats of replayed frame into `_render`.
+	void captureReplayEnd(FrameReplay* _replay, Frame* _render);
+#else
+	inline void captureInit(uint32_t /*_frameNum*/) {}
+	inline void captureShutdown() {}
+	inline void captureCommands(uint32_t /*_frameNum*/, CommandBuffer& /*_cmdbuf*/) {}
+	inline bool captureFrame(const Frame* /*_frame*/, const char* /*_filePath*/) { return false; }
+	inline FrameReplay* captureLoad(const char* /*_filePath*/) { return NULL; }
+	inline void captureUnload(FrameReplay* /*_replay*/) {}
+	inline CommandBuffer* captureGetCommands(FrameReplay* /*_replay*/) { return NULL; }
+	inline Frame* captureReplayBegin(FrameReplay* /*_replay*/, const Frame* /*_render*/) { return NULL; }
+	inline void captureReplayEnd(FrameReplay* /*_replay*/, Frame* /*_render*/) {}
+#endif // BGFX_CONFIG_CAPTURE
+
+} // namespace bgfx
+
+#endif // BGFX_CAPTURE_H_HEADER_GUARD
@@ -397,6 +397,16 @@ static_assert(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS must
 #	define BGFX_CONFIG_MAX_VIEW_NAME 256
 #endif // BGFX_CONFIG_MAX_VIEW_NAME
 
+/// Maximum number of GPU timing regions per frame. Default is 256.
+#ifndef BGFX_CONFIG_MAX_GPU_REGIONS
+#	define BGFX_CONFIG_MAX_GPU_REGIONS 256
+#endif // BGFX_CONFIG_MAX_GPU_REGIONS
+
+/// Maximum nesting depth of GPU timing regions per encoder. Default is 16.
+#ifndef BGFX_CONFIG_MAX_GPU_REGION_DEPTH
+#	define BGFX_CONFIG_MAX_GPU_REGION_DEPTH 16
+#endif // BGFX_CONFIG_MAX_GPU_REGION_DEPTH
+
 /// Maximum number of vertex layout declarations. Default is 64.
 #ifndef BGFX_CONFIG_MAX_VERTEX_LAYOUTS
 #	define BGFX_CONFIG_MAX_VERTEX_LAYOUTS 64
@@ -428,18 +438,24 @@ static_assert(BGFX_CONFIG_MAX_VERTEX_STREAMS < 32, "Must be less than 32!");
 #	define BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS (4<<10)
 #endif // BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS
 
-/// Initial size in bytes of the dynamic index buffer backing store. Default is 1 MB.
-/// The backing store grows as needed via sub-allocation.
+/// Default size in bytes of the dynamic index buffer backing store page, see
+/// `Init::Limits::dynamicIndexBufferSize`. Default is 1 MB.
 #ifndef BGFX_CONFIG_DYNAMIC_INDEX_BUFFER_SIZE
 #	define BGFX_CONFIG_DYNAMIC_INDEX_BUFFER_SIZE (1<<20)
 #endif // BGFX_CONFIG_DYNAMIC_INDEX_BUFFER_SIZE
 
-/// Initial size in bytes of the dynamic vertex buffer backing store. Default is 3 MB.
-/// The backing store grows as needed via sub-allocation.
+/// Default size in bytes of the dynamic vertex buffer backing store page, see
+/// `Init::Limits::dynamicVertexBufferSize`. Default is 3 MB.
 #ifndef BGFX_CONFIG_DYNAMIC_VERTEX_BUFFER_SIZE
 #	define BGFX_CONFIG_DYNAMIC_VERTEX_BUFFER_SIZE (3<<20)
 #endif // BGFX_CONFIG_DYNAMIC_VERTEX_BUFFER_SIZE
 
+/// Default number of matrices in persistent transform buffer, see
+/// `Init::Limits::maxPersistentTransforms`. Default is 0 (disabled).
+#ifndef BGFX_CONFIG_MAX_PERSISTENT_TRANSFORMS
+#	define BGFX_CONFIG_MAX_PERSISTENT_TRANSFORMS 0
+#endif // BGFX_CONFIG_MAX_PERSISTENT_TRANSFORMS
+
 /// Maximum number of shader handles (vertex + fragment + compute). Default is 512.
 #ifndef BGFX_CONFIG_MAX_SHADERS
 #	define BGFX_CONFIG_MAX_SHADERS 512
@@ -455,6 +471,13 @@ static_assert(BGFX_CONFIG_MAX_VERTEX_STREAMS < 32, "Must be less than 32!");
 #	define BGFX_CONFIG_MAX_TEXTURE_SAMPLERS 16
 #endif // BGFX_CONFIG_MAX_TEXTURE_SAMPLERS
 
+/// Binding stage of persistent transform buffer, set with
+/// `bgfx::setPersistentTransform`. Must match `BGFX_TRANSFORM_BUFFER_STAGE`
+/// in shaders. Default is last texture sampler stage.
+#ifndef BGFX_CONFIG_TRANSFORM_BUFFER_STAGE
+#	define BGFX_CONFIG_TRANSFORM_BUFFER_STAGE (BGFX_CONFIG_MAX_TEXTURE_SAMPLERS-1)
+#endif // BGFX_CONFIG_TRANSFORM_BUFFER_STAGE
+
 /// Maximum number of frame buffer handles. Default is 128.
 #ifndef BGFX_CONFIG_MAX_FRAME_BUFFERS
 #	define BGFX_CONFIG_MAX_FRAME_BUFFERS 128
@@ -476,6 +499,11 @@ static_assert(BGFX_CONFIG_MAX_VERTEX_STREAMS < 32, "Must be less than 32!");
 #	define BGFX_CONFIG_MAX_OCCLUSION_QUERIES 256
 #endif // BGFX_CONFIG_MAX_OCCLUSION_QUERIES
 
+/// Maximum number of draw list handles. Default is 1024.
+#ifndef BGFX_CONFIG_MAX_DRAW_LISTS
+#	define BGFX_CONFIG_MAX_DRAW_LISTS (1<<10)
+#endif // BGFX_CONFIG_MAX_DRAW_LISTS
+
 /// Minimum initial size in bytes of the resource command buffer (pre/post
 /// render commands for resource creation and updates). Default is 64 KB.
 /// The buffer grows as needed.
@@ -495,6 +523,13 @@ static_assert(BGFX_CONFIG_MAX_VERTEX_STREAMS < 32, "Must be less than 32!");
 #	define BGFX_CONFIG_MAX_TRANSIENT_INDEX_BUFFER_SIZE (2<<20)
 #endif // BGFX_CONFIG_MAX_TRANSIENT_INDEX_BUFFER_SIZE
 
+#ifndef BGFX_CONFIG_TRANSIENT_SLAB_SIZE
+/// Size of slab encoder reserves from frame's transient vertex or index
+/// buffer. Encoder transient allocations are sub-allocated from slab
+/// without locking. Unused tail of encoder's last slab is wasted.
+#	define BGFX_CONFIG_TRANSIENT_SLAB_SIZE (64<<10)
+#endif // BGFX_CONFIG_TRANSIENT_SLAB_SIZE
+
 #ifndef BGFX_CONFIG_MIN_UNIFORM_BUFFER_SIZE
 /// Mimumum uniform buffer size. This buffer will resize on demand. It's
 /// allocated per encoder, so this is the price of an encoder that submits
@@ -569,6 +604,26 @@ static_assert(BGFX_CONFIG_MAX_VERTEX_STREAMS < 32, "Must be less than 32!");
 #	define BGFX_CONFIG_PROFILER 0
 #endif // BGFX_CONFIG_PROFILER
 
+/// Enable built-in trace recorder. When enabled, profiler scopes from all
+/// threads and per-view GPU timings are recorded into per-thread ring buffers,
+/// and can be saved as Chrome trace-event JSON with `bgfx::saveTrace`.
+/// Default is 0 (disabled).
+#ifndef BGFX_CONFIG_TRACE
+#	define BGFX_CONFIG_TRACE 0
+#endif // BGFX_CONFIG_TRACE
+
+/// Number of trace events kept per thread. Must be power of 2.
+#ifndef BGFX_CONFIG_TRACE_MAX_EVENTS
+#	define BGFX_CONFIG_TRACE_MAX_EVENTS (8<<10)
+#endif // BGFX_CONFIG_TRACE_MAX_EVENTS
+
+/// Enable frame capture. When enabled, resource commands are recorded after init, and
+/// `bgfx::requestFrameCapture` writes them together with sorted frame into file that can be
+/// replayed with `bgfx::replayFrameCapture`. Default is 0 (disabled).
+#ifndef BGFX_CONFIG_CAPTURE
+#	define BGFX_CONFIG_CAPTURE 0
+#endif // BGFX_CONFIG_CAPTURE
+
 /// File path for RenderDoc capture log output. Default is "temp/bgfx".
 #ifndef BGFX_CONFIG_RENDERDOC_LOG_FILEPATH
 #	define BGFX_CONFIG_RENDERDOC_LOG_FILEPATH "temp/bgfx"
@@ -600,6 +655,14 @@ static_assert(BGFX_CONFIG_MAX_VERTEX_STREAMS < 32, "Must be less than 32!");
 #	define BGFX_CONFIG_DEFAULT_MAX_ENCODERS ( (0 != BGFX_CONFIG_MULTITHREADED) ? 8 : 1)
 #endif // BGFX_CONFIG_DEFAULT_MAX_ENCODERS
 
+/// Number of per-thread resource command buffers. Texture and dynamic buffer
+/// updates from threads other than API thread are recorded into thread's own
+/// command buffer without taking resource API lock. Threads past this limit
+/// share API thread's command buffer.
+#ifndef BGFX_CONFIG_MAX_RESOURCE_THREADS
+#	define BGFX_CONFIG_MAX_RESOURCE_THREADS 8
+#endif // BGFX_CONFIG_MAX_RESOURCE_THREADS
+
 /// Maximum number of back buffers for swap chain. Default is 4.
 /// The actual number used is specified via bgfx::Resolution::numBackBuffers.
 #ifndef BGFX_CONFIG_MAX_BACK_BUFFERS
@@ -638,6 +701,35 @@ static_assert(BGFX_CONFIG_MAX_VERTEX_STREAMS < 32, "Must be less than 32!");
 #	define BGFX_CONFIG_C99_API 1
 #endif // BGFX_CONFIG_C99_API
 
+/// Minimum number of draw calls in a view before encoding of view, whose render
+/// items didn't change since previous frame, is cached and replayed. Set to 0 to
+/// disable.
+/// Note: Currently only used by the WebGPU backend (render bundles).
+#ifndef BGFX_CONFIG_RENDER_BUNDLE_MIN_DRAWS
+#	define BGFX_CONFIG_RENDER_BUNDLE_MIN_DRAWS 8
+#endif // BGFX_CONFIG_RENDER_BUNDLE_MIN_DRAWS
+
+/// Minimum number of consecutive compatible draw calls merged into single
+/// instanced draw call, for programs with instanced variant set with
+/// `bgfx::setInstancedProgram`.
+#ifndef BGFX_CONFIG_AUTO_INSTANCING_MIN_DRAWS
+#	define BGFX_CONFIG_AUTO_INSTANCING_MIN_DRAWS 4
+#endif // BGFX_CONFIG_AUTO_INSTANCING_MIN_DRAWS
+
+/// Maximum number of threads, including calling thread, used by
+/// `bgfx::topologySortTriList` to sort large triangle lists. Worker threads
+/// are created on first large sort and kept until shutdown. Set to 1 to
+/// sort on calling thread only.
+#ifndef BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS
+#	define BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS ( (0 != BGFX_CONFIG_MULTITHREADED) ? 4 : 1)
+#endif // BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS
+
+/// Minimum number of triangles sorted by each thread in
+/// `bgfx::topologySortTriList`. Smaller lists are sorted on calling thread.
+#ifndef BGFX_CONFIG_TOPOLOGY_SORT_MIN_TRIANGLES_PER_THREAD
+#	define BGFX_CONFIG_TOPOLOGY_SORT_MIN_TRIANGLES_PER_THREAD (16<<10)
+#endif // BGFX_CONFIG_TOPOLOGY_SORT_MIN_TRIANGLES_PER_THREAD
+
 #ifndef BGFX_CONFIG_MIP_GEN_FALLBACK
 #	define BGFX_CONFIG_MIP_GEN_FALLBACK (0 \
 		| BGFX_CONFIG_RENDERER_DIRECT3D12  \
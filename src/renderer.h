@@ -84,6 +84,120 @@ namespace bgfx
 		uint16_t        m_item;
 	};
 
+	/// Shader constant buffer resolved into flat list of register copies at shader creation. Render
+	/// loop copies uniform data straight into constant scratch instead of decoding opcodes. Shaders
+	/// with anything other than Vec4 and Mat4 constants (Mat3 needs conversion) keep using opcode
+	/// stream.
+	struct UniformCopyList
+	{
+		UniformCopyList()
+			: m_item(NULL)
+			, m_num(0)
+			, m_numRegs(0)
+			, m_fragment(false)
+		{
+		}
+
+		void create(UniformBuffer& _constantBuffer)
+		{
+			uint32_t num = 0;
+
+			for (uint32_t pass = 0; pass < 2; ++pass)
+			{
+				_constantBuffer.reset();
+
+				for (;;)
+				{
+					const uint32_t opcode = _constantBuffer.read();
+
+					if (UniformType::End == opcode)
+					{
+						break;
+					}
+
+					uint8_t type;
+					uint16_t loc;
+					uint16_t regs;
+					uint16_t copy;
+					UniformBuffer::decodeOpcode(opcode, type, loc, regs, copy);
+
+					if (copy)
+					{
+						destroy();
+						return;
+					}
+
+					UniformHandle handle;
+					bx::memCopy(&handle, _constantBuffer.read(sizeof(UniformHandle) ), sizeof(UniformHandle) );
+
+					switch (type & ~kUniformMask)
+					{
+					case UniformType::Vec4:
+					case UniformType::Mat4:
+						if (0 != pass)
+						{
+							UniformCacheItem& item = m_item[m_num++];
+							item.m_offset = loc;
+							item.m_size   = uint16_t(regs*16);
+							item.m_handle = handle.idx;
+
+							m_numRegs += regs;
+							m_fragment = 0 != (type & kUniformFragmentBit);
+						}
+						else
+						{
+							++num;
+						}
+						break;
+
+					default:
+						return;
+					}
+				}
+
+				if (0 == pass)
+				{
+					m_item = (UniformCacheItem*)bx::alloc(g_allocator, bx::max<uint32_t>(num, 1)*sizeof(UniformCacheItem) );
+				}
+			}
+
+			_constantBuffer.reset();
+		}
+
+		void destroy()
+		{
+			if (NULL != m_item)
+			{
+				bx::free(g_allocator, m_item);
+				m_item = NULL;
+			}
+
+			m_num     = 0;
+			m_numRegs = 0;
+		}
+
+		bool isValid() const
+		{
+			return NULL != m_item;
+		}
+
+		void commit(uint8_t* _vsScratch, uint8_t* _fsScratch, void* const* _uniforms) const
+		{
+			uint8_t* dst = m_fragment ? _fsScratch : _vsScratch;
+
+			for (uint32_t ii = 0, num = m_num; ii < num; ++ii)
+			{
+				const UniformCacheItem& item = m_item[ii];
+				bx::memCopy(&dst[item.m_offset], _uniforms[item.m_handle], item.m_size);
+			}
+		}
+
+		UniformCacheItem* m_item;
+		uint16_t m_num;
+		uint16_t m_numRegs;
+		bool     m_fragment;
+	};
+
 	struct ViewState
 	{
 		ViewState()
@@ -102,6 +216,7 @@ namespace bgfx
 			m_invViewCached = UINT16_MAX;
 			m_invProjCached = UINT16_MAX;
 			m_invViewProjCached = UINT16_MAX;
+			m_predefinedView    = UINT16_MAX;
 
 			m_view = m_viewTmp;
 
@@ -119,16 +234,32 @@ namespace bgfx
 			}
 		}
 
+		/// Per-view predefined uniforms (view rect, view and projection matrices)
+		/// are written into backend's uniform scratch only when view or program
+		/// changes. Backend must keep previously written values until program
+		/// changes. This only saves CPU writes (and uniform calls on GL),
+		/// backends that upload whole scratch per draw still upload it.
 		template<uint16_t mtxRegs, typename RendererContext, typename Program, typename Draw>
-		void setPredefined(RendererContext* _renderer, uint16_t _view, const Program& _program, const Frame* _frame, const Draw& _draw)
+		void setPredefined(RendererContext* _renderer, uint16_t _view, const Program& _program, const Frame* _frame, const Draw& _draw, bool _programChanged = true)
 		{
 			const FrameCache& frameCache = _frame->m_frameCache;
 
+			const bool viewChanged = _programChanged || _view != m_predefinedView;
+			m_predefinedView = _view;
+
 			for (uint32_t ii = 0, num = _program.m_numPredefined; ii < num; ++ii)
 			{
 				const PredefinedUniform& predefined = _program.m_predefined[ii];
-				uint8_t flags = predefined.m_type&kUniformFragmentBit;
-				switch (predefined.m_type&(~kUniformFragmentBit) )
+				const uint8_t type  = predefined.m_type&(~kUniformFragmentBit);
+				const uint8_t flags = predefined.m_type&kUniformFragmentBit;
+
+				if (!viewChanged
+				&&  type < PredefinedUniform::Model)
+				{
+					continue;
+				}
+
+				switch (type)
 				{
 				case PredefinedUniform::ViewRect:
 					{
@@ -334,6 +465,23 @@ namespace bgfx
 					}
 					break;
 
+				case PredefinedUniform::TransformIndex:
+					{
+						const float index[4] =
+						{
+							bx::bitsToFloat(_draw.m_transformIndex),
+							0.0f,
+							0.0f,
+							0.0f,
+						};
+						_renderer->setShaderUniform4f(flags
+							, predefined.m_loc
+							, index
+							, 1
+							);
+					}
+					break;
+
 				default:
 					BX_ASSERT(false, "predefined %d not handled", predefined.m_type);
 					break;
@@ -354,6 +502,7 @@ namespace bgfx
 		uint16_t m_invViewCached;
 		uint16_t m_invProjCached;
 		uint16_t m_invViewProjCached;
+		uint16_t m_predefinedView;
 	};
 
 	template <typename Ty, uint16_t MaxHandleT>
@@ -883,6 +1032,109 @@ namespace bgfx
 		bool     m_enabled;
 	};
 
+	/// Maximum number of frames with GPU region queries in flight. When all are in use, regions
+	/// of new frames are not timed.
+	constexpr uint32_t kGpuRegionMaxFrames = 4;
+
+	struct GpuRegionSlice
+	{
+		void init(const Frame* _frame)
+		{
+			m_frameNum = _frame->m_frameNum;
+			m_num      = _frame->m_numGpuRegionSlots;
+
+			for (uint32_t ii = 0, num = _frame->m_numGpuRegions; ii < num; ++ii)
+			{
+				const GpuRegion& region = _frame->m_gpuRegion[ii];
+
+				if (kInvalidGpuRegion != region.m_slot)
+				{
+					bx::strCopy(m_name[region.m_slot], BX_COUNTOF(m_name[0]), region.m_name);
+				}
+			}
+		}
+
+		/// Timestamps are begin/end pairs ordered by region slot.
+		void resolve(Frame* _frame, const uint64_t* _timestamp) const
+		{
+			Stats& perfStats = _frame->m_perfStats;
+
+			for (uint16_t ii = 0; ii < m_num; ++ii)
+			{
+				GpuRegionStats& regionStats = perfStats.gpuRegionStats[ii];
+				bx::strCopy(regionStats.name, BX_COUNTOF(regionStats.name), m_name[ii]);
+				regionStats.gpuTimeBegin = int64_t(_timestamp[ii*2+0]);
+				regionStats.gpuTimeEnd   = int64_t(_timestamp[ii*2+1]);
+				regionStats.gpuFrameNum  = m_frameNum;
+			}
+
+			perfStats.numGpuRegions = m_num;
+		}
+
+		char     m_name[BGFX_CONFIG_MAX_GPU_REGIONS][sizeof(GpuRegionStats::name)];
+		uint32_t m_frameNum;
+		uint16_t m_num;
+	};
+
+	template<typename Ty>
+	struct GpuRegionProfiler
+	{
+		GpuRegionProfiler(Frame* _frame, Ty& _query, bool _enabled = true)
+			: m_frame(_frame)
+			, m_query(_query)
+			, m_slice(UINT32_MAX)
+			, m_event(0)
+		{
+			if (_enabled)
+			{
+				m_query.resolve(_frame);
+
+				if (0 != _frame->m_numGpuRegionEvents)
+				{
+					m_slice = m_query.begin(_frame);
+				}
+			}
+		}
+
+		/// Must be called before sorted render item `_item` is submitted.
+		void update(uint32_t _item)
+		{
+			if (UINT32_MAX == m_slice)
+			{
+				return;
+			}
+
+			for (uint32_t num = m_frame->m_numGpuRegionEvents; m_event < num; ++m_event)
+			{
+				const uint64_t event = m_frame->m_gpuRegionEvent[m_event];
+
+				if (_item < GpuRegionEvent::getItem(event) )
+				{
+					break;
+				}
+
+				const GpuRegion& region = m_frame->m_gpuRegion[GpuRegionEvent::getRegion(event)];
+				m_query.timestamp(m_slice, region.m_slot*2 + (GpuRegionEvent::isBegin(event) ? 0 : 1) );
+			}
+		}
+
+		void end()
+		{
+			if (UINT32_MAX != m_slice)
+			{
+				update(UINT32_MAX);
+
+				m_query.end(m_slice);
+				m_slice = UINT32_MAX;
+			}
+		}
+
+		Frame*   m_frame;
+		Ty&      m_query;
+		uint32_t m_slice;
+		uint32_t m_event;
+	};
+
 } // namespace bgfx
 
 #endif // BGFX_RENDERER_H_HEADER_GUARD
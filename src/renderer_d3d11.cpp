@@ -2045,6 +2045,11 @@ namespace bgfx { namespace d3d11
 			release(mem);
 		}
 
+		void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) override
+		{
+			m_textures[_handle.idx].m_minLod = _minLod;
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr, uint16_t _layerIndex) override
 		{
 			// Resource ref. counts might be messed up outside of bgfx.
@@ -2243,9 +2248,15 @@ namespace bgfx { namespace d3d11
 				);
 		}
 
-		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
+		bool updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
 		{
+			if (0 == bx::memCmp(m_uniforms[_loc], _data, _size) )
+			{
+				return false;
+			}
+
 			bx::memCopy(m_uniforms[_loc], _data, _size);
+			return true;
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle _handle) override
@@ -3613,6 +3624,27 @@ namespace bgfx { namespace d3d11
 			}
 		}
 
+		void commit(const ShaderD3D11& _shader)
+		{
+			if (_shader.m_uniformCopy.isValid() )
+			{
+				_shader.m_uniformCopy.commit(m_vsScratch, m_fsScratch, m_uniforms);
+
+				if (_shader.m_uniformCopy.m_fragment)
+				{
+					m_fsChanges += _shader.m_uniformCopy.m_numRegs;
+				}
+				else
+				{
+					m_vsChanges += _shader.m_uniformCopy.m_numRegs;
+				}
+			}
+			else if (NULL != _shader.m_constantBuffer)
+			{
+				commit(*_shader.m_constantBuffer);
+			}
+		}
+
 		void commit(UniformBuffer& _uniformBuffer)
 		{
 			_uniformBuffer.reset();
@@ -4401,6 +4433,7 @@ namespace bgfx { namespace d3d11
 			if (NULL != m_constantBuffer)
 			{
 				m_constantBuffer->finish();
+				m_uniformCopy.create(*m_constantBuffer);
 			}
 		}
 
@@ -4737,6 +4770,7 @@ namespace bgfx { namespace d3d11
 			}
 
 			m_numMips = ti.numMips;
+			m_minLod  = 0;
 
 			const uint16_t numSides = ti.numLayers * (imageContainer.m_cubeMap ? 6 : 1);
 			const uint32_t numSrd   = numSides * ti.numMips;
@@ -5355,6 +5389,9 @@ namespace bgfx { namespace d3d11
 	{
 		TextureStage& ts = s_renderD3D11->m_textureStage;
 
+		// Mips above min LOD are not resident.
+		_firstMip = bx::max(_firstMip, m_minLod);
+
 		const uint8_t  numMips   = bx::min<uint8_t>(_numMips,   uint8_t(m_numMips   - _firstMip) );
 		const uint16_t numLayers = bx::min<uint16_t>(_numLayers, uint16_t(m_numLayers - _firstLayer) );
 
@@ -6275,6 +6312,8 @@ namespace bgfx { namespace d3d11
 			frameQueryIdx = m_gpuTimer.begin(BGFX_CONFIG_MAX_VIEWS, _render->m_frameNum);
 		}
 
+		_render->sort();
+
 		if (0 < _render->m_iboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
@@ -6289,8 +6328,6 @@ namespace bgfx { namespace d3d11
 			m_vertexBuffers[vb->handle.idx].update(0, _render->m_vboffset, vb->data, true);
 		}
 
-		_render->sort();
-
 		RenderDraw currentState;
 		currentState.clear();
 		currentState.m_stateFlags = BGFX_STATE_NONE;
@@ -6335,6 +6372,7 @@ namespace bgfx { namespace d3d11
 		uint32_t statsNumDrawIndirect[BX_COUNTOF(s_primInfo)] = {};
 		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
+		uint32_t uniformBytesSkipped = 0;
 
 		Profiler<TimerQueryD3D11> profiler(
 			  _render
@@ -6443,8 +6481,7 @@ namespace bgfx { namespace d3d11
 					const RenderCompute& compute = renderItem.compute;
 
 					bool programChanged = false;
-					bool constantsChanged = compute.m_uniformBegin < compute.m_uniformEnd;
-					rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+					bool constantsChanged = rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd, uniformBytesSkipped);
 
 					if (key.m_program.idx != currentProgram.idx)
 					{
@@ -6466,11 +6503,7 @@ namespace bgfx { namespace d3d11
 
 						if (constantsChanged)
 						{
-							UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-							if (NULL != vcb)
-							{
-								commit(*vcb);
-							}
+							commit(*program.m_vsh);
 						}
 
 						viewState.setPredefined<4>(this, view, program, _render, compute);
@@ -6558,6 +6591,12 @@ namespace bgfx { namespace d3d11
 					deviceCtx->CSSetShaderResources(0, maxTextureSamplers, m_textureStage.m_srv);
 					deviceCtx->CSSetSamplers(0, maxTextureSamplers, m_textureStage.m_sampler);
 
+					if (isValid(compute.m_occlusionQuery)
+					&&  !isVisible(_render, compute.m_occlusionQuery, 0 != (compute.m_submitFlags&BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) ) )
+					{
+						continue;
+					}
+
 					if (isValid(compute.m_indirectBuffer) )
 					{
 						const VertexBufferD3D11& vb = m_vertexBuffers[compute.m_indirectBuffer.idx];
@@ -6741,8 +6780,7 @@ namespace bgfx { namespace d3d11
 				}
 
 				bool programChanged = false;
-				bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd;
-				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				bool constantsChanged = rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd, uniformBytesSkipped);
 
 				if (key.m_program.idx != currentProgram.idx)
 				{
@@ -6786,19 +6824,11 @@ namespace bgfx { namespace d3d11
 
 					if (constantsChanged)
 					{
-						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
+						commit(*program.m_vsh);
 
 						if (NULL != program.m_fsh)
 						{
-							UniformBuffer* fcb = program.m_fsh->m_constantBuffer;
-							if (NULL != fcb)
-							{
-								commit(*fcb);
-							}
+							commit(*program.m_fsh);
 						}
 					}
 
@@ -7217,6 +7247,7 @@ namespace bgfx { namespace d3d11
 		perfStats.gpuTimerFreq  = result.m_frequency;
 		perfStats.numDraw       = statsKeyType[0];
 		perfStats.numCompute    = statsKeyType[1];
+		perfStats.uniformBytesSkipped = uniformBytesSkipped;
 		perfStats.numBlit       = _render->m_numBlitItems;
 		perfStats.maxGpuLatency = maxGpuLatency;
 		perfStats.gpuFrameNum   = result.m_frameNum;
@@ -156,6 +156,8 @@ namespace bgfx { namespace d3d11
 				m_constantBuffer = NULL;
 			}
 
+			m_uniformCopy.destroy();
+
 			m_numPredefined = 0;
 
 			if (NULL != m_buffer)
@@ -183,6 +185,7 @@ namespace bgfx { namespace d3d11
 		const Memory* m_code;
 		ID3D11Buffer* m_buffer;
 		UniformBuffer* m_constantBuffer;
+		UniformCopyList m_uniformCopy;
 
 		PredefinedUniform m_predefined[PredefinedUniform::Count];
 		uint16_t m_attrMask[Attrib::Count];
@@ -281,6 +284,7 @@ namespace bgfx { namespace d3d11
 			, m_uav(NULL)
 			, m_videoDecoder(NULL)
 			, m_numMips(0)
+			, m_minLod(0)
 		{
 		}
 
@@ -322,6 +326,7 @@ namespace bgfx { namespace d3d11
 		uint8_t  m_requestedFormat;
 		uint8_t  m_textureFormat;
 		uint8_t  m_numMips;
+		uint8_t  m_minLod;
 	};
 
 	struct FrameBufferD3D11
@@ -2543,6 +2543,11 @@ namespace bgfx { namespace d3d12
 			release(mem);
 		}
 
+		void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) override
+		{
+			m_textures[_handle.idx].m_minLod = _minLod;
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr, uint16_t /*_layerIndex*/) override
 		{
 			// Resource ref. counts might be messed up outside of bgfx.
@@ -2763,9 +2768,15 @@ namespace bgfx { namespace d3d12
 				);
 		}
 
-		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
+		bool updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
 		{
+			if (0 == bx::memCmp(m_uniforms[_loc], _data, _size) )
+			{
+				return false;
+			}
+
 			bx::memCopy(m_uniforms[_loc], _data, _size);
+			return true;
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle _handle) override
@@ -4041,6 +4052,18 @@ namespace bgfx { namespace d3d12
 			return _visible == (0 != _render->m_occlusion[_handle.idx]);
 		}
 
+		void commit(const ShaderD3D12& _shader)
+		{
+			if (_shader.m_uniformCopy.isValid() )
+			{
+				_shader.m_uniformCopy.commit(m_vsScratch, m_fsScratch, m_uniforms);
+			}
+			else if (NULL != _shader.m_constantBuffer)
+			{
+				commit(*_shader.m_constantBuffer);
+			}
+		}
+
 		void commit(UniformBuffer& _uniformBuffer)
 		{
 			_uniformBuffer.reset();
@@ -6069,6 +6092,7 @@ namespace bgfx { namespace d3d12
 			if (NULL != m_constantBuffer)
 			{
 				m_constantBuffer->finish();
+				m_uniformCopy.create(*m_constantBuffer);
 			}
 		}
 
@@ -6296,6 +6320,7 @@ namespace bgfx { namespace d3d12
 			}
 
 			m_numMips = ti.numMips;
+			m_minLod  = 0;
 			const uint16_t numSides = ti.numLayers * (imageContainer.m_cubeMap ? 6 : 1);
 			const uint32_t numSrd   = numSides * ti.numMips;
 			D3D12_SUBRESOURCE_DATA* srd = (D3D12_SUBRESOURCE_DATA*)BX_STACK_ALLOC(numSrd*sizeof(D3D12_SUBRESOURCE_DATA) );
@@ -7216,10 +7241,7 @@ namespace bgfx { namespace d3d12
 
 			bx::memCopy(m_uniforms[m_mipGen->u_mipGen.idx], mipGenData, 16);
 
-			if (NULL != program.m_vsh->m_constantBuffer)
-			{
-				commit(*program.m_vsh->m_constantBuffer);
-			}
+			commit(*program.m_vsh);
 
 			D3D12_GPU_VIRTUAL_ADDRESS gpuAddress;
 			commitShaderConstants(prog, gpuAddress);
@@ -8181,6 +8203,8 @@ namespace bgfx { namespace d3d12
 
 		uint32_t frameQueryIdx = m_gpuTimer.begin(BGFX_CONFIG_MAX_VIEWS, _render->m_frameNum);
 
+		_render->sort();
+
 		if (0 < _render->m_iboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
@@ -8195,8 +8219,6 @@ namespace bgfx { namespace d3d12
 			m_vertexBuffers[vb->handle.idx].update(m_commandList, 0, _render->m_vboffset, vb->data);
 		}
 
-		_render->sort();
-
 		RenderDraw currentState;
 		currentState.clear();
 		currentState.m_stateFlags = BGFX_STATE_NONE;
@@ -8212,6 +8234,7 @@ namespace bgfx { namespace d3d12
 		ProgramHandle currentProgram    = BGFX_INVALID_HANDLE;
 		uint32_t currentBindIdx         = UINT32_MAX;
 		bool     hasPredefined          = false;
+		bool     uniformsChanged        = false;
 		bool     commandListChanged     = false;
 		ID3D12PipelineState* currentPso = NULL;
 		m_lastPso = NULL;
@@ -8241,6 +8264,7 @@ namespace bgfx { namespace d3d12
 		uint32_t statsNumInstances[BX_COUNTOF(s_primInfo)] = {};
 		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
+		uint32_t uniformBytesSkipped = 0;
 
 		Profiler<TimerQueryD3D12> profiler(
 			  _render
@@ -8530,7 +8554,10 @@ namespace bgfx { namespace d3d12
 													: uint32_t(texture.m_flags)
 													;
 												texture.setState(m_commandList, D3D12_RESOURCE_STATE_GENERIC_READ);
-												scratchBuffer.allocSrv(srvHandle[stage], texture, bind.m_firstLayer, bind.m_numLayers, bind.m_firstMip, bind.m_numMips
+
+												// Mips above min LOD are not resident.
+												const uint8_t firstMip = bx::max(bind.m_firstMip, texture.m_minLod);
+												scratchBuffer.allocSrv(srvHandle[stage], texture, bind.m_firstLayer, bind.m_numLayers, firstMip, bind.m_numMips
 													, 0 != (resolvedFlags & BGFX_SAMPLER_SAMPLE_STENCIL)
 													);
 												samplerFlags[stage] = resolvedFlags & (BGFX_SAMPLER_BITS_MASK | BGFX_SAMPLER_BORDER_COLOR_MASK | BGFX_SAMPLER_COMPARE_MASK);
@@ -8603,16 +8630,12 @@ namespace bgfx { namespace d3d12
 					if (compute.m_uniformBegin < compute.m_uniformEnd
 					||  currentProgram.idx != key.m_program.idx)
 					{
-						rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+						rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd, uniformBytesSkipped);
 
 						currentProgram = key.m_program;
 						ProgramD3D12& program = m_program[currentProgram.idx];
 
-						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
+						commit(*program.m_vsh);
 
 						hasPredefined = 0 < program.m_numPredefined;
 						constantsChanged = true;
@@ -8627,6 +8650,12 @@ namespace bgfx { namespace d3d12
 						m_commandList->SetComputeRootConstantBufferView(ComputeRp::CBV, gpuAddress);
 					}
 
+					if (isValid(compute.m_occlusionQuery)
+					&&  !isVisible(_render, compute.m_occlusionQuery, 0 != (compute.m_submitFlags&BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) ) )
+					{
+						continue;
+					}
+
 					if (isValid(compute.m_indirectBuffer) )
 					{
 						VertexBufferD3D12& indirect = m_vertexBuffers[compute.m_indirectBuffer.idx];
@@ -8749,8 +8778,9 @@ namespace bgfx { namespace d3d12
 						primIndex = uint8_t(pt>>BGFX_STATE_PT_SHIFT);
 					}
 
-					bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd;
-					rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+					// Draw might be skipped before constants are committed, keep change pending until then.
+					uniformsChanged |= rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd, uniformBytesSkipped);
+					bool constantsChanged = uniformsChanged;
 
 					currentState.m_streamMask             = draw.m_streamMask;
 					currentState.m_instanceDataBuffer.idx = draw.m_instanceDataBuffer.idx;
@@ -8864,7 +8894,10 @@ namespace bgfx { namespace d3d12
 													: uint32_t(texture.m_flags)
 													;
 												texture.setState(m_commandList, D3D12_RESOURCE_STATE_GENERIC_READ);
-												scratchBuffer.allocSrv(srvHandle[stage], texture, bind.m_firstLayer, bind.m_numLayers, bind.m_firstMip, bind.m_numMips
+
+												// Mips above min LOD are not resident.
+												const uint8_t firstMip = bx::max(bind.m_firstMip, texture.m_minLod);
+												scratchBuffer.allocSrv(srvHandle[stage], texture, bind.m_firstLayer, bind.m_numLayers, firstMip, bind.m_numMips
 													, 0 != (resolvedFlags & BGFX_SAMPLER_SAMPLE_STENCIL)
 													);
 												samplerFlags[stage] = resolvedFlags & (BGFX_SAMPLER_BITS_MASK | BGFX_SAMPLER_BORDER_COLOR_MASK | BGFX_SAMPLER_COMPARE_MASK);
@@ -9016,23 +9049,16 @@ namespace bgfx { namespace d3d12
 						currentProgram = key.m_program;
 						ProgramD3D12& program = m_program[currentProgram.idx];
 
-						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
+						commit(*program.m_vsh);
 
 						if (NULL != program.m_fsh)
 						{
-							UniformBuffer* fcb = program.m_fsh->m_constantBuffer;
-							if (NULL != fcb)
-							{
-								commit(*fcb);
-							}
+							commit(*program.m_fsh);
 						}
 
 						hasPredefined = 0 < program.m_numPredefined;
 						constantsChanged = true;
+						uniformsChanged  = false;
 					}
 
 					if (constantsChanged
@@ -9135,6 +9161,7 @@ namespace bgfx { namespace d3d12
 		perfStats.gpuTimerFreq  = m_gpuTimer.m_frequency;
 		perfStats.numDraw       = statsKeyType[0];
 		perfStats.numCompute    = statsKeyType[1];
+		perfStats.uniformBytesSkipped = uniformBytesSkipped;
 		perfStats.numBlit       = _render->m_numBlitItems;
 		perfStats.maxGpuLatency = maxGpuLatency;
 		perfStats.gpuFrameNum   = result.m_frameNum;
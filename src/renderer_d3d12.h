@@ -286,6 +286,8 @@ namespace bgfx { namespace d3d12
 				m_constantBuffer = NULL;
 			}
 
+			m_uniformCopy.destroy();
+
 			m_numPredefined = 0;
 
 			if (NULL != m_code)
@@ -298,6 +300,7 @@ namespace bgfx { namespace d3d12
 
 		const Memory* m_code;
 		UniformBuffer* m_constantBuffer;
+		UniformCopyList m_uniformCopy;
 
 		PredefinedUniform m_predefined[PredefinedUniform::Count];
 		uint16_t m_attrMask[Attrib::Count];
@@ -364,6 +367,7 @@ namespace bgfx { namespace d3d12
 			, m_directAccessPtr(NULL)
 			, m_state(D3D12_RESOURCE_STATE_COMMON)
 			, m_numMips(0)
+			, m_minLod(0)
 			, m_videoDecoder(NULL)
 		{
 			bx::memSet(&m_srvd, 0, sizeof(m_srvd) );
@@ -397,6 +401,7 @@ namespace bgfx { namespace d3d12
 		uint8_t m_requestedFormat;
 		uint8_t m_textureFormat;
 		uint8_t m_numMips;
+		uint8_t m_minLod;
 		VideoDecoderD3D12* m_videoDecoder;
 	};
 
@@ -633,6 +633,7 @@ namespace bgfx { namespace gl
 
 			ARB_clip_control,
 			ARB_compute_shader,
+			ARB_conditional_render_inverted,
 			ARB_conservative_depth,
 			ARB_copy_image,
 			ARB_debug_label,
@@ -658,6 +659,7 @@ namespace bgfx { namespace gl
 			ARB_multisample,
 			ARB_occlusion_query,
 			ARB_occlusion_query2,
+			ARB_parallel_shader_compile,
 			ARB_program_interface_query,
 			ARB_provoking_vertex,
 			ARB_sampler_objects,
@@ -682,6 +684,7 @@ namespace bgfx { namespace gl
 			ARB_timer_query,
 			ARB_uniform_buffer_object,
 			ARB_vertex_array_object,
+			ARB_vertex_attrib_binding,
 			ARB_vertex_type_2_10_10_10_rev,
 
 			ATI_meminfo,
@@ -757,10 +760,12 @@ namespace bgfx { namespace gl
 
 			KHR_debug,
 			KHR_no_error,
+			KHR_parallel_shader_compile,
 
 			MOZ_WEBGL_compressed_texture_s3tc,
 			MOZ_WEBGL_depth_texture,
 
+			NV_conditional_render,
 			NV_conservative_raster,
 			NV_copy_image,
 			NV_draw_buffers,
@@ -862,6 +867,7 @@ namespace bgfx { namespace gl
 
 		{ "ARB_clip_control",                         BGFX_CONFIG_RENDERER_OPENGL >= 43,        true  },
 		{ "ARB_compute_shader",                       BGFX_CONFIG_RENDERER_OPENGL >= 43,        true  },
+		{ "ARB_conditional_render_inverted",          BGFX_CONFIG_RENDERER_OPENGL >= 45,        true  },
 		{ "ARB_conservative_depth",                   BGFX_CONFIG_RENDERER_OPENGL >= 42,        true  },
 		{ "ARB_copy_image",                           BGFX_CONFIG_RENDERER_OPENGL >= 42,        true  },
 		{ "ARB_debug_label",                          false,                                    true  },
@@ -887,6 +893,7 @@ namespace bgfx { namespace gl
 		{ "ARB_multisample",                          BGFX_CONFIG_RENDERER_OPENGLES >= 20,      true  },
 		{ "ARB_occlusion_query",                      BGFX_CONFIG_RENDERER_OPENGL >= 33,        true  },
 		{ "ARB_occlusion_query2",                     BGFX_CONFIG_RENDERER_OPENGL >= 33,        true  },
+		{ "ARB_parallel_shader_compile",              false,                                    true  },
 		{ "ARB_program_interface_query",              BGFX_CONFIG_RENDERER_OPENGL >= 43,        true  },
 		{ "ARB_provoking_vertex",                     BGFX_CONFIG_RENDERER_OPENGL >= 32,        true  },
 		{ "ARB_sampler_objects",                      BGFX_CONFIG_RENDERER_OPENGL >= 33,        true  },
@@ -911,6 +918,7 @@ namespace bgfx { namespace gl
 		{ "ARB_timer_query",                          BGFX_CONFIG_RENDERER_OPENGL >= 33,        true  },
 		{ "ARB_uniform_buffer_object",                BGFX_CONFIG_RENDERER_OPENGL >= 31,        true  },
 		{ "ARB_vertex_array_object",                  BGFX_CONFIG_RENDERER_OPENGL >= 30,        true  },
+		{ "ARB_vertex_attrib_binding",                BGFX_CONFIG_RENDERER_OPENGL >= 43,        true  },
 		{ "ARB_vertex_type_2_10_10_10_rev",           false,                                    true  },
 
 		{ "ATI_meminfo",                              false,                                    true  },
@@ -986,10 +994,12 @@ namespace bgfx { namespace gl
 
 		{ "KHR_debug",                                BGFX_CONFIG_RENDERER_OPENGL >= 43,        true  },
 		{ "KHR_no_error",                             false,                                    true  },
+		{ "KHR_parallel_shader_compile",              false,                                    true  },
 
 		{ "MOZ_WEBGL_compressed_texture_s3tc",        false,                                    true  },
 		{ "MOZ_WEBGL_depth_texture",                  false,                                    true  },
 
+		{ "NV_conditional_render",                    BGFX_CONFIG_RENDERER_OPENGL >= 30,        true  },
 		{ "NV_conservative_raster",                   false,                                    true  },
 		{ "NV_copy_image",                            false,                                    true  },
 		{ "NV_draw_buffers",                          false,                                    true  }, // GLES extension.
@@ -2204,6 +2214,8 @@ namespace bgfx { namespace gl
 		bool m_detachShader;
 	};
 
+	constexpr uint32_t kProgramCacheWritesPerFrame = 4;
+
 	struct RendererContextGL : public RendererContextI
 	{
 		RendererContextGL()
@@ -2216,6 +2228,11 @@ namespace bgfx { namespace gl
 			, m_maxAnisotropyDefault(0.0f)
 			, m_maxMsaa(0)
 			, m_vao(0)
+			, m_currentVao(0)
+			, m_numVertexArrayBinds(0)
+			, m_numVertexAttribCalls(0)
+			, m_numProgramCacheQueue(0)
+			, m_numProgramsPending(0)
 			, m_blitSupported(false)
 			, m_blitFboSupported(false)
 			, m_textureMultisampleSupport(false)
@@ -2224,6 +2241,8 @@ namespace bgfx { namespace gl
 			, m_readBackSupported(BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) )
 			, m_readBackFboSupported(false)
 			, m_vaoSupport(false)
+			, m_vertexAttribBindingSupport(false)
+			, m_vertexArrayCacheActive(false)
 			, m_samplerObjectSupport(false)
 			, m_srgbWriteControlSupport(BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) )
 			, m_borderColorSupport(BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL) )
@@ -2231,8 +2250,11 @@ namespace bgfx { namespace gl
 			, m_textureSwizzleSupport(false)
 			, m_timerQuerySupport(false)
 			, m_occlusionQuerySupport(false)
+			, m_conditionalRenderSupport(false)
+			, m_conditionalRenderInvertedSupport(false)
 			, m_atocSupport(false)
 			, m_conservativeRasterSupport(false)
+			, m_parallelShaderCompileSupport(false)
 			, m_flip(false)
 			, m_hash( (BX_PLATFORM_WINDOWS<<1) | BX_ARCH_64BIT)
 			, m_backBufferFbo(0)
@@ -2883,8 +2905,23 @@ namespace bgfx { namespace gl
 				{
 					GL_CHECK(glGenVertexArrays(1, &m_vao) );
 					GL_CHECK(glBindVertexArray(m_vao) );
+					m_currentVao = m_vao;
 				}
 
+				m_vertexAttribBindingSupport = true
+					&& m_vaoSupport
+					&& (false
+						|| BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGLES >= 31) // Core since ES 3.1.
+						|| s_extension[Extension::ARB_vertex_attrib_binding].m_supported
+						)
+					&& NULL != glBindVertexBuffer
+					&& NULL != glVertexAttribBinding
+					&& NULL != glVertexAttribFormat
+					&& NULL != glVertexAttribIFormat
+					&& NULL != glVertexBindingDivisor
+					;
+				m_vertexArrayCacheActive = m_vertexAttribBindingSupport;
+
 				m_samplerObjectSupport = false
 					|| BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGLES)
 					|| s_extension[Extension::ARB_sampler_objects].m_supported
@@ -2933,9 +2970,28 @@ namespace bgfx { namespace gl
 					&& NULL != glGetQueryObjectuiv
 					;
 
+				m_conditionalRenderSupport = true
+					&& m_occlusionQuerySupport
+					&& s_extension[Extension::NV_conditional_render].m_supported // Core since GL 3.0.
+					&& NULL != glBeginConditionalRender
+					&& NULL != glEndConditionalRender
+					;
+
+				m_conditionalRenderInvertedSupport = true
+					&& m_conditionalRenderSupport
+					&& s_extension[Extension::ARB_conditional_render_inverted].m_supported
+					;
+
 				m_atocSupport = s_extension[Extension::ARB_multisample].m_supported;
 				m_conservativeRasterSupport = s_extension[Extension::NV_conservative_raster].m_supported;
 
+				// Compile and link are issued at creation time, and program is not used until driver
+				// reports completion, instead of stalling on the first status query.
+				m_parallelShaderCompileSupport = false
+					|| s_extension[Extension::ARB_parallel_shader_compile].m_supported
+					|| s_extension[Extension::KHR_parallel_shader_compile].m_supported
+					;
+
 				// Note: ES 3.1 has image load/store in core, but read-write
 				// images are limited to r32f, r32i, and r32ui formats.
 				m_imageLoadStoreSupport = false
@@ -2947,6 +3003,7 @@ namespace bgfx { namespace gl
 					| (m_atocSupport               ? BGFX_CAPS_ALPHA_TO_COVERAGE      : 0)
 					| (m_conservativeRasterSupport ? BGFX_CAPS_CONSERVATIVE_RASTER    : 0)
 					| (m_occlusionQuerySupport     ? BGFX_CAPS_OCCLUSION_QUERY        : 0)
+					| (m_conditionalRenderSupport  ? BGFX_CAPS_CONDITIONAL_RENDER     : 0)
 					| BGFX_CAPS_TEXTURE_COMPARE_LEQUAL
 					| (computeSupport              ? BGFX_CAPS_COMPUTE                : 0)
 					| (m_imageLoadStoreSupport     ? BGFX_CAPS_IMAGE_RW               : 0)
@@ -3111,6 +3168,7 @@ namespace bgfx { namespace gl
 				if (m_timerQuerySupport)
 				{
 					m_gpuTimer.create();
+					m_gpuRegionQuery.create();
 				}
 
 				if (m_occlusionQuerySupport)
@@ -3149,8 +3207,11 @@ namespace bgfx { namespace gl
 				GL_CHECK(glBindVertexArray(0) );
 				GL_CHECK(glDeleteVertexArrays(1, &m_vao) );
 				m_vao = 0;
+				m_currentVao = 0;
 			}
 
+			m_vertexArrayCache.invalidate();
+
 			captureFinish();
 
 			invalidateCache();
@@ -3158,6 +3219,7 @@ namespace bgfx { namespace gl
 			if (m_timerQuerySupport)
 			{
 				m_gpuTimer.destroy();
+				m_gpuRegionQuery.destroy();
 			}
 
 			if (m_occlusionQuerySupport)
@@ -3216,6 +3278,9 @@ namespace bgfx { namespace gl
 					m_needPresent = false;
 				}
 			}
+
+			// Reading program binary and writing it into cache is kept out of frame submit.
+			programCacheFlush(kProgramCacheWritesPerFrame);
 		}
 
 		void createIndexBuffer(IndexBufferHandle _handle, const Memory* _mem, uint16_t _flags) override
@@ -3299,6 +3364,14 @@ namespace bgfx { namespace gl
 		void destroyProgram(ProgramHandle _handle) override
 		{
 			m_program[_handle.idx].destroy();
+
+			if (m_vertexAttribBindingSupport)
+			{
+				m_vertexArrayCache.invalidateWithParent(_handle.idx);
+
+				// Deleting bound VAO reverts binding to zero, force rebind.
+				m_currentVao = UINT32_MAX;
+			}
 		}
 
 		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip, uint64_t _external) override
@@ -3619,6 +3692,11 @@ namespace bgfx { namespace gl
 			release(mem);
 		}
 
+		void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) override
+		{
+			m_textures[_handle.idx].m_minLod = _minLod;
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr, uint16_t /*_layerIndex*/) override
 		{
 			m_textures[_handle.idx].overrideInternal(_ptr);
@@ -3754,9 +3832,15 @@ namespace bgfx { namespace gl
 				);
 		}
 
-		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
+		bool updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
 		{
+			if (0 == bx::memCmp(m_uniforms[_loc], _data, _size) )
+			{
+				return false;
+			}
+
 			bx::memCopy(m_uniforms[_loc], _data, _size);
+			return true;
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle _handle) override
@@ -3821,6 +3905,11 @@ namespace bgfx { namespace gl
 			GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFbo) );
 			GL_CHECK(glViewport(0, 0, width, height) );
 
+			if (0 != m_vao)
+			{
+				bindVertexArray(m_vao);
+			}
+
 			GL_CHECK(glDisable(GL_SCISSOR_TEST) );
 			GL_CHECK(glDisable(GL_STENCIL_TEST) );
 			GL_CHECK(glDisable(GL_DEPTH_TEST) );
@@ -3830,6 +3919,7 @@ namespace bgfx { namespace gl
 			GL_CHECK(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) );
 
 			ProgramGL& program = m_program[_blitter.m_program.idx];
+			program.isReady(true);
 			setProgram(program.m_id);
 			setUniform1i(program.m_sampler[0], 0);
 
@@ -4031,8 +4121,16 @@ namespace bgfx { namespace gl
 				GL_CHECK(glDeleteVertexArrays(1, &m_vao) );
 				GL_CHECK(glGenVertexArrays(1, &m_vao) );
 				GL_CHECK(glBindVertexArray(m_vao) );
+				m_currentVao = m_vao;
 			}
 
+			// VAOs are not shared between contexts, cached VAOs are only used
+			// with main context.
+			m_vertexArrayCacheActive = true
+				&& m_vertexAttribBindingSupport
+				&& (!isValid(_fbh) || UINT16_MAX == m_frameBuffers[_fbh.idx].m_denseIdx)
+				;
+
 			if (m_srgbWriteControlSupport)
 			{
 				if (0 == m_currentFbo)
@@ -4467,6 +4565,79 @@ namespace bgfx { namespace gl
 			return _visible == (0 != _render->m_occlusion[_handle.idx]);
 		}
 
+		GLuint getConditionQuery(const Frame* _render, const RenderDraw& _draw) const
+		{
+			if (!m_conditionalRenderSupport
+			||  0 == (_draw.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT) )
+			{
+				return 0;
+			}
+
+			const bool visible = 0 != (_draw.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE);
+			if (!visible
+			&&  !m_conditionalRenderInvertedSupport)
+			{
+				// Inverted predicate not available, fall back to CPU test.
+				return 0;
+			}
+
+			return m_occlusionQuery.getIssued(_render, _draw.m_occlusionQuery);
+		}
+
+		void bindVertexArray(GLuint _vao)
+		{
+			if (m_currentVao != _vao)
+			{
+				m_currentVao = _vao;
+				++m_numVertexArrayBinds;
+				GL_CHECK(glBindVertexArray(_vao) );
+			}
+		}
+
+		GLuint getVertexArray(ProgramHandle _program, const RenderDraw& _draw)
+		{
+			const VertexLayout* layout[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+			const bool instanceData = isValid(_draw.m_instanceDataBuffer);
+
+			bx::HashMurmur2A murmur;
+			murmur.begin();
+			murmur.add(_program.idx);
+			murmur.add(_draw.m_streamMask);
+			murmur.add(instanceData);
+
+			if (UINT32_MAX != _draw.m_streamMask)
+			{
+				for (BitMaskToIndexIteratorT it(_draw.m_streamMask); !it.isDone(); it.next() )
+				{
+					const uint8_t idx = it.idx;
+
+					const VertexBufferGL& vb = m_vertexBuffers[_draw.m_stream[idx].m_handle.idx];
+					const uint16_t decl = isValid(_draw.m_stream[idx].m_layoutHandle)
+						? _draw.m_stream[idx].m_layoutHandle.idx
+						: vb.m_layoutHandle.idx
+						;
+					layout[idx] = &m_vertexLayouts[decl];
+					murmur.add(idx);
+					murmur.add(layout[idx]->m_hash);
+				}
+			}
+
+			const uint32_t hash = murmur.end();
+
+			GLuint vao = m_vertexArrayCache.find(hash).idx;
+			if (0 == vao)
+			{
+				GL_CHECK(glGenVertexArrays(1, &vao) );
+				bindVertexArray(vao);
+
+				m_program[_program.idx].bindVertexFormat(layout, _draw.m_streamMask, instanceData);
+
+				m_vertexArrayCache.add(hash, VertexArrayGL{vao}, _program.idx);
+			}
+
+			return vao;
+		}
+
 		void updateCapture()
 		{
 			if (m_resolution.reset&BGFX_RESET_CAPTURE)
@@ -4581,6 +4752,38 @@ namespace bgfx { namespace gl
 			}
 		}
 
+		void programCacheQueue(ProgramGL* _program)
+		{
+			if (!m_programBinarySupport)
+			{
+				return;
+			}
+
+			_program->m_cachePending = true;
+
+			if (m_numProgramCacheQueue == BX_COUNTOF(m_programCacheQueue) )
+			{
+				_program->cache();
+				return;
+			}
+
+			m_programCacheQueue[m_numProgramCacheQueue++] = _program;
+		}
+
+		void programCacheFlush(uint32_t _max)
+		{
+			const uint32_t num = bx::min<uint32_t>(_max, m_numProgramCacheQueue);
+
+			// Program might be destroyed, and its binary written, while it was in queue.
+			for (uint32_t ii = 0; ii < num; ++ii)
+			{
+				m_programCacheQueue[ii]->cache();
+			}
+
+			m_numProgramCacheQueue -= uint16_t(num);
+			bx::memMove(m_programCacheQueue, &m_programCacheQueue[num], m_numProgramCacheQueue*sizeof(ProgramGL*) );
+		}
+
 		void commit(UniformBuffer& _uniformBuffer)
 		{
 			_uniformBuffer.reset();
@@ -4822,7 +5025,7 @@ namespace bgfx { namespace gl
 			{
 				if (0 != m_vao)
 				{
-					GL_CHECK(glBindVertexArray(m_vao) );
+					bindVertexArray(m_vao);
 				}
 
 				GL_CHECK(glDisable(GL_SCISSOR_TEST) );
@@ -4861,6 +5064,7 @@ namespace bgfx { namespace gl
 				GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
 
 				ProgramGL& program = m_program[_clearQuad.m_program[numMrt-1].idx];
+				program.isReady(true);
 				setProgram(program.m_id);
 				program.bindAttributesBegin();
 				program.bindAttributes(layout, 0);
@@ -5035,6 +5239,7 @@ namespace bgfx { namespace gl
 		VertexBufferGL m_vertexBuffers[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
 		ShaderGL m_shaders[BGFX_CONFIG_MAX_SHADERS];
 		ProgramGL m_program[BGFX_CONFIG_MAX_PROGRAMS];
+		ProgramGL* m_programCacheQueue[BGFX_CONFIG_MAX_PROGRAMS];
 		TextureGL m_textures[BGFX_CONFIG_MAX_TEXTURES];
 		VertexLayout m_vertexLayouts[BGFX_CONFIG_MAX_VERTEX_LAYOUTS];
 		FrameBufferGL m_frameBuffers[BGFX_CONFIG_MAX_FRAME_BUFFERS];
@@ -5042,10 +5247,12 @@ namespace bgfx { namespace gl
 		void* m_uniforms[BGFX_CONFIG_MAX_UNIFORMS];
 
 		TimerQueryGL m_gpuTimer;
+		GpuRegionQueryGL m_gpuRegionQuery;
 		OcclusionQueryGL m_occlusionQuery;
 
 		StateCacheT<SamplerGL> m_samplerStateCache;
 		StateCacheT<TextureViewGL> m_textureViewStateCache;
+		StateCacheT<VertexArrayGL> m_vertexArrayCache;
 		UniformStateCache m_uniformStateCache;
 
 		TextVideoMem m_textVideoMem;
@@ -5061,6 +5268,11 @@ namespace bgfx { namespace gl
 		float m_maxAnisotropyDefault;
 		int32_t m_maxMsaa;
 		GLuint m_vao;
+		GLuint m_currentVao;
+		uint32_t m_numVertexArrayBinds;
+		uint32_t m_numVertexAttribCalls;
+		uint16_t m_numProgramCacheQueue;
+		uint16_t m_numProgramsPending;
 		uint16_t m_maxLabelLen;
 		bool m_blitSupported;
 		bool m_blitFboSupported;
@@ -5070,6 +5282,8 @@ namespace bgfx { namespace gl
 		bool m_readBackSupported;
 		bool m_readBackFboSupported;
 		bool m_vaoSupport;
+		bool m_vertexAttribBindingSupport;
+		bool m_vertexArrayCacheActive;
 		bool m_samplerObjectSupport;
 		bool m_srgbWriteControlSupport;
 		bool m_borderColorSupport;
@@ -5077,9 +5291,12 @@ namespace bgfx { namespace gl
 		bool m_textureSwizzleSupport;
 		bool m_timerQuerySupport;
 		bool m_occlusionQuerySupport;
+		bool m_conditionalRenderSupport;
+		bool m_conditionalRenderInvertedSupport;
 		bool m_atocSupport;
 		bool m_conservativeRasterSupport;
 		bool m_imageLoadStoreSupport;
+		bool m_parallelShaderCompileSupport;
 		bool m_flip;
 
 		uint64_t m_hash;
@@ -5339,57 +5556,132 @@ namespace bgfx { namespace gl
 
 		if (!cached)
 		{
-			GLint linked = 0;
-			if (0 != _vsh.m_id)
+			if (0 == _vsh.m_id)
 			{
-				GL_CHECK(glAttachShader(m_id, _vsh.m_id) );
+				BX_WARN(false, "Invalid vertex/compute shader.");
+				GL_CHECK(glDeleteProgram(m_id) );
+				m_usedCount = 0;
+				m_id = 0;
+				return;
+			}
 
-				if (0 != _fsh.m_id)
-				{
-					GL_CHECK(glAttachShader(m_id, _fsh.m_id) );
-				}
+			GL_CHECK(glAttachShader(m_id, _vsh.m_id) );
+
+			if (0 != _fsh.m_id)
+			{
+				GL_CHECK(glAttachShader(m_id, _fsh.m_id) );
+			}
 
-				GL_CHECK(glLinkProgram(m_id) );
-				GL_CHECK(glGetProgramiv(m_id, GL_LINK_STATUS, &linked) );
+			GL_CHECK(glLinkProgram(m_id) );
 
-				if (0 == linked)
-				{
-					char log[1024];
-					GL_CHECK(glGetProgramInfoLog(m_id, sizeof(log), NULL, log) );
-					BX_TRACE("%d: %s", linked, log);
-				}
+			m_vsh     = _vsh.m_id;
+			m_fsh     = _fsh.m_id;
+			m_cacheId = id;
+			m_pending = true;
+			++s_renderGL->m_numProgramsPending;
+
+			if (!s_renderGL->m_parallelShaderCompileSupport)
+			{
+				resolve(true);
 			}
 
-			if (0 == linked)
+			return;
+		}
+
+		init();
+	}
+
+	static void checkShaderCompileStatus(GLuint _id)
+	{
+		if (0 == _id)
+		{
+			return;
+		}
+
+		GLint compiled = 0;
+		GL_CHECK(glGetShaderiv(_id, GL_COMPILE_STATUS, &compiled) );
+
+		if (0 == compiled)
+		{
+			char log[1024];
+			GL_CHECK(glGetShaderInfoLog(_id, sizeof(log), NULL, log) );
+			BGFX_FATAL(false, bgfx::Fatal::InvalidShader, "Failed to compile shader. %d: %s", compiled, log);
+		}
+	}
+
+	bool ProgramGL::resolve(bool _wait)
+	{
+		if (!_wait)
+		{
+			GLint completed = GL_TRUE;
+			GL_CHECK(glGetProgramiv(m_id, GL_COMPLETION_STATUS_KHR, &completed) );
+
+			if (GL_FALSE == completed)
 			{
-				BX_WARN(0 != _vsh.m_id, "Invalid vertex/compute shader.");
-				GL_CHECK(glDeleteProgram(m_id) );
-				m_usedCount = 0;
-				m_id = 0;
-				return;
+				return false;
 			}
+		}
+
+		m_pending = false;
+		--s_renderGL->m_numProgramsPending;
+
+		GLint linked = 0;
+		GL_CHECK(glGetProgramiv(m_id, GL_LINK_STATUS, &linked) );
+
+		if (0 == linked)
+		{
+			char log[1024];
+			GL_CHECK(glGetProgramInfoLog(m_id, sizeof(log), NULL, log) );
+			BX_TRACE("%d: %s", linked, log);
 
-			s_renderGL->programCache(m_id, id);
+			// With parallel compile shader compile status is not checked at shader creation.
+			checkShaderCompileStatus(m_vsh);
+			checkShaderCompileStatus(m_fsh);
+
+			GL_CHECK(glDeleteProgram(m_id) );
+			m_usedCount = 0;
+			m_id = 0;
+			return true;
 		}
 
 		init();
 
-		if (!cached
-		&&  s_renderGL->m_workaround.m_detachShader)
+		if (s_renderGL->m_workaround.m_detachShader)
 		{
 			// Must be after init, otherwise init might fail to lookup shader
 			// info (NVIDIA Tegra 3 OpenGL ES 2.0 14.01003).
-			GL_CHECK(glDetachShader(m_id, _vsh.m_id) );
+			GL_CHECK(glDetachShader(m_id, m_vsh) );
 
-			if (0 != _fsh.m_id)
+			if (0 != m_fsh)
 			{
-				GL_CHECK(glDetachShader(m_id, _fsh.m_id) );
+				GL_CHECK(glDetachShader(m_id, m_fsh) );
 			}
 		}
+
+		s_renderGL->programCacheQueue(this);
+
+		return true;
+	}
+
+	void ProgramGL::cache()
+	{
+		if (m_cachePending)
+		{
+			m_cachePending = false;
+			s_renderGL->programCache(m_id, m_cacheId);
+		}
 	}
 
 	void ProgramGL::destroy()
 	{
+		if (m_pending)
+		{
+			m_pending = false;
+			--s_renderGL->m_numProgramsPending;
+		}
+
+		cache();
+
 		if (NULL != m_constantBuffer)
 		{
 			UniformBuffer::destroy(m_constantBuffer);
@@ -5403,6 +5695,9 @@ namespace bgfx { namespace gl
 			GL_CHECK(glDeleteProgram(m_id) );
 			m_id = 0;
 		}
+
+		m_vsh = 0;
+		m_fsh = 0;
 	}
 
 	void ProgramGL::init()
@@ -5776,6 +6071,7 @@ namespace bgfx { namespace gl
 
 			lazyEnableVertexAttribArray(loc);
 			GL_CHECK(glVertexAttribDivisor(loc, 0) );
+			s_renderGL->m_numVertexAttribCalls += 3;
 
 			if (!isFloat(type)
 			&&  !normalized)
@@ -5812,7 +6108,107 @@ namespace bgfx { namespace gl
 			const uint32_t baseVertex = _baseVertex + m_instanceOffset[ii];
 			GL_CHECK(glVertexAttribPointer(loc, 4, GL_FLOAT, GL_FALSE, _stride, (void*)(uintptr_t)baseVertex) );
 			GL_CHECK(glVertexAttribDivisor(loc, 1) );
+			s_renderGL->m_numVertexAttribCalls += 3;
+		}
+	}
+
+	void ProgramGL::bindVertexFormat(const VertexLayout* const* _layout, uint32_t _streamMask, bool _instanceData) const
+	{
+		uint8_t binding[Attrib::Count];
+		bx::memSet(binding, 0xff, sizeof(binding) );
+
+		uint32_t numCalls = 0;
+
+		if (UINT32_MAX != _streamMask)
+		{
+			for (BitMaskToIndexIteratorT it(_streamMask); !it.isDone(); it.next() )
+			{
+				const uint8_t idx = it.idx;
+				const VertexLayout& layout = *_layout[idx];
+
+				for (uint32_t ii = 0, iiEnd = m_usedCount; ii < iiEnd; ++ii)
+				{
+					Attrib::Enum attr = Attrib::Enum(m_used[ii]);
+					GLint loc = m_attributes[attr];
+
+					if (-1 == loc
+					||  UINT16_MAX == layout.m_attributes[attr])
+					{
+						continue;
+					}
+
+					uint8_t num;
+					AttribType::Enum type;
+					bool normalized;
+					bool asInt;
+					layout.decode(attr, num, type, normalized, asInt);
+
+					if (AttribType::Uint10 == type)
+					{
+						num = 4; // always 4 components on GL
+					}
+
+					if (!isFloat(type)
+					&&  !normalized)
+					{
+						GL_CHECK(glVertexAttribIFormat(loc, num, s_attribType[type], layout.m_offset[attr]) );
+					}
+					else
+					{
+						GL_CHECK(glVertexAttribFormat(loc, num, s_attribType[type], normalized, layout.m_offset[attr]) );
+					}
+
+					GL_CHECK(glVertexAttribBinding(loc, idx) );
+					numCalls += 2;
+
+					binding[ii] = idx;
+				}
+			}
+
+			// Used attributes missing from all layouts read defaults from last stream.
+			const uint8_t lastStream = uint8_t(31 - bx::countLeadingZeros<uint32_t>(_streamMask) );
+
+			for (uint32_t ii = 0, iiEnd = m_usedCount; ii < iiEnd; ++ii)
+			{
+				Attrib::Enum attr = Attrib::Enum(m_used[ii]);
+				GLint loc = m_attributes[attr];
+
+				if (-1 == loc)
+				{
+					continue;
+				}
+
+				if (UINT8_MAX == binding[ii])
+				{
+					const AttribDefault& ad = s_attribDefault[attr];
+					GL_CHECK(glVertexAttribFormat(loc, ad.m_num, s_attribType[ad.m_type], ad.m_normalized, 0) );
+					GL_CHECK(glVertexAttribBinding(loc, lastStream) );
+					numCalls += 2;
+				}
+
+				GL_CHECK(glEnableVertexAttribArray(loc) );
+				++numCalls;
+			}
+		}
+
+		if (_instanceData)
+		{
+			const GLuint instanceBinding = BGFX_CONFIG_MAX_VERTEX_STREAMS;
+
+			for (uint32_t ii = 0; -1 != m_instanceData[ii]; ++ii)
+			{
+				GLint loc = m_instanceData[ii];
+				GL_CHECK(glEnableVertexAttribArray(loc) );
+				GL_CHECK(glVertexAttribFormat(loc, 4, GL_FLOAT, GL_FALSE, m_instanceOffset[ii]) );
+				GL_CHECK(glVertexAttribBinding(loc, instanceBinding) );
+				numCalls += 3;
+			}
+
+			GL_CHECK(glVertexBindingDivisor(instanceBinding, 1) );
+			++numCalls;
 		}
+
+		s_renderGL->m_numVertexAttribCalls += numCalls;
 	}
 
 	void ProgramGL::bindAttributesEnd()
@@ -5824,6 +6220,7 @@ namespace bgfx { namespace gl
 				Attrib::Enum attr = Attrib::Enum(m_unboundUsedAttrib[ii]);
 				GLint loc = m_attributes[attr];
 				lazyDisableVertexAttribArray(loc);
+				++s_renderGL->m_numVertexAttribCalls;
 			}
 		}
 
@@ -5839,6 +6236,7 @@ namespace bgfx { namespace gl
 				Attrib::Enum attr = Attrib::Enum(m_used[ii]);
 				GLint loc = m_attributes[attr];
 				lazyDisableVertexAttribArray(loc);
+				++s_renderGL->m_numVertexAttribCalls;
 			}
 		}
 	}
@@ -5849,6 +6247,7 @@ namespace bgfx { namespace gl
 		{
 			GLint loc = m_instanceData[ii];
 			lazyDisableVertexAttribArray(loc);
+			++s_renderGL->m_numVertexAttribCalls;
 		}
 	}
 
@@ -5875,6 +6274,7 @@ namespace bgfx { namespace gl
 		m_currentSamplerHash = UINT32_MAX;
 		m_baseLevel = 0;
 		m_maxLevel  = -1;
+		m_minLod    = 0;
 
 		const bool writeOnly    = 0 != (m_flags&BGFX_TEXTURE_RT_WRITE_ONLY);
 		const bool computeWrite = 0 != (m_flags&BGFX_TEXTURE_COMPUTE_WRITE );
@@ -6712,6 +7112,9 @@ namespace bgfx { namespace gl
 			;
 		const uint32_t index = (flags & BGFX_SAMPLER_BORDER_COLOR_MASK) >> BGFX_SAMPLER_BORDER_COLOR_SHIFT;
 
+		// Mips above min LOD are not resident.
+		_firstMip = bx::max(_firstMip, m_minLod);
+
 		GLenum target = m_target;
 		const GLuint id = getViewId(_firstMip, _numMips, _firstLayer, _numLayers, &target);
 
@@ -7069,6 +7472,13 @@ namespace bgfx { namespace gl
 
 			GL_CHECK(glCompileShader(m_id) );
 
+			if (s_renderGL->m_parallelShaderCompileSupport)
+			{
+				// Querying compile status would wait for compile to finish. Compile errors are
+				// reported once program link completes.
+				return;
+			}
+
 			GLint compiled = 0;
 			GL_CHECK(glGetShaderiv(m_id, GL_COMPILE_STATUS, &compiled) );
 
@@ -7464,6 +7874,8 @@ namespace bgfx { namespace gl
 			Query& query = m_query[ii];
 			GL_CHECK(glGenQueries(1, &query.m_id) );
 		}
+
+		bx::memSet(m_issuedFrame, 0xff, sizeof(m_issuedFrame) );
 	}
 	void OcclusionQueryGL::destroy()
 	{
@@ -7484,6 +7896,9 @@ namespace bgfx { namespace gl
 		Query& query = m_query[m_control.m_current];
 		GL_CHECK(glBeginQuery(s_occlusionQueryTarget, query.m_id) );
 		query.m_handle = _handle;
+
+		m_issuedId[_handle.idx]    = query.m_id;
+		m_issuedFrame[_handle.idx] = _render->m_frameNum;
 	}
 
 	void OcclusionQueryGL::end()
@@ -7532,6 +7947,8 @@ namespace bgfx { namespace gl
 				query.m_handle.idx = bgfx::kInvalidHandle;
 			}
 		}
+
+		m_issuedFrame[_handle.idx] = UINT32_MAX;
 	}
 
 	static bool isCompressedRegionCopyable(uint32_t _offset, uint32_t _extent, uint32_t _logical, uint32_t _blockDim)
@@ -7824,9 +8241,12 @@ namespace bgfx { namespace gl
 
 		BGFX_GL_PROFILER_BEGIN_LITERAL("rendererSubmit", kColorView);
 
+		m_numVertexArrayBinds  = 0;
+		m_numVertexAttribCalls = 0;
+
 		if (0 != m_vao)
 		{
-			GL_CHECK(glBindVertexArray(m_vao) );
+			bindVertexArray(m_vao);
 		}
 
 		GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_backBufferFbo) );
@@ -7844,6 +8264,8 @@ namespace bgfx { namespace gl
 			frameQueryIdx = m_gpuTimer.begin(BGFX_CONFIG_MAX_VIEWS, _render->m_frameNum);
 		}
 
+		_render->sort();
+
 		if (0 < _render->m_iboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
@@ -7858,8 +8280,6 @@ namespace bgfx { namespace gl
 			m_vertexBuffers[vb->handle.idx].update(0, _render->m_vboffset, vb->data, true);
 		}
 
-		_render->sort();
-
 		RenderDraw currentState;
 		currentState.clear();
 		currentState.m_stateFlags = BGFX_STATE_NONE;
@@ -7916,6 +8336,7 @@ namespace bgfx { namespace gl
 		uint32_t statsNumInstances[BX_COUNTOF(s_primInfo)] = {};
 		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
+		uint32_t uniformBytesSkipped = 0;
 
 		Profiler<TimerQueryGL> profiler(
 			  _render
@@ -7936,8 +8357,16 @@ namespace bgfx { namespace gl
 			viewState.m_rect = _render->m_view[0].m_rect;
 			int32_t numItems = _render->m_numRenderItems;
 
+			GpuRegionProfiler<GpuRegionQueryGL> gpuRegionProfiler(
+				  _render
+				, m_gpuRegionQuery
+				, m_timerQuerySupport
+				);
+
 			for (int32_t item = 0; item < numItems;)
 			{
+				gpuRegionProfiler.update(uint32_t(item) );
+
 				const uint64_t encodedKey = _render->m_sortKeys[item];
 				const bool isCompute = key.decode(encodedKey, _render->m_viewRemap);
 				statsKeyType[isCompute]++;
@@ -8035,7 +8464,9 @@ namespace bgfx { namespace gl
 						BGFX_GL_PROFILER_BEGIN(view, kColorCompute);
 					}
 
-					if (computeSupported)
+					// Skip dispatch while program is still being linked.
+					if (computeSupported
+					&&  m_program[key.m_program.idx].isReady() )
 					{
 						const RenderCompute& compute = renderItem.compute;
 
@@ -8130,8 +8561,13 @@ namespace bgfx { namespace gl
 
 						if (0 != barrier)
 						{
-							bool constantsChanged = compute.m_uniformBegin < compute.m_uniformEnd;
-							rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+							// GL keeps uniform values per program, values cached in m_uniforms might have been
+							// committed to other program, so program switch must commit all constants.
+							const bool programChanged = currentProgram.idx != key.m_program.idx;
+							currentProgram = key.m_program;
+
+							bool constantsChanged = rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd, uniformBytesSkipped);
+							constantsChanged |= programChanged;
 
 							if (constantsChanged
 							&&  NULL != program.m_constantBuffer)
@@ -8141,6 +8577,12 @@ namespace bgfx { namespace gl
 
 							viewState.setPredefined<1>(this, view, program, _render, compute);
 
+							if (isValid(compute.m_occlusionQuery)
+							&&  !isVisible(_render, compute.m_occlusionQuery, 0 != (compute.m_submitFlags&BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) ) )
+							{
+								continue;
+							}
+
 							if (isValid(compute.m_indirectBuffer) )
 							{
 								barrier |= GL_COMMAND_BARRIER_BIT;
@@ -8195,10 +8637,15 @@ namespace bgfx { namespace gl
 				const RenderDraw& draw = renderItem.draw;
 
 				const bool hasOcclusionQuery = 0 != (draw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY);
+				const GLuint conditionQuery  = !hasOcclusionQuery && isValid(draw.m_occlusionQuery)
+					? getConditionQuery(_render, draw)
+					: 0
+					;
 				{
 					const bool occluded = true
 						&& isValid(draw.m_occlusionQuery)
 						&& !hasOcclusionQuery
+						&& 0 == conditionQuery
 						&& !isVisible(_render, draw.m_occlusionQuery, 0 != (draw.m_submitFlags&BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) )
 						;
 
@@ -8566,16 +9013,18 @@ namespace bgfx { namespace gl
 				}
 
 				bool programChanged = false;
-				bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd;
+				bool constantsChanged = rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd, uniformBytesSkipped);
 				bool bindAttribs = false;
-				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
 
 				if (key.m_program.idx != currentProgram.idx)
 				{
 					currentProgram = key.m_program;
-					GLuint id = isValid(currentProgram) ? m_program[currentProgram.idx].m_id : 0;
+					GLuint id = isValid(currentProgram) && m_program[currentProgram.idx].isReady()
+						? m_program[currentProgram.idx].m_id
+						: 0
+						;
 
-					// Skip rendering if program index is valid, but program is invalid.
+					// Skip rendering if program index is valid, but program is invalid or not linked yet.
 					currentProgram = 0 == id ? ProgramHandle{kInvalidHandle} : currentProgram;
 
 					setProgram(id);
@@ -8594,7 +9043,7 @@ namespace bgfx { namespace gl
 						commit(*program.m_constantBuffer);
 					}
 
-					viewState.setPredefined<1>(this, view, program, _render, draw);
+					viewState.setPredefined<1>(this, view, program, _render, draw, programChanged);
 
 					{
 						GLbitfield barrier = 0;
@@ -8745,7 +9194,52 @@ namespace bgfx { namespace gl
 
 						if (0 != currentState.m_streamMask)
 						{
-							if (bindAttribs)
+							if (bindAttribs
+							&&  m_vertexArrayCacheActive)
+							{
+								boundProgram = BGFX_INVALID_HANDLE;
+
+								const GLuint prevVao = m_currentVao;
+								const GLuint vao     = getVertexArray(currentProgram, draw);
+								bindVertexArray(vao);
+
+								if (prevVao != vao)
+								{
+									// Element array binding is part of VAO state.
+									GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, isValid(draw.m_indexBuffer)
+										? m_indexBuffers[draw.m_indexBuffer.idx].m_id
+										: 0
+										) );
+								}
+
+								if (UINT32_MAX != draw.m_streamMask)
+								{
+									for (BitMaskToIndexIteratorT it(draw.m_streamMask); !it.isDone(); it.next() )
+									{
+										const uint8_t idx = it.idx;
+
+										const VertexBufferGL& vb = m_vertexBuffers[draw.m_stream[idx].m_handle.idx];
+										const uint16_t decl = isValid(draw.m_stream[idx].m_layoutHandle)
+											? draw.m_stream[idx].m_layoutHandle.idx
+											: vb.m_layoutHandle.idx;
+										const uint16_t stride = m_vertexLayouts[decl].m_stride;
+										GL_CHECK(glBindVertexBuffer(idx, vb.m_id, draw.m_stream[idx].m_startVertex*stride, stride) );
+									}
+
+									m_numVertexAttribCalls += bx::countBits(draw.m_streamMask);
+								}
+
+								if (isValid(draw.m_instanceDataBuffer) )
+								{
+									GL_CHECK(glBindVertexBuffer(BGFX_CONFIG_MAX_VERTEX_STREAMS
+										, m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_id
+										, draw.m_instanceDataOffset
+										, draw.m_instanceDataStride
+										) );
+									++m_numVertexAttribCalls;
+								}
+							}
+							else if (bindAttribs)
 							{
 								if (isValid(boundProgram) )
 								{
@@ -8770,6 +9264,7 @@ namespace bgfx { namespace gl
 											? draw.m_stream[idx].m_layoutHandle.idx
 											: vb.m_layoutHandle.idx;
 										GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
+										++m_numVertexAttribCalls;
 										program.bindAttributes(m_vertexLayouts[decl], draw.m_stream[idx].m_startVertex, idx == lastStream);
 									}
 								}
@@ -8777,6 +9272,7 @@ namespace bgfx { namespace gl
 								if (isValid(draw.m_instanceDataBuffer) )
 								{
 									GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_id) );
+									++m_numVertexAttribCalls;
 									program.bindInstanceData(draw.m_instanceDataStride, draw.m_instanceDataOffset);
 								}
 
@@ -8814,6 +9310,15 @@ namespace bgfx { namespace gl
 							m_occlusionQuery.begin(_render, draw.m_occlusionQuery);
 						}
 
+						if (0 != conditionQuery)
+						{
+							GL_CHECK(glBeginConditionalRender(conditionQuery
+								, 0 != (draw.m_submitFlags&BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE)
+									? GL_QUERY_WAIT
+									: GL_QUERY_WAIT_INVERTED
+								) );
+						}
+
 						if (isValid(draw.m_indirectBuffer) )
 						{
 							const VertexBufferGL& vb = m_vertexBuffers[draw.m_indirectBuffer.idx];
@@ -8965,6 +9470,11 @@ namespace bgfx { namespace gl
 							}
 						}
 
+						if (0 != conditionQuery)
+						{
+							GL_CHECK(glEndConditionalRender() );
+						}
+
 						if (hasOcclusionQuery)
 						{
 							m_occlusionQuery.end();
@@ -8984,6 +9494,8 @@ namespace bgfx { namespace gl
 				boundProgram = BGFX_INVALID_HANDLE;
 			}
 
+			gpuRegionProfiler.end();
+
 			if (wasCompute)
 			{
 				setViewType(view, "C");
@@ -9055,9 +9567,13 @@ namespace bgfx { namespace gl
 		perfStats.gpuTimerFreq  = 1000000000;
 		perfStats.numDraw       = statsKeyType[0];
 		perfStats.numCompute    = statsKeyType[1];
+		perfStats.uniformBytesSkipped = uniformBytesSkipped;
 		perfStats.numBlit       = _render->m_numBlitItems;
 		perfStats.maxGpuLatency = maxGpuLatency;
 		perfStats.gpuFrameNum   = result.m_frameNum;
+		perfStats.numVertexArrayBinds  = m_numVertexArrayBinds;
+		perfStats.numVertexAttribCalls = m_numVertexAttribCalls;
+		perfStats.numProgramsPending   = m_numProgramsPending;
 		bx::memCopy(perfStats.numPrims, statsNumPrimsRendered, sizeof(perfStats.numPrims) );
 		perfStats.gpuMemoryMax  = -INT64_MAX;
 		perfStats.gpuMemoryUsed = -INT64_MAX;
@@ -9150,9 +9666,10 @@ namespace bgfx { namespace gl
 
 				pos++;
 				tvm.printf(10, pos++, 0x8b, " State cache:     ");
-				tvm.printf(10, pos++, 0x8b, " Sampler ");
-				tvm.printf(10, pos++, 0x8b, " %6d  "
+				tvm.printf(10, pos++, 0x8b, " Sampler  VAO    ");
+				tvm.printf(10, pos++, 0x8b, " %6d  %6d  "
 					, m_samplerStateCache.getCount()
+					, m_vertexArrayCache.getCount()
 					);
 
 #if BGFX_CONFIG_RENDERER_OPENGL
@@ -9255,7 +9772,7 @@ namespace bgfx { namespace gl
 
 		if (0 != m_vao)
 		{
-			GL_CHECK(glBindVertexArray(0) );
+			bindVertexArray(0);
 		}
 	}
 } } // namespace bgfx
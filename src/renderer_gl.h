@@ -685,6 +685,14 @@ typedef double GLdouble;
 #	define GL_ANY_SAMPLES_PASSED 0x8C2F
 #endif // GL_ANY_SAMPLES_PASSED
 
+#ifndef GL_QUERY_WAIT
+#	define GL_QUERY_WAIT 0x8E13
+#endif // GL_QUERY_WAIT
+
+#ifndef GL_QUERY_WAIT_INVERTED
+#	define GL_QUERY_WAIT_INVERTED 0x8E17
+#endif // GL_QUERY_WAIT_INVERTED
+
 #ifndef GL_READ_FRAMEBUFFER
 #	define GL_READ_FRAMEBUFFER 0x8CA8
 #endif /// GL_READ_FRAMEBUFFER
@@ -701,6 +709,10 @@ typedef double GLdouble;
 #	define GL_TIMESTAMP 0x8E28
 #endif // GL_TIMESTAMP
 
+#ifndef GL_COMPLETION_STATUS_KHR
+#	define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif // GL_COMPLETION_STATUS_KHR
+
 #ifndef GL_VBO_FREE_MEMORY_ATI
 #	define GL_VBO_FREE_MEMORY_ATI 0x87FB
 #endif // GL_VBO_FREE_MEMORY_ATI
@@ -1326,6 +1338,21 @@ namespace bgfx { namespace gl
 		GL_CHECK(glDeleteTextures(1, &_view.idx) );
 	}
 
+	struct VertexArrayGL
+	{
+		VertexArrayGL(GLuint _idx = 0)
+			: idx(_idx)
+		{
+		}
+
+		GLuint idx;
+	};
+
+	inline void release(VertexArrayGL& _vao)
+	{
+		GL_CHECK(glDeleteVertexArrays(1, &_vao.idx) );
+	}
+
 	struct IndexBufferGL
 	{
 		void create(uint32_t _size, void* _data, uint16_t _flags)
@@ -1483,6 +1510,7 @@ namespace bgfx { namespace gl
 		bool m_immutableStorage;
 		int32_t m_baseLevel = 0;
 		int32_t m_maxLevel  = -1;
+		uint8_t m_minLod    = 0;
 		bool    m_depthStencilTexturing = false;
 	};
 
@@ -1536,6 +1564,11 @@ namespace bgfx { namespace gl
 	{
 		ProgramGL()
 			: m_id(0)
+			, m_vsh(0)
+			, m_fsh(0)
+			, m_cacheId(0)
+			, m_pending(false)
+			, m_cachePending(false)
 			, m_constantBuffer(NULL)
 			, m_numPredefined(0)
 		{
@@ -1546,6 +1579,16 @@ namespace bgfx { namespace gl
 		void destroy();
 		void init();
 
+		// Returns false while driver is still compiling and linking program in background. When
+		// `_wait` is true it blocks until link is finished.
+		bool isReady(bool _wait = false)
+		{
+			return !m_pending || resolve(_wait);
+		}
+
+		bool resolve(bool _wait);
+		void cache();
+
 		void bindAttributesBegin();
 		void bindAttributes(const VertexLayout& _layout, uint32_t _baseVertex = 0, bool _lastStream = true);
 		void bindInstanceData(uint32_t _stride, uint32_t _baseVertex = 0) const;
@@ -1553,7 +1596,16 @@ namespace bgfx { namespace gl
 		void unbindInstanceData() const;
 		void unbindAttributes();
 
+		// Sets attribute formats and bindings of currently bound VAO, stream
+		// `ii` is sourced from vertex buffer binding point `ii`.
+		void bindVertexFormat(const VertexLayout* const* _layout, uint32_t _streamMask, bool _instanceData) const;
+
 		GLuint m_id;
+		GLuint m_vsh;
+		GLuint m_fsh;
+		uint64_t m_cacheId;
+		bool m_pending;      // Link issued, but not completed yet.
+		bool m_cachePending; // Program binary not written into cache yet.
 
 		uint8_t m_unboundUsedAttrib[Attrib::Count]; // For tracking unbound used attributes between begin()/end().
 		uint8_t m_usedCount;
@@ -1718,6 +1770,91 @@ namespace bgfx { namespace gl
 		bx::RingBufferControl m_control;
 	};
 
+	struct GpuRegionQueryGL
+	{
+		GpuRegionQueryGL()
+			: m_control(BX_COUNTOF(m_slice) )
+		{
+		}
+
+		void create()
+		{
+			GL_CHECK(glGenQueries(BX_COUNTOF(m_query), &m_query[0][0]) );
+			m_control.reset();
+		}
+
+		void destroy()
+		{
+			GL_CHECK(glDeleteQueries(BX_COUNTOF(m_query), &m_query[0][0]) );
+		}
+
+		void resolve(Frame* _render)
+		{
+			if (0 != m_control.getNumUsed() )
+			{
+				const uint32_t idx = m_control.m_read;
+				const GpuRegionSlice& slice = m_slice[idx];
+
+				// Queries are written in order, when last is available all are.
+				GLuint available;
+				GL_CHECK(glGetQueryObjectuiv(m_query[idx][m_last[idx] ]
+					, GL_QUERY_RESULT_AVAILABLE
+					, &available
+					) );
+
+				if (available)
+				{
+					m_control.consume(1);
+
+					uint64_t timestamp[BGFX_CONFIG_MAX_GPU_REGIONS*2];
+
+					for (uint32_t ii = 0, num = slice.m_num*2; ii < num; ++ii)
+					{
+						GL_CHECK(glGetQueryObjectui64v(m_query[idx][ii]
+							, GL_QUERY_RESULT
+							, &timestamp[ii]
+							) );
+					}
+
+					slice.resolve(_render, timestamp);
+				}
+			}
+		}
+
+		uint32_t begin(const Frame* _render)
+		{
+			if (0 == m_control.reserve(1) )
+			{
+				return UINT32_MAX;
+			}
+
+			const uint32_t idx = m_control.m_current;
+			m_slice[idx].init(_render);
+
+			m_control.commit(1);
+
+			return idx;
+		}
+
+		void timestamp(uint32_t _idx, uint32_t _query)
+		{
+			m_last[_idx] = _query;
+
+			GL_CHECK(glQueryCounter(m_query[_idx][_query]
+				, GL_TIMESTAMP
+				) );
+		}
+
+		void end(uint32_t /*_idx*/)
+		{
+		}
+
+		GpuRegionSlice m_slice[kGpuRegionMaxFrames];
+		GLuint   m_query[kGpuRegionMaxFrames][BGFX_CONFIG_MAX_GPU_REGIONS*2];
+		uint32_t m_last[kGpuRegionMaxFrames];
+		bx::RingBufferControl m_control;
+	};
+
 	struct OcclusionQueryGL
 	{
 		OcclusionQueryGL()
@@ -1732,6 +1869,15 @@ namespace bgfx { namespace gl
 		void resolve(Frame* _render, bool _wait = false);
 		void invalidate(OcclusionQueryHandle _handle);
 
+		/// Returns query object issued for `_handle` in current frame, or 0.
+		GLuint getIssued(const Frame* _render, OcclusionQueryHandle _handle) const
+		{
+			return m_issuedFrame[_handle.idx] == _render->m_frameNum
+				? m_issuedId[_handle.idx]
+				: 0
+				;
+		}
+
 		struct Query
 		{
 			GLuint m_id;
@@ -1740,6 +1886,11 @@ namespace bgfx { namespace gl
 
 		Query m_query[BGFX_CONFIG_MAX_OCCLUSION_QUERIES];
 		bx::RingBufferControl m_control;
+
+		// Each query is used at most once per frame, ring buffer slot can't
+		// be reused before frame ends.
+		GLuint   m_issuedId[BGFX_CONFIG_MAX_OCCLUSION_QUERIES];
+		uint32_t m_issuedFrame[BGFX_CONFIG_MAX_OCCLUSION_QUERIES];
 	};
 
 } /* namespace gl */ } // namespace bgfx
@@ -1710,6 +1710,11 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 			release(mem);
 		}
 
+		void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) override
+		{
+			m_textures[_handle.idx].m_minLod = _minLod;
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr, uint16_t /*_layerIndex*/) override
 		{
 			m_textures[_handle.idx].overrideInternal(_ptr);
@@ -1855,9 +1860,15 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 				);
 		}
 
-		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
+		bool updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
 		{
+			if (0 == bx::memCmp(m_uniforms[_loc], _data, _size) )
+			{
+				return false;
+			}
+
 			bx::memCopy(m_uniforms[_loc], _data, _size);
+			return true;
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle _handle) override
@@ -2305,6 +2316,18 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 			setShaderUniform(_flags, _loc, _val, _numRegs);
 		}
 
+		void commit(const UniformCopyList& _uniformCopy, UniformBuffer* _constantBuffer)
+		{
+			if (_uniformCopy.isValid() )
+			{
+				_uniformCopy.commit(m_vsScratch, m_fsScratch, m_uniforms);
+			}
+			else if (NULL != _constantBuffer)
+			{
+				commit(*_constantBuffer);
+			}
+		}
+
 		void commit(UniformBuffer& _uniformBuffer)
 		{
 			_uniformBuffer.reset();
@@ -2959,6 +2982,12 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 				if (NULL != constantBuffer)
 				{
 					constantBuffer->finish();
+
+					UniformCopyList& uniformCopy = shaderType == 0
+						? ps->m_vshUniformCopy
+						: ps->m_fshUniformCopy
+						;
+					uniformCopy.create(*constantBuffer);
 				}
 			}
 		}
@@ -4168,6 +4197,7 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 			}
 
 			m_numMips = ti.numMips;
+			m_minLod  = 0;
 			const uint16_t numSides = ti.numLayers * (imageContainer.m_cubeMap ? 6 : 1);
 			const bool compressed   = bimg::isCompressed(bimg::TextureFormat::Enum(m_textureFormat) );
 			const bool writeOnly    = 0 != (_flags&BGFX_TEXTURE_RT_WRITE_ONLY);
@@ -4594,6 +4624,9 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 
 	MTL::Texture* TextureMtl::getTextureView(uint16_t _firstLayer, uint16_t _numLayers, uint8_t _firstMip, uint8_t _numMips, bool _stencil)
 	{
+		// Mips above min LOD are not resident.
+		_firstMip = bx::max(_firstMip, m_minLod);
+
 		MTL::Texture* ptr = _stencil && NULL != m_ptrStencil
 			? m_ptrStencil
 			: m_ptr
@@ -5869,6 +5902,8 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 
 		m_uniformScratchBuffer.begin();
 
+		_render->sort();
+
 		if (0 < _render->m_iboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
@@ -5883,8 +5918,6 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 			m_vertexBuffers[vb->handle.idx].update(0, bx::strideAlign(_render->m_vboffset,4), vb->data, true);
 		}
 
-		_render->sort();
-
 		RenderDraw currentState;
 		currentState.clear();
 		currentState.m_stateFlags = BGFX_STATE_NONE;
@@ -5928,6 +5961,7 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 		uint32_t statsNumDrawIndirect[BX_COUNTOF(s_primInfo)]   = {};
 		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
+		uint32_t uniformBytesSkipped = 0;
 
 		m_gpuTimer.beginFrame(_render->m_frameNum);
 
@@ -6249,7 +6283,7 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 
 					const RenderCompute& compute = renderItem.compute;
 
-					rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+					rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd, uniformBytesSkipped);
 
 					if (key.m_program.idx != currentProgram.idx)
 					{
@@ -6271,11 +6305,7 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 					{
 						uint32_t vertexUniformBufferSize = currentPso->m_vshConstantBufferSize;
 
-						UniformBuffer* vcb = currentPso->m_vshConstantBuffer;
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
+						commit(currentPso->m_vshUniformCopy, currentPso->m_vshConstantBuffer);
 
 						viewState.setPredefined<4>(this, view, *currentPso, _render, compute);
 
@@ -6344,6 +6374,12 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 						, currentPso->m_numThreads[2]
 						);
 
+					if (isValid(compute.m_occlusionQuery)
+					&&  !isVisible(_render, compute.m_occlusionQuery, 0 != (compute.m_submitFlags&BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) ) )
+					{
+						continue;
+					}
+
 					if (isValid(compute.m_indirectBuffer) )
 					{
 						const VertexBufferMtl& vb = m_vertexBuffers[compute.m_indirectBuffer.idx];
@@ -6529,7 +6565,7 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 				}
 
 				bool programChanged = false;
-				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd, uniformBytesSkipped);
 
 				bool vertexStreamChanged = hasVertexStreamChanged(currentState, draw);
 
@@ -6636,17 +6672,9 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 					const uint32_t vertexUniformBufferSize   = currentPso->m_vshConstantBufferSize;
 					const uint32_t fragmentUniformBufferSize = currentPso->m_fshConstantBufferSize;
 
-					UniformBuffer* vcb = currentPso->m_vshConstantBuffer;
-					if (NULL != vcb)
-					{
-						commit(*vcb);
-					}
+					commit(currentPso->m_vshUniformCopy, currentPso->m_vshConstantBuffer);
 
-					UniformBuffer* fcb = currentPso->m_fshConstantBuffer;
-					if (NULL != fcb)
-					{
-						commit(*fcb);
-					}
+					commit(currentPso->m_fshUniformCopy, currentPso->m_fshConstantBuffer);
 
 					viewState.setPredefined<4>(this, view, *currentPso, _render, draw);
 
@@ -6942,6 +6970,7 @@ static_assert(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNames
 		perfStats.gpuTimerFreq  = m_gpuTimer.m_frequency;
 		perfStats.numDraw       = statsKeyType[0];
 		perfStats.numCompute    = statsKeyType[1];
+		perfStats.uniformBytesSkipped = uniformBytesSkipped;
 		perfStats.numBlit       = _render->m_numBlitItems;
 		perfStats.maxGpuLatency = maxGpuLatency;
 		perfStats.gpuFrameNum   = m_gpuTimer.m_frameNum;
@@ -372,12 +372,17 @@ namespace bgfx { namespace mtl
 				m_fshConstantBuffer = NULL;
 			}
 
+			m_vshUniformCopy.destroy();
+			m_fshUniformCopy.destroy();
+
 			MTL_RELEASE_W(m_rps, 0);
 			MTL_RELEASE_W(m_cps, 0);
 		}
 
 		UniformBuffer* m_vshConstantBuffer;
 		UniformBuffer* m_fshConstantBuffer;
+		UniformCopyList m_vshUniformCopy;
+		UniformCopyList m_fshUniformCopy;
 
 		uint32_t m_vshConstantBufferSize;
 		uint32_t m_vshConstantBufferAlignment;
@@ -427,6 +432,7 @@ namespace bgfx { namespace mtl
 			, m_height(0)
 			, m_depth(0)
 			, m_numMips(0)
+			, m_minLod(0)
 		{
 		}
 
@@ -475,6 +481,7 @@ namespace bgfx { namespace mtl
 		uint8_t m_requestedFormat;
 		uint8_t m_textureFormat;
 		uint8_t m_numMips;
+		uint8_t m_minLod;
 	};
 
 	struct FrameBufferMtl;
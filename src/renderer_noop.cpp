@@ -186,6 +186,10 @@ namespace bgfx { namespace noop
 		{
 		}
 
+		void setTextureMinLod(TextureHandle /*_handle*/, uint8_t /*_minLod*/) override
+		{
+		}
+
 		void overrideInternal(TextureHandle /*_handle*/, uintptr_t /*_ptr*/, uint16_t /*_layerIndex*/) override
 		{
 		}
@@ -227,8 +231,9 @@ namespace bgfx { namespace noop
 		{
 		}
 
-		void updateUniform(uint16_t /*_loc*/, const void* /*_data*/, uint32_t /*_size*/) override
+		bool updateUniform(uint16_t /*_loc*/, const void* /*_data*/, uint32_t /*_size*/) override
 		{
+			return true;
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle /*_handle*/) override
@@ -379,10 +379,12 @@ VK_IMPORT_DEVICE
 	{
 		enum Enum
 		{
+			EXT_conditional_rendering,
 			EXT_conservative_rasterization,
 			EXT_custom_border_color,
 			EXT_debug_report,
 			EXT_debug_utils,
+			EXT_extended_dynamic_state,
 			EXT_line_rasterization,
 			EXT_memory_budget,
 			EXT_shader_viewport_index_layer,
@@ -427,10 +429,12 @@ VK_IMPORT_DEVICE
 	//
 	static Extension s_extension[] =
 	{
+		{ "VK_EXT_conditional_rendering",           1, false, false, true,                                                          Layer::Count },
 		{ "VK_EXT_conservative_rasterization",      1, false, false, true,                                                          Layer::Count },
 		{ "VK_EXT_custom_border_color",             1, false, false, true,                                                          Layer::Count },
 		{ "VK_EXT_debug_report",                    1, false, false, false,                                                         Layer::Count },
 		{ "VK_EXT_debug_utils",                     1, false, false, BGFX_CONFIG_DEBUG_OBJECT_NAME || BGFX_CONFIG_DEBUG_ANNOTATION, Layer::Count },
+		{ "VK_EXT_extended_dynamic_state",          1, false, false, true,                                                          Layer::Count },
 		{ "VK_EXT_line_rasterization",              1, false, false, true,                                                          Layer::Count },
 		{ "VK_EXT_memory_budget",                   1, false, false, true,                                                          Layer::Count },
 		{ "VK_EXT_shader_viewport_index_layer",     1, false, false, true,                                                          Layer::Count },
@@ -1273,8 +1277,10 @@ VK_IMPORT_DEVICE
 
 			const void* nextFeatures = NULL;
 
+			VkPhysicalDeviceConditionalRenderingFeaturesEXT conditionalRenderingFeatures = {};
 			VkPhysicalDeviceLineRasterizationFeaturesEXT lineRasterizationFeatures = {};
 			VkPhysicalDeviceCustomBorderColorFeaturesEXT customBorderColorFeatures = {};
+			VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures = {};
 			VkPhysicalDeviceFragmentShadingRateFeaturesKHR fragmentShadingRate = {};
 			VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT swapchainMaintenance1Features = {};
 
@@ -1692,6 +1698,14 @@ VK_IMPORT_INSTANCE
 
 					VkBaseOutStructure* next = (VkBaseOutStructure*)&deviceFeatures2;
 
+					if (s_extension[Extension::EXT_conditional_rendering].m_supported)
+					{
+						next->pNext = (VkBaseOutStructure*)&conditionalRenderingFeatures;
+						next = (VkBaseOutStructure*)&conditionalRenderingFeatures;
+						conditionalRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT;
+						conditionalRenderingFeatures.pNext = NULL;
+					}
+
 					if (s_extension[Extension::EXT_line_rasterization].m_supported)
 					{
 						next->pNext = (VkBaseOutStructure*)&lineRasterizationFeatures;
@@ -1708,6 +1722,14 @@ VK_IMPORT_INSTANCE
 						customBorderColorFeatures.pNext = NULL;
 					}
 
+					if (s_extension[Extension::EXT_extended_dynamic_state].m_supported)
+					{
+						next->pNext = (VkBaseOutStructure*)&extendedDynamicStateFeatures;
+						next = (VkBaseOutStructure*)&extendedDynamicStateFeatures;
+						extendedDynamicStateFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+						extendedDynamicStateFeatures.pNext = NULL;
+					}
+
 					if (s_extension[Extension::EXT_swapchain_maintenance1].m_supported)
 					{
 						next->pNext = (VkBaseOutStructure*)&swapchainMaintenance1Features;
@@ -1845,6 +1867,16 @@ VK_IMPORT_INSTANCE
 					&& customBorderColorFeatures.customBorderColors
 					;
 
+				m_extendedDynamicStateSupported = true
+					&& s_extension[Extension::EXT_extended_dynamic_state].m_supported
+					&& extendedDynamicStateFeatures.extendedDynamicState
+					;
+
+				m_conditionalRenderSupported = true
+					&& s_extension[Extension::EXT_conditional_rendering].m_supported
+					&& conditionalRenderingFeatures.conditionalRendering
+					;
+
 				m_timerQuerySupport = m_deviceProperties.limits.timestampComputeAndGraphics;
 
 				m_swapchainMaintenance1Supported = true
@@ -2188,6 +2220,28 @@ VK_IMPORT_DEVICE
 				goto error;
 			}
 
+			m_extendedDynamicStateSupported = true
+				&& m_extendedDynamicStateSupported
+				&& NULL != vkCmdSetCullModeEXT
+				&& NULL != vkCmdSetFrontFaceEXT
+				&& NULL != vkCmdSetPrimitiveTopologyEXT
+				&& NULL != vkCmdSetDepthTestEnableEXT
+				&& NULL != vkCmdSetDepthWriteEnableEXT
+				&& NULL != vkCmdSetDepthCompareOpEXT
+				&& NULL != vkCmdSetStencilTestEnableEXT
+				&& NULL != vkCmdSetStencilOpEXT
+				;
+
+			BX_TRACE("Extended dynamic state: %s", m_extendedDynamicStateSupported ? "supported" : "not supported");
+
+			m_conditionalRenderSupported = true
+				&& m_conditionalRenderSupported
+				&& NULL != vkCmdBeginConditionalRenderingEXT
+				&& NULL != vkCmdEndConditionalRenderingEXT
+				;
+
+			g_caps.supported |= m_conditionalRenderSupported ? BGFX_CAPS_CONDITIONAL_RENDER : 0;
+
 			vkGetDeviceQueue(m_device, m_globalQueueFamily, 0, &m_globalQueue);
 			vkGetDeviceQueue(m_device, m_videoDecodeQueueFamily, 0, &m_videoDecodeQueue);
 
@@ -2380,6 +2434,15 @@ VK_IMPORT_DEVICE
 					BX_TRACE("Init error: creating GPU timer failed %d: %s.", result, getName(result) );
 					goto error;
 				}
+
+				result = m_gpuRegionQuery.init();
+
+				if (VK_SUCCESS != result)
+				{
+					BX_TRACE("Init error: creating GPU region query failed %d: %s.", result, getName(result) );
+					m_gpuTimer.shutdown();
+					goto error;
+				}
 			}
 
 			errorState = ErrorState::TimerQueryCreated;
@@ -2403,6 +2466,7 @@ VK_IMPORT_DEVICE
 				if (m_timerQuerySupport)
 				{
 					m_gpuTimer.shutdown();
+					m_gpuRegionQuery.shutdown();
 				}
 				[[fallthrough]];
 
@@ -2463,6 +2527,7 @@ VK_IMPORT_DEVICE
 			if (m_timerQuerySupport)
 			{
 				m_gpuTimer.shutdown();
+				m_gpuRegionQuery.shutdown();
 			}
 			m_occlusionQuery.shutdown();
 
@@ -2736,6 +2801,11 @@ VK_IMPORT_DEVICE
 			bgfx::release(mem);
 		}
 
+		void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) override
+		{
+			m_textures[_handle.idx].m_minLod = _minLod;
+		}
+
 		void overrideInternal(TextureHandle /*_handle*/, uintptr_t /*_ptr*/, uint16_t /*_layerIndex*/) override
 		{
 		}
@@ -2869,9 +2939,15 @@ VK_IMPORT_DEVICE
 				);
 		}
 
-		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
+		bool updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
 		{
+			if (0 == bx::memCmp(m_uniforms[_loc], _data, _size) )
+			{
+				return false;
+			}
+
 			bx::memCopy(m_uniforms[_loc], _data, _size);
+			return true;
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle _handle) override
@@ -2993,6 +3069,7 @@ VK_IMPORT_DEVICE
 				, 0
 				);
 			vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pso);
+			setDynamicState(state, packStencil(BGFX_STENCIL_NONE, BGFX_STENCIL_NONE) );
 
 			ProgramVK& program = m_program[_blitter.m_program.idx];
 			float proj[16];
@@ -3002,12 +3079,7 @@ VK_IMPORT_DEVICE
 			uint8_t flags = predefined.m_type;
 			setShaderUniform(flags, predefined.m_loc, proj, 4);
 
-			UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-
-			if (NULL != vcb)
-			{
-				commit(*vcb);
-			}
+			commit(*program.m_vsh);
 
 			ChunkedScratchBufferVK& uniformScratchBuffer = m_uniformScratchBuffer;
 
@@ -3523,6 +3595,89 @@ VK_IMPORT_DEVICE
 			_desc.maxDepthBounds = 1.0f;
 		}
 
+		static constexpr uint64_t kDynamicStateMask = 0
+			| BGFX_STATE_CULL_MASK
+			| BGFX_STATE_FRONT_CCW
+			| BGFX_STATE_DEPTH_TEST_MASK
+			| BGFX_STATE_WRITE_Z
+			| BGFX_STATE_PT_MASK
+			;
+
+		// With VK_EXT_extended_dynamic_state cull mode, front face, topology, depth and stencil
+		// state are not part of the pipeline, and must be set after the pipeline is bound.
+		void setDynamicState(uint64_t _state, uint64_t _stencil)
+		{
+			if (!m_extendedDynamicStateSupported)
+			{
+				return;
+			}
+
+			_state   &= kDynamicStateMask;
+			_stencil &= kStencilNoRefAndRwMask;
+
+			const uint64_t changedState   = m_dynamicStateValid ? m_dynamicState   ^ _state   : UINT64_MAX;
+			const uint64_t changedStencil = m_dynamicStateValid ? m_dynamicStencil ^ _stencil : UINT64_MAX;
+
+			m_dynamicState      = _state;
+			m_dynamicStencil    = _stencil;
+			m_dynamicStateValid = true;
+
+			if (0 != (changedState & BGFX_STATE_CULL_MASK) )
+			{
+				const uint32_t cull = (_state&BGFX_STATE_CULL_MASK) >> BGFX_STATE_CULL_SHIFT;
+				vkCmdSetCullModeEXT(m_commandBuffer, s_cullMode[cull]);
+			}
+
+			if (0 != (changedState & BGFX_STATE_FRONT_CCW) )
+			{
+				vkCmdSetFrontFaceEXT(m_commandBuffer, (_state&BGFX_STATE_FRONT_CCW) ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+			}
+
+			if (0 != (changedState & BGFX_STATE_PT_MASK) )
+			{
+				vkCmdSetPrimitiveTopologyEXT(m_commandBuffer, s_primInfo[(_state&BGFX_STATE_PT_MASK) >> BGFX_STATE_PT_SHIFT].m_topology);
+			}
+
+			if (0 != (changedState & BGFX_STATE_DEPTH_TEST_MASK) )
+			{
+				const uint32_t func = (_state&BGFX_STATE_DEPTH_TEST_MASK) >> BGFX_STATE_DEPTH_TEST_SHIFT;
+				vkCmdSetDepthTestEnableEXT(m_commandBuffer, 0 != func);
+				vkCmdSetDepthCompareOpEXT(m_commandBuffer, s_cmpFunc[func]);
+			}
+
+			if (0 != (changedState & BGFX_STATE_WRITE_Z) )
+			{
+				vkCmdSetDepthWriteEnableEXT(m_commandBuffer, !!(_state&BGFX_STATE_WRITE_Z) );
+			}
+
+			if (0 != changedStencil)
+			{
+				const bool enabled = stencilEnabled(_stencil);
+				vkCmdSetStencilTestEnableEXT(m_commandBuffer, enabled);
+
+				if (enabled)
+				{
+					const uint32_t fstencil = unpackStencil(0, _stencil);
+					const uint32_t bstencil = stencilFrontAndBack(_stencil) ? unpackStencil(1, _stencil) : fstencil;
+
+					vkCmdSetStencilOpEXT(m_commandBuffer
+						, VK_STENCIL_FACE_FRONT_BIT
+						, s_stencilOp[(fstencil & BGFX_STENCIL_OP_FAIL_S_MASK) >> BGFX_STENCIL_OP_FAIL_S_SHIFT]
+						, s_stencilOp[(fstencil & BGFX_STENCIL_OP_PASS_Z_MASK) >> BGFX_STENCIL_OP_PASS_Z_SHIFT]
+						, s_stencilOp[(fstencil & BGFX_STENCIL_OP_FAIL_Z_MASK) >> BGFX_STENCIL_OP_FAIL_Z_SHIFT]
+						, s_cmpFunc[(fstencil & BGFX_STENCIL_TEST_MASK) >> BGFX_STENCIL_TEST_SHIFT]
+						);
+					vkCmdSetStencilOpEXT(m_commandBuffer
+						, VK_STENCIL_FACE_BACK_BIT
+						, s_stencilOp[(bstencil & BGFX_STENCIL_OP_FAIL_S_MASK) >> BGFX_STENCIL_OP_FAIL_S_SHIFT]
+						, s_stencilOp[(bstencil & BGFX_STENCIL_OP_PASS_Z_MASK) >> BGFX_STENCIL_OP_PASS_Z_SHIFT]
+						, s_stencilOp[(bstencil & BGFX_STENCIL_OP_FAIL_Z_MASK) >> BGFX_STENCIL_OP_FAIL_Z_SHIFT]
+						, s_cmpFunc[(bstencil & BGFX_STENCIL_TEST_MASK) >> BGFX_STENCIL_TEST_SHIFT]
+						);
+				}
+			}
+		}
+
 		void setInputLayout(VkPipelineVertexInputStateCreateInfo& _vertexInputState, uint8_t _numStream, const VertexLayout** _layout, const ProgramVK& _program, uint8_t _numInstanceData)
 		{
 			_vertexInputState.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -4010,6 +4165,18 @@ VK_IMPORT_DEVICE
 
 			_stencil &= kStencilNoRefAndRwMask;
 
+			if (m_extendedDynamicStateSupported)
+			{
+				// Only topology class must match pipeline, actual topology is dynamic.
+				const uint64_t pt = _state & BGFX_STATE_PT_MASK;
+				_state &= ~(kDynamicStateMask);
+				_state |= BGFX_STATE_PT_TRISTRIP  == pt ? 0
+					:     BGFX_STATE_PT_LINESTRIP == pt ? BGFX_STATE_PT_LINES
+					:     pt
+					;
+				_stencil = 0;
+			}
+
 			VertexLayout layout;
 			if (0 < _numStreams)
 			{
@@ -4111,17 +4278,35 @@ VK_IMPORT_DEVICE
 				VK_DYNAMIC_STATE_STENCIL_REFERENCE,
 				VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK,
 				VK_DYNAMIC_STATE_STENCIL_WRITE_MASK,
-				VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR, // optional
 			};
 
+			VkDynamicState dynamicStatesExt[BX_COUNTOF(dynamicStates) + 9];
+			uint32_t numDynamicStates = BX_COUNTOF(dynamicStates);
+			bx::memCopy(dynamicStatesExt, dynamicStates, sizeof(dynamicStates) );
+
+			if (m_variableRateShadingSupported)
+			{
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR;
+			}
+
+			if (m_extendedDynamicStateSupported)
+			{
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_CULL_MODE_EXT;
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_FRONT_FACE_EXT;
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT;
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT;
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT;
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT;
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT;
+				dynamicStatesExt[numDynamicStates++] = VK_DYNAMIC_STATE_STENCIL_OP_EXT;
+			}
+
 			VkPipelineDynamicStateCreateInfo dynamicState;
 			dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
 			dynamicState.pNext = NULL;
 			dynamicState.flags = 0;
-			dynamicState.dynamicStateCount = BX_COUNTOF(dynamicStates) -
-				(m_variableRateShadingSupported ? 0 : 1)
-				;
-			dynamicState.pDynamicStates = dynamicStates;
+			dynamicState.dynamicStateCount = numDynamicStates;
+			dynamicState.pDynamicStates = dynamicStatesExt;
 
 			VkPipelineShaderStageCreateInfo shaderStages[2];
 			shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -4434,13 +4619,16 @@ VK_IMPORT_DEVICE
 								: _program.m_textures[bindInfo.index].type
 								;
 
+							// Mips above min LOD are not resident.
+							const uint8_t firstMip = bx::max(bind.m_firstMip, texture.m_minLod);
+
 							texture.setState(m_commandBuffer, texture.m_sampledLayout);
 
 							imageInfo[imageCount].imageLayout = texture.m_sampledLayout;
 							imageInfo[imageCount].sampler     = sampler;
 							imageInfo[imageCount].imageView   = getCachedImageView(
 								  { bind.m_idx }
-								, bind.m_firstMip
+								, firstMip
 								, bind.m_numMips
 								, type
 								, sampleStencil
@@ -4597,6 +4785,52 @@ VK_IMPORT_DEVICE
 			return _visible == (0 != _render->m_occlusion[_handle.idx]);
 		}
 
+		bool hasConditionCurrent(const Frame* _render) const
+		{
+			for (uint32_t ii = 0, num = _render->m_numRenderItems; ii < num; ++ii)
+			{
+				const RenderItem& renderItem = _render->m_renderItem[_render->m_sortValues[ii] ];
+
+				const bool hasCondition = 0 != (_render->m_sortKeys[ii] & kSortKeyDrawBit)
+					? isValid(renderItem.draw.m_occlusionQuery)    && 0 != (renderItem.draw.m_submitFlags    & BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT)
+					: isValid(renderItem.compute.m_occlusionQuery) && 0 != (renderItem.compute.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT)
+					;
+
+				if (hasCondition)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void beginConditionalRendering(OcclusionQueryHandle _handle, bool _visible)
+		{
+			VkConditionalRenderingBeginInfoEXT crbi;
+			crbi.sType  = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT;
+			crbi.pNext  = NULL;
+			crbi.buffer = m_occlusionQuery.m_predicate;
+			crbi.offset = _handle.idx * sizeof(uint32_t);
+			crbi.flags  = _visible
+				? 0
+				: VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT
+				;
+			vkCmdBeginConditionalRenderingEXT(m_commandBuffer, &crbi);
+		}
+
+		void commit(const ShaderVK& _shader)
+		{
+			if (_shader.m_uniformCopy.isValid() )
+			{
+				_shader.m_uniformCopy.commit(m_vsScratch, m_fsScratch, m_uniforms);
+			}
+			else if (NULL != _shader.m_constantBuffer)
+			{
+				commit(*_shader.m_constantBuffer);
+			}
+		}
+
 		void commit(UniformBuffer& _uniformBuffer)
 		{
 			_uniformBuffer.reset();
@@ -4797,6 +5031,7 @@ VK_IMPORT_DEVICE
 		{
 			m_cmd.kick(_finishAll);
 			VK_CHECK(m_cmd.alloc(&m_commandBuffer) );
+			m_dynamicStateValid = false;
 			m_cmd.finish(_finishAll);
 		}
 
@@ -5013,6 +5248,12 @@ VK_IMPORT_DEVICE
 		bool m_borderColorSupport;
 		bool m_timerQuerySupport;
 		bool m_swapchainMaintenance1Supported = false;
+		bool m_extendedDynamicStateSupported = false;
+		bool m_conditionalRenderSupported = false;
+
+		uint64_t m_dynamicState;
+		uint64_t m_dynamicStencil;
+		bool     m_dynamicStateValid = false;
 
 		FrameBufferVK m_backBuffer;
 
@@ -5048,6 +5289,7 @@ VK_IMPORT_DEVICE
 		VkPipelineCache  m_pipelineCache;
 
 		TimerQueryVK m_gpuTimer;
+		GpuRegionQueryVK m_gpuRegionQuery;
 		OcclusionQueryVK m_occlusionQuery;
 
 		void* m_renderDocDll;
@@ -5848,6 +6090,7 @@ VK_DESTROY
 			if (NULL != m_constantBuffer)
 			{
 				m_constantBuffer->finish();
+				m_uniformCopy.create(*m_constantBuffer);
 			}
 		}
 
@@ -5977,6 +6220,8 @@ VK_DESTROY
 			m_constantBuffer = NULL;
 		}
 
+		m_uniformCopy.destroy();
+
 		m_numPredefined = 0;
 
 		if (NULL != m_code)
@@ -6318,6 +6563,134 @@ VK_DESTROY
 		return false;
 	}
 
+	VkResult GpuRegionQueryVK::init()
+	{
+		BGFX_PROFILER_SCOPE("GpuRegionQueryVK::init", kColorFrame);
+		VkResult result = VK_SUCCESS;
+
+		const VkDevice device = s_renderVK->m_device;
+		const VkCommandBuffer commandBuffer = s_renderVK->m_commandBuffer;
+
+		const uint32_t count = m_control.m_size * BGFX_CONFIG_MAX_GPU_REGIONS * 2;
+
+		VkQueryPoolCreateInfo qpci;
+		qpci.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		qpci.pNext = NULL;
+		qpci.flags = 0;
+		qpci.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		qpci.queryCount = count;
+		qpci.pipelineStatistics = 0;
+
+		result = vkCreateQueryPool(device, &qpci, s_renderVK->m_allocatorCb, &m_queryPool);
+
+		if (VK_SUCCESS != result)
+		{
+			BX_TRACE("Create GPU region query error: vkCreateQueryPool failed %d: %s.", result, getName(result) );
+			return result;
+		}
+
+		vkCmdResetQueryPool(commandBuffer, m_queryPool, 0, count);
+
+		const uint32_t size = count * sizeof(uint64_t);
+		result = s_renderVK->createReadbackBuffer(size, &m_readback, &m_readbackMemory);
+
+		if (VK_SUCCESS != result)
+		{
+			return result;
+		}
+
+		result = vkMapMemory(device, m_readbackMemory.mem, m_readbackMemory.offset, VK_WHOLE_SIZE, 0, (void**)&m_queryResult);
+
+		if (VK_SUCCESS != result)
+		{
+			BX_TRACE("Create GPU region query error: vkMapMemory failed %d: %s.", result, getName(result) );
+			return result;
+		}
+
+		m_control.reset();
+
+		return result;
+	}
+
+	void GpuRegionQueryVK::shutdown()
+	{
+		vkDestroy(m_queryPool);
+		vkDestroy(m_readback);
+		vkUnmapMemory(s_renderVK->m_device, m_readbackMemory.mem);
+		s_renderVK->recycleMemory(m_readbackMemory);
+	}
+
+	void GpuRegionQueryVK::resolve(Frame* _render)
+	{
+		if (0 != m_control.getNumUsed() )
+		{
+			const uint32_t idx = m_control.m_read;
+
+			if (m_completed[idx] <= s_renderVK->m_cmd.m_submitted)
+			{
+				m_control.consume(1);
+
+				m_slice[idx].resolve(_render, &m_queryResult[idx * BGFX_CONFIG_MAX_GPU_REGIONS * 2]);
+			}
+		}
+	}
+
+	uint32_t GpuRegionQueryVK::begin(const Frame* _render)
+	{
+		BGFX_PROFILER_SCOPE("GpuRegionQueryVK::begin", kColorFrame);
+
+		// Don't wait for older results, regions of this frame are not timed instead.
+		if (0 == m_control.reserve(1) )
+		{
+			return UINT32_MAX;
+		}
+
+		const uint32_t idx = m_control.m_current;
+		GpuRegionSlice& slice = m_slice[idx];
+		slice.init(_render);
+		m_completed[idx] = UINT64_MAX;
+
+		const VkCommandBuffer commandBuffer = s_renderVK->m_commandBuffer;
+		const uint32_t offset = idx * BGFX_CONFIG_MAX_GPU_REGIONS * 2;
+
+		vkCmdResetQueryPool(commandBuffer, m_queryPool, offset, slice.m_num * 2);
+
+		m_control.commit(1);
+
+		return idx;
+	}
+
+	void GpuRegionQueryVK::timestamp(uint32_t _idx, uint32_t _query)
+	{
+		const VkCommandBuffer commandBuffer = s_renderVK->m_commandBuffer;
+		const uint32_t offset = _idx * BGFX_CONFIG_MAX_GPU_REGIONS * 2;
+
+		vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPool, offset + _query);
+	}
+
+	void GpuRegionQueryVK::end(uint32_t _idx)
+	{
+		BGFX_PROFILER_SCOPE("GpuRegionQueryVK::end", kColorFrame);
+
+		m_completed[_idx] = s_renderVK->m_cmd.m_submitted + s_renderVK->m_maxFrameLatency;
+
+		const VkCommandBuffer commandBuffer = s_renderVK->m_commandBuffer;
+		const uint32_t offset = _idx * BGFX_CONFIG_MAX_GPU_REGIONS * 2;
+
+		vkCmdCopyQueryPoolResults(
+			  commandBuffer
+			, m_queryPool
+			, offset
+			, m_slice[_idx].m_num * 2
+			, m_readback
+			, offset * sizeof(uint64_t)
+			, sizeof(uint64_t)
+			, VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_64_BIT
+			);
+
+		setMemoryBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT);
+	}
+
 	VkResult OcclusionQueryVK::init()
 	{
 		BGFX_PROFILER_SCOPE("OcclusionQueryVK::init", kColorFrame);
@@ -6365,6 +6738,53 @@ VK_DESTROY
 
 		m_control.reset();
 
+		m_predicate  = VK_NULL_HANDLE;
+		m_numPending = 0;
+		bx::memSet(m_predicatedFrame, 0xff, sizeof(m_predicatedFrame) );
+
+		if (s_renderVK->m_conditionalRenderSupported)
+		{
+			VkBufferCreateInfo bci;
+			bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+			bci.pNext = NULL;
+			bci.flags = 0;
+			bci.size  = size;
+			bci.usage = 0
+				| VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT
+				| VK_BUFFER_USAGE_TRANSFER_DST_BIT
+				;
+			bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+			bci.queueFamilyIndexCount = 0;
+			bci.pQueueFamilyIndices   = NULL;
+
+			result = vkCreateBuffer(device, &bci, s_renderVK->m_allocatorCb, &m_predicate);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Create occlusion query error: vkCreateBuffer failed %d: %s.", result, getName(result) );
+				return result;
+			}
+
+			VkMemoryRequirements mr;
+			vkGetBufferMemoryRequirements(device, m_predicate, &mr);
+
+			result = s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_predicateMemory, false);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Create occlusion query error: vkAllocateMemory failed %d: %s.", result, getName(result) );
+				return result;
+			}
+
+			result = vkBindBufferMemory(device, m_predicate, m_predicateMemory.mem, m_predicateMemory.offset);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Create occlusion query error: vkBindBufferMemory failed %d: %s.", result, getName(result) );
+				return result;
+			}
+		}
+
 		return result;
 	}
 
@@ -6374,6 +6794,12 @@ VK_DESTROY
 		vkDestroy(m_readback);
 		vkUnmapMemory(s_renderVK->m_device, m_readbackMemory.mem);
 		s_renderVK->recycleMemory(m_readbackMemory);
+
+		if (VK_NULL_HANDLE != m_predicate)
+		{
+			vkDestroy(m_predicate);
+			s_renderVK->recycleMemory(m_predicateMemory);
+		}
 	}
 
 	void OcclusionQueryVK::begin(OcclusionQueryHandle _handle)
@@ -6398,6 +6824,7 @@ VK_DESTROY
 		vkCmdEndQuery(commandBuffer, m_queryPool, handle.idx);
 
 		m_control.commit(1);
+		++m_numPending;
 	}
 
 	void OcclusionQueryVK::flush(Frame* _render)
@@ -6441,6 +6868,41 @@ VK_DESTROY
 
 			resolve(_render);
 		}
+
+		m_numPending = 0;
+	}
+
+	void OcclusionQueryVK::predicate(Frame* _render)
+	{
+		BGFX_PROFILER_SCOPE("OcclusionQueryVK::predicate", kColorFrame);
+
+		const VkCommandBuffer commandBuffer = s_renderVK->m_commandBuffer;
+
+		const uint32_t size = m_control.m_size;
+
+		for (uint32_t ii = 0; ii < m_numPending; ++ii)
+		{
+			const OcclusionQueryHandle& handle = m_handle[(m_control.m_current + size - m_numPending + ii) % size];
+			if (isValid(handle) )
+			{
+				vkCmdCopyQueryPoolResults(
+					  commandBuffer
+					, m_queryPool
+					, handle.idx
+					, 1
+					, m_predicate
+					, handle.idx * sizeof(uint32_t)
+					, sizeof(uint32_t)
+					, VK_QUERY_RESULT_WAIT_BIT
+					);
+
+				m_predicatedFrame[handle.idx] = _render->m_frameNum;
+			}
+		}
+
+		m_numPending = 0;
+
+		setMemoryBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT);
 	}
 
 	void OcclusionQueryVK::resolve(Frame* _render)
@@ -6468,6 +6930,8 @@ VK_DESTROY
 				handle.idx = bgfx::kInvalidHandle;
 			}
 		}
+
+		m_predicatedFrame[_handle.idx] = UINT32_MAX;
 	}
 
 	void ReadbackVK::create(VkImage _image, uint32_t _width, uint32_t _height, TextureFormat::Enum _format)
@@ -6878,6 +7342,7 @@ VK_DESTROY
 			m_height    = ti.height;
 			m_depth     = ti.depth;
 			m_numLayers = ti.numLayers;
+			m_minLod    = 0;
 			m_requestedFormat = uint8_t(imageContainer.m_format);
 			m_textureFormat   = uint8_t(getViableTextureFormat(imageContainer) );
 			m_format = bimg::isDepth(bimg::TextureFormat::Enum(m_textureFormat) )
@@ -9741,6 +10206,8 @@ VK_DESTROY
 			frameQueryIdx = m_gpuTimer.begin(BGFX_CONFIG_MAX_VIEWS, _render->m_frameNum);
 		}
 
+		_render->sort();
+
 		if (0 < _render->m_iboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
@@ -9757,8 +10224,6 @@ VK_DESTROY
 			m_vertexBuffers[vb->handle.idx].update(m_commandBuffer, 0, _render->m_vboffset, vb->data);
 		}
 
-		_render->sort();
-
 		RenderDraw currentState;
 		currentState.clear();
 		currentState.m_stateFlags = BGFX_STATE_NONE;
@@ -9772,6 +10237,7 @@ VK_DESTROY
 
 		ProgramHandle currentProgram = BGFX_INVALID_HANDLE;
 		bool hasPredefined = false;
+		bool uniformsChanged = false;
 		VkPipeline currentPipeline = VK_NULL_HANDLE;
 		VkDescriptorSet currentDescriptorSet = VK_NULL_HANDLE;
 		uint32_t currentBindHash = 0;
@@ -9817,6 +10283,7 @@ VK_DESTROY
 		uint32_t statsNumInstances[BX_COUNTOF(s_primInfo)] = {};
 		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
+		uint32_t uniformBytesSkipped = 0;
 
 		const uint64_t f0 = BGFX_STATE_BLEND_FACTOR;
 		const uint64_t f1 = BGFX_STATE_BLEND_INV_FACTOR;
@@ -9863,13 +10330,27 @@ VK_DESTROY
 
 		m_occlusionQuery.flush(_render);
 
+		const bool conditionCurrent = true
+			&& m_conditionalRenderSupported
+			&& hasConditionCurrent(_render)
+			;
+
 		if (0 == (_render->m_debug&BGFX_DEBUG_IFH) )
 		{
 			viewState.m_rect = _render->m_view[0].m_rect;
 
+			// Query pool is reset outside of render pass.
+			GpuRegionProfiler<GpuRegionQueryVK> gpuRegionProfiler(
+				  _render
+				, m_gpuRegionQuery
+				, m_timerQuerySupport
+				);
+
 			int32_t numItems = _render->m_numRenderItems;
 			for (int32_t item = 0; item < numItems;)
 			{
+				gpuRegionProfiler.update(uint32_t(item) );
+
 				const uint64_t encodedKey = _render->m_sortKeys[item];
 				const bool isCompute = key.decode(encodedKey, _render->m_viewRemap);
 				statsKeyType[isCompute]++;
@@ -9934,6 +10415,19 @@ VK_DESTROY
 						beginRenderPass = false;
 					}
 
+					if (conditionCurrent
+					&&  0 != m_occlusionQuery.m_numPending)
+					{
+						// Query results can't be copied inside render pass.
+						if (beginRenderPass)
+						{
+							vkCmdEndRenderPass(m_commandBuffer);
+							beginRenderPass = false;
+						}
+
+						m_occlusionQuery.predicate(_render);
+					}
+
 					submitUniformCache(ucs, view);
 					submitBlit(bs, view);
 
@@ -10159,17 +10653,12 @@ VK_DESTROY
 					if (compute.m_uniformBegin < compute.m_uniformEnd
 					||  currentProgram.idx != key.m_program.idx)
 					{
-						rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+						rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd, uniformBytesSkipped);
 
 						currentProgram = key.m_program;
 						ProgramVK& program = m_program[currentProgram.idx];
 
-						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
+						commit(*program.m_vsh);
 
 						hasPredefined = 0 < program.m_numPredefined;
 						constantsChanged = true;
@@ -10246,6 +10735,25 @@ VK_DESTROY
 							);
 					}
 
+					const bool hasCondition = true
+						&& conditionCurrent
+						&& isValid(compute.m_occlusionQuery)
+						&& 0 != (compute.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT)
+						&& m_occlusionQuery.isPredicated(_render, compute.m_occlusionQuery)
+						;
+
+					if (isValid(compute.m_occlusionQuery)
+					&&  !hasCondition
+					&&  !isVisible(_render, compute.m_occlusionQuery, 0 != (compute.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) ) )
+					{
+						continue;
+					}
+
+					if (hasCondition)
+					{
+						beginConditionalRendering(compute.m_occlusionQuery, 0 != (compute.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) );
+					}
+
 					if (isValid(compute.m_indirectBuffer) )
 					{
 						const VertexBufferVK& vb = m_vertexBuffers[compute.m_indirectBuffer.idx];
@@ -10267,18 +10775,32 @@ VK_DESTROY
 						vkCmdDispatch(m_commandBuffer, compute.m_numX, compute.m_numY, compute.m_numZ);
 					}
 
+					if (hasCondition)
+					{
+						vkCmdEndConditionalRenderingEXT(m_commandBuffer);
+					}
+
 					continue;
 				}
 
 				const RenderDraw& draw = renderItem.draw;
 
-				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				// Draw might be skipped before constants are committed, keep change pending until then.
+				uniformsChanged |= rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd, uniformBytesSkipped);
 
 				const bool hasOcclusionQuery = 0 != (draw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY);
+				const bool hasCondition = true
+					&& conditionCurrent
+					&& !hasOcclusionQuery
+					&& isValid(draw.m_occlusionQuery)
+					&& 0 != (draw.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_CURRENT)
+					&& m_occlusionQuery.isPredicated(_render, draw.m_occlusionQuery)
+					;
 				{
 					const bool occluded = true
 						&& isValid(draw.m_occlusionQuery)
 						&& !hasOcclusionQuery
+						&& !hasCondition
 						&& !isVisible(_render, draw.m_occlusionQuery, 0 != (draw.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) )
 						;
 
@@ -10408,6 +10930,8 @@ VK_DESTROY
 						vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
 					}
 
+					setDynamicState(draw.m_stateFlags, draw.m_stencil);
+
 					const bool hasStencil = stencilEnabled(draw.m_stencil);
 
 					if (hasStencil
@@ -10482,31 +11006,26 @@ VK_DESTROY
 						}
 					}
 
+					const bool programChanged = currentProgram.idx != key.m_program.idx;
+
 					bool constantsChanged = false;
-					if (draw.m_uniformBegin < draw.m_uniformEnd
-					||  currentProgram.idx != key.m_program.idx
+					if (uniformsChanged
+					||  programChanged
 					||  BGFX_STATE_ALPHA_REF_MASK & changedFlags)
 					{
 						currentProgram = key.m_program;
 						ProgramVK& program = m_program[currentProgram.idx];
 
-						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
+						commit(*program.m_vsh);
 
 						if (NULL != program.m_fsh)
 						{
-							UniformBuffer* fcb = program.m_fsh->m_constantBuffer;
-							if (NULL != fcb)
-							{
-								commit(*fcb);
-							}
+							commit(*program.m_fsh);
 						}
 
 						hasPredefined = 0 < program.m_numPredefined;
 						constantsChanged = true;
+						uniformsChanged  = false;
 					}
 
 					const ProgramVK& program = m_program[currentProgram.idx];
@@ -10515,7 +11034,7 @@ VK_DESTROY
 					{
 						uint32_t ref = (draw.m_stateFlags & BGFX_STATE_ALPHA_REF_MASK) >> BGFX_STATE_ALPHA_REF_SHIFT;
 						viewState.m_alphaRef = ref / 255.0f;
-						viewState.setPredefined<4>(this, view, program, _render, draw);
+						viewState.setPredefined<4>(this, view, program, _render, draw, programChanged);
 					}
 
 					if (VK_NULL_HANDLE != program.m_descriptorSetLayout)
@@ -10608,6 +11127,11 @@ VK_DESTROY
 						m_occlusionQuery.begin(draw.m_occlusionQuery);
 					}
 
+					if (hasCondition)
+					{
+						beginConditionalRendering(draw.m_occlusionQuery, 0 != (draw.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) );
+					}
+
 					const uint8_t primIndex = uint8_t( (draw.m_stateFlags & BGFX_STATE_PT_MASK) >> BGFX_STATE_PT_SHIFT);
 					const PrimInfo& prim = s_primInfo[primIndex];
 
@@ -10727,6 +11251,11 @@ VK_DESTROY
 					statsNumInstances[primIndex]      += draw.m_numInstances;
 					statsNumIndices                   += numIndices;
 
+					if (hasCondition)
+					{
+						vkCmdEndConditionalRenderingEXT(m_commandBuffer);
+					}
+
 					if (hasOcclusionQuery)
 					{
 						m_occlusionQuery.end();
@@ -10740,6 +11269,8 @@ VK_DESTROY
 				beginRenderPass = false;
 			}
 
+			gpuRegionProfiler.end();
+
 			if (wasCompute)
 			{
 				setViewType(view, "C");
@@ -10832,6 +11363,7 @@ VK_DESTROY
 		perfStats.gpuTimerFreq  = m_gpuTimer.m_frequency;
 		perfStats.numDraw       = statsKeyType[0];
 		perfStats.numCompute    = statsKeyType[1];
+		perfStats.uniformBytesSkipped = uniformBytesSkipped;
 		perfStats.numBlit       = _render->m_numBlitItems;
 		perfStats.maxGpuLatency = maxGpuLatency;
 		perfStats.gpuFrameNum   = result.m_frameNum;
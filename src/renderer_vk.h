@@ -232,6 +232,18 @@
 			VK_IMPORT_DEVICE_FUNC(true,  vkCmdDrawIndexedIndirectCountKHR);           \
 			/* VK_KHR_fragment_shading_rate */                                        \
 			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetFragmentShadingRateKHR);              \
+			/* VK_EXT_conditional_rendering */                                        \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdBeginConditionalRenderingEXT);           \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdEndConditionalRenderingEXT);             \
+			/* VK_EXT_extended_dynamic_state */                                       \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetCullModeEXT);                         \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetFrontFaceEXT);                        \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetPrimitiveTopologyEXT);                \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetDepthTestEnableEXT);                  \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetDepthWriteEnableEXT);                 \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetDepthCompareOpEXT);                   \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetStencilTestEnableEXT);                \
+			VK_IMPORT_DEVICE_FUNC(true, vkCmdSetStencilOpEXT);                        \
 			/* VK_KHR_video_queue / VK_KHR_video_decode_queue */                      \
 			VK_IMPORT_DEVICE_FUNC(true, vkCmdBeginVideoCodingKHR);                    \
 			VK_IMPORT_DEVICE_FUNC(true, vkCmdEndVideoCodingKHR);                      \
@@ -553,6 +565,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		const Memory* m_code;
 		VkShaderModule m_module;
 		UniformBuffer* m_constantBuffer;
+		UniformCopyList m_uniformCopy;
 
 		PredefinedUniform m_predefined[PredefinedUniform::Count];
 		uint16_t m_attrMask[Attrib::Count];
@@ -653,6 +666,30 @@ VK_DESTROY_FUNC(DescriptorSet);
 		bx::RingBufferControl m_control;
 	};
 
+	struct GpuRegionQueryVK
+	{
+		GpuRegionQueryVK()
+			: m_control(BX_COUNTOF(m_slice) )
+		{
+		}
+
+		VkResult init();
+		void shutdown();
+		void resolve(Frame* _render);
+		uint32_t begin(const Frame* _render);
+		void timestamp(uint32_t _idx, uint32_t _query);
+		void end(uint32_t _idx);
+
+		GpuRegionSlice m_slice[kGpuRegionMaxFrames];
+		uint64_t m_completed[kGpuRegionMaxFrames];
+
+		VkBuffer m_readback;
+		DeviceMemoryAllocationVK m_readbackMemory;
+		VkQueryPool m_queryPool;
+		const uint64_t* m_queryResult;
+		bx::RingBufferControl m_control;
+	};
+
 	struct OcclusionQueryVK
 	{
 		OcclusionQueryVK()
@@ -668,6 +705,16 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void resolve(Frame* _render);
 		void invalidate(OcclusionQueryHandle _handle);
 
+		/// Copies results of queries ended since last call into predicate
+		/// buffer. Must be called outside of render pass.
+		void predicate(Frame* _render);
+
+		/// Returns true if `_handle` result is available in predicate buffer.
+		bool isPredicated(const Frame* _render, OcclusionQueryHandle _handle) const
+		{
+			return m_predicatedFrame[_handle.idx] == _render->m_frameNum;
+		}
+
 		OcclusionQueryHandle m_handle[BGFX_CONFIG_MAX_OCCLUSION_QUERIES];
 
 		VkBuffer m_readback;
@@ -675,6 +722,11 @@ VK_DESTROY_FUNC(DescriptorSet);
 		VkQueryPool m_queryPool;
 		const uint32_t* m_queryResult;
 		bx::RingBufferControl m_control;
+
+		VkBuffer m_predicate;
+		DeviceMemoryAllocationVK m_predicateMemory;
+		uint32_t m_predicatedFrame[BGFX_CONFIG_MAX_OCCLUSION_QUERIES];
+		uint32_t m_numPending;
 	};
 
 	struct ReadbackVK
@@ -737,6 +789,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		uint8_t  m_requestedFormat;
 		uint8_t  m_textureFormat;
 		uint8_t  m_numMips;
+		uint8_t  m_minLod;
 
 		MsaaSamplerVK m_sampler;
 
@@ -848,6 +848,29 @@ WGPU_IMPORT
 		trace(_message);
 	}
 
+	static bool hasBlendFactor(uint64_t _state)
+	{
+		constexpr uint64_t kF0 = BGFX_STATE_BLEND_FACTOR;
+		constexpr uint64_t kF1 = BGFX_STATE_BLEND_INV_FACTOR;
+		constexpr uint64_t kF2 = BGFX_STATE_BLEND_FACTOR<<4;
+		constexpr uint64_t kF3 = BGFX_STATE_BLEND_INV_FACTOR<<4;
+		constexpr uint64_t kF4 = BGFX_STATE_BLEND_FACTOR<<8;
+		constexpr uint64_t kF5 = BGFX_STATE_BLEND_INV_FACTOR<<8;
+		constexpr uint64_t kF6 = BGFX_STATE_BLEND_FACTOR<<12;
+		constexpr uint64_t kF7 = BGFX_STATE_BLEND_INV_FACTOR<<12;
+
+		return false
+			|| kF0 == (_state & kF0)
+			|| kF1 == (_state & kF1)
+			|| kF2 == (_state & kF2)
+			|| kF3 == (_state & kF3)
+			|| kF4 == (_state & kF4)
+			|| kF5 == (_state & kF5)
+			|| kF6 == (_state & kF6)
+			|| kF7 == (_state & kF7)
+			;
+	}
+
 	struct RendererContextWGPU : public RendererContextI
 	{
 		RendererContextWGPU()
@@ -1698,6 +1721,7 @@ WGPU_IMPORT
 
 		void destroyProgram(ProgramHandle _handle) override
 		{
+			invalidateRenderBundleCache();
 			m_program[_handle.idx].destroy();
 		}
 
@@ -1869,12 +1893,20 @@ WGPU_IMPORT
 			tc.m_mem       = NULL;
 			bx::write(&writer, tc, bx::ErrorAssert{});
 
+			invalidateBindGroupCache();
+
 			texture.destroy();
 			texture.create(mem, texture.m_flags, 0);
 
 			release(mem);
 		}
 
+		void setTextureMinLod(TextureHandle _handle, uint8_t _minLod) override
+		{
+			invalidateBindGroupCache();
+			m_textures[_handle.idx].m_minLod = _minLod;
+		}
+
 		void overrideInternal(TextureHandle /*_handle*/, uintptr_t /*_ptr*/, uint16_t /*_layerIndex*/) override
 		{
 		}
@@ -1970,9 +2002,15 @@ WGPU_IMPORT
 				);
 		}
 
-		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
+		bool updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
 		{
+			if (0 == bx::memCmp(m_uniforms[_loc], _data, _size) )
+			{
+				return false;
+			}
+
 			bx::memCopy(m_uniforms[_loc], _data, _size);
+			return true;
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle _handle) override
@@ -2268,6 +2306,8 @@ WGPU_IMPORT
 
 		void invalidateCache()
 		{
+			invalidateRenderBundleCache();
+
 			m_computePipelineCache.invalidate();
 			m_renderPipelineCache.invalidate();
 			m_textureViewStateCache.invalidate();
@@ -2282,6 +2322,8 @@ WGPU_IMPORT
 			}
 
 			m_bindGroupMap.clear();
+
+			invalidateRenderBundleCache();
 		}
 
 		bool updateResolution(const Resolution& _resolution)
@@ -2377,6 +2419,18 @@ WGPU_IMPORT
 			return _visible == (0 != _render->m_occlusion[_handle.idx]);
 		}
 
+		void commit(const ShaderWGPU& _shader)
+		{
+			if (_shader.m_uniformCopy.isValid() )
+			{
+				_shader.m_uniformCopy.commit(m_vsScratch, m_fsScratch, m_uniforms);
+			}
+			else if (NULL != _shader.m_constantBuffer)
+			{
+				commit(*_shader.m_constantBuffer);
+			}
+		}
+
 		void commit(UniformBuffer& _uniformBuffer)
 		{
 			_uniformBuffer.reset();
@@ -3171,6 +3225,16 @@ WGPU_IMPORT
 								&& 0 != (resolvedFlags & BGFX_SAMPLER_SAMPLE_STENCIL)
 								;
 
+							// Mips above min LOD are not resident.
+							const uint8_t firstMip = Binding::Texture == bind.m_type
+								? bx::max(bind.m_firstMip, texture.m_minLod)
+								: bind.m_firstMip
+								;
+							const uint8_t numMips = UINT8_MAX == bind.m_numMips
+								? UINT8_MAX
+								: bx::min<uint8_t>(bind.m_numMips, uint8_t(texture.m_numMips - firstMip) )
+								;
+
 							bindGroupEntry[entryCount++] =
 							{
 								.nextInChain = NULL,
@@ -3180,8 +3244,8 @@ WGPU_IMPORT
 								.size        = 0,
 								.sampler     = NULL,
 								.textureView = _isCompute
-									? texture.getTextureView(bind.m_firstMip, bind.m_numMips, Binding::Image == bind.m_type, 0, UINT16_MAX, Binding::Image == bind.m_type && UINT16_MAX != bind.m_numLayers, sampleStencil)
-									: texture.getTextureView(bind.m_firstMip, bind.m_numMips, false, bind.m_firstLayer, bind.m_numLayers, false, sampleStencil)
+									? texture.getTextureView(firstMip, numMips, Binding::Image == bind.m_type, 0, UINT16_MAX, Binding::Image == bind.m_type && UINT16_MAX != bind.m_numLayers, sampleStencil)
+									: texture.getTextureView(firstMip, numMips, false, bind.m_firstLayer, bind.m_numLayers, false, sampleStencil)
 									,
 							};
 
@@ -3407,6 +3471,650 @@ WGPU_IMPORT
 			};
 		}
 
+		void invalidateRenderBundleCache()
+		{
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_renderBundle); ++ii)
+			{
+				RenderBundleWGPU& rb = m_renderBundle[ii];
+				rb.destroy();
+				rb.m_hash     = 0;
+				rb.m_prevHash = 0;
+			}
+		}
+
+		void hashUniforms(bx::HashMurmur3& _murmur, const ShaderWGPU& _shader) const
+		{
+			if (_shader.m_uniformCopy.isValid() )
+			{
+				for (uint32_t ii = 0, num = _shader.m_uniformCopy.m_num; ii < num; ++ii)
+				{
+					const UniformCacheItem& item = _shader.m_uniformCopy.m_item[ii];
+					_murmur.add(m_uniforms[item.m_handle], item.m_size);
+				}
+
+				return;
+			}
+
+			if (NULL == _shader.m_constantBuffer)
+			{
+				return;
+			}
+
+			UniformBuffer& constantBuffer = *_shader.m_constantBuffer;
+			constantBuffer.reset();
+
+			for (;;)
+			{
+				const uint32_t opcode = constantBuffer.read();
+
+				if (UniformType::End == opcode)
+				{
+					break;
+				}
+
+				uint8_t type;
+				uint16_t loc;
+				uint16_t num;
+				uint16_t copy;
+				UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
+
+				if (copy)
+				{
+					constantBuffer.read(g_uniformTypeSize[type]*num);
+					continue;
+				}
+
+				UniformHandle handle;
+				bx::memCopy(&handle, constantBuffer.read(sizeof(UniformHandle) ), sizeof(UniformHandle) );
+
+				switch (type & ~kUniformMask)
+				{
+				case UniformType::Mat3:
+					_murmur.add(m_uniforms[handle.idx], num/3*g_uniformTypeSize[UniformType::Mat3]);
+					break;
+
+				case UniformType::Vec4:
+				case UniformType::Mat4:
+					_murmur.add(m_uniforms[handle.idx], num*16);
+					break;
+
+				default:
+					break;
+				}
+			}
+		}
+
+		// Views whose draws, bindings and uniform values didn't change since previous frame are
+		// encoded once into render bundle with their own copy of uniform data, and replayed with
+		// executeBundles until view contents change. Returns NULL if view must be encoded
+		// directly into render pass.
+		const RenderBundleWGPU* submitRenderBundle(
+			  Frame* _render
+			, ViewState& _viewState
+			, WGPURenderPassEncoder _renderPassEncoder
+			, ViewId _view
+			, FrameBufferHandle _fbh
+			, uint32_t _msaaCount
+			, uint32_t _begin
+			, uint32_t _end
+			, const PrimInfo& _prim
+			, uint64_t& _blendFactor
+			, uint32_t& _uniformBytesSkipped
+			)
+		{
+			if (_end - _begin < BGFX_CONFIG_RENDER_BUNDLE_MIN_DRAWS)
+			{
+				return NULL;
+			}
+
+			RenderBundleWGPU& rb = m_renderBundle[_view];
+
+			if (0 < rb.m_skip)
+			{
+				--rb.m_skip;
+				return NULL;
+			}
+
+			bool     stencilUsed = false;
+			bool     factorUsed  = false;
+			uint32_t stencilRef  = 0;
+			uint32_t rgba        = 0;
+
+			for (uint32_t item = _begin; item < _end; ++item)
+			{
+				if (0 == (_render->m_sortKeys[item] & kSortKeyDrawBit) )
+				{
+					rb.m_skip    = rb.m_backoff;
+					rb.m_backoff = uint8_t(bx::min(rb.m_backoff*2+1, 63) );
+					return NULL;
+				}
+
+				const RenderDraw& draw = _render->m_renderItem[_render->m_sortValues[item] ].draw;
+
+				if (0 == draw.m_streamMask)
+				{
+					continue;
+				}
+
+				// Occlusion queries, per draw scissor, and mismatched stencil reference or blend
+				// constant can't be recorded into render bundle.
+				bool compatible = true
+					&& !isValid(draw.m_occlusionQuery)
+					&& !isValid(draw.m_numIndirectBuffer)
+					&& UINT16_MAX == draw.m_scissor
+					;
+
+				if (stencilEnabled(draw.m_stencil) )
+				{
+					const uint32_t fstencil = unpackStencil(0, draw.m_stencil);
+					const uint32_t ref = (fstencil&BGFX_STENCIL_FUNC_REF_MASK)>>BGFX_STENCIL_FUNC_REF_SHIFT;
+					compatible &= !stencilUsed || stencilRef == ref;
+					stencilUsed = true;
+					stencilRef  = ref;
+				}
+
+				if (hasBlendFactor(draw.m_stateFlags) )
+				{
+					compatible &= !factorUsed || rgba == draw.m_rgba;
+					factorUsed  = true;
+					rgba        = draw.m_rgba;
+				}
+
+				if (!compatible)
+				{
+					rb.m_skip    = rb.m_backoff;
+					rb.m_backoff = uint8_t(bx::min(rb.m_backoff*2+1, 63) );
+					return NULL;
+				}
+			}
+
+			bx::HashMurmur3 murmur;
+			murmur.begin(0x524e4442);
+			murmur.add(_fbh.idx);
+			murmur.add(_msaaCount);
+			murmur.add(m_wireframe);
+
+			// Hash inputs of uniform data instead of committing it for every draw. Cached uniform values
+			// aren't modified until view is accepted, so values inherited from previous views are hashed
+			// once per program, and per draw only uniform updates and model matrices are hashed.
+			murmur.add(_viewState.m_rect);
+			murmur.add(_viewState.m_ndcFixup);
+			murmur.add(_viewState.m_view[_view]);
+			murmur.add(_render->m_view[_view].m_proj);
+
+			const FrameCache& frameCache = _render->m_frameCache;
+			uint16_t currentProgram = kInvalidHandle;
+
+			for (uint32_t item = _begin; item < _end; ++item)
+			{
+				SortKey key;
+				key.decode(_render->m_sortKeys[item], _render->m_viewRemap);
+
+				const RenderItem& renderItem = _render->m_renderItem[_render->m_sortValues[item] ];
+				const RenderDraw& draw       = renderItem.draw;
+				const RenderBind& renderBind = _render->m_renderBind[draw.m_bindIdx];
+
+				if (0 == draw.m_streamMask)
+				{
+					continue;
+				}
+
+				const ProgramWGPU& program = m_program[key.m_program.idx];
+
+				if (currentProgram != key.m_program.idx)
+				{
+					currentProgram = key.m_program.idx;
+
+					hashUniforms(murmur, *program.m_vsh);
+
+					if (NULL != program.m_fsh)
+					{
+						hashUniforms(murmur, *program.m_fsh);
+					}
+				}
+
+				if (draw.m_uniformBegin < draw.m_uniformEnd)
+				{
+					UniformBuffer* uniformBuffer = _render->m_uniformBuffer[draw.m_uniformIdx];
+					uniformBuffer->reset(draw.m_uniformBegin);
+
+					const uint32_t size = draw.m_uniformEnd - draw.m_uniformBegin;
+					murmur.add(uniformBuffer->read(size), size);
+				}
+
+				if (0 < program.m_numPredefined)
+				{
+					murmur.add(&frameCache.m_matrixCache.m_cache[draw.m_startMatrix], draw.m_numMatrices*sizeof(Matrix4) );
+					murmur.add(draw.m_transformIndex);
+				}
+
+				murmur.add(key.m_program.idx);
+				murmur.add(draw.m_stream, sizeof(draw.m_stream) );
+				murmur.add(draw.m_stateFlags);
+				murmur.add(draw.m_stencil);
+				murmur.add(draw.m_rgba);
+				murmur.add(draw.m_startIndex);
+				murmur.add(draw.m_numIndices);
+				murmur.add(draw.m_numVertices);
+				murmur.add(draw.m_instanceDataOffset);
+				murmur.add(draw.m_numInstances);
+				murmur.add(draw.m_startIndirect);
+				murmur.add(draw.m_numIndirect);
+				murmur.add(draw.m_streamMask);
+				murmur.add(draw.m_instanceDataStride);
+				murmur.add(draw.m_submitFlags);
+				murmur.add(draw.m_indexBuffer.idx);
+				murmur.add(draw.m_instanceDataBuffer.idx);
+				murmur.add(draw.m_indirectBuffer.idx);
+
+				for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
+				{
+					if (isValid(program.m_shaderBinding[stage].uniformHandle) )
+					{
+						murmur.add(&renderBind.m_bind[stage], sizeof(renderBind.m_bind[stage]) );
+					}
+				}
+			}
+
+			const uint32_t hash = murmur.end();
+
+			const bool record = false
+				|| NULL == rb.m_bundle
+				|| hash != rb.m_hash
+				;
+
+			if (record
+			&&  hash != rb.m_prevHash)
+			{
+				rb.m_prevHash = hash;
+				rb.m_skip     = rb.m_backoff;
+				rb.m_backoff  = uint8_t(bx::min(rb.m_backoff*2+1, 63) );
+				return NULL;
+			}
+
+			const uint32_t align = uint32_t(m_limits.minUniformBufferOffsetAlignment);
+
+			uint32_t uniformSize = 0;
+			uint32_t uniformEnd  = 0;
+			m_renderBundleScratch.clear();
+
+			// Cached uniform values are brought up to date even when bundle is only replayed, views
+			// after this one might inherit them.
+			for (uint32_t item = _begin; item < _end; ++item)
+			{
+				SortKey key;
+				key.decode(_render->m_sortKeys[item], _render->m_viewRemap);
+
+				const RenderDraw& draw = _render->m_renderItem[_render->m_sortValues[item] ].draw;
+
+				if (0 == draw.m_streamMask)
+				{
+					continue;
+				}
+
+				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd, _uniformBytesSkipped);
+
+				if (!record)
+				{
+					continue;
+				}
+
+				const ProgramWGPU& program = m_program[key.m_program.idx];
+
+				commit(*program.m_vsh);
+
+				if (NULL != program.m_fsh)
+				{
+					commit(*program.m_fsh);
+				}
+
+				const uint32_t ref = (draw.m_stateFlags&BGFX_STATE_ALPHA_REF_MASK)>>BGFX_STATE_ALPHA_REF_SHIFT;
+				_viewState.m_alphaRef = ref/255.0f;
+				_viewState.setPredefined<4>(this, _view, program, _render, draw);
+
+				const uint32_t vsSize = program.m_vsh->m_size;
+				const uint32_t fsSize = NULL != program.m_fsh ? program.m_fsh->m_size : 0;
+				const uint32_t vsAligned = bx::strideAlign(vsSize, align);
+				const uint32_t fsAligned = bx::strideAlign(fsSize, align);
+
+				m_renderBundleScratch.resize(uniformSize + vsAligned + fsAligned);
+				bx::memCopy(&m_renderBundleScratch[uniformSize], m_vsScratch, vsSize);
+				bx::memCopy(&m_renderBundleScratch[uniformSize + vsAligned], m_fsScratch, fsSize);
+
+				if (0 < vsSize)
+				{
+					uniformEnd = bx::max(uniformEnd, uniformSize + program.m_vsh->m_blockSize);
+				}
+
+				if (0 < fsSize)
+				{
+					uniformEnd = bx::max(uniformEnd, uniformSize + vsAligned + program.m_fsh->m_blockSize);
+				}
+
+				uniformSize += vsAligned + fsAligned;
+			}
+
+			if (record)
+			{
+				// View contents are same as in previous frame, record them into render bundle.
+				rb.destroy();
+				rb.m_hash       = hash;
+				rb.m_stencilRef = stencilRef;
+				rb.m_rgba       = rgba;
+				rb.m_hasStencil = stencilUsed;
+				rb.m_hasFactor  = factorUsed;
+				rb.m_numPrimsSubmitted = 0;
+				rb.m_numPrimsRendered  = 0;
+				rb.m_numInstances      = 0;
+				rb.m_numDrawIndirect   = 0;
+				rb.m_numIndices        = 0;
+
+				if (0 < uniformSize)
+				{
+					WGPUBufferDescriptor bufferDesc =
+					{
+						.nextInChain = NULL,
+						.label = toWGPUStringView("render bundle uniform buffer"),
+						.usage = 0
+							| WGPUBufferUsage_Uniform
+							| WGPUBufferUsage_CopyDst
+							,
+						.size = bx::alignUp(bx::max(uniformSize, uniformEnd), 4),
+						.mappedAtCreation = false,
+					};
+
+					rb.m_uniformBuffer = WGPU_CHECK(wgpuDeviceCreateBuffer(m_device, &bufferDesc) );
+					m_cmd.writeBuffer(rb.m_uniformBuffer, 0, &m_renderBundleScratch[0], uniformSize);
+				}
+
+				const FrameBufferWGPU& fb = isValid(_fbh)
+					? m_frameBuffers[_fbh.idx]
+					: m_backBuffer
+					;
+
+				const bool isSwapChain = fb.isSwapChain();
+
+				WGPUTextureFormat colorFormats[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
+				const uint32_t numColorAttachments = isSwapChain
+					? 1
+					: fb.m_numColorAttachments
+					;
+
+				for (uint32_t ii = 0; ii < numColorAttachments; ++ii)
+				{
+					const TextureFormat::Enum textureFormat = isSwapChain
+						? fb.m_swapChain.m_resolution.formatColor
+						: TextureFormat::Enum(m_textures[fb.m_texture[ii].idx].m_textureFormat)
+						;
+					colorFormats[ii] = s_textureFormat[textureFormat].m_fmt;
+				}
+
+				const WGPUTextureView depthStencilTextureView = isSwapChain
+					? fb.m_swapChain.m_depthStencilView
+					: fb.m_depthStencilView
+					;
+
+				const TextureFormat::Enum formatDepthStencil = isSwapChain
+					? fb.m_swapChain.m_resolution.formatDepthStencil
+					: TextureFormat::Enum(fb.m_formatDepthStencil)
+					;
+
+				WGPURenderBundleEncoderDescriptor renderBundleEncoderDesc =
+				{
+					.nextInChain        = NULL,
+					.label              = toWGPUStringView(s_viewName[_view]),
+					.colorFormatCount   = numColorAttachments,
+					.colorFormats       = colorFormats,
+					.depthStencilFormat = NULL == depthStencilTextureView
+						? WGPUTextureFormat_Undefined
+						: s_textureFormat[formatDepthStencil].m_fmt
+						,
+					.sampleCount        = _msaaCount,
+					.depthReadOnly      = false,
+					.stencilReadOnly    = !hasStencil(formatDepthStencil),
+				};
+
+				WGPURenderBundleEncoder encoder = WGPU_CHECK(wgpuDeviceCreateRenderBundleEncoder(m_device, &renderBundleEncoderDesc) );
+
+				WGPURenderPipeline currentPipeline = NULL;
+				uint16_t currentProgram = kInvalidHandle;
+				uint32_t currentBindIdx = UINT32_MAX;
+				uint16_t currentIndexBuffer = kInvalidHandle;
+				bool     currentIndex16 = true;
+
+				WGPUBuffer currentBuffers[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+				uint32_t   currentOffsets[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+				uint32_t   currentSizes[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+				uint32_t   currentNumStreams = 0;
+
+				ChunkedScratchBufferOffset sbo;
+				sbo.buffer = rb.m_uniformBuffer;
+				uint32_t uniformOffset = 0;
+
+				for (uint32_t item = _begin; item < _end; ++item)
+				{
+					SortKey key;
+					key.decode(_render->m_sortKeys[item], _render->m_viewRemap);
+
+					const RenderItem& renderItem = _render->m_renderItem[_render->m_sortValues[item] ];
+					const RenderDraw& draw       = renderItem.draw;
+					const RenderBind& renderBind = _render->m_renderBind[draw.m_bindIdx];
+
+					if (0 == draw.m_streamMask)
+					{
+						continue;
+					}
+
+					const ProgramWGPU& program = m_program[key.m_program.idx];
+					const uint8_t numInstanceData = uint8_t(draw.m_instanceDataStride/16);
+
+					const RenderPipeline& renderPipeline = *getPipeline(
+						  key.m_program
+						, _fbh
+						, _msaaCount
+						, draw.m_stateFlags
+						, draw.m_rgba
+						, draw.m_stencil
+						, draw.m_streamMask
+						, draw.m_stream
+						, numInstanceData
+						, draw.isIndex16()
+						, renderBind
+						);
+
+					if (currentPipeline != renderPipeline.pipeline)
+					{
+						currentPipeline = renderPipeline.pipeline;
+						WGPU_CHECK(wgpuRenderBundleEncoderSetPipeline(encoder, renderPipeline.pipeline) );
+					}
+
+					const uint32_t vsAligned = bx::strideAlign(program.m_vsh->m_size, align);
+					const uint32_t fsAligned = bx::strideAlign(NULL != program.m_fsh ? program.m_fsh->m_size : 0, align);
+					sbo.offsets[0] = uniformOffset;
+					sbo.offsets[1] = uniformOffset + vsAligned;
+					uniformOffset += vsAligned + fsAligned;
+
+					if (currentProgram != key.m_program.idx
+					||  currentBindIdx != draw.m_bindIdx)
+					{
+						currentProgram = key.m_program.idx;
+						currentBindIdx = draw.m_bindIdx;
+						rb.m_bindGroup.push_back(createBindGroup(renderPipeline.bindGroupLayout, program, renderBind, sbo, false) );
+					}
+
+					const BindGroup& bindGroup = rb.m_bindGroup.back();
+					WGPU_CHECK(wgpuRenderBundleEncoderSetBindGroup(encoder, 0, bindGroup.bindGroup, bindGroup.numOffsets, sbo.offsets) );
+
+					WGPUBuffer buffers[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+					uint32_t   offsets[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+					uint32_t   sizes[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+					uint32_t   numStreams  = 0;
+					uint32_t   numVertices = draw.m_numVertices;
+
+					if (UINT32_MAX != draw.m_streamMask)
+					{
+						for (BitMaskToIndexIteratorT it(draw.m_streamMask)
+							; !it.isDone()
+							; it.next(), numStreams++
+							)
+						{
+							const uint8_t idx = it.idx;
+
+							const VertexBufferWGPU& vb = m_vertexBuffers[draw.m_stream[idx].m_handle.idx];
+							const uint16_t layoutIdx = isValid(draw.m_stream[idx].m_layoutHandle)
+								? draw.m_stream[idx].m_layoutHandle.idx
+								: vb.m_layoutHandle.idx
+								;
+							const uint32_t stride = m_vertexLayouts[layoutIdx].m_stride;
+
+							numVertices = bx::min(UINT32_MAX == draw.m_numVertices
+								? vb.m_size/stride
+								: draw.m_numVertices
+								, numVertices
+								);
+
+							buffers[numStreams] = vb.m_buffer;
+							offsets[numStreams] = draw.m_stream[idx].m_startVertex * stride;
+							sizes[numStreams]   = stride * numVertices;
+						}
+
+						if (isValid(draw.m_instanceDataBuffer) )
+						{
+							buffers[numStreams] = m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_buffer;
+							offsets[numStreams] = draw.m_instanceDataOffset;
+							sizes[numStreams]   = draw.m_instanceDataStride * draw.m_numInstances;
+							++numStreams;
+						}
+					}
+
+					for (uint32_t ii = 0; ii < numStreams; ++ii)
+					{
+						if (ii >= currentNumStreams
+						||  currentBuffers[ii] != buffers[ii]
+						||  currentOffsets[ii] != offsets[ii]
+						||  currentSizes[ii]   != sizes[ii])
+						{
+							currentBuffers[ii] = buffers[ii];
+							currentOffsets[ii] = offsets[ii];
+							currentSizes[ii]   = sizes[ii];
+							WGPU_CHECK(wgpuRenderBundleEncoderSetVertexBuffer(encoder, ii, buffers[ii], offsets[ii], sizes[ii]) );
+						}
+					}
+
+					currentNumStreams = bx::max(currentNumStreams, numStreams);
+
+					if (isValid(draw.m_indexBuffer)
+					&& (currentIndexBuffer != draw.m_indexBuffer.idx || currentIndex16 != draw.isIndex16() ) )
+					{
+						currentIndexBuffer = draw.m_indexBuffer.idx;
+						currentIndex16     = draw.isIndex16();
+
+						WGPU_CHECK(wgpuRenderBundleEncoderSetIndexBuffer(
+							  encoder
+							, m_indexBuffers[draw.m_indexBuffer.idx].m_buffer
+							, draw.isIndex16() ? WGPUIndexFormat_Uint16 : WGPUIndexFormat_Uint32
+							, 0
+							, WGPU_WHOLE_SIZE
+							) );
+					}
+
+					uint32_t numIndices        = 0;
+					uint32_t numPrimsSubmitted = 0;
+					uint32_t numPrimsRendered  = 0;
+					uint32_t numDrawIndirect   = 0;
+
+					if (isValid(draw.m_indirectBuffer) )
+					{
+						const VertexBufferWGPU& indirect = m_vertexBuffers[draw.m_indirectBuffer.idx];
+						numDrawIndirect = UINT32_MAX == draw.m_numIndirect
+							? indirect.m_size/BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+							: draw.m_numIndirect
+							;
+
+						uint64_t args = draw.m_startIndirect * BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
+						for (uint32_t ii = 0; ii < numDrawIndirect; ++ii)
+						{
+							if (isValid(draw.m_indexBuffer) )
+							{
+								WGPU_CHECK(wgpuRenderBundleEncoderDrawIndexedIndirect(encoder, indirect.m_buffer, args) );
+							}
+							else
+							{
+								WGPU_CHECK(wgpuRenderBundleEncoderDrawIndirect(encoder, indirect.m_buffer, args) );
+							}
+
+							args += BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
+						}
+					}
+					else if (isValid(draw.m_indexBuffer) )
+					{
+						if (UINT32_MAX == draw.m_numIndices)
+						{
+							const IndexBufferWGPU& ib = m_indexBuffers[draw.m_indexBuffer.idx];
+							const uint32_t indexSize = 0 == (ib.m_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
+							numIndices        = ib.m_size/indexSize;
+							numPrimsSubmitted = numIndices/_prim.m_div - _prim.m_sub;
+							numPrimsRendered  = numPrimsSubmitted*draw.m_numInstances;
+
+							WGPU_CHECK(wgpuRenderBundleEncoderDrawIndexed(encoder, numIndices, draw.m_numInstances, 0, 0, 0) );
+						}
+						else if (_prim.m_min <= draw.m_numIndices)
+						{
+							numIndices        = draw.m_numIndices;
+							numPrimsSubmitted = numIndices/_prim.m_div - _prim.m_sub;
+							numPrimsRendered  = numPrimsSubmitted*draw.m_numInstances;
+
+							WGPU_CHECK(wgpuRenderBundleEncoderDrawIndexed(encoder, numIndices, draw.m_numInstances, draw.m_startIndex, 0, 0) );
+						}
+					}
+					else
+					{
+						numPrimsSubmitted = numVertices/_prim.m_div - _prim.m_sub;
+						numPrimsRendered  = numPrimsSubmitted*draw.m_numInstances;
+
+						WGPU_CHECK(wgpuRenderBundleEncoderDraw(encoder, numVertices, draw.m_numInstances, 0, 0) );
+					}
+
+					rb.m_numPrimsSubmitted += numPrimsSubmitted;
+					rb.m_numPrimsRendered  += numPrimsRendered;
+					rb.m_numInstances      += 0 == numDrawIndirect ? draw.m_numInstances : 0;
+					rb.m_numDrawIndirect   += numDrawIndirect;
+					rb.m_numIndices        += numIndices;
+				}
+
+				rb.m_bundle = WGPU_CHECK(wgpuRenderBundleEncoderFinish(encoder, NULL) );
+				wgpuRelease(encoder);
+			}
+
+			if (rb.m_hasStencil)
+			{
+				WGPU_CHECK(wgpuRenderPassEncoderSetStencilReference(_renderPassEncoder, rb.m_stencilRef) );
+			}
+
+			if (rb.m_hasFactor
+			&&  _blendFactor != rb.m_rgba)
+			{
+				_blendFactor = rb.m_rgba;
+
+				WGPUColor bf =
+				{
+					.r = ( (rb.m_rgba>>24)     )/255.0f,
+					.g = ( (rb.m_rgba>>16)&0xff)/255.0f,
+					.b = ( (rb.m_rgba>> 8)&0xff)/255.0f,
+					.a = ( (rb.m_rgba    )&0xff)/255.0f,
+				};
+
+				WGPU_CHECK(wgpuRenderPassEncoderSetBlendConstant(_renderPassEncoder, &bf) );
+			}
+
+			WGPU_CHECK(wgpuRenderPassEncoderExecuteBundles(_renderPassEncoder, 1, &rb.m_bundle) );
+
+			rb.m_prevHash = hash;
+			rb.m_backoff  = 0;
+
+			return &rb;
+		}
+
 		void* m_webgpuDll;
 		void* m_renderDocDll;
 
@@ -3449,6 +4157,9 @@ WGPU_IMPORT
 		typedef stl::unordered_map<uint32_t, BindGroup> BindGroupMap;
 		BindGroupMap m_bindGroupMap;
 
+		RenderBundleWGPU m_renderBundle[BGFX_CONFIG_MAX_VIEWS];
+		stl::vector<uint8_t> m_renderBundleScratch;
+
 		void* m_uniforms[BGFX_CONFIG_MAX_UNIFORMS];
 		Matrix4 m_predefinedUniforms[PredefinedUniform::Count];
 		UniformRegistry m_uniformReg;
@@ -3563,6 +4274,19 @@ WGPU_IMPORT
 		return s_renderWGPU->m_cmd.m_currentFrameInFlight;
 	}
 
+	void RenderBundleWGPU::destroy()
+	{
+		for (BindGroupArray::iterator it = m_bindGroup.begin(), itEnd = m_bindGroup.end(); it != itEnd; ++it)
+		{
+			release(*it);
+		}
+
+		m_bindGroup.clear();
+
+		wgpuRelease(m_bundle);
+		wgpuRelease(m_uniformBuffer);
+	}
+
 	void BufferWGPU::create(uint32_t _size, void* _data, uint16_t _flags, bool _vertex, uint32_t _stride)
 	{
 		BX_UNUSED(_stride);
@@ -3824,6 +4548,7 @@ WGPU_IMPORT
 			if (NULL != m_constantBuffer)
 			{
 				m_constantBuffer->finish();
+				m_uniformCopy.create(*m_constantBuffer);
 			}
 		}
 
@@ -3901,6 +4626,8 @@ WGPU_IMPORT
 			m_constantBuffer = NULL;
 		}
 
+		m_uniformCopy.destroy();
+
 		m_numPredefined = 0;
 
 		if (NULL != m_code)
@@ -4052,6 +4779,7 @@ WGPU_IMPORT
 			}
 
 			m_numMips = ti.numMips;
+			m_minLod  = 0;
 
 			const bool compressed = bimg::isCompressed(bimg::TextureFormat::Enum(m_textureFormat) );
 			const bool swizzle    = TextureFormat::BGRA8 == m_textureFormat && 0 != (m_flags&BGFX_TEXTURE_COMPUTE_WRITE);
@@ -5723,10 +6451,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 
 			bx::memCopy(m_uniforms[m_mipGen->u_mipGen.idx], mipGenData, 16);
 
-			if (NULL != program.m_vsh->m_constantBuffer)
-			{
-				commit(*program.m_vsh->m_constantBuffer);
-			}
+			commit(*program.m_vsh);
 
 			RenderBind renderBind;
 			bx::memSet(&renderBind, 0, sizeof(renderBind) );
@@ -5905,6 +6630,8 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 
 		frameQueryIdx = m_gpuTimer.begin(BGFX_CONFIG_MAX_VIEWS, _render->m_frameNum);
 
+		_render->sort();
+
 		if (0 < _render->m_iboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
@@ -5921,8 +6648,6 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 			m_vertexBuffers[vb->handle.idx].update(0, _render->m_vboffset, vb->data);
 		}
 
-		_render->sort();
-
 		m_cmd.wait();
 
 		RenderDraw currentState;
@@ -5964,6 +6689,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 		uint32_t statsNumDrawIndirect[BX_COUNTOF(s_primInfo)] = {};
 		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
+		uint32_t uniformBytesSkipped = 0;
 
 		m_uniformScratchBuffer.begin();
 
@@ -6268,6 +6994,45 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 						, viewScissorRect.m_height
 						);
 					restoreScissor = false;
+
+					if (viewChanged
+					&&  0 != BGFX_CONFIG_RENDER_BUNDLE_MIN_DRAWS)
+					{
+						uint32_t viewEnd = item;
+						for (; viewEnd < uint32_t(numItems); ++viewEnd)
+						{
+							if (_render->m_viewRemap[SortKey::decodeView(_render->m_sortKeys[viewEnd])] != view)
+							{
+								break;
+							}
+						}
+
+						const RenderBundleWGPU* rb = submitRenderBundle(
+							  _render
+							, viewState
+							, renderPassEncoder
+							, view
+							, fbh
+							, msaaCount
+							, uint32_t(item - 1)
+							, viewEnd
+							, prim
+							, blendFactor
+							, uniformBytesSkipped
+							);
+
+						if (NULL != rb)
+						{
+							statsNumPrimsSubmitted[primIndex] += rb->m_numPrimsSubmitted;
+							statsNumPrimsRendered[primIndex]  += rb->m_numPrimsRendered;
+							statsNumInstances[primIndex]      += rb->m_numInstances;
+							statsNumDrawIndirect[primIndex]   += rb->m_numDrawIndirect;
+							statsNumIndices                   += rb->m_numIndices;
+
+							item = int32_t(viewEnd);
+							continue;
+						}
+					}
 				}
 
 				if (isCompute)
@@ -6291,8 +7056,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 					const RenderCompute& compute = renderItem.compute;
 
 					bool programChanged = false;
-					bool constantsChanged = compute.m_uniformBegin < compute.m_uniformEnd;
-					rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+					bool constantsChanged = rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd, uniformBytesSkipped);
 
 					if (key.m_program.idx != currentProgram.idx)
 					{
@@ -6306,11 +7070,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 
 					if (constantsChanged)
 					{
-						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
+						commit(*program.m_vsh);
 					}
 
 					ChunkedScratchBufferOffset sbo;
@@ -6347,6 +7107,12 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 
 					WGPU_CHECK(wgpuComputePassEncoderSetBindGroup(computePassEncoder, 0, bindGroupCached->bindGroup, bindGroupCached->numOffsets, sbo.offsets) );
 
+					if (isValid(compute.m_occlusionQuery)
+					&&  !isVisible(_render, compute.m_occlusionQuery, 0 != (compute.m_submitFlags&BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) ) )
+					{
+						continue;
+					}
+
 					if (isValid(compute.m_indirectBuffer) )
 					{
 						const VertexBufferWGPU& indirect = m_vertexBuffers[compute.m_indirectBuffer.idx];
@@ -6407,8 +7173,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 				currentState.m_stencil = newStencil;
 
 				bool programChanged = false;
-				bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd;
-				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				bool constantsChanged = rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd, uniformBytesSkipped);
 
 				const uint64_t state = draw.m_stateFlags;
 
@@ -6472,25 +7237,18 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 				}
 
 				const ProgramWGPU& program = m_program[key.m_program.idx];
+				programChanged = currentProgram.idx != key.m_program.idx;
 
 				if (constantsChanged
-				||  currentProgram.idx != key.m_program.idx)
+				||  programChanged)
 				{
 					currentProgram = key.m_program;
 
-					UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-					if (NULL != vcb)
-					{
-						commit(*vcb);
-					}
+					commit(*program.m_vsh);
 
 					if (NULL != program.m_fsh)
 					{
-						UniformBuffer* fcb = program.m_fsh->m_constantBuffer;
-						if (NULL != fcb)
-						{
-							commit(*fcb);
-						}
+						commit(*program.m_fsh);
 					}
 
 					hasPredefined = 0 < program.m_numPredefined;
@@ -6502,7 +7260,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 				{
 					const uint32_t ref = (draw.m_stateFlags&BGFX_STATE_ALPHA_REF_MASK)>>BGFX_STATE_ALPHA_REF_SHIFT;
 					viewState.m_alphaRef = ref/255.0f;
-					viewState.setPredefined<4>(this, view, program, _render, draw);
+					viewState.setPredefined<4>(this, view, program, _render, draw, programChanged);
 				}
 
 				ChunkedScratchBufferOffset sbo;
@@ -6565,26 +7323,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 					WGPU_CHECK(wgpuRenderPassEncoderSetStencilReference(renderPassEncoder, ref) );
 				}
 
-				constexpr uint64_t kF0 = BGFX_STATE_BLEND_FACTOR;
-				constexpr uint64_t kF1 = BGFX_STATE_BLEND_INV_FACTOR;
-				constexpr uint64_t kF2 = BGFX_STATE_BLEND_FACTOR<<4;
-				constexpr uint64_t kF3 = BGFX_STATE_BLEND_INV_FACTOR<<4;
-				constexpr uint64_t kF4 = BGFX_STATE_BLEND_FACTOR<<8;
-				constexpr uint64_t kF5 = BGFX_STATE_BLEND_INV_FACTOR<<8;
-				constexpr uint64_t kF6 = BGFX_STATE_BLEND_FACTOR<<12;
-				constexpr uint64_t kF7 = BGFX_STATE_BLEND_INV_FACTOR<<12;
-				bool hasFactor = 0
-					|| kF0 == (state & kF0)
-					|| kF1 == (state & kF1)
-					|| kF2 == (state & kF2)
-					|| kF3 == (state & kF3)
-					|| kF4 == (state & kF4)
-					|| kF5 == (state & kF5)
-					|| kF6 == (state & kF6)
-					|| kF7 == (state & kF7)
-					;
-
-				if (hasFactor
+				if (hasBlendFactor(state)
 				&&  blendFactor != draw.m_rgba)
 				{
 					blendFactor = draw.m_rgba;
@@ -6954,6 +7693,7 @@ m_resolution.formatColor = TextureFormat::BGRA8;
 
 		perfStats.numDraw       = statsKeyType[0];
 		perfStats.numCompute    = statsKeyType[1];
+		perfStats.uniformBytesSkipped = uniformBytesSkipped;
 		perfStats.numBlit       = _render->m_numBlitItems;
 
 		perfStats.gpuMemoryMax  = -INT64_MAX;
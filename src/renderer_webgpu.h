@@ -197,23 +197,23 @@
 		/* */                                                                       \
 		WGPU_IGNORE_____(false, RenderBundleSetLabel);                              \
 		WGPU_IGNORE_____(false, RenderBundleAddRef);                                \
-		WGPU_IGNORE_____(false, RenderBundleRelease);                               \
+		WGPU_IMPORT_FUNC(false, RenderBundleRelease);                               \
 		/* */                                                                       \
-		WGPU_IGNORE_____(false, RenderBundleEncoderDraw);                           \
-		WGPU_IGNORE_____(false, RenderBundleEncoderDrawIndexed);                    \
-		WGPU_IGNORE_____(false, RenderBundleEncoderDrawIndexedIndirect);            \
-		WGPU_IGNORE_____(false, RenderBundleEncoderDrawIndirect);                   \
-		WGPU_IGNORE_____(false, RenderBundleEncoderFinish);                         \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderDraw);                           \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderDrawIndexed);                    \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderDrawIndexedIndirect);            \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderDrawIndirect);                   \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderFinish);                         \
 		WGPU_IGNORE_____(false, RenderBundleEncoderInsertDebugMarker);              \
 		WGPU_IGNORE_____(false, RenderBundleEncoderPopDebugGroup);                  \
 		WGPU_IGNORE_____(false, RenderBundleEncoderPushDebugGroup);                 \
-		WGPU_IGNORE_____(false, RenderBundleEncoderSetBindGroup);                   \
-		WGPU_IGNORE_____(false, RenderBundleEncoderSetIndexBuffer);                 \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderSetBindGroup);                   \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderSetIndexBuffer);                 \
 		WGPU_IGNORE_____(false, RenderBundleEncoderSetLabel);                       \
-		WGPU_IGNORE_____(false, RenderBundleEncoderSetPipeline);                    \
-		WGPU_IGNORE_____(false, RenderBundleEncoderSetVertexBuffer);                \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderSetPipeline);                    \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderSetVertexBuffer);                \
 		WGPU_IGNORE_____(false, RenderBundleEncoderAddRef);                         \
-		WGPU_IGNORE_____(false, RenderBundleEncoderRelease);                        \
+		WGPU_IMPORT_FUNC(false, RenderBundleEncoderRelease);                        \
 		/* */                                                                       \
 		WGPU_IMPORT_FUNC(false, RenderPassEncoderBeginOcclusionQuery);              \
 		WGPU_IMPORT_FUNC(false, RenderPassEncoderDraw);                             \
@@ -222,7 +222,7 @@
 		WGPU_IMPORT_FUNC(false, RenderPassEncoderDrawIndirect);                     \
 		WGPU_IMPORT_FUNC(false, RenderPassEncoderEnd);                              \
 		WGPU_IMPORT_FUNC(false, RenderPassEncoderEndOcclusionQuery);                \
-		WGPU_IGNORE_____(false, RenderPassEncoderExecuteBundles);                   \
+		WGPU_IMPORT_FUNC(false, RenderPassEncoderExecuteBundles);                   \
 		WGPU_IMPORT_FUNC(false, RenderPassEncoderInsertDebugMarker);                \
 		WGPU_IGNORE_____(false, RenderPassEncoderMultiDrawIndexedIndirect);         \
 		WGPU_IGNORE_____(false, RenderPassEncoderMultiDrawIndirect);                \
@@ -346,8 +346,8 @@
 	/*WGPU_RELEASE_FUNC(ExternalTexture);*/     \
 	WGPU_RELEASE_FUNC(PipelineLayout);          \
 	WGPU_RELEASE_FUNC(QuerySet);                \
-	/*WGPU_RELEASE_FUNC(RenderBundle);*/        \
-	/*WGPU_RELEASE_FUNC(RenderBundleEncoder);*/ \
+	WGPU_RELEASE_FUNC(RenderBundle);            \
+	WGPU_RELEASE_FUNC(RenderBundleEncoder);     \
 	WGPU_RELEASE_FUNC(RenderPipeline);          \
 	/*WGPU_RELEASE_FUNC(ResourceTable);*/       \
 	WGPU_RELEASE_FUNC(Sampler);                 \
@@ -530,6 +530,7 @@ namespace wgpu {
 		const Memory* m_code;
 		WGPUShaderModule m_module;
 		UniformBuffer* m_constantBuffer;
+		UniformCopyList m_uniformCopy;
 
 		PredefinedUniform m_predefined[PredefinedUniform::Count];
 		uint16_t m_attrMask[Attrib::Count];
@@ -592,6 +593,47 @@ namespace wgpu {
 		WGPURenderPipeline  pipeline;
 	};
 
+	struct RenderBundleWGPU
+	{
+		RenderBundleWGPU()
+			: m_bundle(NULL)
+			, m_uniformBuffer(NULL)
+			, m_hash(0)
+			, m_prevHash(0)
+			, m_stencilRef(0)
+			, m_rgba(0)
+			, m_skip(0)
+			, m_backoff(0)
+			, m_hasStencil(false)
+			, m_hasFactor(false)
+		{
+		}
+
+		void destroy();
+
+		typedef stl::vector<BindGroup> BindGroupArray;
+		BindGroupArray m_bindGroup;
+
+		WGPURenderBundle m_bundle;
+		WGPUBuffer       m_uniformBuffer;
+
+		uint32_t m_hash;
+		uint32_t m_prevHash;
+		uint32_t m_stencilRef;
+		uint32_t m_rgba;
+
+		uint32_t m_numPrimsSubmitted;
+		uint32_t m_numPrimsRendered;
+		uint32_t m_numInstances;
+		uint32_t m_numDrawIndirect;
+		uint32_t m_numIndices;
+
+		uint8_t m_skip;
+		uint8_t m_backoff;
+		bool    m_hasStencil;
+		bool    m_hasFactor;
+	};
+
 	inline void release(RenderPipeline& _renderPipeline)
 	{
 		_renderPipeline.invalidate();
@@ -632,6 +674,7 @@ namespace wgpu {
 			: m_texture(NULL)
 			, m_textureResolve(NULL)
 			, m_type(Texture2D)
+			, m_minLod(0)
 		{
 		}
 
@@ -657,6 +700,7 @@ namespace wgpu {
 		uint8_t  m_requestedFormat;
 		uint8_t  m_textureFormat;
 		uint8_t  m_numMips;
+		uint8_t  m_minLod;
 	};
 
 	struct SwapChainWGPU
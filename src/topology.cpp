@@ -4,9 +4,13 @@
  */
 
 #include <bx/allocator.h>
+#include <bx/cpu.h>
 #include <bx/debug.h>
 #include <bx/math.h>
+#include <bx/semaphore.h>
+#include <bx/simd_t.h>
 #include <bx/sort.h>
+#include <bx/thread.h>
 
 #include "config.h"
 #include "topology.h"
@@ -262,45 +266,58 @@ namespace bgfx
 		return 0;
 	}
 
-	inline float fmin3(float _a, float _b, float _c)
+	inline bx::simd128_t fmin3(bx::simd128_t _a, bx::simd128_t _b, bx::simd128_t _c)
 	{
-		return bx::min(_a, _b, _c);
+		return bx::simd_min(bx::simd_min(_a, _b), _c);
 	}
 
-	inline float fmax3(float _a, float _b, float _c)
+	inline bx::simd128_t fmax3(bx::simd128_t _a, bx::simd128_t _b, bx::simd128_t _c)
 	{
-		return bx::max(_a, _b, _c);
+		return bx::simd_max(bx::simd_max(_a, _b), _c);
 	}
 
-	inline float favg3(float _a, float _b, float _c)
+	inline bx::simd128_t favg3(bx::simd128_t _a, bx::simd128_t _b, bx::simd128_t _c)
 	{
-		return (_a + _b + _c) * 1.0f/3.0f;
+		return bx::simd_mul(bx::simd_add(bx::simd_add(_a, _b), _c), bx::simd_splat<bx::simd128_t>(1.0f/3.0f) );
 	}
 
-	const bx::Vec3 vertexPos(const void* _vertices, uint32_t _stride, uint32_t _index)
+	inline bx::simd128_t distanceDir(const bx::simd128_t* _dir, bx::simd128_t _x, bx::simd128_t _y, bx::simd128_t _z)
 	{
-		const uint8_t* vertices = (const uint8_t*)_vertices;
-		return bx::load<bx::Vec3>(&vertices[_index*_stride]);
+		using namespace bx;
+		return simd_madd(_x, _dir[0], simd_madd(_y, _dir[1], simd_mul(_z, _dir[2]) ) );
+	}
+
+	inline bx::simd128_t distanceSqPos(const bx::simd128_t* _pos, bx::simd128_t _x, bx::simd128_t _y, bx::simd128_t _z)
+	{
+		using namespace bx;
+		const simd128_t dx = simd_sub(_pos[0], _x);
+		const simd128_t dy = simd_sub(_pos[1], _y);
+		const simd128_t dz = simd_sub(_pos[2], _z);
+		return simd_madd(dx, dx, simd_madd(dy, dy, simd_mul(dz, dz) ) );
 	}
 
-	inline float distanceDir(const float* _dir, const void* _vertices, uint32_t _stride, uint32_t _index)
+	inline bx::simd128_t distancePos(const bx::simd128_t* _pos, bx::simd128_t _x, bx::simd128_t _y, bx::simd128_t _z)
 	{
-		return bx::dot(vertexPos(_vertices, _stride, _index), bx::load<bx::Vec3>(_dir) );
+		return bx::simd_sqrt(distanceSqPos(_pos, _x, _y, _z) );
 	}
 
-	inline float distancePos(const float* _pos, const void* _vertices, uint32_t _stride, uint32_t _index)
+	const bx::Vec3 vertexPos(const void* _vertices, uint32_t _stride, uint32_t _index)
 	{
-		const bx::Vec3 tmp = bx::sub(bx::load<bx::Vec3>(_pos), vertexPos(_vertices, _stride, _index) );
-		return bx::sqrt(bx::dot(tmp, tmp) );
+		const uint8_t* vertices = (const uint8_t*)_vertices;
+		return bx::load<bx::Vec3>(&vertices[_index*_stride]);
 	}
 
-	typedef float (*KeyFn)(float, float, float);
-	typedef float (*DistanceFn)(const float*, const void*, uint32_t, uint32_t);
+	typedef bx::simd128_t (*KeyFn)(bx::simd128_t, bx::simd128_t, bx::simd128_t);
+	typedef bx::simd128_t (*DistanceFn)(const bx::simd128_t*, bx::simd128_t, bx::simd128_t, bx::simd128_t);
 
+	// Calculates sort keys for 4 triangles at once. Triangle corners are transposed into
+	// x, y, z registers, so distance and key are evaluated for all lanes together. Min/max
+	// distance sorts use squared distance, ordering is the same and it avoids square root.
 	template<typename IndexT, DistanceFn dfn, KeyFn kfn, uint32_t xorBits>
 	inline void calcSortKeys(
 		  uint32_t* _keys
 		, uint32_t* _values
+		, uint32_t  _first
 		, const float _dirOrPos[3]
 		, const void* _vertices
 		, uint32_t _stride
@@ -308,23 +325,221 @@ namespace bgfx
 		, uint32_t _num
 		)
 	{
-		for (uint32_t ii = 0; ii < _num; ++ii)
+		using namespace bx;
+
+		if (0 == _num)
+		{
+			return;
+		}
+
+		const simd128_t dirOrPos[3] =
+		{
+			simd_splat<simd128_t>(_dirOrPos[0]),
+			simd_splat<simd128_t>(_dirOrPos[1]),
+			simd_splat<simd128_t>(_dirOrPos[2]),
+		};
+
+		BX_ALIGN_DECL_16(float) soa[3][3][4];
+		BX_ALIGN_DECL_16(float) key[4];
+
+		for (uint32_t ii = 0; ii < _num; ii += 4)
 		{
-			const uint32_t idx0 = _indices[0];
-			const uint32_t idx1 = _indices[1];
-			const uint32_t idx2 = _indices[2];
-			_indices += 3;
+			// Lanes past the end replicate the last triangle, their keys are not stored.
+			for (uint32_t lane = 0; lane < 4; ++lane)
+			{
+				const IndexT* tri = &_indices[(_first + min(ii+lane, _num-1) )*3];
+
+				for (uint32_t corner = 0; corner < 3; ++corner)
+				{
+					const Vec3 pos = vertexPos(_vertices, _stride, tri[corner]);
+					soa[corner][0][lane] = pos.x;
+					soa[corner][1][lane] = pos.y;
+					soa[corner][2][lane] = pos.z;
+				}
+			}
+
+			const simd128_t distance0 = dfn(dirOrPos, simd_ld<simd128_t>(soa[0][0]), simd_ld<simd128_t>(soa[0][1]), simd_ld<simd128_t>(soa[0][2]) );
+			const simd128_t distance1 = dfn(dirOrPos, simd_ld<simd128_t>(soa[1][0]), simd_ld<simd128_t>(soa[1][1]), simd_ld<simd128_t>(soa[1][2]) );
+			const simd128_t distance2 = dfn(dirOrPos, simd_ld<simd128_t>(soa[2][0]), simd_ld<simd128_t>(soa[2][1]), simd_ld<simd128_t>(soa[2][2]) );
 
-			float distance0 = dfn(_dirOrPos, _vertices, _stride, idx0);
-			float distance1 = dfn(_dirOrPos, _vertices, _stride, idx1);
-			float distance2 = dfn(_dirOrPos, _vertices, _stride, idx2);
+			simd_st(key, kfn(distance0, distance1, distance2) );
 
-			uint32_t ui = bx::floatToBits(kfn(distance0, distance1, distance2) );
-			_keys[ii]   = bx::floatFlip(ui) ^ xorBits;
-			_values[ii] = ii;
+			const uint32_t num = min(_num-ii, 4u);
+			for (uint32_t lane = 0; lane < num; ++lane)
+			{
+				uint32_t ui = floatToBits(key[lane]);
+				_keys[ii+lane]   = floatFlip(ui) ^ xorBits;
+				_values[ii+lane] = _first+ii+lane;
+			}
 		}
 	}
 
+	struct BX_NO_VTABLE TopologySortJobI
+	{
+		virtual ~TopologySortJobI() = 0;
+		virtual void sort() = 0;
+	};
+
+	inline TopologySortJobI::~TopologySortJobI()
+	{
+	}
+
+	// Persistent worker threads for sorting large triangle lists. Threads are created on
+	// first large sort and kept until topologyShutdown. Creating and joining threads on
+	// every call would eat most of the gain for sorts done every frame.
+	class TopologySortWorkers
+	{
+	public:
+		TopologySortWorkers()
+			: m_num(0)
+		{
+		}
+
+		void init()
+		{
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_thread); ++ii)
+			{
+				if (!m_thread[ii].init(threadFunc, this, 0, "bgfx - topology sort") )
+				{
+					break;
+				}
+
+				++m_num;
+			}
+		}
+
+		void shutdown()
+		{
+			for (uint32_t ii = 0; ii < m_num; ++ii)
+			{
+				m_thread[ii].push(NULL);
+				m_thread[ii].shutdown();
+			}
+
+			m_num = 0;
+		}
+
+		uint32_t getNum() const
+		{
+			return m_num;
+		}
+
+		void push(uint32_t _worker, TopologySortJobI* _job)
+		{
+			m_thread[_worker].push(_job);
+		}
+
+		void wait(uint32_t _numJobs)
+		{
+			for (uint32_t ii = 0; ii < _numJobs; ++ii)
+			{
+				m_done.wait();
+			}
+		}
+
+	private:
+		static constexpr uint32_t kMaxWorkers = BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS > 1
+			? BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS-1
+			: 1
+			;
+
+		static int32_t threadFunc(bx::Thread* _thread, void* _userData)
+		{
+			TopologySortWorkers* workers = (TopologySortWorkers*)_userData;
+
+			for (TopologySortJobI* job = (TopologySortJobI*)_thread->pop(); NULL != job; job = (TopologySortJobI*)_thread->pop() )
+			{
+				job->sort();
+				workers->m_done.post();
+			}
+
+			return 0;
+		}
+
+		bx::Thread    m_thread[kMaxWorkers];
+		bx::Semaphore m_done;
+		uint32_t      m_num;
+	};
+
+	static TopologySortWorkers* s_topologySortWorkers;
+	static bx::AllocatorI*      s_topologySortAllocator;
+	static int32_t              s_topologySortBusy;
+
+	// Workers are shared by all callers. Returns NULL when other thread is using them, caller
+	// then sorts on its own thread.
+	static TopologySortWorkers* topologySortAcquireWorkers(bx::AllocatorI* _allocator)
+	{
+		if (0 != bx::atomicCompareAndSwap<int32_t>(&s_topologySortBusy, 0, 1) )
+		{
+			return NULL;
+		}
+
+		if (NULL == s_topologySortWorkers)
+		{
+			s_topologySortAllocator = _allocator;
+			s_topologySortWorkers   = BX_NEW(_allocator, TopologySortWorkers);
+			s_topologySortWorkers->init();
+		}
+
+		return s_topologySortWorkers;
+	}
+
+	static void topologySortReleaseWorkers()
+	{
+		bx::atomicCompareAndSwap<int32_t>(&s_topologySortBusy, 1, 0);
+	}
+
+	void topologyShutdown()
+	{
+		if (NULL != s_topologySortWorkers)
+		{
+			s_topologySortWorkers->shutdown();
+			bx::deleteObject(s_topologySortAllocator, s_topologySortWorkers);
+			s_topologySortWorkers = NULL;
+		}
+	}
+
+	// Sorts range of triangles into its own part of keys/values scratch. Ranges are sorted
+	// independently, on worker threads for large meshes, and merged into destination.
+	template<typename IndexT>
+	struct TopologySortRange : public TopologySortJobI
+	{
+		void sort() override
+		{
+			switch (m_sort)
+			{
+			default:
+			case TopologySort::DirectionFrontToBackMin: calcSortKeys<IndexT, distanceDir,   fmin3, 0         >(m_keys, m_values, m_first, m_dir, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DirectionFrontToBackAvg: calcSortKeys<IndexT, distanceDir,   favg3, 0         >(m_keys, m_values, m_first, m_dir, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DirectionFrontToBackMax: calcSortKeys<IndexT, distanceDir,   fmax3, 0         >(m_keys, m_values, m_first, m_dir, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DirectionBackToFrontMin: calcSortKeys<IndexT, distanceDir,   fmin3, UINT32_MAX>(m_keys, m_values, m_first, m_dir, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DirectionBackToFrontAvg: calcSortKeys<IndexT, distanceDir,   favg3, UINT32_MAX>(m_keys, m_values, m_first, m_dir, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DirectionBackToFrontMax: calcSortKeys<IndexT, distanceDir,   fmax3, UINT32_MAX>(m_keys, m_values, m_first, m_dir, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DistanceFrontToBackMin:  calcSortKeys<IndexT, distanceSqPos, fmin3, 0         >(m_keys, m_values, m_first, m_pos, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DistanceFrontToBackAvg:  calcSortKeys<IndexT, distancePos,   favg3, 0         >(m_keys, m_values, m_first, m_pos, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DistanceFrontToBackMax:  calcSortKeys<IndexT, distanceSqPos, fmax3, 0         >(m_keys, m_values, m_first, m_pos, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DistanceBackToFrontMin:  calcSortKeys<IndexT, distanceSqPos, fmin3, UINT32_MAX>(m_keys, m_values, m_first, m_pos, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DistanceBackToFrontAvg:  calcSortKeys<IndexT, distancePos,   favg3, UINT32_MAX>(m_keys, m_values, m_first, m_pos, m_vertices, m_stride, m_indices, m_num); break;
+			case TopologySort::DistanceBackToFrontMax:  calcSortKeys<IndexT, distanceSqPos, fmax3, UINT32_MAX>(m_keys, m_values, m_first, m_pos, m_vertices, m_stride, m_indices, m_num); break;
+			}
+
+			bx::radixSort(m_keys, m_tempKeys, m_values, m_tempValues, m_num);
+		}
+
+		TopologySort::Enum m_sort;
+		uint32_t*     m_keys;
+		uint32_t*     m_values;
+		uint32_t*     m_tempKeys;
+		uint32_t*     m_tempValues;
+		uint32_t      m_first;
+		uint32_t      m_num;
+		const float*  m_dir;
+		const float*  m_pos;
+		const void*   m_vertices;
+		uint32_t      m_stride;
+		const IndexT* m_indices;
+	};
+
 	template<typename IndexT>
 	void topologySortTriList(
 		  TopologySort::Enum  _sort
@@ -339,34 +554,103 @@ namespace bgfx
 		, const void* _vertices
 		, uint32_t    _stride
 		, const IndexT* _indices
+		, bx::AllocatorI* _allocator
 		)
 	{
-		using namespace bx;
+		uint32_t numRanges = bx::clamp<uint32_t>(
+			  _num / BGFX_CONFIG_TOPOLOGY_SORT_MIN_TRIANGLES_PER_THREAD
+			, 1
+			, BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS
+			);
+
+		TopologySortWorkers* workers = 1 < numRanges
+			? topologySortAcquireWorkers(_allocator)
+			: NULL
+			;
+
+		numRanges = NULL == workers
+			? 1
+			: bx::min(numRanges, workers->getNum()+1)
+			;
 
-		switch (_sort)
+		TopologySortRange<IndexT> range[BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS];
+
+		for (uint32_t ii = 0; ii < numRanges; ++ii)
 		{
-		default:
-		case TopologySort::DirectionFrontToBackMin: calcSortKeys<IndexT, distanceDir, fmin3, 0         >(_keys, _values, _dir, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DirectionFrontToBackAvg: calcSortKeys<IndexT, distanceDir, favg3, 0         >(_keys, _values, _dir, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DirectionFrontToBackMax: calcSortKeys<IndexT, distanceDir, fmax3, 0         >(_keys, _values, _dir, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DirectionBackToFrontMin: calcSortKeys<IndexT, distanceDir, fmin3, UINT32_MAX>(_keys, _values, _dir, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DirectionBackToFrontAvg: calcSortKeys<IndexT, distanceDir, favg3, UINT32_MAX>(_keys, _values, _dir, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DirectionBackToFrontMax: calcSortKeys<IndexT, distanceDir, fmax3, UINT32_MAX>(_keys, _values, _dir, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DistanceFrontToBackMin:  calcSortKeys<IndexT, distancePos, fmin3, 0         >(_keys, _values, _pos, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DistanceFrontToBackAvg:  calcSortKeys<IndexT, distancePos, favg3, 0         >(_keys, _values, _pos, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DistanceFrontToBackMax:  calcSortKeys<IndexT, distancePos, fmax3, 0         >(_keys, _values, _pos, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DistanceBackToFrontMin:  calcSortKeys<IndexT, distancePos, fmin3, UINT32_MAX>(_keys, _values, _pos, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DistanceBackToFrontAvg:  calcSortKeys<IndexT, distancePos, favg3, UINT32_MAX>(_keys, _values, _pos, _vertices, _stride, _indices, _num); break;
-		case TopologySort::DistanceBackToFrontMax:  calcSortKeys<IndexT, distancePos, fmax3, UINT32_MAX>(_keys, _values, _pos, _vertices, _stride, _indices, _num); break;
+			const uint32_t first = uint32_t(uint64_t(_num)*(ii  )/numRanges);
+			const uint32_t last  = uint32_t(uint64_t(_num)*(ii+1)/numRanges);
+
+			TopologySortRange<IndexT>& rr = range[ii];
+			rr.m_sort       = _sort;
+			rr.m_keys       = &_keys[first];
+			rr.m_values     = &_values[first];
+			rr.m_tempKeys   = &_tempKeys[first];
+			rr.m_tempValues = &_tempValues[first];
+			rr.m_first      = first;
+			rr.m_num        = last - first;
+			rr.m_dir        = _dir;
+			rr.m_pos        = _pos;
+			rr.m_vertices   = _vertices;
+			rr.m_stride     = _stride;
+			rr.m_indices    = _indices;
+		}
+
+		// Calling thread sorts first range, workers sort the rest.
+		for (uint32_t ii = 1; ii < numRanges; ++ii)
+		{
+			workers->push(ii-1, &range[ii]);
 		}
 
-		radixSort(_keys, _tempKeys, _values, _tempValues, _num);
+		range[0].sort();
+
+		if (NULL != workers)
+		{
+			workers->wait(numRanges-1);
+			topologySortReleaseWorkers();
+		}
 
 		IndexT* sorted = _dst;
 
+		if (1 == numRanges)
+		{
+			for (uint32_t ii = 0; ii < _num; ++ii)
+			{
+				uint32_t face = _values[ii]*3;
+				const IndexT idx0 = _indices[face+0];
+				const IndexT idx1 = _indices[face+1];
+				const IndexT idx2 = _indices[face+2];
+
+				sorted[0] = idx0;
+				sorted[1] = idx1;
+				sorted[2] = idx2;
+				sorted += 3;
+			}
+
+			return;
+		}
+
+		// Merge sorted ranges. On equal keys lower range wins, so output order is the same
+		// as when whole list is sorted at once.
+		uint32_t head[BGFX_CONFIG_TOPOLOGY_SORT_MAX_THREADS] = {};
+
 		for (uint32_t ii = 0; ii < _num; ++ii)
 		{
-			uint32_t face = _values[ii]*3;
+			uint32_t best = UINT32_MAX;
+
+			for (uint32_t jj = 0; jj < numRanges; ++jj)
+			{
+				const TopologySortRange<IndexT>& rr = range[jj];
+
+				if (head[jj] < rr.m_num
+				&& (UINT32_MAX == best || rr.m_keys[head[jj]] < range[best].m_keys[head[best]]) )
+				{
+					best = jj;
+				}
+			}
+
+			uint32_t face = range[best].m_values[head[best]]*3;
+			++head[best];
+
 			const IndexT idx0 = _indices[face+0];
 			const IndexT idx1 = _indices[face+1];
 			const IndexT idx2 = _indices[face+2];
@@ -419,6 +703,7 @@ namespace bgfx
 					, _vertices
 					, _stride
 					, (const uint32_t*)_indices
+					, _allocator
 					);
 		}
 		else
@@ -436,6 +721,7 @@ namespace bgfx
 					, _vertices
 					, _stride
 					, (const uint16_t*)_indices
+					, _allocator
 					);
 		}
 
@@ -51,6 +51,9 @@ namespace bgfx
 		, bx::AllocatorI* _allocator
 		);
 
+	/// Stops worker threads used by `topologySortTriList` to sort large triangle lists.
+	void topologyShutdown();
+
 } // namespace bgfx
 
 #endif // BGFX_TOPOLOGY_H_HEADER_GUARD
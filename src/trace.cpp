@@ -0,0 +1,370 @@
+/*
+ * Copyright 2011-2026 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "bgfx_p.h"
+
+#if BGFX_CONFIG_TRACE
+
+#include <bx/file.h>
+
+namespace bgfx
+{
+	static_assert(0 == (BGFX_CONFIG_TRACE_MAX_EVENTS & (BGFX_CONFIG_TRACE_MAX_EVENTS-1) ), "Must be power of 2.");
+
+	constexpr uint32_t kTraceMaxThreads = 64;
+	constexpr uint32_t kTraceMaxDepth   = 64;
+	constexpr uint32_t kTraceMaxFrames  = 8;
+
+	struct TraceEvent
+	{
+		int64_t begin;
+		int64_t end;
+		char    name[48];
+	};
+
+	static_assert(64 == sizeof(TraceEvent) );
+
+	// Events are written only by owning thread, and read by `traceSave` from any thread. Writer
+	// fills slot first and then publishes it by incrementing write counter. Reader discards slots
+	// that might have been overwritten while it was copying them.
+	struct TraceThread
+	{
+		void push(const char* _name, int64_t _begin, int64_t _end)
+		{
+			TraceEvent& event = m_event[m_write & (BGFX_CONFIG_TRACE_MAX_EVENTS-1)];
+			event.begin = _begin;
+			event.end   = _end;
+			bx::strCopy(event.name, BX_COUNTOF(event.name), _name);
+
+			bx::atomicFetchAndAdd<uint32_t>(&m_write, 1);
+		}
+
+		uint32_t read(TraceEvent* _events) const
+		{
+			const uint32_t write = bx::atomicFetchAndAdd<uint32_t>(const_cast<uint32_t*>(&m_write), 0);
+			const uint32_t first = write > BGFX_CONFIG_TRACE_MAX_EVENTS ? write - BGFX_CONFIG_TRACE_MAX_EVENTS : 0;
+
+			for (uint32_t ii = first; ii < write; ++ii)
+			{
+				_events[ii-first] = m_event[ii & (BGFX_CONFIG_TRACE_MAX_EVENTS-1)];
+			}
+
+			const uint32_t after = bx::atomicFetchAndAdd<uint32_t>(const_cast<uint32_t*>(&m_write), 0);
+			const uint32_t valid = after >= BGFX_CONFIG_TRACE_MAX_EVENTS ? after - BGFX_CONFIG_TRACE_MAX_EVENTS + 1 : 0;
+			const uint32_t skip  = bx::min(write - first, valid > first ? valid - first : 0);
+
+			bx::memMove(_events, &_events[skip], (write - first - skip)*sizeof(TraceEvent) );
+
+			return write - first - skip;
+		}
+
+		struct Scope
+		{
+			const char* name;
+			int64_t     begin;
+		};
+
+		TraceEvent m_event[BGFX_CONFIG_TRACE_MAX_EVENTS];
+		Scope      m_stack[kTraceMaxDepth];
+		char       m_name[64];
+		uint32_t   m_tid;
+		uint32_t   m_depth;
+		uint32_t   m_write;
+	};
+
+	struct TraceContext
+	{
+		TraceThread* registerThread()
+		{
+			bx::MutexScope lock(m_mutex);
+
+			if (m_numThreads == kTraceMaxThreads)
+			{
+				BX_TRACE("Trace: Too many threads, max %d.", kTraceMaxThreads);
+				return NULL;
+			}
+
+			TraceThread* thread = BX_NEW(g_allocator, TraceThread);
+			thread->m_tid   = m_numThreads;
+			thread->m_depth = 0;
+			thread->m_write = 0;
+			bx::snprintf(thread->m_name, BX_COUNTOF(thread->m_name), "Thread %d", m_numThreads);
+
+			m_thread[m_numThreads++] = thread;
+
+			return thread;
+		}
+
+		struct FrameTime
+		{
+			uint32_t frameNum;
+			int64_t  cpuTimeBegin;
+		};
+
+		bx::Mutex    m_mutex;
+		TraceThread* m_thread[kTraceMaxThreads];
+		uint32_t     m_numThreads;
+		uint32_t     m_generation;
+		int64_t      m_timeBase;
+
+		TraceThread* m_gpu;
+		FrameTime    m_frameTime[kTraceMaxFrames];
+		uint32_t     m_gpuFrameNum;
+	};
+
+	static TraceContext* s_trace = NULL;
+	static uint32_t s_traceGeneration = 0;
+	static BX_THREAD_LOCAL TraceThread* s_traceThread(NULL);
+	static BX_THREAD_LOCAL uint32_t     s_traceThreadGeneration(0);
+
+	static TraceThread* getTraceThread()
+	{
+		TraceContext* trace = s_trace;
+
+		if (NULL == trace)
+		{
+			return NULL;
+		}
+
+		if (s_traceThreadGeneration != trace->m_generation)
+		{
+			s_traceThreadGeneration = trace->m_generation;
+			s_traceThread = trace->registerThread();
+		}
+
+		return s_traceThread;
+	}
+
+	void traceInit()
+	{
+		TraceContext* trace = BX_NEW(g_allocator, TraceContext);
+		trace->m_numThreads  = 0;
+		trace->m_generation  = ++s_traceGeneration;
+		trace->m_timeBase    = bx::getHPCounter();
+		trace->m_gpuFrameNum = UINT32_MAX;
+		bx::memSet(trace->m_frameTime, 0xff, sizeof(trace->m_frameTime) );
+
+		trace->m_gpu = trace->registerThread();
+		bx::strCopy(trace->m_gpu->m_name, BX_COUNTOF(trace->m_gpu->m_name), "GPU");
+
+		s_trace = trace;
+	}
+
+	void traceShutdown()
+	{
+		TraceContext* trace = s_trace;
+		s_trace = NULL;
+
+		if (NULL != trace)
+		{
+			for (uint32_t ii = 0; ii < trace->m_numThreads; ++ii)
+			{
+				bx::deleteObject(g_allocator, trace->m_thread[ii]);
+			}
+
+			bx::deleteObject(g_allocator, trace);
+		}
+	}
+
+	void traceBegin(const char* _name)
+	{
+		TraceThread* thread = getTraceThread();
+
+		if (NULL != thread)
+		{
+			if (thread->m_depth < kTraceMaxDepth)
+			{
+				TraceThread::Scope& scope = thread->m_stack[thread->m_depth];
+				scope.name  = _name;
+				scope.begin = bx::getHPCounter();
+			}
+
+			++thread->m_depth;
+		}
+	}
+
+	void traceEnd()
+	{
+		TraceThread* thread = getTraceThread();
+
+		// Scope might be started before trace was initialized.
+		if (NULL != thread
+		&&  0 != thread->m_depth)
+		{
+			--thread->m_depth;
+
+			if (thread->m_depth < kTraceMaxDepth)
+			{
+				const TraceThread::Scope& scope = thread->m_stack[thread->m_depth];
+				thread->push(scope.name, scope.begin, bx::getHPCounter() );
+			}
+		}
+	}
+
+	void traceSetThreadName(const char* _name)
+	{
+		TraceThread* thread = getTraceThread();
+
+		if (NULL != thread)
+		{
+			bx::MutexScope lock(s_trace->m_mutex);
+			bx::strCopy(thread->m_name, BX_COUNTOF(thread->m_name), _name);
+		}
+	}
+
+	void traceFrame(const Frame* _frame)
+	{
+		TraceContext* trace = s_trace;
+
+		if (NULL == trace)
+		{
+			return;
+		}
+
+		const Stats& stats = _frame->m_perfStats;
+
+		TraceContext::FrameTime& frameTime = trace->m_frameTime[_frame->m_frameNum % kTraceMaxFrames];
+		frameTime.frameNum     = _frame->m_frameNum;
+		frameTime.cpuTimeBegin = stats.cpuTimeBegin;
+
+		if (0 == stats.gpuTimerFreq
+		||  stats.gpuFrameNum == trace->m_gpuFrameNum)
+		{
+			return;
+		}
+
+		// GPU results arrive few frames late, CPU submit time of that frame is still needed to place
+		// them on the timeline.
+		const TraceContext::FrameTime& gpuFrameTime = trace->m_frameTime[stats.gpuFrameNum % kTraceMaxFrames];
+		if (gpuFrameTime.frameNum != stats.gpuFrameNum)
+		{
+			return;
+		}
+
+		trace->m_gpuFrameNum = stats.gpuFrameNum;
+
+		// GPU and CPU clocks are not synchronized, GPU frame begin is aligned with CPU submit begin
+		// of the same frame.
+		const double  toCpu  = double(bx::getHPFrequency() ) / double(stats.gpuTimerFreq);
+		const int64_t offset = gpuFrameTime.cpuTimeBegin - int64_t(stats.gpuTimeBegin*toCpu);
+
+		char name[64];
+		bx::snprintf(name, BX_COUNTOF(name), "Frame %d", stats.gpuFrameNum);
+		trace->m_gpu->push(
+			  name
+			, offset + int64_t(stats.gpuTimeBegin*toCpu)
+			, offset + int64_t(stats.gpuTimeEnd*toCpu)
+			);
+
+		for (uint16_t ii = 0; ii < stats.numViews; ++ii)
+		{
+			const ViewStats& viewStats = stats.viewStats[ii];
+
+			if (viewStats.gpuFrameNum == stats.gpuFrameNum
+			&&  viewStats.gpuTimeEnd  >  viewStats.gpuTimeBegin)
+			{
+				trace->m_gpu->push(
+					  viewStats.name
+					, offset + int64_t(viewStats.gpuTimeBegin*toCpu)
+					, offset + int64_t(viewStats.gpuTimeEnd*toCpu)
+					);
+			}
+		}
+	}
+
+	static void escapeJson(char* _dst, int32_t _dstSize, const char* _src)
+	{
+		int32_t len = 0;
+
+		for (; '\0' != *_src && len < _dstSize-2; ++_src)
+		{
+			const char ch = *_src;
+
+			if ('"'  == ch
+			||  '\\' == ch)
+			{
+				_dst[len++] = '\\';
+				_dst[len++] = ch;
+			}
+			else
+			{
+				_dst[len++] = uint8_t(ch) < 0x20 ? ' ' : ch;
+			}
+		}
+
+		_dst[len] = '\0';
+	}
+
+	bool traceSave(const char* _filePath)
+	{
+		TraceContext* trace = s_trace;
+
+		if (NULL == trace)
+		{
+			return false;
+		}
+
+		bx::FileWriter writer;
+		if (!bx::open(&writer, _filePath) )
+		{
+			BX_TRACE("Trace: Failed to open file %s.", _filePath);
+			return false;
+		}
+
+		TraceEvent* events = (TraceEvent*)bx::alloc(g_allocator, BGFX_CONFIG_TRACE_MAX_EVENTS*sizeof(TraceEvent) );
+
+		const double toUs = 1000000.0 / double(bx::getHPFrequency() );
+
+		bx::Error err;
+		bx::write(&writer, &err, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+		{
+			bx::MutexScope lock(trace->m_mutex);
+
+			const char* separator = "";
+			char name[128];
+
+			for (uint32_t ii = 0; ii < trace->m_numThreads; ++ii)
+			{
+				const TraceThread* thread = trace->m_thread[ii];
+
+				escapeJson(name, BX_COUNTOF(name), thread->m_name);
+				bx::write(&writer, &err
+					, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}"
+					, separator
+					, thread->m_tid
+					, name
+					);
+				separator = ",\n";
+
+				const uint32_t num = thread->read(events);
+
+				for (uint32_t jj = 0; jj < num; ++jj)
+				{
+					const TraceEvent& event = events[jj];
+
+					escapeJson(name, BX_COUNTOF(name), event.name);
+					bx::write(&writer, &err
+						, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}"
+						, name
+						, thread->m_tid
+						, double(event.begin - trace->m_timeBase)*toUs
+						, double(event.end - event.begin)*toUs
+						);
+				}
+			}
+		}
+
+		bx::write(&writer, &err, "\n]}\n");
+		bx::close(&writer);
+
+		bx::free(g_allocator, events);
+
+		return err.isOk();
+	}
+
+} // namespace bgfx
+
+#endif // BGFX_CONFIG_TRACE
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2011-2026 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_TRACE_H_HEADER_GUARD
+#define BGFX_TRACE_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+#include "config.h"
+
+namespace bgfx
+{
+	struct Frame;
+
+#if BGFX_CONFIG_TRACE
+	/// Allocate trace recorder. Events recorded before init are ignored.
+	void traceInit();
+
+	///
+	void traceShutdown();
+
+	/// Begin trace scope on calling thread. Name must be valid until matching `traceEnd`.
+	void traceBegin(const char* _name);
+
+	/// End trace scope on calling thread.
+	void traceEnd();
+
+	/// Set calling thread name.
+	void traceSetThreadName(const char* _name);
+
+	/// Record per-view GPU timings of rendered frame. Called by render thread.
+	void traceFrame(const Frame* _frame);
+
+	/// Write recorded events as Chrome trace-event JSON.
+	bool traceSave(const char* _filePath);
+#else
+	inline void traceInit() {}
+	inline void traceShutdown() {}
+	inline void traceBegin(const char* /*_name*/) {}
+	inline void traceEnd() {}
+	inline void traceSetThreadName(const char* /*_name*/) {}
+	inline void traceFrame(const Frame* /*_frame*/) {}
+	inline bool traceSave(const char* /*_filePath*/) { return false; }
+#endif // BGFX_CONFIG_TRACE
+
+} // namespace bgfx
+
+#endif // BGFX_TRACE_H_HEADER_GUARD
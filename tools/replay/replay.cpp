@@ -0,0 +1,276 @@
+/*
+ * Copyright 2011-2026 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/commandline.h>
+#include <bx/string.h>
+#include <bx/timer.h>
+#include <bgfx/bgfx.h>
+
+#include "bgfx_utils.h"
+
+#define BGFX_REPLAY_VERSION_MAJOR 1
+#define BGFX_REPLAY_VERSION_MINOR 0
+
+struct Sample
+{
+	Sample()
+		: m_min(bx::kDoubleLargest)
+		, m_max(0.0)
+		, m_sum(0.0)
+		, m_num(0)
+	{
+	}
+
+	void add(double _value)
+	{
+		m_min  = bx::min(m_min, _value);
+		m_max  = bx::max(m_max, _value);
+		m_sum += _value;
+		++m_num;
+	}
+
+	void print(const char* _name) const
+	{
+		if (0 != m_num)
+		{
+			bx::printf("  %-14s %10.3f %10.3f %10.3f\n"
+				, _name
+				, m_sum/double(m_num)
+				, m_min
+				, m_max
+				);
+		}
+	}
+
+	double   m_min;
+	double   m_max;
+	double   m_sum;
+	uint32_t m_num;
+};
+
+struct FrameSamples
+{
+	void add(const bgfx::Stats* _stats)
+	{
+		const double toCpuMs = 1000.0/double(_stats->cpuTimerFreq);
+
+		m_frame.add(double(_stats->cpuTimeFrame)*toCpuMs);
+		m_submit.add(double(_stats->cpuTimeEnd - _stats->cpuTimeBegin)*toCpuMs);
+		m_waitRender.add(double(_stats->waitRender)*toCpuMs);
+		m_waitSubmit.add(double(_stats->waitSubmit)*toCpuMs);
+
+		if (0 != _stats->gpuTimerFreq)
+		{
+			const double toGpuMs = 1000.0/double(_stats->gpuTimerFreq);
+			m_gpu.add(double(_stats->gpuTimeEnd - _stats->gpuTimeBegin)*toGpuMs);
+		}
+	}
+
+	void print(const char* _title) const
+	{
+		bx::printf("%s (%d frames):\n", _title, m_frame.m_num);
+		bx::printf("  %-14s %10s %10s %10s\n", "[ms]", "avg", "min", "max");
+		m_frame.print("Frame");
+		m_submit.print("Render submit");
+		m_waitRender.print("Wait render");
+		m_waitSubmit.print("Wait submit");
+		m_gpu.print("GPU");
+	}
+
+	Sample m_frame;
+	Sample m_submit;
+	Sample m_waitRender;
+	Sample m_waitSubmit;
+	Sample m_gpu;
+};
+
+static const bx::CommandLineOption s_options[] =
+{
+	{ 'h',  "help",     0, NULL,          "Display this help and exit."                            },
+	{ 'v',  "version",  0, NULL,          "Output version information and exit."                   },
+	{ 'f',  NULL,       1, "<file path>", "Frame capture file path.\n"
+	                                      "Input may also be passed positionally, without -f."     },
+	{ 'r',  "renderer", 1, "<name>",      "Renderer: noop, d3d11, d3d12, gl, mtl, vk.\n"
+	                                      "Defaults to platform default renderer."                 },
+	{ 'n',  "frames",   1, "<num>",       "Number of replayed frames. Defaults to 100."            },
+	{ '\0', "warmup",   1, "<num>",       "Number of frames excluded from results. Defaults to 3." },
+	{ '\0', "width",    1, "<num>",       "Back buffer width. Defaults to 1280."                   },
+	{ '\0', "height",   1, "<num>",       "Back buffer height. Defaults to 720."                   },
+};
+
+void help(const char* _error = NULL)
+{
+	if (NULL != _error)
+	{
+		bx::printf("Error:\n%s\n\n", _error);
+	}
+
+	bx::printf(
+		  "replay, bgfx frame capture replay tool, version %d.%d.%d.\n"
+		  "Copyright 2011-2026 Branimir Karadzic. All rights reserved.\n"
+		  "License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE\n\n"
+		, BGFX_REPLAY_VERSION_MAJOR
+		, BGFX_REPLAY_VERSION_MINOR
+		, BGFX_API_VERSION
+		);
+
+	bx::printf(
+		  "Usage: replay -f <in> [-r <renderer>] [-n <frames>]\n"
+		  "       replay <in>\n"
+
+		  "\n"
+		  "Replays frame captured with `bgfx::requestFrameCapture` without window, and\n"
+		  "reports per-phase timings. bgfx must be built with BGFX_CONFIG_CAPTURE=1.\n"
+
+		  "\n"
+		  "Options:\n"
+		);
+
+	bx::Error err;
+	bx::write(bx::getStdOut(), s_options, BX_COUNTOF(s_options), &err);
+
+	bx::printf(
+		  "\n"
+		  "For additional information, see https://github.com/bkaradzic/bgfx\n"
+		);
+}
+
+int main(int _argc, const char* _argv[])
+{
+	bx::CommandLine cmdLine(_argc, _argv, s_options, BX_COUNTOF(s_options) );
+
+	if (cmdLine.hasArg('v', "version") )
+	{
+		bx::printf(
+			"replay, bgfx frame capture replay tool, version %d.%d.%d.\n"
+			, BGFX_REPLAY_VERSION_MAJOR
+			, BGFX_REPLAY_VERSION_MINOR
+			, BGFX_API_VERSION
+		);
+		return bx::kExitSuccess;
+	}
+
+	if (cmdLine.hasArg('h', "help") )
+	{
+		help();
+		return bx::kExitFailure;
+	}
+
+	const char* unknown = cmdLine.findUnknownOption();
+	if (NULL != unknown)
+	{
+		char error[256];
+		bx::snprintf(error, BX_COUNTOF(error), "Unknown option '%s'.", unknown);
+		help(error);
+		return bx::kExitFailure;
+	}
+
+	const char* filePath = cmdLine.findOption('f');
+	filePath = NULL != filePath ? filePath : cmdLine.getPositional(1);
+	if (NULL == filePath)
+	{
+		help("Input file name must be specified.");
+		return bx::kExitFailure;
+	}
+
+	bgfx::RendererType::Enum type = bgfx::RendererType::Count;
+
+	const char* renderer = cmdLine.findOption('r', "renderer");
+	if (NULL != renderer)
+	{
+		type = getType(renderer);
+
+		if (bgfx::RendererType::Count == type)
+		{
+			help("Unknown renderer.");
+			return bx::kExitFailure;
+		}
+	}
+
+	uint32_t numFrames = 100;
+	cmdLine.hasArg(numFrames, 'n', "frames");
+
+	uint32_t numWarmup = 3;
+	cmdLine.hasArg(numWarmup, '\0', "warmup");
+
+	uint32_t width = 1280;
+	cmdLine.hasArg(width, '\0', "width");
+
+	uint32_t height = 720;
+	cmdLine.hasArg(height, '\0', "height");
+
+	// Without native window handle renderer is created headless, and it renders into back
+	// buffer that's never presented.
+	bgfx::Init init;
+	init.type = type;
+	init.resolution.width  = width;
+	init.resolution.height = height;
+	init.resolution.reset  = BGFX_RESET_NONE;
+
+	if (!bgfx::init(init) )
+	{
+		bx::printf("Failed to initialize bgfx.\n");
+		return bx::kExitFailure;
+	}
+
+	bgfx::setDebug(BGFX_DEBUG_PROFILER);
+
+	if (!bgfx::replayFrameCapture(filePath) )
+	{
+		bx::printf("Unable to replay frame capture '%s'.\n", filePath);
+		bgfx::shutdown();
+		return bx::kExitFailure;
+	}
+
+	bx::printf("Replaying '%s' with %s renderer.\n\n"
+		, filePath
+		, bgfx::getRendererName(bgfx::getRendererType() )
+		);
+
+	FrameSamples warmup;
+	FrameSamples replay;
+
+	const int64_t timeBegin = bx::getHPCounter();
+
+	for (uint32_t ii = 0, num = numWarmup + numFrames; ii < num; ++ii)
+	{
+		bgfx::frame();
+
+		const bgfx::Stats* stats = bgfx::getStats();
+
+		if (ii < numWarmup)
+		{
+			warmup.add(stats);
+		}
+		else
+		{
+			replay.add(stats);
+		}
+	}
+
+	const double elapsed = double(bx::getHPCounter() - timeBegin)*1000.0/double(bx::getHPFrequency() );
+
+	const bgfx::Stats* stats = bgfx::getStats();
+	bx::printf("Draw calls %d, compute %d, blits %d, views %d.\n\n"
+		, stats->numDraw
+		, stats->numCompute
+		, stats->numBlit
+		, stats->numViews
+		);
+
+	// First frames include creation of captured resources.
+	warmup.print("Warm-up");
+	bx::printf("\n");
+	replay.print("Replay");
+
+	bx::printf("\nTotal %0.3f [ms].\n", elapsed);
+
+	bgfx::replayFrameCapture(NULL);
+	bgfx::frame();
+
+	bgfx::shutdown();
+
+	return bx::kExitSuccess;
+}
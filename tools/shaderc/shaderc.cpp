@@ -272,6 +272,7 @@ namespace bgfx
 		, raw(false)
 		, preprocessOnly(false)
 		, depends(false)
+		, instanced(false)
 		, debugInformation(false)
 		, avoidFlowControl(false)
 		, noPreshader(false)
@@ -297,6 +298,7 @@ namespace bgfx
 			"\t  raw: %s\n"
 			"\t  preprocessOnly: %s\n"
 			"\t  depends: %s\n"
+			"\t  instanced: %s\n"
 			"\t  debugInformation: %s\n"
 			"\t  avoidFlowControl: %s\n"
 			"\t  noPreshader: %s\n"
@@ -317,6 +319,7 @@ namespace bgfx
 			, raw ? "true" : "false"
 			, preprocessOnly ? "true" : "false"
 			, depends ? "true" : "false"
+			, instanced ? "true" : "false"
 			, debugInformation ? "true" : "false"
 			, avoidFlowControl ? "true" : "false"
 			, noPreshader ? "true" : "false"
@@ -1009,6 +1012,8 @@ namespace bgfx
 		{ '\0', "raw",                     0, NULL,             "Do not process shader. No preprocessor. (GLSL only)"                             },
 		{ '\0', "type",                    1, "<type>",         "Shader type. Can be 'vertex', 'fragment, or 'compute'."                          },
 		{ '\0', "varyingdef",              1, "<file path>",    "varying.def.sc's file path."                                                     },
+		{ '\0', "instanced",               0, NULL,             "Generate instanced variant of vertex shader. Model matrix is read from\n"
+		                                                        "i_data0-3 instead of u_model."                                                   },
 		{ '\0', "verbose",                 0, NULL,             "Be verbose."                                                                     },
 		{ '\0', "debug",                   0, NULL,             "Debug information. (Vulkan, DirectX and Metal only)"                             },
 		{ '\0', "disasm",                  0, NULL,             "Disassemble compiled shader. (DirectX only)"                                     },
@@ -1182,6 +1187,8 @@ namespace bgfx
 		preprocessor.setDefaultDefine("BGFX_SHADER_TYPE_FRAGMENT");
 		preprocessor.setDefaultDefine("BGFX_SHADER_TYPE_VERTEX");
 
+		preprocessor.setDefaultDefine("BGFX_SHADER_INSTANCED");
+
 		char glslDefine[128] = { '\0' };
 		char esslDefine[128] = { '\0' };
 		char hlslDefine[128] = { '\0' };
@@ -1362,6 +1369,11 @@ namespace bgfx
 
 		case 'v':
 			preprocessor.setDefine("BGFX_SHADER_TYPE_VERTEX=1");
+
+			if (_options.instanced)
+			{
+				preprocessor.setDefine("BGFX_SHADER_INSTANCED=1");
+			}
 			break;
 
 		default:
@@ -1550,6 +1562,47 @@ namespace bgfx
 			}
 		}
 
+		const bool instanced = true
+			&& 'v' == _options.shaderType
+			&& _options.instanced
+			;
+
+		if (instanced)
+		{
+			// Instanced variant reads model matrix columns from instance data.
+			static const char* s_instanceData[] =
+			{
+				"i_data0",
+				"i_data1",
+				"i_data2",
+				"i_data3",
+			};
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(s_instanceData); ++ii)
+			{
+				const std::string name = s_instanceData[ii];
+
+				if (shaderInputs.end() == std::find(shaderInputs.begin(), shaderInputs.end(), name) )
+				{
+					shaderInputs.push_back(name);
+				}
+
+				if (varyingMap.end() == varyingMap.find(name) )
+				{
+					char semantics[16];
+					bx::snprintf(semantics, sizeof(semantics), "TEXCOORD%d", 31-ii);
+
+					Varying var;
+					var.m_type      = "vec4";
+					var.m_name      = name;
+					var.m_semantics = semantics;
+					varyingMap.insert(std::make_pair(var.m_name, var) );
+				}
+			}
+
+			std::sort(shaderInputs.begin(), shaderInputs.end() );
+		}
+
 		bool invalidShaderAttribute = false;
 		if ('v' == _options.shaderType)
 		{
@@ -1806,6 +1859,18 @@ namespace bgfx
 		}
 		else // Vertex/Fragment
 		{
+			if (instanced)
+			{
+				bx::StringView brace = bx::strFind(bx::strFind(input, "void main()"), "{");
+				if (!brace.isEmpty() )
+				{
+					strInsert(const_cast<char*>(brace.getPtr()+1)
+						, "\nmat4 bgfx_instanceModel[1];"
+						  "\nbgfx_instanceModel[0] = mtxFromCols(i_data0, i_data1, i_data2, i_data3);\n"
+						);
+				}
+			}
+
 			bx::StringView shader(input);
 			bx::StringView entry = bx::strFind(shader, "void main()");
 			if (entry.isEmpty() )
@@ -2559,6 +2624,7 @@ namespace bgfx
 		}
 
 		options.depends = cmdLine.hasArg("depends");
+		options.instanced = cmdLine.hasArg("instanced");
 		options.preprocessOnly = cmdLine.hasArg("preprocess");
 		const char* includeDir = cmdLine.findOption('i');
 
@@ -146,6 +146,7 @@ namespace bgfx
 		bool raw;
 		bool preprocessOnly;
 		bool depends;
+		bool instanced;
 
 		bool debugInformation;
 
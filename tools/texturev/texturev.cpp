@@ -977,6 +977,15 @@ int cmdVideo(CmdContext* /*_context*/, void* _userData, int _argc, char const* c
 	{
 		player->restart();
 	}
+	else if (0 == bx::strCmp(verb, "cache", 5) )
+	{
+		uint32_t megabytes = 0;
+		if (_argc >= 3
+		&&  bx::fromString(&megabytes, _argv[2]) )
+		{
+			player->setDemuxBudget(megabytes<<20);
+		}
+	}
 
 	return 0;
 }
@@ -1900,6 +1909,18 @@ int _main_(int _argc, char** _argv)
 
 					ImGui::Text("/ %5.2fs  " ICON_FA_FORWARD " %.2fx", durS, videoPlayer.playbackRate() );
 
+					VideoPlayer::DemuxStats demuxStats;
+					videoPlayer.getDemuxStats(demuxStats);
+
+					const uint32_t numLookups = demuxStats.hits + demuxStats.misses;
+					ImGui::Text("Demux %.1f MiB/s, cache %.1f / %.1f MiB (%d AUs), hit %.1f%%"
+						, demuxStats.bytesPerSec / double(1<<20)
+						, double(demuxStats.cachedBytes) / double(1<<20)
+						, double(demuxStats.budgetBytes) / double(1<<20)
+						, demuxStats.cachedAus
+						, 0 != numLookups ? 100.0 * double(demuxStats.hits) / double(numLookups) : 100.0
+						);
+
 					const int64_t aUs = videoPlayer.aMarkerUs();
 					const int64_t bUs = videoPlayer.bMarkerUs();
 					if (aUs >= 0 && bUs >= 0)
@@ -11,6 +11,9 @@
 #include <bx/timer.h>
 #include <bx/debug.h>
 #include <bx/file.h>
+#include <bx/mutex.h>
+#include <bx/semaphore.h>
+#include <bx/thread.h>
 
 #include <entry/entry.h>
 
@@ -45,8 +48,6 @@ struct VideoPlayer::Impl
 	uint32_t                 trackId      = 0;
 	uint32_t                 lengthSize   = 4;
 
-	stl::vector<uint8_t>     annexBScratch;
-
 	struct Frame
 	{
 		uint64_t ptsUs;
@@ -55,8 +56,114 @@ struct VideoPlayer::Impl
 
 	stl::vector<Frame> frames;
 
+	// Demux thread owns l-smash root after file is loaded, and fills Annex-B access unit cache
+	// indexed by sample. Cached samples are always contiguous range [cacheFirst, cacheEnd).
+	bx::Thread    demuxThread;
+	bx::Mutex     demuxMutex;
+	bx::Semaphore demuxSem;
+
+	stl::vector<stl::vector<uint8_t> > cache;
+	uint32_t cacheFirst    = 0;
+	uint32_t cacheEnd      = 0;
+	uint32_t cacheBytes    = 0;
+	uint32_t cacheBudget   = 0;
+	uint32_t consumeIndex  = 0;
+	uint32_t requestIndex  = UINT32_MAX;
+	uint32_t missIndex     = UINT32_MAX;
+	bool     demuxExit     = false;
+
+	uint64_t demuxBytes    = 0;
+	uint32_t demuxAus      = 0;
+	int64_t  demuxHpc      = 0;
+	uint32_t cacheHits     = 0;
+	uint32_t cacheMisses   = 0;
+
+	bool isCached(uint32_t _index) const
+	{
+		return cacheFirst <= _index && _index < cacheEnd;
+	}
+
+	void release(uint32_t _index)
+	{
+		cacheBytes -= uint32_t(cache[_index].size() );
+		stl::vector<uint8_t>().swap(cache[_index]);
+	}
+
+	uint32_t findIdrAtOrBefore(uint32_t _index) const
+	{
+		for (uint32_t ii = bx::min(_index, uint32_t(frames.size() ) - 1); 0 < ii; --ii)
+		{
+			if (frames[ii].isKeyframe)
+			{
+				return ii;
+			}
+		}
+
+		return 0;
+	}
+
+	// Must be called with demuxMutex locked. Returns UINT32_MAX when there is nothing to demux.
+	uint32_t nextDemuxIndex()
+	{
+		if (UINT32_MAX != requestIndex)
+		{
+			if (requestIndex < cacheFirst
+			||  requestIndex > cacheEnd)
+			{
+				for (uint32_t ii = cacheFirst; ii < cacheEnd; ++ii)
+				{
+					release(ii);
+				}
+
+				cacheFirst = requestIndex;
+				cacheEnd   = requestIndex;
+			}
+
+			requestIndex = UINT32_MAX;
+		}
+
+		// GOP being decoded is kept, seek back to its IDR is served from cache.
+		const uint32_t keepFrom = findIdrAtOrBefore(consumeIndex);
+
+		while (cacheBytes > cacheBudget
+		&&     cacheFirst < keepFrom
+		&&     cacheFirst < cacheEnd)
+		{
+			release(cacheFirst++);
+		}
+
+		const bool hasSpace = false
+			|| cacheBytes < cacheBudget
+			|| cacheEnd   <= consumeIndex
+			;
+
+		if (cacheEnd < uint32_t(frames.size() )
+		&&  hasSpace)
+		{
+			return cacheEnd;
+		}
+
+		return UINT32_MAX;
+	}
+
+	void stopDemux()
+	{
+		if (demuxThread.isRunning() )
+		{
+			{
+				bx::MutexScope lock(demuxMutex);
+				demuxExit = true;
+			}
+
+			demuxSem.post();
+			demuxThread.shutdown();
+		}
+	}
+
 	~Impl()
 	{
+		stopDemux();
+
 		if (NULL != root)
 		{
 			lsmash_destroy_root(root);
@@ -73,7 +180,7 @@ struct VideoPlayer::Impl
 
 namespace
 {
-	const uint32_t kMaxSubmitPerCall = 1;
+	const uint32_t kMaxSubmitPerCall = 8;
 	const int64_t  kLookaheadUs      = 2 * 1000000;
 	const int64_t  kSkipStepUs       = 8 * 1000000;
 	const float    kRateStepFactor   = 1.25892541f;
@@ -589,6 +696,68 @@ namespace
 		return true;
 	}
 
+	int32_t demuxThreadFunc(bx::Thread* /*_self*/, void* _userData)
+	{
+		VideoPlayer::Impl& video = *static_cast<VideoPlayer::Impl*>(_userData);
+
+		while (true)
+		{
+			uint32_t index;
+
+			{
+				bx::MutexScope lock(video.demuxMutex);
+
+				if (video.demuxExit)
+				{
+					break;
+				}
+
+				index = video.nextDemuxIndex();
+			}
+
+			if (UINT32_MAX == index)
+			{
+				video.demuxSem.wait();
+				continue;
+			}
+
+			const int64_t begin = bx::getHPCounter();
+
+			// Failed sample read is cached as empty access unit, and it's skipped on submit.
+			stl::vector<uint8_t> data;
+
+			lsmash_sample_t* sample = lsmash_get_sample_from_media_timeline(
+				  video.root
+				, video.trackId
+				, index + 1
+				);
+
+			if (NULL != sample)
+			{
+				avccToAnnexB(data, sample->data, sample->length, video.lengthSize);
+				lsmash_delete_sample(sample);
+			}
+
+			const int64_t elapsed = bx::getHPCounter() - begin;
+
+			bx::MutexScope lock(video.demuxMutex);
+
+			video.demuxBytes += data.size();
+			video.demuxHpc   += elapsed;
+			++video.demuxAus;
+
+			// Cache might be reset by seek while sample was read.
+			if (index == video.cacheEnd)
+			{
+				video.cache[index].swap(data);
+				video.cacheBytes += uint32_t(video.cache[index].size() );
+				++video.cacheEnd;
+			}
+		}
+
+		return 0;
+	}
+
 } // namespace
 
 VideoPlayer::VideoPlayer()
@@ -607,6 +776,7 @@ VideoPlayer::VideoPlayer()
 	, m_playbackRate(1.0f)
 	, m_aMarkerUs(-1)
 	, m_bMarkerUs(-1)
+	, m_demuxBudget(32<<20)
 	, m_videoTexture(BGFX_INVALID_HANDLE)
 {
 }
@@ -728,6 +898,10 @@ bool VideoPlayer::open(const char* _filePath)
 	m_isOpen         = true;
 	m_hasError       = false;
 
+	m_impl->cache.resize(m_impl->frames.size() );
+	m_impl->cacheBudget = m_demuxBudget;
+	m_impl->demuxThread.init(demuxThreadFunc, m_impl, 0, "texturev - demux");
+
 	submitAccessUnitsUpTo(kLookaheadUs);
 
 	return true;
@@ -839,81 +1013,152 @@ uint32_t VideoPlayer::findFrameAtOrBefore(uint64_t _ptsUs) const
 	return result;
 }
 
-void VideoPlayer::submitDecodeFrame(uint32_t _index, bool _setPosition)
+void VideoPlayer::submitAccessUnitsUpTo(int64_t _untilPtsUs)
 {
-	const VideoPlayer::Impl::Frame& f = m_impl->frames[_index];
+	if (NULL == m_impl)
+	{
+		return;
+	}
 
-	lsmash_sample_t* s = lsmash_get_sample_from_media_timeline(
-		  m_impl->root
-		, m_impl->trackId
-		, _index + 1
-		);
+	const uint32_t numFrames = uint32_t(m_impl->frames.size() );
 
-	if (NULL == s)
+	if (m_nextAuToSubmit >= numFrames
+	||  int64_t(m_impl->frames[m_nextAuToSubmit].ptsUs) > _untilPtsUs)
 	{
 		return;
 	}
 
-	struct Payload
+	const bgfx::Memory* mem = NULL;
+
 	{
-		bgfx::VideoDecoderFrame frame;
-		bgfx::VideoDecoderAu    au;
-	};
+		bx::MutexScope lock(m_impl->demuxMutex);
 
-	stl::vector<uint8_t>& scratch = m_impl->annexBScratch;
-	scratch.clear();
-	avccToAnnexB(scratch, s->data, s->length, m_impl->lengthSize);
-	const uint32_t bitstreamSize = uint32_t(scratch.size() );
-	const uint32_t totalSize     = uint32_t(sizeof(Payload) ) + bitstreamSize;
+		m_impl->consumeIndex = m_nextAuToSubmit;
 
-	const bgfx::Memory* mem = bgfx::alloc(totalSize);
-	Payload* dstPayload     = (Payload*)mem->data;
-	uint8_t* dstBitstream   = (uint8_t*)(dstPayload + 1);
-
-	bx::memCopy(dstBitstream, scratch.data(), bitstreamSize);
-
-	dstPayload->au.size                  = bitstreamSize;
-	dstPayload->au.ptsUs                 = int64_t(f.ptsUs);
-	dstPayload->frame.magic              = BX_MAKEFOURCC('V', 'D', 'F', 0x0);
-	dstPayload->frame.bitstream          = dstBitstream;
-	dstPayload->frame.aus                = &dstPayload->au;
-	dstPayload->frame.numAus             = 1;
-	dstPayload->frame.presentationTimeUs = 0;
-	dstPayload->frame.flags              = _setPosition
-		? BGFX_VIDEO_DECODE_FRAME_SET
-		: BGFX_VIDEO_DECODE_FRAME_NONE
-		;
+		uint32_t end  = m_nextAuToSubmit;
+		uint32_t num  = 0;
+		uint32_t size = 0;
 
-	bgfx::updateTexture2D(
-		  m_videoTexture
-		, 0
-		, 0
-		, 0, 0
-		, m_width
-		, m_height
-		, mem
-		);
+		for (; end < numFrames
+			&& int64_t(m_impl->frames[end].ptsUs) <= _untilPtsUs
+			&& m_impl->isCached(end)
+			&& num < kMaxSubmitPerCall
+			; ++end)
+		{
+			const uint32_t auSize = uint32_t(m_impl->cache[end].size() );
+			num  += 0 != auSize ? 1 : 0;
+			size += auSize;
+		}
+
+		if (end == m_nextAuToSubmit)
+		{
+			if (m_impl->missIndex != m_nextAuToSubmit)
+			{
+				m_impl->missIndex = m_nextAuToSubmit;
+				++m_impl->cacheMisses;
+			}
 
-	lsmash_delete_sample(s);
+			if (!m_impl->isCached(m_nextAuToSubmit)
+			&&  m_nextAuToSubmit != m_impl->cacheEnd)
+			{
+				m_impl->requestIndex = m_nextAuToSubmit;
+			}
+		}
+		else
+		{
+			m_impl->cacheHits += end - m_nextAuToSubmit;
+
+			if (0 != num)
+			{
+				const uint32_t ausSize = num*uint32_t(sizeof(bgfx::VideoDecoderAu) );
+				mem = bgfx::alloc(uint32_t(sizeof(bgfx::VideoDecoderFrame) ) + ausSize + size);
+
+				bgfx::VideoDecoderFrame* frame = (bgfx::VideoDecoderFrame*)mem->data;
+				bgfx::VideoDecoderAu*    aus   = (bgfx::VideoDecoderAu*)(frame + 1);
+				uint8_t*                 data  = (uint8_t*)aus + ausSize;
+
+				frame->magic              = BX_MAKEFOURCC('V', 'D', 'F', 0x0);
+				frame->bitstream          = data;
+				frame->aus                = aus;
+				frame->numAus             = num;
+				frame->presentationTimeUs = 0;
+				frame->flags              = m_pendingSet
+					? BGFX_VIDEO_DECODE_FRAME_SET
+					: BGFX_VIDEO_DECODE_FRAME_NONE
+					;
+
+				for (uint32_t ii = m_nextAuToSubmit; ii < end; ++ii)
+				{
+					const stl::vector<uint8_t>& au = m_impl->cache[ii];
+
+					if (!au.empty() )
+					{
+						aus->size  = uint32_t(au.size() );
+						aus->ptsUs = int64_t(m_impl->frames[ii].ptsUs);
+						++aus;
+
+						bx::memCopy(data, au.data(), au.size() );
+						data += au.size();
+					}
+				}
+
+				m_pendingSet = false;
+			}
+
+			m_nextAuToSubmit     = end;
+			m_impl->consumeIndex = end;
+		}
+	}
+
+	m_impl->demuxSem.post();
+
+	if (NULL != mem)
+	{
+		bgfx::updateTexture2D(
+			  m_videoTexture
+			, 0
+			, 0
+			, 0, 0
+			, m_width
+			, m_height
+			, mem
+			);
+	}
 }
 
-void VideoPlayer::submitAccessUnitsUpTo(int64_t _untilPtsUs)
+void VideoPlayer::setDemuxBudget(uint32_t _bytes)
 {
-	if (NULL == m_impl)
+	m_demuxBudget = _bytes;
+
+	if (NULL != m_impl)
 	{
-		return;
+		{
+			bx::MutexScope lock(m_impl->demuxMutex);
+			m_impl->cacheBudget = _bytes;
+		}
+
+		m_impl->demuxSem.post();
 	}
+}
 
-	uint32_t submitted = 0;
+void VideoPlayer::getDemuxStats(DemuxStats& _stats) const
+{
+	bx::memSet(&_stats, 0, sizeof(_stats) );
+	_stats.budgetBytes = m_demuxBudget;
 
-	while (m_nextAuToSubmit < uint32_t(m_impl->frames.size() )
-		&& int64_t(m_impl->frames[m_nextAuToSubmit].ptsUs) <= _untilPtsUs
-		&& submitted < kMaxSubmitPerCall)
+	if (NULL != m_impl)
 	{
-		submitDecodeFrame(m_nextAuToSubmit, m_pendingSet);
-		m_pendingSet = false;
-		++m_nextAuToSubmit;
-		++submitted;
+		bx::MutexScope lock(m_impl->demuxMutex);
+
+		_stats.bytesPerSec = 0 != m_impl->demuxHpc
+			? double(m_impl->demuxBytes) * double(bx::getHPFrequency() ) / double(m_impl->demuxHpc)
+			: 0.0
+			;
+		_stats.cachedBytes = m_impl->cacheBytes;
+		_stats.cachedAus   = m_impl->cacheEnd - m_impl->cacheFirst;
+		_stats.demuxedAus  = m_impl->demuxAus;
+		_stats.hits        = m_impl->cacheHits;
+		_stats.misses      = m_impl->cacheMisses;
 	}
 }
 
@@ -54,12 +54,27 @@ public:
 
 	bgfx::VideoCodec::Enum codec() const;
 
+	struct DemuxStats
+	{
+		double   bytesPerSec; //!< Demux throughput, while demux thread is busy.
+		uint32_t budgetBytes; //!< Access unit cache budget.
+		uint32_t cachedBytes; //!< Bytes in access unit cache.
+		uint32_t cachedAus;   //!< Access units in cache.
+		uint32_t demuxedAus;  //!< Total demuxed access units.
+		uint32_t hits;        //!< Access units submitted from cache.
+		uint32_t misses;      //!< Access units not in cache when they were due.
+	};
+
+	/// Set access unit cache budget. Demux thread reads ahead of playback until budget is used.
+	void setDemuxBudget(uint32_t _bytes);
+
+	void getDemuxStats(DemuxStats& _stats) const;
+
 	struct Impl;
 
 private:
 	void submitAccessUnitsUpTo(int64_t _untilPtsUs);
 	void submitPresentationTick(int64_t _presentationTimeUs);
-	void submitDecodeFrame(uint32_t _index, bool _setPosition);
 
 	uint32_t findIdrAtOrBefore(uint64_t _ptsUs) const;
 	uint32_t findIdrAtOrAfter(uint64_t _ptsUs) const;
@@ -86,6 +101,8 @@ private:
 	int64_t  m_aMarkerUs;
 	int64_t  m_bMarkerUs;
 
+	uint32_t m_demuxBudget;
+
 	bgfx::TextureHandle m_videoTexture;
 };
 